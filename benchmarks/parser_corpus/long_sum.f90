@@ -0,0 +1,192 @@
+! Pathological input: one assignment with 2000 terms. A flat expression
+! this wide must stay linear in the parser; it caught quadratic
+! behaviour in generated code before the corpus existed.
+program long_sum
+implicit none
+integer :: s
+s = 0
+s = s + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9 + 6*10 + 0*0 &
+    + 1*1 + 2*2 + 3*3 + 4*4 + 5*5 + 6*6 + 0*7 + 1*8 + 2*9 + 3*10 + 4*0 &
+    + 5*1 + 6*2 + 0*3 + 1*4 + 2*5 + 3*6 + 4*7 + 5*8 + 6*9 + 0*10 + 1*0 &
+    + 2*1 + 3*2 + 4*3 + 5*4 + 6*5 + 0*6 + 1*7 + 2*8 + 3*9 + 4*10 + 5*0 &
+    + 6*1 + 0*2 + 1*3 + 2*4 + 3*5 + 4*6 + 5*7 + 6*8 + 0*9 + 1*10 + 2*0 &
+    + 3*1 + 4*2 + 5*3 + 6*4 + 0*5 + 1*6 + 2*7 + 3*8 + 4*9 + 5*10 + 6*0 &
+    + 0*1 + 1*2 + 2*3 + 3*4 + 4*5 + 5*6 + 6*7 + 0*8 + 1*9 + 2*10 + 3*0 &
+    + 4*1 + 5*2 + 6*3 + 0*4 + 1*5 + 2*6 + 3*7 + 4*8 + 5*9
+if (s /= 29970) error stop
+print *, s
+end program long_sum
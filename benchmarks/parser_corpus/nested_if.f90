@@ -0,0 +1,610 @@
+! Pathological input: 300 nested if blocks; statement-level recursion
+! as opposed to the expression-level recursion in nested_parens.f90.
+program nested_if
+implicit none
+integer :: n
+n = 0
+if (n < 1) then
+if (n < 2) then
+if (n < 3) then
+if (n < 4) then
+if (n < 5) then
+if (n < 6) then
+if (n < 7) then
+if (n < 8) then
+if (n < 9) then
+if (n < 10) then
+if (n < 11) then
+if (n < 12) then
+if (n < 13) then
+if (n < 14) then
+if (n < 15) then
+if (n < 16) then
+if (n < 17) then
+if (n < 18) then
+if (n < 19) then
+if (n < 20) then
+if (n < 21) then
+if (n < 22) then
+if (n < 23) then
+if (n < 24) then
+if (n < 25) then
+if (n < 26) then
+if (n < 27) then
+if (n < 28) then
+if (n < 29) then
+if (n < 30) then
+if (n < 31) then
+if (n < 32) then
+if (n < 33) then
+if (n < 34) then
+if (n < 35) then
+if (n < 36) then
+if (n < 37) then
+if (n < 38) then
+if (n < 39) then
+if (n < 40) then
+if (n < 41) then
+if (n < 42) then
+if (n < 43) then
+if (n < 44) then
+if (n < 45) then
+if (n < 46) then
+if (n < 47) then
+if (n < 48) then
+if (n < 49) then
+if (n < 50) then
+if (n < 51) then
+if (n < 52) then
+if (n < 53) then
+if (n < 54) then
+if (n < 55) then
+if (n < 56) then
+if (n < 57) then
+if (n < 58) then
+if (n < 59) then
+if (n < 60) then
+if (n < 61) then
+if (n < 62) then
+if (n < 63) then
+if (n < 64) then
+if (n < 65) then
+if (n < 66) then
+if (n < 67) then
+if (n < 68) then
+if (n < 69) then
+if (n < 70) then
+if (n < 71) then
+if (n < 72) then
+if (n < 73) then
+if (n < 74) then
+if (n < 75) then
+if (n < 76) then
+if (n < 77) then
+if (n < 78) then
+if (n < 79) then
+if (n < 80) then
+if (n < 81) then
+if (n < 82) then
+if (n < 83) then
+if (n < 84) then
+if (n < 85) then
+if (n < 86) then
+if (n < 87) then
+if (n < 88) then
+if (n < 89) then
+if (n < 90) then
+if (n < 91) then
+if (n < 92) then
+if (n < 93) then
+if (n < 94) then
+if (n < 95) then
+if (n < 96) then
+if (n < 97) then
+if (n < 98) then
+if (n < 99) then
+if (n < 100) then
+if (n < 101) then
+if (n < 102) then
+if (n < 103) then
+if (n < 104) then
+if (n < 105) then
+if (n < 106) then
+if (n < 107) then
+if (n < 108) then
+if (n < 109) then
+if (n < 110) then
+if (n < 111) then
+if (n < 112) then
+if (n < 113) then
+if (n < 114) then
+if (n < 115) then
+if (n < 116) then
+if (n < 117) then
+if (n < 118) then
+if (n < 119) then
+if (n < 120) then
+if (n < 121) then
+if (n < 122) then
+if (n < 123) then
+if (n < 124) then
+if (n < 125) then
+if (n < 126) then
+if (n < 127) then
+if (n < 128) then
+if (n < 129) then
+if (n < 130) then
+if (n < 131) then
+if (n < 132) then
+if (n < 133) then
+if (n < 134) then
+if (n < 135) then
+if (n < 136) then
+if (n < 137) then
+if (n < 138) then
+if (n < 139) then
+if (n < 140) then
+if (n < 141) then
+if (n < 142) then
+if (n < 143) then
+if (n < 144) then
+if (n < 145) then
+if (n < 146) then
+if (n < 147) then
+if (n < 148) then
+if (n < 149) then
+if (n < 150) then
+if (n < 151) then
+if (n < 152) then
+if (n < 153) then
+if (n < 154) then
+if (n < 155) then
+if (n < 156) then
+if (n < 157) then
+if (n < 158) then
+if (n < 159) then
+if (n < 160) then
+if (n < 161) then
+if (n < 162) then
+if (n < 163) then
+if (n < 164) then
+if (n < 165) then
+if (n < 166) then
+if (n < 167) then
+if (n < 168) then
+if (n < 169) then
+if (n < 170) then
+if (n < 171) then
+if (n < 172) then
+if (n < 173) then
+if (n < 174) then
+if (n < 175) then
+if (n < 176) then
+if (n < 177) then
+if (n < 178) then
+if (n < 179) then
+if (n < 180) then
+if (n < 181) then
+if (n < 182) then
+if (n < 183) then
+if (n < 184) then
+if (n < 185) then
+if (n < 186) then
+if (n < 187) then
+if (n < 188) then
+if (n < 189) then
+if (n < 190) then
+if (n < 191) then
+if (n < 192) then
+if (n < 193) then
+if (n < 194) then
+if (n < 195) then
+if (n < 196) then
+if (n < 197) then
+if (n < 198) then
+if (n < 199) then
+if (n < 200) then
+if (n < 201) then
+if (n < 202) then
+if (n < 203) then
+if (n < 204) then
+if (n < 205) then
+if (n < 206) then
+if (n < 207) then
+if (n < 208) then
+if (n < 209) then
+if (n < 210) then
+if (n < 211) then
+if (n < 212) then
+if (n < 213) then
+if (n < 214) then
+if (n < 215) then
+if (n < 216) then
+if (n < 217) then
+if (n < 218) then
+if (n < 219) then
+if (n < 220) then
+if (n < 221) then
+if (n < 222) then
+if (n < 223) then
+if (n < 224) then
+if (n < 225) then
+if (n < 226) then
+if (n < 227) then
+if (n < 228) then
+if (n < 229) then
+if (n < 230) then
+if (n < 231) then
+if (n < 232) then
+if (n < 233) then
+if (n < 234) then
+if (n < 235) then
+if (n < 236) then
+if (n < 237) then
+if (n < 238) then
+if (n < 239) then
+if (n < 240) then
+if (n < 241) then
+if (n < 242) then
+if (n < 243) then
+if (n < 244) then
+if (n < 245) then
+if (n < 246) then
+if (n < 247) then
+if (n < 248) then
+if (n < 249) then
+if (n < 250) then
+if (n < 251) then
+if (n < 252) then
+if (n < 253) then
+if (n < 254) then
+if (n < 255) then
+if (n < 256) then
+if (n < 257) then
+if (n < 258) then
+if (n < 259) then
+if (n < 260) then
+if (n < 261) then
+if (n < 262) then
+if (n < 263) then
+if (n < 264) then
+if (n < 265) then
+if (n < 266) then
+if (n < 267) then
+if (n < 268) then
+if (n < 269) then
+if (n < 270) then
+if (n < 271) then
+if (n < 272) then
+if (n < 273) then
+if (n < 274) then
+if (n < 275) then
+if (n < 276) then
+if (n < 277) then
+if (n < 278) then
+if (n < 279) then
+if (n < 280) then
+if (n < 281) then
+if (n < 282) then
+if (n < 283) then
+if (n < 284) then
+if (n < 285) then
+if (n < 286) then
+if (n < 287) then
+if (n < 288) then
+if (n < 289) then
+if (n < 290) then
+if (n < 291) then
+if (n < 292) then
+if (n < 293) then
+if (n < 294) then
+if (n < 295) then
+if (n < 296) then
+if (n < 297) then
+if (n < 298) then
+if (n < 299) then
+if (n < 300) then
+n = n + 1
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+end if
+if (n /= 1) error stop
+print *, n
+end program nested_if
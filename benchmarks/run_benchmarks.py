@@ -0,0 +1,198 @@
+#!/usr/bin/env python
+
+"""
+Compile-time benchmark suite.
+
+Generates representative large inputs (a long module, a deep `use` chain
+and big array expressions), compiles them with the `lfortran` driver and
+measures the tokenize/parse, source formatting (`fmt` round trip),
+semantics and full-compilation phases. The
+results are written as machine-readable JSON so CI can compare a run
+against a committed baseline and fail on compile-speed regressions:
+
+    ./run_benchmarks.py -o current.json
+    ./run_benchmarks.py --compare baseline.json --threshold 1.25
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess as sp
+import sys
+import tempfile
+import time
+
+BASE_DIR = os.path.dirname(os.path.realpath(__file__))
+LFORTRAN_PATH = f"{BASE_DIR}/../src/bin/lfortran"
+# Checked-in pathological inputs (deep nesting, very wide expressions);
+# parse-only, so parser complexity regressions are caught
+CORPUS_DIR = os.path.join(BASE_DIR, "parser_corpus")
+
+
+def generate_long_module(n_functions=2000):
+    lines = ["module bench_long_module", "implicit none", "contains"]
+    for i in range(n_functions):
+        lines.append(f"""\
+integer function f{i}(x) result(r)
+integer, intent(in) :: x
+r = x*{i % 97} + {i}
+end function f{i}""")
+    lines.append("end module bench_long_module")
+    return "\n".join(lines) + "\n"
+
+
+def generate_use_chain(n_modules=100):
+    # bench_chain_i uses bench_chain_{i-1}; returns a list of
+    # (filename, source), in compilation order
+    files = []
+    for i in range(n_modules):
+        lines = [f"module bench_chain_{i}", "implicit none"]
+        if i > 0:
+            lines.insert(1, f"use bench_chain_{i - 1}")
+        lines.append(f"integer, parameter :: p{i} = {i} + " +
+                     (f"p{i - 1}" if i > 0 else "0"))
+        lines.append(f"end module bench_chain_{i}")
+        files.append((f"bench_chain_{i}.f90", "\n".join(lines) + "\n"))
+    lines = ["program bench_chain_main",
+             f"use bench_chain_{n_modules - 1}", "implicit none",
+             f"print *, p{n_modules - 1}", "end program bench_chain_main"]
+    files.append(("bench_chain_main.f90", "\n".join(lines) + "\n"))
+    return files
+
+
+def generate_array_exprs(n_statements=400):
+    lines = ["program bench_array_expr", "implicit none",
+             "real :: a(1000), b(1000), c(1000), d(1000)",
+             "a = 1; b = 2; c = 3; d = 0"]
+    for i in range(n_statements):
+        lines.append(f"d = d + a*b + c*{i}.0 - a/(b + {i + 1}.0) "
+                     "+ abs(a - b)*sqrt(c)")
+    lines.append("print *, d(1)")
+    lines.append("end program bench_array_expr")
+    return "\n".join(lines) + "\n"
+
+
+def run_phase(args, cwd):
+    t0 = time.time()
+    p = sp.run(args, cwd=cwd, stdout=sp.DEVNULL, stderr=sp.PIPE)
+    t1 = time.time()
+    if p.returncode != 0:
+        print(f"Command failed: {' '.join(args)}")
+        print(p.stderr.decode(errors="replace"))
+        sys.exit(2)
+    return t1 - t0
+
+
+def measure(lfortran, filename, cwd, compile_end_to_end):
+    # Wall-clock per driver phase; each flag stops after the given stage,
+    # so the differences approximate the per-phase cost
+    result = {}
+    result["parse"] = run_phase([lfortran, "--show-ast", filename], cwd)
+    result["fmt"] = run_phase([lfortran, "fmt", filename], cwd)
+    result["semantics"] = run_phase([lfortran, "--show-asr", filename], cwd)
+    if compile_end_to_end:
+        result["compile"] = run_phase([lfortran, "-c", filename], cwd)
+    return result
+
+
+def run_suite(lfortran, compile_end_to_end):
+    results = {}
+    workdir = tempfile.mkdtemp(prefix="lfortran_bench_")
+    try:
+        with open(os.path.join(workdir, "bench_long_module.f90"), "w") as f:
+            f.write(generate_long_module())
+        results["long_module"] = measure(lfortran, "bench_long_module.f90",
+                                         workdir, compile_end_to_end)
+
+        with open(os.path.join(workdir, "bench_array_expr.f90"), "w") as f:
+            f.write(generate_array_exprs())
+        results["array_expr"] = measure(lfortran, "bench_array_expr.f90",
+                                        workdir, compile_end_to_end)
+
+        # The pathological corpus is checked in, not generated, so a
+        # fuzzing find can be added as a file and gated like any other
+        # phase. Parse-only: these inputs exist to catch parser
+        # complexity regressions, not backend ones
+        for filename in sorted(os.listdir(CORPUS_DIR)):
+            if not filename.endswith(".f90"):
+                continue
+            name = os.path.splitext(filename)[0]
+            results[f"corpus_{name}"] = {
+                "parse": run_phase([lfortran, "--show-ast", filename],
+                                   CORPUS_DIR),
+            }
+
+        if compile_end_to_end:
+            # The use chain needs modfiles of its dependencies, so it is
+            # only measured when object-code compilation is available
+            files = generate_use_chain()
+            for filename, source in files:
+                with open(os.path.join(workdir, filename), "w") as f:
+                    f.write(source)
+            t = 0.0
+            for filename, _ in files[:-1]:
+                t += run_phase([lfortran, "-c", filename], workdir)
+            results["use_chain"] = {
+                "compile_modules": t,
+                "semantics": run_phase(
+                    [lfortran, "--show-asr", files[-1][0]], workdir),
+            }
+    finally:
+        shutil.rmtree(workdir)
+    return results
+
+
+def compare(current, baseline, threshold):
+    regressions = []
+    for bench, phases in baseline.items():
+        for phase, base_t in phases.items():
+            cur_t = current.get(bench, {}).get(phase)
+            if cur_t is None:
+                continue
+            status = "OK"
+            if base_t > 0 and cur_t > base_t * threshold:
+                status = "REGRESSION"
+                regressions.append((bench, phase))
+            print(f"{bench}/{phase}: {cur_t:.3f}s "
+                  f"(baseline {base_t:.3f}s) {status}")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="LFortran compile-time benchmarks")
+    parser.add_argument("--lfortran", default=LFORTRAN_PATH,
+                        help="path to the lfortran executable")
+    parser.add_argument("-o", "--output", default=None,
+                        help="write results as JSON to this file")
+    parser.add_argument("--compare", default=None,
+                        help="baseline JSON to compare against")
+    parser.add_argument("--threshold", type=float, default=1.25,
+                        help="fail if a phase is slower than baseline*threshold")
+    parser.add_argument("--no-compile", action="store_true",
+                        help="skip end-to-end compilation (no LLVM backend needed)")
+    args = parser.parse_args()
+
+    if not shutil.which(args.lfortran):
+        print(f"lfortran executable not found: {args.lfortran}")
+        sys.exit(2)
+
+    results = run_suite(args.lfortran, not args.no_compile)
+
+    print(json.dumps(results, indent=4))
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(results, f, indent=4)
+
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, args.threshold)
+        if regressions:
+            print(f"{len(regressions)} phase(s) regressed beyond "
+                  f"{args.threshold}x baseline")
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
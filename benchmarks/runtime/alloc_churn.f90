@@ -0,0 +1,21 @@
+! Allocation churn: explicit allocate/deallocate plus realloc-on-assignment
+! with varying sizes every iteration; dominated by the allocator and the
+! allocatable-assignment machinery.
+program bench_alloc_churn
+implicit none
+integer, parameter :: reps = 20000
+real(8), allocatable :: a(:), b(:)
+integer :: i, n
+real(8) :: total
+total = 0
+do i = 1, reps
+    n = mod(i, 1000) + 10
+    allocate(a(n))
+    a = real(i, 8)
+    b = a + 1.0d0
+    total = total + b(n)
+    deallocate(a)
+end do
+if (total <= 0) error stop
+print *, total
+end program bench_alloc_churn
@@ -0,0 +1,15 @@
+! Formatted external writes; dominated by the format-processing runtime.
+! The scratch file is deleted on close.
+program bench_formatted_io
+implicit none
+integer, parameter :: reps = 50000
+integer :: i
+real(8) :: x
+open(10, file="bench_formatted_io.tmp", status="replace")
+do i = 1, reps
+    x = real(i, 8)/3.0d0
+    write(10, '(i8, 2x, f12.6, 2x, es14.6)') i, x, x*x
+end do
+close(10, status="delete")
+print *, reps
+end program bench_formatted_io
@@ -0,0 +1,30 @@
+! Triple-loop 256x256 matrix multiply, repeated; compute-bound kernel
+! exercising loop-nest code generation rather than the matmul intrinsic.
+program bench_matmul_loops
+implicit none
+integer, parameter :: n = 256, reps = 10
+real(8), allocatable :: a(:, :), b(:, :), c(:, :)
+integer :: i, j, k, r
+real(8) :: s
+allocate(a(n, n), b(n, n), c(n, n))
+do j = 1, n
+    do i = 1, n
+        a(i, j) = real(mod(i*j, 7), 8)
+        b(i, j) = real(mod(i + j, 5), 8)
+    end do
+end do
+s = 0
+do r = 1, reps
+    c = 0
+    do j = 1, n
+        do k = 1, n
+            do i = 1, n
+                c(i, j) = c(i, j) + a(i, k)*b(k, j)
+            end do
+        end do
+    end do
+    s = s + c(1, 1)
+end do
+if (s /= real(reps, 8)*c(1, 1)) error stop
+print *, c(n/2, n/2)
+end program bench_matmul_loops
@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+
+"""
+Runtime benchmark suite: LFortran (LLVM backend) versus gfortran.
+
+Builds every kernel in this directory with both compilers, runs each a
+few times, keeps the best wall time and reports the lfortran/gfortran
+ratio per kernel as machine-readable JSON, so CI can store a baseline
+per platform and fail when generated-code performance regresses:
+
+    ./run_benchmarks.py -o current.json
+    ./run_benchmarks.py --compare baseline.json --threshold 1.25
+
+The kernels are self-checking (`error stop` on a wrong result), so a
+miscompilation shows up as a failure rather than a fast wrong answer.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess as sp
+import sys
+import tempfile
+import time
+
+BASE_DIR = os.path.dirname(os.path.realpath(__file__))
+LFORTRAN_PATH = f"{BASE_DIR}/../../src/bin/lfortran"
+
+KERNELS = [
+    "stencil",
+    "matmul_loops",
+    "string_ops",
+    "formatted_io",
+    "alloc_churn",
+]
+
+
+def build(compiler_args, source, exe, cwd):
+    p = sp.run(compiler_args + ["-o", exe, source],
+               cwd=cwd, stdout=sp.DEVNULL, stderr=sp.PIPE)
+    if p.returncode != 0:
+        print(f"Build failed: {' '.join(compiler_args)} {source}")
+        print(p.stderr.decode(errors="replace"))
+        return False
+    return True
+
+
+def run_timed(exe, cwd, repeat):
+    # Best of `repeat` runs; the minimum is the least noisy estimator
+    # for a single-threaded CPU-bound kernel
+    best = None
+    for _ in range(repeat):
+        t0 = time.time()
+        p = sp.run([f"./{exe}"], cwd=cwd, stdout=sp.DEVNULL, stderr=sp.PIPE)
+        t1 = time.time()
+        if p.returncode != 0:
+            print(f"Run failed: {exe}")
+            print(p.stderr.decode(errors="replace"))
+            return None
+        if best is None or t1 - t0 < best:
+            best = t1 - t0
+    return best
+
+
+def run_suite(lfortran_args, gfortran_args, repeat):
+    results = {}
+    ok = True
+    workdir = tempfile.mkdtemp(prefix="lfortran_bench_runtime_")
+    try:
+        for kernel in KERNELS:
+            source = os.path.join(BASE_DIR, f"{kernel}.f90")
+            entry = {"lfortran": None, "gfortran": None, "ratio": None}
+            if build(lfortran_args, source, f"{kernel}_lf", workdir):
+                entry["lfortran"] = run_timed(f"{kernel}_lf", workdir, repeat)
+            if build(gfortran_args, source, f"{kernel}_gf", workdir):
+                entry["gfortran"] = run_timed(f"{kernel}_gf", workdir, repeat)
+            if entry["lfortran"] is None:
+                # A kernel lfortran cannot build or run correctly is
+                # itself a regression signal
+                ok = False
+            elif entry["gfortran"] is not None and entry["gfortran"] > 0:
+                entry["ratio"] = entry["lfortran"] / entry["gfortran"]
+            results[kernel] = entry
+    finally:
+        shutil.rmtree(workdir)
+    return results, ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-o", "--output",
+                        help="write results as JSON to this file")
+    parser.add_argument("--compare", metavar="BASELINE",
+                        help="compare ratios against a baseline JSON file")
+    parser.add_argument("--threshold", type=float, default=1.25,
+                        help="max allowed ratio_current/ratio_baseline "
+                             "before failing (default: 1.25)")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="runs per kernel, best time kept (default: 3)")
+    parser.add_argument("--lfortran", default=LFORTRAN_PATH,
+                        help="path to the lfortran executable")
+    parser.add_argument("--gfortran", default="gfortran",
+                        help="path to the gfortran executable")
+    parser.add_argument("--fast", action="store_true",
+                        help="benchmark `lfortran --fast` instead of the "
+                             "default optimization level")
+    args = parser.parse_args()
+
+    lfortran_args = [args.lfortran]
+    if args.fast:
+        lfortran_args.append("--fast")
+    gfortran_args = [args.gfortran, "-O2"]
+
+    results, ok = run_suite(lfortran_args, gfortran_args, args.repeat)
+
+    for kernel, entry in results.items():
+        lf = f"{entry['lfortran']:.3f}s" if entry["lfortran"] else "FAILED"
+        gf = f"{entry['gfortran']:.3f}s" if entry["gfortran"] else "FAILED"
+        ratio = f"{entry['ratio']:.2f}x" if entry["ratio"] else "n/a"
+        print(f"{kernel:<16} lfortran {lf:>9}  gfortran {gf:>9}  "
+              f"ratio {ratio}")
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(results, f, indent=4, sort_keys=True)
+            f.write("\n")
+
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+        for kernel, entry in results.items():
+            base = baseline.get(kernel, {}).get("ratio")
+            if base is None or entry["ratio"] is None:
+                continue
+            if entry["ratio"] > base * args.threshold:
+                print(f"REGRESSION: {kernel} ratio {entry['ratio']:.2f} vs "
+                      f"baseline {base:.2f} "
+                      f"(threshold {args.threshold:.2f}x)")
+                ok = False
+
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
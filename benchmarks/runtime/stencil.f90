@@ -0,0 +1,28 @@
+! 5-point Jacobi stencil on a 512x512 grid; memory-bound loop nest.
+program bench_stencil
+implicit none
+integer, parameter :: n = 512, iters = 200
+real(8), allocatable :: a(:, :), b(:, :)
+integer :: i, j, it
+allocate(a(n, n), b(n, n))
+a = 0
+a(1, :) = 1
+a(n, :) = 1
+a(:, 1) = 1
+a(:, n) = 1
+b = a
+do it = 1, iters
+    do j = 2, n - 1
+        do i = 2, n - 1
+            b(i, j) = 0.25d0*(a(i - 1, j) + a(i + 1, j) + a(i, j - 1) + a(i, j + 1))
+        end do
+    end do
+    do j = 2, n - 1
+        do i = 2, n - 1
+            a(i, j) = 0.25d0*(b(i - 1, j) + b(i + 1, j) + b(i, j - 1) + b(i, j + 1))
+        end do
+    end do
+end do
+if (a(n/2, n/2) < 0.0d0 .or. a(n/2, n/2) > 1.0d0) error stop
+print *, a(n/2, n/2)
+end program bench_stencil
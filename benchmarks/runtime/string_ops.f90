@@ -0,0 +1,15 @@
+! Deferred-length string churn: repeat/concatenation/len_trim/index in a
+! tight loop, dominated by the string runtime and allocator.
+program bench_string_ops
+implicit none
+integer, parameter :: reps = 200000
+character(len=:), allocatable :: s
+integer :: i, total
+total = 0
+do i = 1, reps
+    s = repeat('ab', mod(i, 16) + 1) // '_tail'
+    total = total + len_trim(s) + index(s, '_tail')
+end do
+if (total <= 0) error stop
+print *, total
+end program bench_string_ops
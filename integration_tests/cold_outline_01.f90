@@ -0,0 +1,37 @@
+module cold_outline_01_mod
+    implicit none
+contains
+    function checked_sqrt(x) result(r)
+        real(8), intent(in) :: x
+        real(8) :: r
+        if (x < 0.0_8) then
+            print *, "checked_sqrt: negative argument:", x
+            print *, "checked_sqrt: expected a non-negative value"
+            error stop
+        end if
+        r = sqrt(x)
+    end function checked_sqrt
+
+    function checked_index(i, n) result(j)
+        integer, intent(in) :: i, n
+        integer :: j
+        if (i < 1 .or. i > n) then
+            print *, "checked_index: index", i, "out of range 1 ..", n
+            error stop
+        end if
+        j = i
+    end function checked_index
+end module cold_outline_01_mod
+
+program cold_outline_01
+    use cold_outline_01_mod
+    implicit none
+    real(8) :: r
+    integer :: i
+
+    r = checked_sqrt(16.0_8)
+    if (abs(r - 4.0_8) > 1e-12_8) error stop
+
+    i = checked_index(3, 10)
+    if (i /= 3) error stop
+end program cold_outline_01
@@ -0,0 +1,18 @@
+subroutine set_parts()
+    ! same storage as the array in the main program, under different
+    ! names; accesses resolve through byte-offset storage association
+    integer :: first, second, third
+    common /blk33/ first, second, third
+    first = 11
+    second = 22
+    third = 33
+end subroutine set_parts
+
+program common_33
+    integer :: a(3)
+    common /blk33/ a
+    call set_parts()
+    if (a(1) /= 11) error stop
+    if (a(2) /= 22) error stop
+    if (a(3) /= 33) error stop
+end program common_33
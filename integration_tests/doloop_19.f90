@@ -0,0 +1,37 @@
+program doloop_19
+! Array kernels in do loops: constant bounds (affine form in the MLIR
+! backend), a downward loop, and exit/cycle
+implicit none
+integer, parameter :: n = 100
+integer :: a(n), b(n), c(n)
+integer :: i, total
+
+do i = 1, n
+    a(i) = i
+    b(i) = 2 * i
+end do
+
+do i = 1, n
+    c(i) = a(i) + 3 * b(i)
+end do
+
+do i = 1, n
+    if (c(i) /= 7 * i) error stop
+end do
+
+total = 0
+do i = n, 1, -1
+    total = total + a(i)
+end do
+if (total /= n * (n + 1) / 2) error stop
+
+total = 0
+do i = 1, n
+    if (a(i) > 10) exit
+    if (a(i) == 3) cycle
+    total = total + a(i)
+end do
+if (total /= 52) error stop
+
+print *, "PASSED"
+end program
@@ -0,0 +1,30 @@
+program gpu_metal_196
+! Reductions: integer sum, real min and real max via reduce clauses
+implicit none
+integer, parameter :: n = 100000
+real :: x(n)
+real :: lo, hi
+integer :: total
+integer :: i
+
+do i = 1, n
+    x(i) = real(i)
+end do
+
+total = 0
+do concurrent (i = 1:n) reduce(+:total)
+    total = total + 2
+end do
+if (total /= 2 * n) error stop
+
+lo = 1.0e30
+hi = -1.0e30
+do concurrent (i = 1:n) reduce(min:lo) reduce(max:hi)
+    lo = min(lo, x(i))
+    hi = max(hi, x(i))
+end do
+if (abs(lo - 1.0) > 1.0e-5) error stop
+if (abs(hi - real(n)) > 1.0e-2) error stop
+
+print *, "PASSED"
+end program
@@ -0,0 +1,27 @@
+program gpu_metal_197
+! 1-D 3-point stencil: neighbour reads at i-1, i, i+1 are eligible for
+! threadgroup-memory tiling in the Metal backend
+implicit none
+integer, parameter :: n = 100000
+real :: a(n), b(n)
+integer :: i
+real :: expected
+
+do i = 1, n
+    a(i) = real(i)
+end do
+b = 0.0
+
+do concurrent (i = 2:n-1)
+    b(i) = 0.25 * a(i-1) + 0.5 * a(i) + 0.25 * a(i+1)
+end do
+
+do i = 2, n - 1
+    expected = 0.25 * real(i-1) + 0.5 * real(i) + 0.25 * real(i+1)
+    if (abs(b(i) - expected) > 1.0e-3) error stop
+end do
+if (abs(b(1)) > 1.0e-6) error stop
+if (abs(b(n)) > 1.0e-6) error stop
+
+print *, "PASSED"
+end program
@@ -0,0 +1,50 @@
+program intrinsics_454
+    ! matmul with transpose() applied directly to an argument
+    implicit none
+    real :: a(2, 3), b(2, 2), c(3, 2), r32(3, 2)
+    real(8) :: ad(2, 3), bd(2, 2), rd(3, 3)
+    integer :: ia(2, 3), ib(2, 2), ir(3, 2)
+    integer :: i, j
+
+    a = reshape([1.0, 2.0, 3.0, 4.0, 5.0, 6.0], [2, 3])
+    b = reshape([1.0, 2.0, 3.0, 4.0], [2, 2])
+    c = reshape([1.0, 2.0, 3.0, 4.0, 5.0, 6.0], [3, 2])
+
+    ! transpose on the first argument
+    r32 = matmul(transpose(a), b)
+    do j = 1, 2
+        do i = 1, 3
+            if (abs(r32(i, j) - sum(a(:, i) * b(:, j))) > 1e-6) error stop
+        end do
+    end do
+
+    ! transpose on the second argument
+    r32 = matmul(c, transpose(b))
+    do j = 1, 2
+        do i = 1, 3
+            if (abs(r32(i, j) - sum(c(i, :) * b(j, :))) > 1e-6) error stop
+        end do
+    end do
+
+    ! transpose on both arguments
+    ad = reshape([1.0_8, 2.0_8, 3.0_8, 4.0_8, 5.0_8, 6.0_8], [2, 3])
+    bd = reshape([1.0_8, 2.0_8, 3.0_8, 4.0_8], [2, 2])
+    rd(1:3, 1:2) = matmul(transpose(ad), transpose(bd))
+    do j = 1, 2
+        do i = 1, 3
+            if (abs(rd(i, j) - sum(ad(:, i) * bd(j, :))) > 1e-12) error stop
+        end do
+    end do
+
+    ! integer matrices
+    ia = reshape([1, 2, 3, 4, 5, 6], [2, 3])
+    ib = reshape([7, 8, 9, 10], [2, 2])
+    ir = matmul(transpose(ia), ib)
+    do j = 1, 2
+        do i = 1, 3
+            if (ir(i, j) /= sum(ia(:, i) * ib(:, j))) error stop
+        end do
+    end do
+
+    print *, "ok"
+end program
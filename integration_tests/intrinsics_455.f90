@@ -0,0 +1,38 @@
+program intrinsics_455
+    ! cshift/eoshift through the contiguous-dimension runtime kernels
+    implicit none
+    integer :: a(7), i
+    real(8) :: r(6)
+    real :: m(3, 4), ms(3, 4)
+    integer :: j, k
+
+    a = [(10 * i, i = 1, 7)]
+    if (any(cshift(a, 3) /= [40, 50, 60, 70, 10, 20, 30])) error stop
+    if (any(cshift(a, -2) /= [60, 70, 10, 20, 30, 40, 50])) error stop
+    if (any(cshift(a, 0) /= a)) error stop
+    if (any(cshift(a, 7) /= a)) error stop
+    if (any(cshift(a, 10) /= cshift(a, 3))) error stop
+
+    r = [(1.5_8 * i, i = 1, 6)]
+    if (any(abs(cshift(r, 2) - [4.5_8, 6.0_8, 7.5_8, 9.0_8, 1.5_8, 3.0_8]) > 1e-12)) error stop
+
+    do k = 1, 4
+        do j = 1, 3
+            m(j, k) = real(10 * k + j)
+        end do
+    end do
+    ms = cshift(m, 1)
+    do k = 1, 4
+        do j = 1, 3
+            if (abs(ms(j, k) - m(mod(j, 3) + 1, k)) > 0.0) error stop
+        end do
+    end do
+
+    if (any(eoshift(a, 2) /= [30, 40, 50, 60, 70, 0, 0])) error stop
+    if (any(eoshift(a, -3) /= [0, 0, 0, 10, 20, 30, 40])) error stop
+    if (any(eoshift(a, 2, boundary=-1) /= [30, 40, 50, 60, 70, -1, -1])) error stop
+    if (any(eoshift(a, 0) /= a)) error stop
+    if (any(abs(eoshift(r, -1, boundary=0.25_8) - [0.25_8, 1.5_8, 3.0_8, 4.5_8, 6.0_8, 7.5_8]) > 1e-12)) error stop
+
+    print *, "ok"
+end program
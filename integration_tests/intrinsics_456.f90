@@ -0,0 +1,32 @@
+program intrinsics_456
+    ! lfortran_dump/lfortran_restore binary checkpoint extension
+    implicit none
+    real(8) :: a(2, 3), r(2, 3)
+    integer :: iv(5), irv(5)
+    integer :: i, j
+
+    do j = 1, 3
+        do i = 1, 2
+            a(i, j) = i * 10.0_8 + j
+        end do
+    end do
+    iv = [(7 * i, i = 1, 5)]
+    r = 0
+    irv = 0
+
+    open(unit=91, file="intrinsics_456.dat", form="unformatted", &
+        access="stream", status="replace")
+    call lfortran_dump(91, a)
+    call lfortran_dump(91, iv)
+    close(91)
+
+    open(unit=91, file="intrinsics_456.dat", form="unformatted", &
+        access="stream", status="old")
+    call lfortran_restore(91, r)
+    call lfortran_restore(91, irv)
+    close(91)
+
+    if (any(abs(a - r) > 0.0_8)) error stop
+    if (any(iv /= irv)) error stop
+    print *, "ok"
+end program
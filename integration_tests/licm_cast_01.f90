@@ -0,0 +1,29 @@
+program licm_cast_01
+    ! Mixed-kind operands inside loops: the conversion of the invariant
+    ! narrower operand must be hoisted without changing results
+    implicit none
+    real(8) :: a(100), b(100)
+    real(4) :: c
+    integer(8) :: s
+    integer(4) :: m
+    integer :: i
+
+    c = 1.5_4
+    do i = 1, 100
+        b(i) = real(i, 8)
+    end do
+
+    do i = 1, 100
+        a(i) = b(i) * c + c
+    end do
+    do i = 1, 100
+        if (abs(a(i) - (real(i, 8) * 1.5_8 + 1.5_8)) > 1e-12_8) error stop
+    end do
+
+    m = 7
+    s = 0_8
+    do i = 1, 100
+        s = s + int(i, 8) * m
+    end do
+    if (s /= 35350_8) error stop
+end program licm_cast_01
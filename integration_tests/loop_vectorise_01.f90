@@ -0,0 +1,18 @@
+program loop_vectorise_01
+    ! 1-based copy loop whose trip count is a multiple of the vector length
+    implicit none
+    integer :: i
+    real :: a(32), b(32)
+
+    do i = 1, 32
+        b(i) = real(i)
+    end do
+
+    do i = 1, 32
+        a(i) = b(i)
+    end do
+
+    do i = 1, 32
+        if (a(i) /= real(i)) error stop
+    end do
+end program
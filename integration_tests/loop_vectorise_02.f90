@@ -0,0 +1,27 @@
+program loop_vectorise_02
+    ! Trip count not divisible by the vector length and a lower bound
+    ! above 1: the blocked loop must start at the real lower bound and
+    ! the scalar tail loop must copy the leftover elements
+    implicit none
+    integer :: i
+    real :: a(40), b(40)
+
+    do i = 1, 40
+        a(i) = -1.0
+        b(i) = real(2 * i)
+    end do
+
+    do i = 5, 37
+        a(i) = b(i)
+    end do
+
+    do i = 1, 4
+        if (a(i) /= -1.0) error stop
+    end do
+    do i = 5, 37
+        if (a(i) /= real(2 * i)) error stop
+    end do
+    do i = 38, 40
+        if (a(i) /= -1.0) error stop
+    end do
+end program
@@ -0,0 +1,23 @@
+program loop_vectorise_03
+    ! Non-unit increment: the pass must leave this loop untouched and
+    ! only the odd elements may change
+    implicit none
+    integer :: i
+    real :: a(33), b(33)
+
+    do i = 1, 33
+        a(i) = 0.0
+        b(i) = real(i)
+    end do
+
+    do i = 1, 33, 2
+        a(i) = b(i)
+    end do
+
+    do i = 1, 33, 2
+        if (a(i) /= real(i)) error stop
+    end do
+    do i = 2, 32, 2
+        if (a(i) /= 0.0) error stop
+    end do
+end program
@@ -0,0 +1,25 @@
+program loop_vectorise_04
+    ! Sum reduction s = s + a(i): strip-mined under --fast; the result
+    ! must still be exact for integers and for exactly representable reals
+    implicit none
+    integer :: i, s
+    integer :: a(37)
+    real(8) :: r, x(37)
+
+    do i = 1, 37
+        a(i) = i
+        x(i) = 0.5d0
+    end do
+
+    s = 0
+    do i = 1, 37
+        s = s + a(i)
+    end do
+    if (s /= 37 * 38 / 2) error stop
+
+    r = 0.0d0
+    do i = 1, 37
+        r = r + x(i)
+    end do
+    if (r /= 18.5d0) error stop
+end program
@@ -0,0 +1,42 @@
+module modules_73_config
+implicit none
+private
+public :: tol, max_iter, scale, sum_scaled
+
+! Effectively constant: initialized, read everywhere, never written
+real, protected :: tol = 1.0e-6
+integer, protected :: max_iter = 100
+
+! Written below, so it must stay a variable
+real :: scale = 1.0
+
+contains
+
+    subroutine set_scale(s)
+        real, intent(in) :: s
+        scale = s
+    end subroutine
+
+    real function sum_scaled(n)
+        integer, intent(in) :: n
+        integer :: i
+        sum_scaled = 0
+        call set_scale(2.0)
+        do i = 1, min(n, max_iter)
+            if (tol > 1.0) error stop
+            sum_scaled = sum_scaled + scale * i
+        end do
+    end function
+
+end module
+
+program modules_73
+use modules_73_config
+implicit none
+
+if (abs(sum_scaled(10) - 110.0) > 1e-5) error stop
+if (abs(tol - 1.0e-6) > 1e-12) error stop
+if (max_iter /= 100) error stop
+
+print *, "PASSED"
+end program
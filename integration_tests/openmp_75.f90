@@ -0,0 +1,24 @@
+program openmp_75
+    implicit none
+    integer, parameter :: n = 1000
+    integer :: a(n), b(n)
+    integer :: i
+
+    do i = 1, n
+        b(i) = i
+    end do
+
+    ! race free: each iteration writes its own element of a, so the
+    ! --check-parallel instrumentation must stay silent and the result
+    ! must be unchanged
+    !$omp parallel do shared(a, b) private(i)
+    do i = 1, n
+        a(i) = 2 * b(i) + 1
+    end do
+    !$omp end parallel do
+
+    do i = 1, n
+        if (a(i) /= 2 * i + 1) error stop
+    end do
+    print *, "Done"
+end program openmp_75
@@ -0,0 +1,64 @@
+module pointer_25_mod
+    implicit none
+contains
+    subroutine copy_through_pointer()
+        integer, target :: src(10)
+        integer :: dst(10)
+        integer, pointer :: p(:)
+        integer :: i
+        do i = 1, 10
+            src(i) = 3 * i
+        end do
+        ! p is associated only with the whole of src, so dst = p is a
+        ! flat whole-array copy
+        p => src
+        dst = p
+        do i = 1, 10
+            if (dst(i) /= 3 * i) error stop
+        end do
+    end subroutine copy_through_pointer
+
+    subroutine copy_into_pointer()
+        integer, target :: dst(10)
+        integer :: src(10)
+        integer, pointer :: p(:)
+        integer :: i
+        do i = 1, 10
+            src(i) = 7 * i
+            dst(i) = 0
+        end do
+        p => dst
+        p = src
+        do i = 1, 10
+            if (dst(i) /= 7 * i) error stop
+        end do
+    end subroutine copy_into_pointer
+
+    subroutine reassociated_pointer()
+        ! p aliases both a and b over the lifetime of the procedure;
+        ! the copies must still be correct
+        integer, target :: a(10), b(10)
+        integer, pointer :: p(:)
+        integer :: i
+        do i = 1, 10
+            a(i) = i
+            b(i) = 0
+        end do
+        p => a
+        b = p
+        p => b
+        a = p
+        do i = 1, 10
+            if (a(i) /= i) error stop
+            if (b(i) /= i) error stop
+        end do
+    end subroutine reassociated_pointer
+end module pointer_25_mod
+
+program pointer_25
+    use pointer_25_mod
+    implicit none
+    call copy_through_pointer()
+    call copy_into_pointer()
+    call reassociated_pointer()
+end program pointer_25
@@ -0,0 +1,74 @@
+module procedure_pointer_25_mod
+implicit none
+
+abstract interface
+    real function unary(x)
+        real, intent(in) :: x
+    end function
+end interface
+
+contains
+
+    real function square(x)
+        real, intent(in) :: x
+        square = x * x
+    end function
+
+    real function cube(x)
+        real, intent(in) :: x
+        cube = x * x * x
+    end function
+
+    ! Single-target local pointer: the call can be devirtualized
+    real function apply_square(x)
+        real, intent(in) :: x
+        procedure(unary), pointer :: f
+        f => square
+        apply_square = f(x)
+    end function
+
+    ! The pointer is re-associated on a branch, so both targets stay
+    ! possible and the call must remain indirect
+    real function apply_either(x, use_cube)
+        real, intent(in) :: x
+        logical, intent(in) :: use_cube
+        procedure(unary), pointer :: f
+        f => square
+        if (use_cube) then
+            f => cube
+        end if
+        apply_either = f(x)
+    end function
+
+    real function integrate(f, a, b, n)
+        procedure(unary) :: f
+        real, intent(in) :: a, b
+        integer, intent(in) :: n
+        integer :: i
+        real :: h
+        h = (b - a) / n
+        integrate = 0
+        do i = 0, n - 1
+            integrate = integrate + f(a + (i + 0.5) * h) * h
+        end do
+    end function
+
+end module
+
+program procedure_pointer_25
+use procedure_pointer_25_mod
+implicit none
+procedure(unary), pointer :: g
+real :: s
+
+if (abs(apply_square(3.0) - 9.0) > 1e-6) error stop
+if (abs(apply_either(3.0, .false.) - 9.0) > 1e-6) error stop
+if (abs(apply_either(3.0, .true.) - 27.0) > 1e-6) error stop
+
+! Callback set once and invoked inside a hot loop
+g => square
+s = integrate(g, 0.0, 1.0, 1000)
+if (abs(s - 1.0 / 3.0) > 1e-4) error stop
+
+print *, "PASSED"
+end program
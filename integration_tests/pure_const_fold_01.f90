@@ -0,0 +1,45 @@
+module pure_const_fold_01_mod
+    implicit none
+contains
+    pure recursive function factorial(n) result(res)
+        integer, intent(in) :: n
+        integer :: res
+        if (n <= 1) then
+            res = 1
+        else
+            res = n * factorial(n - 1)
+        end if
+    end function factorial
+
+    pure function mi_to_km(mi) result(km)
+        real(8), intent(in) :: mi
+        real(8) :: km
+        km = mi * 1.609344_8
+    end function mi_to_km
+
+    pure function sum_to(n) result(res)
+        integer, intent(in) :: n
+        integer :: res
+        integer :: i
+        res = 0
+        do i = 1, n
+            res = res + i
+        end do
+    end function sum_to
+end module pure_const_fold_01_mod
+
+program pure_const_fold_01
+    use pure_const_fold_01_mod
+    implicit none
+    integer :: r
+    real(8) :: d
+
+    r = factorial(8)
+    if (r /= 40320) error stop
+
+    r = sum_to(100)
+    if (r /= 5050) error stop
+
+    d = mi_to_km(10.0_8)
+    if (abs(d - 16.09344_8) > 1e-12_8) error stop
+end program pure_const_fold_01
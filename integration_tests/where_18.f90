@@ -0,0 +1,56 @@
+program where_18
+    ! exercises both where lowerings: safe arithmetic bodies take the
+    ! branchless merge path, the division body must stay guarded
+    implicit none
+    real(8) :: a(10), b(10), c(10)
+    integer :: i
+
+    do i = 1, 10
+        a(i) = real(i - 5, 8)
+        b(i) = 2.0_8
+        c(i) = -1.0_8
+    end do
+
+    where (a > 0.0_8)
+        c = a * b + 1.0_8
+    else where
+        c = -a
+    end where
+    do i = 1, 10
+        if (i > 5) then
+            if (abs(c(i) - (real(i - 5, 8) * 2.0_8 + 1.0_8)) > 1e-12_8) error stop
+        else
+            if (abs(c(i) - real(5 - i, 8)) > 1e-12_8) error stop
+        end if
+    end do
+
+    ! division is only evaluated where the mask is true
+    where (a /= 0.0_8)
+        c = b / a
+    else where
+        c = 0.0_8
+    end where
+    do i = 1, 10
+        if (i == 5) then
+            if (c(i) /= 0.0_8) error stop
+        else
+            if (abs(c(i) - 2.0_8 / real(i - 5, 8)) > 1e-12_8) error stop
+        end if
+    end do
+
+    ! the mask reads an assigned variable: must behave as if evaluated
+    ! once on entry
+    where (a > 0.0_8)
+        a = -a
+        b = 3.0_8
+    end where
+    do i = 1, 10
+        if (i > 5) then
+            if (abs(a(i) + real(i - 5, 8)) > 1e-12_8) error stop
+            if (b(i) /= 3.0_8) error stop
+        else
+            if (abs(a(i) - real(i - 5, 8)) > 1e-12_8) error stop
+            if (b(i) /= 2.0_8) error stop
+        end if
+    end do
+end program where_18
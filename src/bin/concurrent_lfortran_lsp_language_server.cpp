@@ -113,4 +113,10 @@ namespace LCompilers::LanguageServerProtocol {
         }
     }
 
+    auto ConcurrentLFortranLspLanguageServer::updateSymbolIndex(
+        std::shared_ptr<LspTextDocument> document
+    ) -> void {
+        getSymbolIndex(*document);
+    }
+
 } // namespace LCompilers::LanguageServerProtocol
@@ -49,6 +49,10 @@ namespace LCompilers::LanguageServerProtocol {
         auto updateHighlights(
             std::shared_ptr<LspTextDocument> document
         ) -> void override;
+
+        auto updateSymbolIndex(
+            std::shared_ptr<LspTextDocument> document
+        ) -> void override;
     }; // class ConcurrentLFortranLspLanguageServer
 
 } // namespace LCompilers::LanguageServerProtocol
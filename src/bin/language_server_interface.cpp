@@ -301,6 +301,23 @@ namespace LCompilers::LLanguageServer::Interface {
             "Maximum number of errors and warnings to report."
         )->capture_default_str();
 
+        workspaceConfig->validationDebounceMs = 250;
+        server->add_option(
+            "--validation-debounce-ms",
+            workspaceConfig->validationDebounceMs,
+            ("Milliseconds to wait after a document change before validating "
+             "it; changes within the window coalesce into a single run.")
+        )->capture_default_str();
+
+        workspaceConfig->maxMemoryUtilizationMb = 0;
+        server->add_option(
+            "--max-memory-utilization-mb",
+            workspaceConfig->maxMemoryUtilizationMb,
+            ("Memory ceiling in megabytes; when the process exceeds it, the "
+             "caches of the least-recently-used documents are dropped. A "
+             "value of 0 disables the ceiling.")
+        )->capture_default_str();
+
         workspaceConfig->trace.server = lsp::TraceValues::Off;
         server->add_option(
             "--trace-server", workspaceConfig->trace.server,
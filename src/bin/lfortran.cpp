@@ -1,5 +1,9 @@
 #include "libasr/utils.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <thread>
+#include <iomanip>
 #include <iostream>
 #include <regex>
 #include <stdlib.h>
@@ -11,9 +15,12 @@
 #include <bin/CLI11.hpp>
 
 #include <libasr/stacktrace.h>
+#include <libasr/self_profiler.h>
+#include <libasr/profiler.h>
 #include <lfortran/parser/parser.h>
 #include <lfortran/parser/preprocessor.h>
 #include <lfortran/pickle.h>
+#include <libasr/asr_stats.h>
 #include <libasr/pickle.h>
 #include <lfortran/semantics/ast_to_asr.h>
 #include <lfortran/mod_to_asr.h>
@@ -175,6 +182,33 @@ void print_one_component(std::string component) {
 }
 
 
+// RAII guard that writes the structured profile collected during
+// compilation (--time-trace) when main_app() returns, whichever return
+// path is taken.
+struct TimeTraceWriter {
+    const CompilerOptions &compiler_options;
+    ~TimeTraceWriter() {
+        if (compiler_options.time_trace.empty()) return;
+        std::ofstream out(compiler_options.time_trace);
+        LCompilers::write_chrome_trace(out,
+            compiler_options.po.profile_events);
+    }
+};
+
+// RAII guard that stops the sampling self-profiler (--self-profile) and
+// writes the collapsed stacks when main_app() returns, whichever return
+// path is taken.
+struct SelfProfileWriter {
+    const CompilerOptions &compiler_options;
+    ~SelfProfileWriter() {
+        if (compiler_options.self_profile.empty()) return;
+        if (!LCompilers::stop_self_profiler(compiler_options.self_profile)) {
+            std::cerr << "Could not write the self-profile to: "
+                << compiler_options.self_profile << std::endl;
+        }
+    }
+};
+
 // Note: this function is case sensitive to the input string
 void print_time_report(const std::vector<std::string>& vector_of_time_report) {
     // Categorize entries
@@ -185,7 +219,8 @@ void print_time_report(const std::vector<std::string>& vector_of_time_report) {
 
     for (const auto& entry : vector_of_time_report) {
         if (entry.find("Allocator usage of last chunk (MB)") != std::string::npos ||
-            entry.find("Allocator chunks") != std::string::npos) {
+            entry.find("Allocator chunks") != std::string::npos ||
+            entry.find("Modfile bytes") != std::string::npos) {
             allocator_entries.push_back(entry);
         } else if (entry.find("[PASS]") != std::string::npos) {
             pass_entries.push_back(entry);
@@ -621,6 +656,391 @@ int emit_tokens(const std::string &infile, bool line_numbers, const CompilerOpti
     return 0;
 }
 
+// Collects module dependency edges from the AST: which modules a file uses
+// (including submodule parents) and which modfiles it provides. Use
+// statements can appear at any nesting level (functions, blocks), so the
+// whole tree is walked.
+class ModuleDependencyVisitor : public LCompilers::LFortran::AST::BaseWalkVisitor<ModuleDependencyVisitor>
+{
+public:
+    std::set<std::string> used;
+    std::set<std::string> provided_names;
+    std::set<std::string> provided_modfiles;
+
+    void visit_Use(const LCompilers::LFortran::AST::Use_t &x) {
+        used.insert(LCompilers::to_lower(x.m_module));
+    }
+    void visit_Module(const LCompilers::LFortran::AST::Module_t &x) {
+        std::string name = LCompilers::to_lower(x.m_name);
+        provided_names.insert(name);
+        provided_modfiles.insert(name + ".mod");
+        LCompilers::LFortran::AST::BaseWalkVisitor<ModuleDependencyVisitor>::visit_Module(x);
+    }
+    void visit_Submodule(const LCompilers::LFortran::AST::Submodule_t &x) {
+        std::string parent = LCompilers::to_lower(x.m_id);
+        std::string name = LCompilers::to_lower(x.m_name);
+        used.insert(parent);
+        provided_names.insert(name);
+        provided_modfiles.insert(parent + "@" + name + ".smod");
+        provided_modfiles.insert(name + ".mod");
+        LCompilers::LFortran::AST::BaseWalkVisitor<ModuleDependencyVisitor>::visit_Submodule(x);
+    }
+};
+
+// Modules supplied by the compiler itself; build systems must not see them
+// as prerequisites.
+static bool is_compiler_provided_module(const std::string &name)
+{
+    return name == "iso_c_binding" || name == "iso_fortran_env"
+        || name == "ieee_arithmetic" || name == "ieee_exceptions"
+        || name == "ieee_features"
+        || name == "omp_lib" || name == "omp_lib_kinds"
+        || LCompilers::startswith(name, "lfortran_intrinsic");
+}
+
+// Emits Make/Ninja-compatible dependency rules for the file after parsing
+// only (no semantics, no module loading), in the style of `gfortran -M`:
+// the object file and the provided modfiles depend on the source, its
+// include files and the modfiles of every used module.
+int emit_deps(const std::string &infile, CompilerOptions &compiler_options)
+{
+    std::string input = read_file_ok(infile);
+
+    LCompilers::FortranEvaluator fe(compiler_options);
+    LCompilers::LocationManager lm;
+    LCompilers::diag::Diagnostics diagnostics;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = infile;
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(input.size());
+    }
+    LCompilers::Result<LCompilers::LFortran::AST::TranslationUnit_t*> r
+            = fe.get_ast2(input, lm, diagnostics);
+    std::cerr << diagnostics.render(lm, compiler_options);
+    if (!r.ok) {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return 2;
+    }
+    ModuleDependencyVisitor v;
+    v.visit_TranslationUnit(*r.result);
+
+    std::string targets = std::filesystem::path(infile).filename()
+        .replace_extension(".o").string();
+    for (auto &modfile : v.provided_modfiles) {
+        targets += " " + modfile;
+    }
+    std::string prerequisites = infile;
+    // Files pulled in by include lines are recorded by the prescanner in
+    // the location manager behind the primary file:
+    for (size_t i = 1; i < lm.files.size(); i++) {
+        if (!lm.files[i].in_filename.empty()) {
+            prerequisites += " " + lm.files[i].in_filename;
+        }
+    }
+    for (auto &mod : v.used) {
+        if (v.provided_names.count(mod) || is_compiler_provided_module(mod)) {
+            continue;
+        }
+        prerequisites += " " + mod + ".mod";
+    }
+    std::cout << targets << ": " << prerequisites << std::endl;
+    return 0;
+}
+
+// Counts static references to each derived-type member across the whole
+// unit so the layout report can point at hot fields without profiling.
+class StructMemberAccessCounter
+    : public LCompilers::ASR::BaseWalkVisitor<StructMemberAccessCounter>
+{
+public:
+    std::map<std::string, std::map<std::string, int>> counts;
+
+    void visit_StructInstanceMember(
+            const LCompilers::ASR::StructInstanceMember_t &x) {
+        LCompilers::ASR::symbol_t *m
+            = LCompilers::ASRUtils::symbol_get_past_external(x.m_m);
+        LCompilers::SymbolTable *parent_symtab
+            = LCompilers::ASRUtils::symbol_parent_symtab(m);
+        if (parent_symtab->asr_owner && LCompilers::ASR::is_a<
+                LCompilers::ASR::symbol_t>(*parent_symtab->asr_owner)) {
+            LCompilers::ASR::symbol_t *owner
+                = LCompilers::ASR::down_cast<LCompilers::ASR::symbol_t>(
+                    parent_symtab->asr_owner);
+            if (LCompilers::ASR::is_a<LCompilers::ASR::Struct_t>(*owner)) {
+                counts[LCompilers::ASRUtils::symbol_name(owner)]
+                    [LCompilers::ASRUtils::symbol_name(m)]++;
+            }
+        }
+        LCompilers::ASR::BaseWalkVisitor<StructMemberAccessCounter>
+            ::visit_StructInstanceMember(x);
+    }
+};
+
+// Collects every Struct symbol defined in this compilation, skipping
+// modules pulled in from modfiles and intrinsic modules.
+static void collect_struct_symbols(LCompilers::SymbolTable &symtab,
+        std::vector<LCompilers::ASR::Struct_t*> &structs)
+{
+    for (auto &item : symtab.get_scope()) {
+        LCompilers::ASR::symbol_t *sym = item.second;
+        if (LCompilers::ASR::is_a<LCompilers::ASR::Module_t>(*sym)) {
+            LCompilers::ASR::Module_t *m
+                = LCompilers::ASR::down_cast<LCompilers::ASR::Module_t>(sym);
+            if (m->m_loaded_from_mod || m->m_intrinsic) {
+                continue;
+            }
+        }
+        if (LCompilers::ASR::is_a<LCompilers::ASR::Struct_t>(*sym)) {
+            structs.push_back(
+                LCompilers::ASR::down_cast<LCompilers::ASR::Struct_t>(sym));
+        }
+        if (LCompilers::SymbolTable *nested
+                = LCompilers::ASRUtils::symbol_symtab(sym)) {
+            collect_struct_symbols(*nested, structs);
+        }
+    }
+}
+
+// Size and alignment of one derived-type member as codegen lays it out:
+// pointer and allocatable scalars become plain pointers, everything else
+// follows compute_type_size_align. Returns {-1, -1} when the size is not
+// known at compile time.
+static std::pair<int64_t, int64_t> struct_member_size_align(
+    LCompilers::ASR::ttype_t *t)
+{
+    if ((LCompilers::ASR::is_a<LCompilers::ASR::Pointer_t>(*t)
+            || LCompilers::ASR::is_a<LCompilers::ASR::Allocatable_t>(*t))
+            && !LCompilers::ASR::is_a<LCompilers::ASR::Array_t>(*t)) {
+        return {8, 8};
+    }
+    return LCompilers::ASRUtils::compute_type_size_align(t);
+}
+
+// Prints the memory layout codegen will use for every derived type defined
+// in the file: per-member offsets and sizes, padding holes, how often each
+// member is referenced statically, and the smallest size a reordered member
+// sequence would reach. The report is analysis only; the layout itself is
+// never changed (member order is load-bearing for bind(c), SEQUENCE and
+// constructor semantics).
+int emit_struct_layout_report(const std::string &infile,
+    CompilerOptions &compiler_options)
+{
+    std::string input = read_file_ok(infile);
+
+    LCompilers::FortranEvaluator fe(compiler_options);
+    LCompilers::LocationManager lm;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = infile;
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(input.size());
+    }
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
+        r = fe.get_asr2(input, lm, diagnostics);
+    std::cerr << diagnostics.render(lm, compiler_options);
+    if (!r.ok) {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return 2;
+    }
+
+    StructMemberAccessCounter counter;
+    counter.visit_TranslationUnit(*r.result);
+
+    std::vector<LCompilers::ASR::Struct_t*> structs;
+    collect_struct_symbols(*r.result->m_symtab, structs);
+    if (structs.empty()) {
+        std::cout << "no derived types defined in " << infile << std::endl;
+        return 0;
+    }
+
+    for (LCompilers::ASR::Struct_t *st : structs) {
+        std::cout << "derived type " << st->m_name;
+        if (st->m_abi == LCompilers::ASR::abiType::BindC) {
+            std::cout << " [bind(c)]";
+        }
+        if (st->m_is_packed) {
+            std::cout << " [packed]";
+        }
+        if (st->m_parent) {
+            std::cout << " [extends("
+                << LCompilers::ASRUtils::symbol_name(st->m_parent) << ")]";
+        }
+        std::cout << std::endl;
+
+        struct MemberRow {
+            std::string name;
+            int64_t size, align;
+            int refs;
+        };
+        std::vector<MemberRow> rows;
+        bool computable = true;
+        auto &refs = counter.counts[st->m_name];
+        if (st->m_parent) {
+            // codegen embeds the parent as the first field
+            LCompilers::ASR::Struct_t *par
+                = LCompilers::ASR::down_cast<LCompilers::ASR::Struct_t>(
+                    LCompilers::ASRUtils::symbol_get_past_external(
+                        st->m_parent));
+            auto [psize, palign] = LCompilers::ASRUtils::
+                compute_type_size_align(par->m_struct_signature);
+            if (psize < 0) {
+                computable = false;
+            }
+            rows.push_back({"(" + std::string(par->m_name) + ")",
+                psize, palign, 0});
+        }
+        for (size_t i = 0; i < st->n_members; i++) {
+            std::string member_name = st->m_members[i];
+            LCompilers::ASR::symbol_t *member
+                = st->m_symtab->get_symbol(member_name);
+            if (!member
+                    || !LCompilers::ASR::is_a<LCompilers::ASR::Variable_t>(
+                        *member)) {
+                continue;
+            }
+            LCompilers::ASR::Variable_t *var
+                = LCompilers::ASR::down_cast<LCompilers::ASR::Variable_t>(
+                    member);
+            auto [msize, malign] = struct_member_size_align(var->m_type);
+            if (msize < 0) {
+                computable = false;
+            }
+            int ref_count = 0;
+            auto ref = refs.find(member_name);
+            if (ref != refs.end()) {
+                ref_count = ref->second;
+            }
+            rows.push_back({member_name, msize, malign, ref_count});
+        }
+
+        if (!computable) {
+            std::cout << "    offset not computed (size depends on"
+                " run-time information)" << std::endl;
+            for (auto &row : rows) {
+                std::cout << "    " << std::setw(6) << "?"
+                    << " " << std::setw(5);
+                if (row.size >= 0) {
+                    std::cout << row.size;
+                } else {
+                    std::cout << "?";
+                }
+                std::cout << " " << std::setw(5) << row.refs
+                    << "  " << row.name << std::endl;
+            }
+            continue;
+        }
+
+        // lay rows out in declaration order, recording padding holes
+        auto layout_size = [&](const std::vector<MemberRow> &order,
+                std::vector<int64_t> *offsets) -> int64_t {
+            int64_t offset = 0;
+            int64_t max_align = 1;
+            for (auto &row : order) {
+                int64_t align = st->m_is_packed ? 1 : row.align;
+                offset = ((offset + align - 1) / align) * align;
+                if (offsets) {
+                    offsets->push_back(offset);
+                }
+                offset += row.size;
+                if (align > max_align) {
+                    max_align = align;
+                }
+            }
+            return ((offset + max_align - 1) / max_align) * max_align;
+        };
+
+        std::vector<int64_t> offsets;
+        int64_t total = layout_size(rows, &offsets);
+        int64_t payload = 0;
+        for (auto &row : rows) {
+            payload += row.size;
+        }
+        int64_t padding = total - payload;
+
+        std::cout << "    offset  size  refs  member" << std::endl;
+        for (size_t i = 0; i < rows.size(); i++) {
+            std::cout << "    " << std::setw(6) << offsets[i]
+                << " " << std::setw(5) << rows[i].size
+                << " " << std::setw(5) << rows[i].refs
+                << "  " << rows[i].name << std::endl;
+            int64_t end = offsets[i] + rows[i].size;
+            int64_t next = (i + 1 < rows.size()) ? offsets[i + 1] : total;
+            if (next > end) {
+                std::cout << "    " << std::setw(6) << end
+                    << " " << std::setw(5) << (next - end)
+                    << "       (padding)" << std::endl;
+            }
+        }
+        std::cout << "    size " << total << " bytes, padding " << padding
+            << " bytes";
+        if (total > 0) {
+            std::cout << " (" << std::fixed << std::setprecision(1)
+                << (100.0 * (double)padding / (double)total) << "%)";
+        }
+        std::cout << std::endl;
+
+        // best achievable order: descending alignment breaks all holes
+        // except the tail; keep an embedded parent pinned at offset 0
+        if (padding > 0) {
+            if (st->m_abi == LCompilers::ASR::abiType::BindC) {
+                std::cout << "    layout fixed by bind(c); members cannot"
+                    " be reordered" << std::endl;
+            } else {
+                std::vector<MemberRow> reordered = rows;
+                size_t first = st->m_parent ? 1 : 0;
+                std::stable_sort(reordered.begin() + first, reordered.end(),
+                    [](const MemberRow &a, const MemberRow &b) {
+                        if (a.align != b.align) {
+                            return a.align > b.align;
+                        }
+                        return a.size > b.size;
+                    });
+                int64_t best = layout_size(reordered, nullptr);
+                if (best < total) {
+                    std::cout << "    declaring members as";
+                    for (size_t i = first; i < reordered.size(); i++) {
+                        std::cout << (i == first ? " " : ", ")
+                            << reordered[i].name;
+                    }
+                    std::cout << " would shrink it to " << best
+                        << " bytes (saves " << (total - best)
+                        << " bytes per element in arrays)" << std::endl;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Prints size and complexity statistics of the ASR the frontend produced
+// (see asr_stats() in libasr) without dumping the full pickle.
+int emit_asr_stats(const std::string &infile,
+    CompilerOptions &compiler_options)
+{
+    std::string input = read_file_ok(infile);
+
+    LCompilers::FortranEvaluator fe(compiler_options);
+    LCompilers::LocationManager lm;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = infile;
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(input.size());
+    }
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::Result<LCompilers::ASR::TranslationUnit_t*>
+        r = fe.get_asr2(input, lm, diagnostics);
+    std::cerr << diagnostics.render(lm, compiler_options);
+    if (!r.ok) {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return 2;
+    }
+    std::cout << LCompilers::asr_stats(*r.result);
+    return 0;
+}
+
 int emit_ast(const std::string &infile, CompilerOptions &compiler_options)
 {
     std::string input = read_file_ok(infile);
@@ -841,8 +1261,10 @@ int python_wrapper(const std::string &infile, std::string array_order,
         std::string astr_data_json = LCompilers::pickle_json(*asr, lm, compiler_options.po.no_loc, compiler_options.po.with_intrinsic_mods);
         return visualize_json(astr_data_json, compiler_options.platform);
     } else {
-        std::cout << LCompilers::pickle(*asr, compiler_options.use_colors, compiler_options.indent,
-                compiler_options.po.with_intrinsic_mods, compiler_options.po.clojure) << std::endl;
+        // Stream the dump so --show-asr does not hold the whole text in memory:
+        LCompilers::pickle(std::cout, *asr, compiler_options.use_colors, compiler_options.indent,
+                compiler_options.po.with_intrinsic_mods, compiler_options.po.clojure);
+        std::cout << std::endl;
     }
     return has_error_w_cc;
 }
@@ -954,6 +1376,41 @@ int emit_fortran(const std::string &infile, CompilerOptions &compiler_options) {
     }
 }
 
+int emit_fortran_units(const std::string &infile, const std::string &outdir,
+        CompilerOptions &compiler_options) {
+    std::string input = read_file_ok(infile);
+
+    LCompilers::FortranEvaluator fe(compiler_options);
+    LCompilers::LocationManager lm;
+    LCompilers::diag::Diagnostics diagnostics;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = infile;
+        lm.files.push_back(fl);
+        lm.file_ends.push_back(input.size());
+    }
+    LCompilers::Result<std::vector<LCompilers::FortranProgramUnit>> units
+        = fe.get_fortran_units(input, lm, diagnostics);
+    std::cerr << diagnostics.render(lm, compiler_options);
+    if (units.ok) {
+        std::filesystem::create_directories(outdir);
+        for (LCompilers::FortranProgramUnit &unit : units.result) {
+            std::filesystem::path outfile
+                = std::filesystem::path(outdir) / (unit.name + ".f90");
+            std::ofstream out(outfile);
+            out << unit.source;
+            if (!out) {
+                std::cerr << "Cannot write to file: " << outfile.string() << std::endl;
+                return 1;
+            }
+        }
+        return compiler_options.continue_compilation && diagnostics.has_error();
+    } else {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return 1;
+    }
+}
+
 int dump_all_passes(const std::string &infile, CompilerOptions &compiler_options,
                         LCompilers::PassManager &pass_manager) {
     std::string input = read_file_ok(infile);
@@ -1101,7 +1558,8 @@ int handle_mlir(const std::string &infile,
     }
 
     // ASR -> MLIR -> LLVM
-    LCompilers::LLVMEvaluator e(compiler_options.target);
+    LCompilers::LLVMEvaluator e(compiler_options.target,
+        compiler_options.po.fast);
     std::unique_ptr<LCompilers::MLIRModule> m;
     diagnostics.diagnostics.clear();
     LCompilers::Result<std::unique_ptr<LCompilers::MLIRModule>>
@@ -1179,6 +1637,247 @@ int emit_asm(const std::string &infile, CompilerOptions &compiler_options)
     }
 }
 
+// Whether the object/source caches apply to this compilation. Separate
+// compilation bakes a per-invocation unique ID into symbol names, and the
+// GPU backends produce sidecar outputs next to the object file; neither
+// object is reusable as-is.
+static bool object_cache_applies(const CompilerOptions &compiler_options,
+        bool assembly)
+{
+    if (compiler_options.object_cache_dir.empty() || assembly) {
+        return false;
+    }
+    if (compiler_options.separate_compilation
+            || !compiler_options.gpu_backend.empty()
+            || compiler_options.po.enable_gpu_offloading) {
+        return false;
+    }
+    return true;
+}
+
+// Returns the cache file path for the given ASR and options, or "" when the
+// object cache does not apply to this compilation. The key is a content hash
+// of the ASR together with every option that changes the generated object.
+static std::string object_cache_file_for(LCompilers::ASR::TranslationUnit_t &asr,
+        const CompilerOptions &compiler_options, bool assembly)
+{
+    if (!object_cache_applies(compiler_options, assembly)) {
+        return "";
+    }
+    std::string key = LCompilers::pickle(asr)
+        + "\n" + LFORTRAN_VERSION
+        + "\ntarget=" + compiler_options.target
+        + "\nfast=" + std::to_string(compiler_options.po.fast)
+        + "\ndebug=" + std::to_string(compiler_options.emit_debug_info)
+        + "\nglobal=" + std::to_string(
+            compiler_options.generate_code_for_global_procedures)
+        + "\npgo-gen=" + std::to_string(compiler_options.profile_generate)
+        + "\npgo-use=" + compiler_options.profile_use
+        + "\nlto=" + std::to_string(compiler_options.lto);
+    return (std::filesystem::path(compiler_options.object_cache_dir)
+        / (LCompilers::fnv1a_hash64_hex(key) + "-"
+            + std::to_string(key.size()) + ".o")).string();
+}
+
+// Source-level cache, sitting in front of the ASR-keyed object cache above.
+// It is keyed by the raw source, the command line and the compiler version;
+// alongside the object it stores the modfiles the compilation produced and
+// the interface hash (or, under --fast, the content hash) of every modfile
+// it read. A hit therefore requires every dependency interface to match the
+// previous compilation: interface changes still cascade into rebuilds,
+// while body-only edits in a used module and untouched files skip parsing
+// and semantics entirely and just replay the stored object and modfiles.
+
+// Returns the cache path prefix for this compilation, or "" when the source
+// cache does not apply.
+static std::string source_cache_stem(const std::string &input,
+        const std::string &infile, bool assembly,
+        const CompilerOptions &compiler_options)
+{
+    if (!object_cache_applies(compiler_options, assembly)) {
+        return "";
+    }
+    // The full command line is over-conservative (an unrelated flag change
+    // misses), but it is the only key that provably covers every option
+    // that can influence parsing, semantics or codegen.
+    std::string key = input
+        + "\nfile=" + infile
+        + "\nargv=" + lcompilers_commandline_options
+        + "\nversion=" + LFORTRAN_VERSION;
+    return (std::filesystem::path(compiler_options.object_cache_dir)
+        / ("src-" + LCompilers::fnv1a_hash64_hex(key) + "-"
+            + std::to_string(key.size()))).string();
+}
+
+// Locates the modfile a dependency module was loaded from, mirroring the
+// search order of find_and_load_module (runtime library, modfile directory,
+// include directories).
+static std::string find_dependency_modfile(const std::string &module_name,
+        const CompilerOptions &compiler_options)
+{
+    std::vector<std::filesystem::path> dirs;
+    dirs.push_back(std::filesystem::path(
+        compiler_options.po.runtime_library_dir));
+    dirs.push_back(compiler_options.po.mod_files_dir);
+    dirs.insert(dirs.end(), compiler_options.po.include_dirs.begin(),
+        compiler_options.po.include_dirs.end());
+    std::error_code ec;
+    for (auto &dir : dirs) {
+        std::filesystem::path full_path = dir / (module_name + ".mod");
+        if (std::filesystem::exists(full_path, ec)
+                && std::filesystem::file_size(full_path, ec) > 0) {
+            return full_path.string();
+        }
+    }
+    // Submodules are stored as <parent>@<name>.smod with an empty
+    // <name>.mod placeholder next to them:
+    std::string smod_suffix = "@" + module_name + ".smod";
+    for (auto &dir : dirs) {
+        std::filesystem::path search_dir
+            = dir.empty() ? std::filesystem::path(".") : dir;
+        if (!std::filesystem::is_directory(search_dir, ec)) continue;
+        for (auto &entry
+                : std::filesystem::directory_iterator(search_dir, ec)) {
+            std::string fname = entry.path().filename().string();
+            if (fname.size() > smod_suffix.size()
+                    && fname.compare(fname.size() - smod_suffix.size(),
+                        smod_suffix.size(), smod_suffix) == 0) {
+                return entry.path().string();
+            }
+        }
+    }
+    return "";
+}
+
+// Replays a cached compilation: verifies every recorded dependency hash,
+// then restores the stored modfiles and object file. Returns false on any
+// mismatch or I/O problem, in which case the caller falls through to a full
+// compilation (which refreshes the entry).
+static bool source_cache_lookup(const std::string &stem,
+        const std::string &outfile, const CompilerOptions &compiler_options)
+{
+    std::string manifest;
+    if (!LCompilers::read_file(stem + ".manifest", manifest)) {
+        return false;
+    }
+    std::istringstream in(manifest);
+    std::string line;
+    std::vector<std::string> mods;
+    while (std::getline(in, line)) {
+        if (line.rfind("dep ", 0) == 0) {
+            std::size_t sp = line.find(' ', 4);
+            if (sp == std::string::npos) return false;
+            std::string hash = line.substr(4, sp - 4);
+            std::string content;
+            if (!LCompilers::read_file(line.substr(sp + 1), content)) {
+                return false;
+            }
+            if (LCompilers::fnv1a_hash64_hex(content) != hash) {
+                return false;
+            }
+        } else if (line.rfind("idep ", 0) == 0) {
+            // Interface-hash dependency: the entry stays valid across
+            // body-only edits of the dependency module.
+            std::size_t sp = line.find(' ', 5);
+            if (sp == std::string::npos) return false;
+            std::string hash = line.substr(5, sp - 5);
+            std::string content;
+            if (!LCompilers::read_file(line.substr(sp + 1), content)) {
+                return false;
+            }
+            if (LCompilers::modfile_read_interface_hash(content) != hash) {
+                return false;
+            }
+        } else if (line.rfind("mod ", 0) == 0) {
+            mods.push_back(line.substr(4));
+        } else if (!line.empty()) {
+            return false;
+        }
+    }
+    // Restore the modfiles first: downstream compilations need them even
+    // when this unit contributes no object code of its own.
+    std::error_code ec;
+    for (auto &name : mods) {
+        if (!std::filesystem::copy_file(stem + "." + name,
+                compiler_options.po.mod_files_dir / name,
+                std::filesystem::copy_options::overwrite_existing, ec)) {
+            return false;
+        }
+    }
+    return std::filesystem::copy_file(stem + ".o", outfile,
+        std::filesystem::copy_options::overwrite_existing, ec);
+}
+
+// Stores the object file, the modfiles this compilation produced and the
+// content hashes of the modfiles it read. A failure to populate the cache is
+// not a compilation failure; the entry is simply left incomplete (without
+// its manifest) and never considered.
+static void source_cache_store(const std::string &stem,
+        const std::string &outfile, LCompilers::ASR::TranslationUnit_t &asr,
+        const CompilerOptions &compiler_options)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(compiler_options.object_cache_dir, ec);
+    if (ec) return;
+    if (!std::filesystem::copy_file(outfile, stem + ".o",
+            std::filesystem::copy_options::overwrite_existing, ec)) {
+        return;
+    }
+    std::string manifest;
+    for (auto &item : asr.m_symtab->get_scope()) {
+        if (!LCompilers::ASR::is_a<LCompilers::ASR::Module_t>(*item.second)) {
+            continue;
+        }
+        LCompilers::ASR::Module_t *m
+            = LCompilers::ASR::down_cast<LCompilers::ASR::Module_t>(item.second);
+        if (m->m_loaded_from_mod) {
+            std::string path = find_dependency_modfile(m->m_name,
+                compiler_options);
+            std::string content;
+            if (path.empty() || !LCompilers::read_file(path, content)) {
+                // The dependency cannot be tracked; do not cache at all.
+                return;
+            }
+            // A body-only edit to a dependency module changes its modfile
+            // but not its interface hash, and this unit's object does not
+            // contain dependency code, so tracking the interface hash is
+            // enough. Under --fast dependency bodies may be inlined here;
+            // fall back to hashing the whole modfile then.
+            std::string iface_hash = compiler_options.po.fast
+                ? "" : LCompilers::modfile_read_interface_hash(content);
+            if (!iface_hash.empty()) {
+                manifest += "idep " + iface_hash + " " + path + "\n";
+            } else {
+                manifest += "dep " + LCompilers::fnv1a_hash64_hex(content)
+                    + " " + path + "\n";
+            }
+        } else {
+            // The same modfile names save_mod_files just wrote:
+            std::vector<std::string> names;
+            if (!m->m_parent_module) {
+                names.push_back(std::string(m->m_name) + ".mod");
+            } else {
+                names.push_back(std::string(m->m_parent_module) + "@"
+                    + std::string(m->m_name) + ".smod");
+                names.push_back(std::string(m->m_name) + ".mod");
+            }
+            for (auto &name : names) {
+                if (!std::filesystem::copy_file(
+                        compiler_options.po.mod_files_dir / name,
+                        stem + "." + name,
+                        std::filesystem::copy_options::overwrite_existing,
+                        ec)) {
+                    return;
+                }
+                manifest += "mod " + name + "\n";
+            }
+        }
+    }
+    std::ofstream out(stem + ".manifest",
+        std::ofstream::out | std::ofstream::binary);
+    out << manifest;
+}
+
 int compile_src_to_object_file(const std::string &infile,
         const std::string &outfile,
         bool time_report,
@@ -1190,6 +1889,7 @@ int compile_src_to_object_file(const std::string &infile,
     int time_file_read=0;
     int time_src_to_asr=0;
     int time_save_mod=0;
+    int time_llvm_init=0;
     int time_opt=0;
     int time_llvm_to_bin=0;
 
@@ -1198,6 +1898,15 @@ int compile_src_to_object_file(const std::string &infile,
     auto t2 = std::chrono::high_resolution_clock::now();
     time_file_read = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
 
+    // Source cache: identical source, options and dependency modfiles means
+    // the stored object and modfiles can be replayed without parsing.
+    std::string source_cache = source_cache_stem(input, infile, assembly,
+        compiler_options);
+    if (!source_cache.empty()
+            && source_cache_lookup(source_cache, outfile, compiler_options)) {
+        return 0;
+    }
+
     LCompilers::FortranEvaluator fe(compiler_options);
     LCompilers::ASR::TranslationUnit_t* asr;
 
@@ -1242,7 +1951,11 @@ int compile_src_to_object_file(const std::string &infile,
     }
 
     // ASR -> LLVM
-    LCompilers::LLVMEvaluator e(compiler_options.target);
+    t1 = std::chrono::high_resolution_clock::now();
+    LCompilers::LLVMEvaluator e(compiler_options.target,
+        compiler_options.po.fast);
+    t2 = std::chrono::high_resolution_clock::now();
+    time_llvm_init = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
 
     if (!(compiler_options.separate_compilation || compiler_options.generate_code_for_global_procedures)
         && !LCompilers::ASRUtils::main_program_present(*asr)
@@ -1250,6 +1963,11 @@ int compile_src_to_object_file(const std::string &infile,
         // Create an empty object file (things will be actually
         // compiled and linked when the main program is present):
         e.create_empty_object_file(outfile);
+        if (!source_cache.empty() && !has_error_w_cc) {
+            // Module-only files are exactly the ones whose recompilation
+            // cascades, so cache them too.
+            source_cache_store(source_cache, outfile, *asr, compiler_options);
+        }
         return 0;
     }
 
@@ -1259,6 +1977,18 @@ int compile_src_to_object_file(const std::string &infile,
         LCompilers::ASRUtils::mark_modules_as_external(*asr);
     }
 
+    // Object cache: when an identical ASR was already compiled with the
+    // same options, reuse the stored object and skip LLVM entirely.
+    std::string cache_file = object_cache_file_for(*asr, compiler_options,
+        assembly);
+    if (!cache_file.empty()) {
+        std::error_code ec;
+        if (std::filesystem::copy_file(cache_file, outfile,
+                std::filesystem::copy_options::overwrite_existing, ec)) {
+            return has_error_w_cc;
+        }
+    }
+
     std::unique_ptr<LCompilers::LLVMModule> m;
     diagnostics.diagnostics.clear();
     if (compiler_options.emit_debug_info) {
@@ -1290,9 +2020,26 @@ int compile_src_to_object_file(const std::string &infile,
         e.save_asm_file(*(m->m_m), outfile);
     } else {
         t1 = std::chrono::high_resolution_clock::now();
-        e.save_object_file(*(m->m_m), outfile);
+        if (compiler_options.lto) {
+            e.save_bitcode_file(*(m->m_m), outfile);
+        } else {
+            e.save_object_file(*(m->m_m), outfile);
+        }
         t2 = std::chrono::high_resolution_clock::now();
         time_llvm_to_bin = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        if (!cache_file.empty()) {
+            // A failure to populate the cache is not a compilation failure.
+            std::error_code ec;
+            std::filesystem::create_directories(
+                compiler_options.object_cache_dir, ec);
+            if (!ec) {
+                std::filesystem::copy_file(outfile, cache_file,
+                    std::filesystem::copy_options::overwrite_existing, ec);
+            }
+        }
+        if (!source_cache.empty() && !has_error_w_cc) {
+            source_cache_store(source_cache, outfile, *asr, compiler_options);
+        }
     }
 
     // CUDA: save the generated kernel source alongside the object file
@@ -1338,12 +2085,26 @@ int compile_src_to_object_file(const std::string &infile,
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "Allocator chunks: " + std::to_string(fe.get_al().num_chunks());
         compiler_options.po.vector_of_time_report.push_back(message);
+        uint64_t modfile_mapped = 0, modfile_heap = 0, modfile_files = 0;
+        LCompilers::ASRUtils::modfile_cache_stats(modfile_mapped, modfile_heap,
+            modfile_files);
+        if (modfile_files > 0) {
+            message = "Modfile bytes shared-mapped (MB): " +
+                std::to_string(modfile_mapped / (1024. * 1024)) +
+                " in " + std::to_string(modfile_files) + " files";
+            compiler_options.po.vector_of_time_report.push_back(message);
+            message = "Modfile bytes heap-cached (MB): " +
+                std::to_string(modfile_heap / (1024. * 1024));
+            compiler_options.po.vector_of_time_report.push_back(message);
+        }
         message = "File reading: " + std::to_string(time_file_read / 1000) + "." + std::to_string(time_file_read % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "Src -> ASR:  " + std::to_string(time_src_to_asr / 1000) + "." + std::to_string(time_src_to_asr % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "ASR -> mod:  " + std::to_string(time_save_mod / 1000) + "." + std::to_string(time_save_mod % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
+        message = "LLVM init:   " + std::to_string(time_llvm_init / 1000) + "." + std::to_string(time_llvm_init % 1000) + " ms";
+        compiler_options.po.vector_of_time_report.push_back(message);
         message = "LLVM opt:    " + std::to_string(time_opt / 1000) + "." + std::to_string(time_opt % 1000) + " ms";
         compiler_options.po.vector_of_time_report.push_back(message);
         message = "LLVM -> BIN: " + std::to_string(time_llvm_to_bin / 1000) + "." + std::to_string(time_llvm_to_bin % 1000) + " ms";
@@ -1358,7 +2119,8 @@ int compile_llvm_to_object_file(const std::string& infile,
                                 CompilerOptions& compiler_options)
 {
     std::string input = read_file_ok(infile);
-    LCompilers::LLVMEvaluator e(compiler_options.target);
+    LCompilers::LLVMEvaluator e(compiler_options.target,
+        compiler_options.po.fast);
 
     std::unique_ptr<LCompilers::LLVMModule> m = e.parse_module2(input, infile);
     e.save_object_file(*(m->m_m), outfile);
@@ -1692,7 +2454,7 @@ int compile_to_object_file_cpp(const std::string &infile,
 
         std::string CXX = "g++";
         std::string options;
-        if (compiler_options.openmp) {
+        if (compiler_options.openmp || compiler_options.po.parallel_do_concurrent) {
             options += "-fopenmp ";
         }
         if (kokkos) {
@@ -2030,6 +2792,18 @@ int link_executable(const std::vector<std::string> &infiles,
                 options = " -target " + compiler_options.target;
             }
 
+            if (compiler_options.profile_generate) {
+                // Links the LLVM profile runtime that the instrumented
+                // objects call into (requires a clang linker driver).
+                options += " -fprofile-generate";
+            }
+
+            if (compiler_options.lto) {
+                // The objects are bitcode with ThinLTO summaries; the clang
+                // linker driver runs the ThinLTO backend over them.
+                options += " -flto=thin";
+            }
+
             if (static_executable) {
                 if (compiler_options.platform != LCompilers::Platform::macOS_Intel
                 && compiler_options.platform != LCompilers::Platform::macOS_ARM
@@ -2063,7 +2837,8 @@ int link_executable(const std::vector<std::string> &infiles,
                 compile_cmd += extra_linker_flags;
             }
             compile_cmd += " -l" + runtime_lib + " -lm";
-            if (compiler_options.openmp && CC.find("clang" ) != std::string::npos) {
+            if ((compiler_options.openmp || compiler_options.po.parallel_do_concurrent)
+                    && CC.find("clang" ) != std::string::npos) {
                 std::string openmp_shared_library = compiler_options.openmp_lib_dir;
                 std::string omp_cmd =  " -L" + openmp_shared_library + " -Wl,-rpath," + openmp_shared_library + " -lomp";
                 if (!openmp_shared_library.empty()) {
@@ -2230,7 +3005,7 @@ int link_executable(const std::vector<std::string> &infiles,
         if (shared_executable) {
             options += " -shared ";
         }
-        if (compiler_options.openmp) {
+        if (compiler_options.openmp || compiler_options.po.parallel_do_concurrent) {
             options += " -fopenmp ";
         }
         if (kokkos) {
@@ -2479,6 +3254,47 @@ EMSCRIPTEN_KEEPALIVE char* emit_wasm_from_source(char *input) {
 
 #endif
 
+// Batch-compilation daemon for edit-compile-test loops: reads one request
+// per line from stdin ("<infile> [<outfile>]"), compiles it to an object
+// file and answers with "OK <outfile>" or "ERR <outfile>" on stdout. The
+// process state that is expensive to rebuild per invocation (the modfile
+// content cache, resolved runtime paths, the loaded runtime library) stays
+// resident between requests. EOF or an empty line ends the session.
+int daemon_mode(LCompilers::PassManager &pass_manager,
+        CompilerOptions &compiler_options) {
+#ifdef HAVE_LFORTRAN_LLVM
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.empty()) break;
+        std::istringstream request(line);
+        std::string infile, outfile;
+        request >> infile >> outfile;
+        if (outfile.empty()) {
+            outfile = std::filesystem::path(infile)
+                .filename().replace_extension(".o").string();
+        }
+        int err = 1;
+        if (CLI::NonexistentPath(infile).empty()) {
+            std::cerr << "error: no such file or directory: '" + infile + "'" << std::endl;
+        } else {
+            // compilation mutates the options and the pass manager, so give
+            // each request a fresh copy
+            CompilerOptions request_options = compiler_options;
+            LCompilers::PassManager request_pass_manager = pass_manager;
+            err = compile_src_to_object_file(infile, outfile, false, false,
+                request_options, request_pass_manager);
+        }
+        std::cout << (err ? "ERR " : "OK ") << outfile << std::endl;
+    }
+    return 0;
+#else
+    (void) pass_manager;
+    (void) compiler_options;
+    std::cerr << "The --daemon option requires the LLVM backend to be enabled. Recompile with `WITH_LLVM=yes`." << std::endl;
+    return 1;
+#endif
+}
+
 int main_app(int argc, char *argv[]) {
     int dirname_length;
     auto start_time = std::chrono::high_resolution_clock::now();
@@ -2549,6 +3365,15 @@ int main_app(int argc, char *argv[]) {
         return 0;
     }
     compiler_options.po.time_report = compiler_options.time_report;
+    compiler_options.po.time_trace = !compiler_options.time_trace.empty();
+    TimeTraceWriter time_trace_writer{compiler_options};
+    if (!compiler_options.self_profile.empty()) {
+        if (!LCompilers::start_self_profiler()) {
+            std::cerr << "The --self-profile option requires stack unwinding support. Recompile with `WITH_UNWIND=yes`." << std::endl;
+            return 1;
+        }
+    }
+    SelfProfileWriter self_profile_writer{compiler_options};
 #ifdef HAVE_INTERNAL_ALLOC_CHECK
     compiler_options.internal_alloc_check = true;
 #endif
@@ -2644,6 +3469,17 @@ int main_app(int argc, char *argv[]) {
     }
 #endif
 
+    if (opts.arg_files.size() == 1) {
+        // With a single input file there is nothing to compile in parallel
+        // at the file level, so -j parallelizes inside passes instead
+        compiler_options.po.pass_jobs = opts.arg_jobs;
+    }
+
+    if (opts.arg_daemon) {
+        lfortran_pass_manager.use_default_passes();
+        return daemon_mode(lfortran_pass_manager, compiler_options);
+    }
+
     if (opts.arg_files.size() == 0) {
 #ifdef HAVE_LFORTRAN_LLVM
         return prompt(opts.arg_v, compiler_options);
@@ -2705,6 +3541,15 @@ int main_app(int argc, char *argv[]) {
     if (opts.show_tokens) {
         return emit_tokens(opts.arg_file, false, compiler_options);
     }
+    if (opts.show_deps) {
+        return emit_deps(opts.arg_file, compiler_options);
+    }
+    if (opts.struct_layout_report) {
+        return emit_struct_layout_report(opts.arg_file, compiler_options);
+    }
+    if (opts.asr_stats) {
+        return emit_asr_stats(opts.arg_file, compiler_options);
+    }
     if (opts.show_ast) {
         return emit_ast(opts.arg_file, compiler_options);
     }
@@ -2775,6 +3620,9 @@ int main_app(int argc, char *argv[]) {
     if (opts.show_fortran) {
         return emit_fortran(opts.arg_file, compiler_options);
     }
+    if (!opts.fortran_outdir.empty()) {
+        return emit_fortran_units(opts.arg_file, opts.fortran_outdir, compiler_options);
+    }
     if (opts.arg_S) {
         if (backend == Backend::llvm) {
 #ifdef HAVE_LFORTRAN_LLVM
@@ -2847,39 +3695,54 @@ int main_app(int argc, char *argv[]) {
     // we need this separate vector to store temporary object files as some object files passed as arguments
     // are considered as it is and we do not want to delete them
     std::vector<std::string> temp_object_files;
-    for (const auto &arg_file : opts.arg_files) {
+    size_t n_files = opts.arg_files.size();
+    std::vector<std::string> output_objects(n_files);
+    std::vector<int> file_errors(n_files, 0);
+    // set when the x86 backend compiled a whole program directly to a binary,
+    // in which case there is nothing to link
+    bool x86_binary_emitted = false;
+    // Compiles opts.arg_files[i] to output_objects[i] and returns the error
+    // code. Must not touch any state shared between files, so that several
+    // files can be compiled concurrently with `-j N`; compiler options and
+    // the pass manager are copied per file since the compilation updates them
+    // (time reports, pass lists).
+    auto compile_one = [&](size_t i) -> int {
+        const std::string &arg_file = opts.arg_files[i];
         int err = 0;
         std::string tmp_o = (std::filesystem::path(LFORTRAN_TEMP_DIR) / std::filesystem::path(arg_file)
                                 .filename().replace_extension(".tmp_" + LCOMPILERS_UNIQUE_ID + ".o")).string();
-        temp_object_files.push_back(tmp_o);
+        output_objects[i] = tmp_o;
+        CompilerOptions file_compiler_options = compiler_options;
+        LCompilers::PassManager file_pass_manager = lfortran_pass_manager;
         if (endswith(arg_file, ".f90") || endswith(arg_file, ".f") ||
             endswith(arg_file, ".F90") || endswith(arg_file, ".F")) {
             if (backend == Backend::x86) {
+                x86_binary_emitted = true;
                 return compile_to_binary_x86(arg_file, outfile,
-                        compiler_options.time_report, compiler_options);
+                        file_compiler_options.time_report, file_compiler_options);
             }
             if (backend == Backend::llvm) {
 #ifdef HAVE_LFORTRAN_LLVM
-                err = compile_src_to_object_file(arg_file, tmp_o, compiler_options.time_report, false,
-                    compiler_options, lfortran_pass_manager);
+                err = compile_src_to_object_file(arg_file, tmp_o, file_compiler_options.time_report, false,
+                    file_compiler_options, file_pass_manager);
 #else
                 std::cerr << "Compiling Fortran files to object files requires the LLVM backend to be enabled. Recompile with `WITH_LLVM=yes`." << std::endl;
                 return 1;
 #endif
             } else if (backend == Backend::cpp) {
                 err = compile_to_object_file_cpp(arg_file, tmp_o, opts.arg_v, false,
-                        true, rtlib_header_dir, compiler_options);
+                        true, rtlib_header_dir, file_compiler_options);
             } else if (backend == Backend::c) {
                 err = compile_to_object_file_c(arg_file, tmp_o, opts.arg_v,
-                        false, rtlib_c_header_dir, lfortran_pass_manager, compiler_options);
+                        false, rtlib_c_header_dir, file_pass_manager, file_compiler_options);
             } else if (backend == Backend::fortran) {
-                err = compile_to_binary_fortran(arg_file, tmp_o, compiler_options);
+                err = compile_to_binary_fortran(arg_file, tmp_o, file_compiler_options);
             } else if (backend == Backend::wasm) {
                 err = compile_to_binary_wasm(arg_file, outfile,
-                        compiler_options.time_report, compiler_options);
+                        file_compiler_options.time_report, file_compiler_options);
             } else if (backend == Backend::mlir) {
 #ifdef HAVE_LFORTRAN_MLIR
-                err = handle_mlir(arg_file, tmp_o, compiler_options, false, false);
+                err = handle_mlir(arg_file, tmp_o, file_compiler_options, false, false);
 #else
                 std::cerr << "Compiling Fortran files to object files using "
                     "`--backend=mlir` requires the MLIR backend to be enabled. "
@@ -2892,19 +3755,51 @@ int main_app(int argc, char *argv[]) {
         } else if (endswith(arg_file, ".ll")) {
             // this way we can execute LLVM IR files directly
 #ifdef HAVE_LFORTRAN_LLVM
-            err = compile_llvm_to_object_file(arg_file, tmp_o, compiler_options);
-            if (err) return err;
+            err = compile_llvm_to_object_file(arg_file, tmp_o, file_compiler_options);
 #else
             std::cerr << "Compiling LLVM IR to object files requires the LLVM backend to be enabled. Recompile with `WITH_LLVM=yes`." << std::endl;
             return 1;
 #endif
         } else {
             // assume it's an object file
-            tmp_o = arg_file;
+            output_objects[i] = arg_file;
+        }
+        return err;
+    };
+    size_t n_jobs = (size_t) std::max(opts.arg_jobs, 1);
+    if (n_jobs > n_files) n_jobs = n_files;
+    if (n_jobs > 1 && backend != Backend::x86) {
+        // compile independent source files concurrently; linking stays serial
+        std::atomic<size_t> next_file{0};
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < n_jobs; t++) {
+            workers.emplace_back([&]() {
+                size_t i;
+                while ((i = next_file.fetch_add(1)) < n_files) {
+                    file_errors[i] = compile_one(i);
+                }
+            });
+        }
+        for (auto &worker : workers) worker.join();
+    } else {
+        for (size_t i = 0; i < n_files; i++) {
+            file_errors[i] = compile_one(i);
+            if (x86_binary_emitted) return file_errors[i];
+            if (file_errors[i] && (endswith(opts.arg_files[i], ".ll") ||
+                    !compiler_options.continue_compilation)) {
+                return file_errors[i];
+            }
+        }
+    }
+    for (size_t i = 0; i < n_files; i++) {
+        const std::string &arg_file = opts.arg_files[i];
+        int err = file_errors[i];
+        if (output_objects[i] != arg_file) {
+            temp_object_files.push_back(output_objects[i]);
         }
         if (err && !compiler_options.continue_compilation) return err;
         err_ = err;
-        if (!err) object_files.push_back(tmp_o);
+        if (!err) object_files.push_back(output_objects[i]);
     }
     if (object_files.size() == 0) {
         return err_;
@@ -229,6 +229,7 @@ namespace LCompilers::CommandLineInterface {
         bool disable_error_banner = false;
         bool disable_realloc_lhs = false;
         std::string fpe_traps_str;
+        std::string soa_structs_str;
 
         // Standard options compatible with gfortran, gcc or clang
         // We follow the established conventions
@@ -246,6 +247,7 @@ namespace LCompilers::CommandLineInterface {
         app.add_option("-L", opts.arg_L, "Library path option")->allow_extra_args(false);
         app.add_option("-I", compiler_options.po.include_dirs, "Include path")->allow_extra_args(false);
         app.add_option("-J", compiler_options.po.mod_files_dir, "Where to save mod files");
+        app.add_option("-j", opts.arg_jobs, "Number of source files to compile in parallel")->capture_default_str();
         app.add_flag("-g", compiler_options.emit_debug_info, "Compile with debugging information");
         app.add_option("-D", compiler_options.c_preprocessor_defines, "Define <macro>=<value> (or 1 if <value> omitted)")->allow_extra_args(false);
         app.add_flag("--version", opts.arg_version, "Display compiler version information");
@@ -286,7 +288,10 @@ namespace LCompilers::CommandLineInterface {
         // Output and debugging-related flags
         app.add_flag("--show-tokens", opts.show_tokens, "Show tokens for the given file and exit")->group(group_output_debugging_options);
         app.add_flag("--show-ast", opts.show_ast, "Show AST for the given file and exit")->group(group_output_debugging_options);
+        app.add_flag("--deps", opts.show_deps, "Emit Make-compatible module dependency rules for the given file (parse only) and exit")->group(group_output_debugging_options);
         app.add_flag("--show-asr", opts.show_asr, "Show ASR for the given file and exit")->group(group_output_debugging_options);
+        app.add_flag("--asr-stats", opts.asr_stats, "Show ASR size and complexity statistics as JSON and exit")->group(group_output_debugging_options);
+        app.add_flag("--struct-layout-report", opts.struct_layout_report, "Show derived-type memory layout (offsets, padding, member reference counts) for the given file and exit")->group(group_output_debugging_options);
         app.add_flag("--with-intrinsic-mods", compiler_options.po.with_intrinsic_mods, "Show intrinsic modules in ASR")->group(group_output_debugging_options);
         app.add_flag("--show-ast-f90", opts.show_ast_f90, "Show Fortran from AST for the given file and exit")->group(group_output_debugging_options);
         app.add_flag("--no-color", opts.arg_no_color, "Turn off colored AST/ASR")->group(group_output_debugging_options);
@@ -306,14 +311,20 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--show-wat", opts.show_wat, "Show WAT (WebAssembly Text Format) and exit")->group(group_output_debugging_options);
         app.add_flag("--show-julia", opts.show_julia, "Show Julia translation source for the given file and exit")->group(group_output_debugging_options);
         app.add_flag("--show-fortran", opts.show_fortran, "Show Fortran translation source for the given file and exit")->group(group_output_debugging_options);
+        app.add_option("--fortran-outdir", opts.fortran_outdir, "Write the Fortran translation as one file per program unit into the given directory and exit")->group(group_output_debugging_options);
         app.add_flag("--show-stacktrace", compiler_options.show_stacktrace, "Show internal stacktrace on compiler errors")->group(group_output_debugging_options);
         app.add_flag("--time-report", compiler_options.time_report, "Show compilation time report")->group(group_output_debugging_options);
+        app.add_option("--time-trace", compiler_options.time_trace, "Write a Chrome trace-format profile of the compilation to the given file")->group(group_output_debugging_options);
+        app.add_option("--self-profile", compiler_options.self_profile, "Sample the compiler's own call stacks during compilation and write them collapsed (for flamegraph tooling) to the given file")->group(group_output_debugging_options);
+        app.add_flag("--incremental-asr-verify", compiler_options.po.incremental_verify, "Verify only this compilation's own units after each pass (debug builds)")->group(group_output_debugging_options);
 
 
         // Pass and transformation-related flags
         app.add_option("--pass", opts.arg_pass, "Apply the ASR pass and show ASR (implies --show-asr)")->group(group_pass_transformation_options);
         app.add_option("--skip-pass", opts.skip_pass, "Skip an ASR pass in default pipeline")->group(group_pass_transformation_options);
+        app.add_option("--soa-structs", soa_structs_str, "Comma-separated derived type names whose local allocatable arrays may be split into per-member arrays (struct-of-arrays)")->group(group_pass_transformation_options);
         app.add_flag("--dump-all-passes", compiler_options.po.dump_all_passes, "Apply all the passes and dump the ASR into a file")->group(group_pass_transformation_options);
+        app.add_flag("--dump-pass-stats", compiler_options.po.dump_pass_stats, "Report pass trigger construct counts and the passes skipped as no-ops")->group(group_pass_transformation_options);
         app.add_flag("--dump-all-passes-fortran", compiler_options.po.dump_fortran, "Apply all passes and dump the ASR after each pass into fortran file")->group(group_pass_transformation_options);
         app.add_flag("--cumulative", compiler_options.po.pass_cumulative, "Apply all the passes cumulatively till the given pass")->group(group_pass_transformation_options);
 
@@ -359,15 +370,28 @@ namespace LCompilers::CommandLineInterface {
         app.add_flag("--semantics-only", compiler_options.semantics_only, "do parsing and semantics, and report all the errors")->group(group_miscellaneous_options);
         app.add_flag("--print-leading-space", compiler_options.print_leading_space, "Print leading white space if format is unspecified")->group(group_miscellaneous_options);
         app.add_flag("--interactive-parse", compiler_options.interactive, "Use interactive parse")->group(group_miscellaneous_options);
+        app.add_flag("--daemon", opts.arg_daemon, "Serve compile requests from stdin, keeping caches resident between requests")->group(group_miscellaneous_options);
         app.add_flag("--verbose", compiler_options.po.verbose, "Print debugging statements")->group(group_miscellaneous_options);
         app.add_flag("--fast", compiler_options.po.fast, "Best performance (disable strict standard compliance)")->group(group_miscellaneous_options);
         app.add_flag("--no-fast-math", compiler_options.po.no_fast_math, "Disable fast-math optimizations (preserve NaN/Inf semantics)")->group(group_miscellaneous_options);
+        app.add_flag("--ffast-math", compiler_options.po.fast_math, "Enable fast-math floating point semantics (FMA contraction, reassociation) without the rest of --fast")->group(group_miscellaneous_options);
+        app.add_flag("--parallel-intrinsics", compiler_options.po.parallel_intrinsics, "Lower matmul on large arrays to threaded runtime kernels")->group(group_miscellaneous_options);
+        app.add_flag("--check-parallel", compiler_options.po.check_parallel, "Instrument OpenMP regions with the runtime data-race checker")->group(group_miscellaneous_options);
+        app.add_flag("--coarray", compiler_options.po.coarray, "Lower coarray statements onto the image runtime (MPI-backed when built WITH_RUNTIME_MPI)")->group(group_miscellaneous_options);
+        app.add_flag("--parallel-do-concurrent", compiler_options.po.parallel_do_concurrent, "Parallelize do concurrent loops automatically (infers reduction and private locality)")->group(group_miscellaneous_options);
         app.add_flag("--realloc-lhs-arrays", compiler_options.po.realloc_lhs_arrays, "Reallocate left hand side automatically for arrays")->group(group_miscellaneous_options);
         app.add_flag("--disable-realloc-lhs-arrays", disable_realloc_lhs, "Disables reallocating left hand side automatically for arrays")->group(group_miscellaneous_options);
         app.add_flag("--ignore-pragma", compiler_options.ignore_pragma, "Ignores all the pragmas")->group(group_miscellaneous_options);
         app.add_flag("--stack-arrays", compiler_options.stack_arrays, "Allocate memory for arrays on stack")->group(group_miscellaneous_options);
         app.add_flag("--descriptor-index-64", compiler_options.descriptor_index_64, "Use 64-bit indices in array descriptors (implied by -fdefault-integer-8)")->group(group_miscellaneous_options);
         app.add_flag("--detect-leaks", compiler_options.detect_leaks, "Print a memory leak report")->group(group_miscellaneous_options);
+        app.add_flag("--arena-allocator", compiler_options.arena_allocator, "Serve allocatables from per-procedure arena regions that are bulk-freed on exit")->group(group_miscellaneous_options);
+        app.add_flag("--instrument", compiler_options.instrument_functions, "Record procedure entry/exit times and print a hot-procedure report at program exit (LLVM backend)")->group(group_miscellaneous_options);
+        app.add_flag("--memory-profile", compiler_options.memory_profile, "Track allocation counts, bytes and peak residency per source location and print a report at program exit")->group(group_miscellaneous_options);
+        app.add_option("--object-cache", compiler_options.object_cache_dir, "Cache object files and modfiles in the given directory, keyed by content hashes (including modfile dependencies), and reuse them for unchanged code")->group(group_miscellaneous_options);
+        app.add_flag("--profile-generate", compiler_options.profile_generate, "Instrument the generated code with profiling counters (run the program, then merge the .profraw files with llvm-profdata)")->group(group_miscellaneous_options);
+        app.add_option("--profile-use", compiler_options.profile_use, "Optimize using the given merged .profdata profile")->group(group_miscellaneous_options);
+        app.add_flag("--lto", compiler_options.lto, "Emit LLVM bitcode objects and run ThinLTO at link time (requires a clang linker driver)")->group(group_miscellaneous_options);
         app.add_flag("--array-bounds-checking", compiler_options.po.bounds_checking, "Enables runtime array bounds checking")->group(group_miscellaneous_options);
         app.add_flag("--no-array-bounds-checking", disable_bounds_checking, "Disables runtime array bounds checking")->group(group_miscellaneous_options);
         app.add_flag("--strict-array-bounds-checking", compiler_options.po.strict_bounds_checking, "Enables strict runtime array bounds checking: Array passed into subroutine must exactly match the expected size")->group(group_miscellaneous_options);
@@ -509,6 +533,19 @@ namespace LCompilers::CommandLineInterface {
             }
         }
 
+        // Split --soa-structs into lowercase type names for the pass
+        if (!soa_structs_str.empty()) {
+            std::string token;
+            std::istringstream stream(soa_structs_str);
+            while (std::getline(stream, token, ',')) {
+                token.erase(0, token.find_first_not_of(" \t"));
+                token.erase(token.find_last_not_of(" \t") + 1);
+                if (!token.empty()) {
+                    compiler_options.po.soa_structs.push_back(to_lower(token));
+                }
+            }
+        }
+
         // Parse and validate --fpe-trap values, build bitmask
         if (!fpe_traps_str.empty()) {
             std::string token;
@@ -36,6 +36,9 @@ namespace LCompilers::CommandLineInterface {
         bool show_tokens = false;
         bool show_ast = false;
         bool show_asr = false;
+        bool show_deps = false;
+        bool struct_layout_report = false;
+        bool asr_stats = false;
         bool show_ast_f90 = false;
         std::string arg_pass;
         bool arg_no_color = false;
@@ -51,8 +54,11 @@ namespace LCompilers::CommandLineInterface {
         bool show_wat = false;
         bool show_julia = false;
         bool show_fortran = false;
+        std::string fortran_outdir;
         bool static_link = false;
         bool shared_link = false;
+        int arg_jobs = 1;
+        bool arg_daemon = false;
         std::string skip_pass;
         std::string arg_backend = "llvm";
         std::string arg_kernel_f;
@@ -166,6 +166,26 @@ namespace LCompilers::LanguageServerProtocol::Config {
             );
         }
 
+        if ((iter = object.find("validationDebounceMs")) != object.end()) {
+            config->validationDebounceMs = iter->second->uinteger();
+        } else {
+            throw LSP_EXCEPTION(
+                ErrorCodes::InvalidParams,
+                ("Missing required LFortranLspConfig attribute: "
+                 "validationDebounceMs")
+            );
+        }
+
+        if ((iter = object.find("maxMemoryUtilizationMb")) != object.end()) {
+            config->maxMemoryUtilizationMb = iter->second->uinteger();
+        } else {
+            throw LSP_EXCEPTION(
+                ErrorCodes::InvalidParams,
+                ("Missing required LFortranLspConfig attribute: "
+                 "maxMemoryUtilizationMb")
+            );
+        }
+
         if ((iter = object.find("compiler")) != object.end()) {
             config->compiler = anyToLFortranLspConfig_compiler(*iter->second);
         } else {
@@ -191,6 +211,18 @@ namespace LCompilers::LanguageServerProtocol::Config {
                 transformer.uintegerToAny(lfortran.maxNumberOfProblems)
             )
         );
+        object.emplace(
+            "validationDebounceMs",
+            std::make_unique<LSPAny>(
+                transformer.uintegerToAny(lfortran.validationDebounceMs)
+            )
+        );
+        object.emplace(
+            "maxMemoryUtilizationMb",
+            std::make_unique<LSPAny>(
+                transformer.uintegerToAny(lfortran.maxMemoryUtilizationMb)
+            )
+        );
         object.emplace(
             "compiler",
             std::make_unique<LSPAny>(
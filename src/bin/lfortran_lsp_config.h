@@ -21,6 +21,8 @@ namespace LCompilers::LanguageServerProtocol::Config {
 
     struct LFortranLspConfig : public LspConfig {
         unsigned int maxNumberOfProblems;
+        unsigned int validationDebounceMs;
+        unsigned int maxMemoryUtilizationMb;
         LFortranLspConfig_compiler compiler;
     };
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
@@ -145,6 +146,19 @@ namespace LCompilers::LanguageServerProtocol {
             optionsByUri.clear();
             logger.debug() << "Invalidated compiler options cache." << std::endl;
         }
+        {
+            // The cached diagnostics were produced under the old compiler
+            // options and may no longer apply:
+            auto writeLock = LSP_WRITE_LOCK(errorsMutex, "errors");
+            errorsByDocumentId.clear();
+            logger.debug() << "Invalidated diagnostics cache." << std::endl;
+        }
+        {
+            // The symbol index depends on the compiler options as well:
+            auto writeLock = LSP_WRITE_LOCK(symbolIndexMutex, "symbol-index");
+            symbolsByDocumentId.clear();
+            logger.debug() << "Invalidated symbol index." << std::endl;
+        }
     }
 
     auto LFortranLspLanguageServer::getLFortranConfig(
@@ -247,6 +261,7 @@ namespace LCompilers::LanguageServerProtocol {
             return;
         }
         const auto start = std::chrono::high_resolution_clock::now();
+        touchDocumentCaches(document.id());
         auto readLock = LSP_READ_LOCK(document.mutex(), "document:" + document.uri());
         const std::string &path = document.path().string();
         const std::string &text = document.text();
@@ -261,14 +276,35 @@ namespace LCompilers::LanguageServerProtocol {
                 std::shared_ptr<CompilerOptions> compilerOptions =
                     getCompilerOptions(document);
                 readLock.lock();
-                logger.trace()
-                    << "Getting diagnostics from LFortran for document with URI="
-                    << uri << std::endl;
-                // NOTE: Lock the logger to add debug statements to stderr within LFortran.
-                // std::unique_lock<std::recursive_mutex> loggerLock(logger.mutex());
-                std::vector<lc::error_highlight> highlights =
-                    lfortran.showErrors(path, text, *compilerOptions);
-                // loggerLock.unlock();
+                std::shared_ptr<
+                    std::pair<std::string, std::vector<lc::error_highlight>>
+                > errors;
+                {
+                    auto errorsLock = LSP_READ_LOCK(errorsMutex, "errors");
+                    auto iter = errorsByDocumentId.find(document.id());
+                    if ((iter != errorsByDocumentId.end()) &&
+                            (iter->second->first == text)) {
+                        errors = iter->second;
+                    }
+                }
+                if (errors) {
+                    logger.trace()
+                        << "Reusing cached diagnostics for unchanged document with URI="
+                        << uri << std::endl;
+                } else {
+                    logger.trace()
+                        << "Getting diagnostics from LFortran for document with URI="
+                        << uri << std::endl;
+                    // NOTE: Lock the logger to add debug statements to stderr within LFortran.
+                    // std::unique_lock<std::recursive_mutex> loggerLock(logger.mutex());
+                    errors = std::make_shared<
+                        std::pair<std::string, std::vector<lc::error_highlight>>
+                    >(text, lfortran.showErrors(path, text, *compilerOptions));
+                    // loggerLock.unlock();
+                    auto errorsLock = LSP_WRITE_LOCK(errorsMutex, "errors");
+                    errorsByDocumentId.insert_or_assign(document.id(), errors);
+                }
+                const std::vector<lc::error_highlight> &highlights = errors->second;
 
                 logger.trace()
                     << "Collected " << highlights.size()
@@ -334,7 +370,7 @@ namespace LCompilers::LanguageServerProtocol {
                         }
                         sendLogTrace(logTraceParams);
                     }
-                    sendTextDocument_publishDiagnostics(params);
+                    publishDiagnostics(params);
                 } else {
                     logger.trace()  //<- trace instead of debug because this will happen often
                         << "Validation canceled before publishing results."
@@ -356,6 +392,9 @@ namespace LCompilers::LanguageServerProtocol {
                 )
                 << std::endl;
         }
+        // Validation is the main driver of cache growth, so check the memory
+        // ceiling after each run:
+        reduceMemoryPressure();
     }
 
     // request: "initialize"
@@ -399,6 +438,7 @@ namespace LCompilers::LanguageServerProtocol {
                 }
                 clientSupportsFormatting = textDocument.formatting.has_value();
                 clientSupportsRangeFormatting = textDocument.rangeFormatting.has_value();
+                clientSupportsFoldingRanges = textDocument.foldingRange.has_value();
             }
             logger.debug()
                 << "clientSupportsGotoDefinition = "
@@ -444,6 +484,10 @@ namespace LCompilers::LanguageServerProtocol {
                 << "clientSupportsRangeFormatting = "
                 << clientSupportsRangeFormatting
                 << std::endl;
+            logger.debug()
+                << "clientSupportsFoldingRanges = "
+                << clientSupportsFoldingRanges
+                << std::endl;
         }
 
         InitializeResult_serverInfo &serverInfo = result.serverInfo.emplace();
@@ -529,6 +573,12 @@ namespace LCompilers::LanguageServerProtocol {
             semanticTokensProvider = std::move(semanticTokensOptions);
         }
 
+        if (clientSupportsFoldingRanges) {
+            ServerCapabilities_foldingRangeProvider &foldingRangeProvider =
+                capabilities.foldingRangeProvider.emplace();
+            foldingRangeProvider = true;
+        }
+
         if (clientSupportsCodeCompletion) {
             CompletionOptions &completionProvider =
                 capabilities.completionProvider.emplace();
@@ -713,17 +763,14 @@ namespace LCompilers::LanguageServerProtocol {
         std::shared_ptr<LspTextDocument> document = getDocument(uri);
         std::shared_ptr<CompilerOptions> compilerOptions =
             getCompilerOptions(*document);
-        auto readLock = LSP_READ_LOCK(document->mutex(), "document:" + document->uri());
-        const std::string &path = document->path().string();
-        const std::string &text = document->text();
         logger.trace()
             << "Looking up all symbols in document with URI=" << uri
             << std::endl;
-        // NOTE: Lock the logger to add debug statements to stderr within LFortran.
-        // std::unique_lock<std::recursive_mutex> loggerLock(logger.mutex());
-        std::vector<lc::document_symbols> symbols =
-            lfortran.getSymbols(path, text, *compilerOptions);
-        // loggerLock.unlock();
+        std::shared_ptr<
+            std::pair<std::string, std::vector<lc::document_symbols>>
+        > index = getSymbolIndex(*document);
+        const std::vector<lc::document_symbols> &symbols = index->second;
+        auto readLock = LSP_READ_LOCK(document->mutex(), "document:" + document->uri());
         logger.trace()
             << "Found " << symbols.size() << " symbol(s) matching the query."
             << std::endl;
@@ -986,6 +1033,7 @@ namespace LCompilers::LanguageServerProtocol {
     auto LFortranLspLanguageServer::getHighlights(
         LspTextDocument &document
     ) -> std::shared_ptr<std::pair<std::vector<FortranToken>, int>> {
+        touchDocumentCaches(document.id());
         auto documentLock = LSP_READ_LOCK(document.mutex(), "document:" + document.uri());
         int version = document.version();
         auto readLock = LSP_READ_LOCK(highlightsMutex, "highlights");
@@ -1010,6 +1058,134 @@ namespace LCompilers::LanguageServerProtocol {
         )->second;
     }
 
+    auto LFortranLspLanguageServer::touchDocumentCaches(
+        std::size_t documentId
+    ) -> void {
+        auto writeLock = LSP_WRITE_LOCK(cacheAccessMutex, "cache-access");
+        cacheAccessByDocumentId.insert_or_assign(
+            documentId,
+            std::chrono::steady_clock::now()
+        );
+    }
+
+    auto LFortranLspLanguageServer::reduceMemoryPressure() -> void {
+        std::size_t maxMemoryUtilizationMb;
+        {
+            auto workspaceLock = LSP_READ_LOCK(workspaceMutex, "workspace");
+            maxMemoryUtilizationMb = std::static_pointer_cast<lsc::LFortranLspConfig>(
+                workspaceConfig
+            )->maxMemoryUtilizationMb;
+        }
+        if (maxMemoryUtilizationMb == 0) {
+            return;  // No memory ceiling has been configured.
+        }
+        std::size_t utilization = pu.memoryUtilization();
+        if (utilization <= (static_cast<std::size_t>(maxMemoryUtilizationMb) * 1048576)) {
+            return;
+        }
+        // Shed the caches of every document except the one whose caches were
+        // used most recently. The freed memory does not return to the
+        // operating system immediately but becomes reusable, which caps
+        // further growth; the caches rebuild on demand:
+        std::vector<
+            std::pair<std::chrono::steady_clock::time_point, std::size_t>
+        > accesses;
+        {
+            auto readLock = LSP_READ_LOCK(cacheAccessMutex, "cache-access");
+            accesses.reserve(cacheAccessByDocumentId.size());
+            for (const auto &[documentId, accessTime] : cacheAccessByDocumentId) {
+                accesses.emplace_back(accessTime, documentId);
+            }
+        }
+        if (accesses.size() < 2) {
+            return;
+        }
+        std::sort(accesses.begin(), accesses.end());
+        std::size_t bytesFreed = 0;
+        std::size_t numEvicted = 0;
+        for (std::size_t i = 0; (i + 1) < accesses.size(); ++i) {
+            std::size_t documentId = accesses[i].second;
+            {
+                auto writeLock = LSP_WRITE_LOCK(highlightsMutex, "highlights");
+                auto iter = highlightsByDocumentId.find(documentId);
+                if (iter != highlightsByDocumentId.end()) {
+                    bytesFreed += sizeof(FortranToken) * iter->second->first.capacity();
+                    highlightsByDocumentId.erase(iter);
+                }
+            }
+            {
+                auto writeLock = LSP_WRITE_LOCK(errorsMutex, "errors");
+                auto iter = errorsByDocumentId.find(documentId);
+                if (iter != errorsByDocumentId.end()) {
+                    bytesFreed += iter->second->first.capacity();
+                    for (const lc::error_highlight &error : iter->second->second) {
+                        bytesFreed += sizeof(error)
+                            + error.message.capacity()
+                            + error.filename.capacity();
+                    }
+                    errorsByDocumentId.erase(iter);
+                }
+            }
+            {
+                auto writeLock = LSP_WRITE_LOCK(symbolIndexMutex, "symbol-index");
+                auto iter = symbolsByDocumentId.find(documentId);
+                if (iter != symbolsByDocumentId.end()) {
+                    bytesFreed += iter->second->first.capacity();
+                    for (const lc::document_symbols &symbol : iter->second->second) {
+                        bytesFreed += sizeof(symbol)
+                            + symbol.symbol_name.capacity()
+                            + symbol.filename.capacity();
+                    }
+                    symbolsByDocumentId.erase(iter);
+                }
+            }
+            {
+                auto writeLock = LSP_WRITE_LOCK(cacheAccessMutex, "cache-access");
+                cacheAccessByDocumentId.erase(documentId);
+            }
+            ++numEvicted;
+        }
+        logger.warn()
+            << "Memory utilization (" << utilization
+            << " bytes) exceeds the configured ceiling of "
+            << maxMemoryUtilizationMb << " MB; dropped the caches of "
+            << numEvicted << " cold document(s) (~" << (bytesFreed / 1024)
+            << " KB)." << std::endl;
+    }
+
+    auto LFortranLspLanguageServer::getSymbolIndex(
+        LspTextDocument &document
+    ) -> std::shared_ptr<std::pair<std::string, std::vector<lc::document_symbols>>> {
+        touchDocumentCaches(document.id());
+        std::shared_ptr<CompilerOptions> compilerOptions =
+            getCompilerOptions(document);
+        auto documentLock = LSP_READ_LOCK(document.mutex(), "document:" + document.uri());
+        const std::string &path = document.path().string();
+        const std::string &text = document.text();
+        {
+            auto readLock = LSP_READ_LOCK(symbolIndexMutex, "symbol-index");
+            auto iter = symbolsByDocumentId.find(document.id());
+            if ((iter != symbolsByDocumentId.end())
+                && (iter->second->first == text)) {
+                return iter->second;
+            }
+        }
+        logger.trace()
+            << "Indexing symbols in document with URI=" << document.uri()
+            << std::endl;
+        // NOTE: Indexing compiles the document, so it is performed outside the
+        // index lock; a concurrent indexer of the same text at worst repeats
+        // the work and the last writer wins with an equivalent result.
+        std::shared_ptr<
+            std::pair<std::string, std::vector<lc::document_symbols>>
+        > index = std::make_shared<
+            std::pair<std::string, std::vector<lc::document_symbols>>
+        >(text, lfortran.getSymbols(path, text, *compilerOptions));
+        auto writeLock = LSP_WRITE_LOCK(symbolIndexMutex, "symbol-index");
+        symbolsByDocumentId.insert_or_assign(document.id(), index);
+        return index;
+    }
+
     auto LFortranLspLanguageServer::encodeHighlights(
         std::vector<unsigned int> &encodings,
         LspTextDocument &document,
@@ -1059,6 +1235,141 @@ namespace LCompilers::LanguageServerProtocol {
         return result;
     }
 
+    auto LFortranLspLanguageServer::computeFoldingRanges(
+        LspTextDocument &document,
+        const std::vector<FortranToken> &highlights
+    ) -> std::vector<FoldingRange> {
+        std::vector<FoldingRange> foldingRanges;
+        auto documentLock = LSP_READ_LOCK(document.mutex(), "document:" + document.uri());
+        const std::string &text = document.text();
+        // Start lines of the blocks that have been opened but not yet closed:
+        std::vector<std::size_t> openLines;
+        std::size_t elseLine = std::string::npos;
+        bool skipNextKeyword = false;
+        std::size_t skipLine = 0;
+        std::string keyword;
+        for (const FortranToken &token : highlights) {
+            if (token.type != SemanticTokenTypes::Keyword) {
+                continue;
+            }
+            // Classify the token's position within its line: tokens within
+            // comments are ignored and block terminators must start their
+            // statements (optionally prefixed by a numeric label):
+            bool inComment = false;
+            bool atStatementStart = true;
+            for (std::size_t i = token.position; i > 0;) {
+                char c = text[--i];
+                if (c == '\n') {
+                    break;
+                }
+                if (c == '!') {
+                    inComment = true;
+                    break;
+                }
+                if ((c != ' ') && (c != '\t') && (c != ';')
+                        && ((c < '0') || (c > '9'))) {
+                    atStatementStart = false;
+                }
+            }
+            if (inComment) {
+                continue;
+            }
+            keyword.assign(text, token.position, token.length);
+            std::transform(
+                keyword.begin(), keyword.end(), keyword.begin(),
+                [](unsigned char c) {
+                    return std::tolower(c);
+                }
+            );
+            std::size_t line, column;
+            document.fromPosition(line, column, token.position);
+            if (skipNextKeyword && (line == skipLine)) {
+                // This keyword qualifies the "end" that precedes it on the
+                // same line (e.g. the "do" of "end do"):
+                skipNextKeyword = false;
+                continue;
+            }
+            skipNextKeyword = false;
+            if ((keyword == "end") || (keyword == "enddo") || (keyword == "endif")) {
+                if (!atStatementStart) {
+                    continue;
+                }
+                if (keyword == "end") {
+                    skipNextKeyword = true;
+                    skipLine = line;
+                }
+                if (!openLines.empty()) {
+                    std::size_t startLine = openLines.back();
+                    openLines.pop_back();
+                    if (line > (startLine + 1)) {
+                        FoldingRange &foldingRange = foldingRanges.emplace_back();
+                        foldingRange.startLine = startLine;
+                        // Keep the terminating statement visible when folded:
+                        foldingRange.endLine = line - 1;
+                        foldingRange.kind = FoldingRangeKind::Region;
+                    }
+                }
+                continue;
+            }
+            if (keyword == "else") {
+                elseLine = line;
+                continue;
+            }
+            if (keyword == "then") {
+                // An "else if (...) then" continues the block opened by its
+                // "if (...) then" rather than opening another:
+                if (line != elseLine) {
+                    openLines.push_back(line);
+                }
+                continue;
+            }
+            if ((keyword == "program") || (keyword == "module")
+                    || (keyword == "subroutine") || (keyword == "function")
+                    || (keyword == "interface") || (keyword == "do")) {
+                openLines.push_back(line);
+                continue;
+            }
+            if (keyword == "type") {
+                // Only derived-type definitions open blocks; skip
+                // declarations like "type(point) :: p" and the "type is"
+                // guards of select-type constructs:
+                std::size_t next = token.position + token.length;
+                while ((next < text.size())
+                        && ((text[next] == ' ') || (text[next] == '\t'))) {
+                    ++next;
+                }
+                if ((next < text.size()) && (text[next] != '(')
+                        && (text.compare(next, 3, "is ") != 0)
+                        && (text.compare(next, 3, "is(") != 0)) {
+                    openLines.push_back(line);
+                }
+                continue;
+            }
+        }
+        // NOTE: Any blocks that remain open are unterminated (e.g. while the
+        // document is being edited) and are dropped rather than guessed at.
+        return foldingRanges;
+    }
+
+    // request: "textDocument/foldingRange"
+    auto LFortranLspLanguageServer::receiveTextDocument_foldingRange(
+        const RequestMessage &/*request*/,
+        FoldingRangeParams &params
+    ) -> TextDocument_FoldingRangeResult {
+        TextDocument_FoldingRangeResult result;
+        if (clientSupportsFoldingRanges) {
+            const std::string &uri = params.textDocument.uri;
+            std::shared_ptr<LspTextDocument> document = getDocument(uri);
+            auto highlights = getHighlights(*document);
+            result = std::make_unique<std::vector<FoldingRange>>(
+                computeFoldingRanges(*document, highlights->first)
+            );
+        } else {
+            result = nullptr;
+        }
+        return result;
+    }
+
     inline auto startsWith(
         const std::string &term,
         const std::string_view &prefix
@@ -1076,15 +1387,14 @@ namespace LCompilers::LanguageServerProtocol {
         if (clientSupportsCodeCompletion) {
             const std::string &uri = params.textDocument.uri;
             std::shared_ptr<LspTextDocument> document = getDocument(uri);
-            const std::shared_ptr<CompilerOptions> compilerOptions = getCompilerOptions(*document);
-            auto readLock = LSP_READ_LOCK(document->mutex(), "document:" + document->uri());
-            const std::string &path = document->path().string();
-            const std::string &text = document->text();
             logger.trace()
                 << "Looking up all symbols in document with URI=" << uri
                 << std::endl;
-            std::vector<lc::document_symbols> symbols =
-                lfortran.getSymbols(path, text, *compilerOptions);
+            std::shared_ptr<
+                std::pair<std::string, std::vector<lc::document_symbols>>
+            > index = getSymbolIndex(*document);
+            const std::vector<lc::document_symbols> &symbols = index->second;
+            auto readLock = LSP_READ_LOCK(document->mutex(), "document:" + document->uri());
             logger.trace()
                 << "Found " << symbols.size() << " symbol(s) matching the query."
                 << std::endl;
@@ -1277,6 +1587,7 @@ namespace LCompilers::LanguageServerProtocol {
         std::shared_ptr<LspTextDocument> document = getDocument(uri);
         validate(document);
         updateHighlights(document);
+        updateSymbolIndex(document);
     }
 
     // notification: "textDocument/didChange"
@@ -1289,6 +1600,7 @@ namespace LCompilers::LanguageServerProtocol {
         std::shared_ptr<LspTextDocument> document = getDocument(uri);
         validate(document);
         updateHighlights(document);
+        updateSymbolIndex(document);
     }
 
     // notification: "textDocument/didClose"
@@ -1305,6 +1617,36 @@ namespace LCompilers::LanguageServerProtocol {
                 highlightsByDocumentId.erase(iter);
             }
         }
+        {
+            auto errorsLock = LSP_WRITE_LOCK(errorsMutex, "errors");
+            auto iter = errorsByDocumentId.find(document->id());
+            if (iter != errorsByDocumentId.end()) {
+                errorsByDocumentId.erase(iter);
+            }
+        }
+        {
+            auto indexLock = LSP_WRITE_LOCK(symbolIndexMutex, "symbol-index");
+            auto iter = symbolsByDocumentId.find(document->id());
+            if (iter != symbolsByDocumentId.end()) {
+                symbolsByDocumentId.erase(iter);
+            }
+        }
+        {
+            // Without this the compiler options of closed documents would
+            // accumulate for the lifetime of the server:
+            auto optionsLock = LSP_WRITE_LOCK(optionMutex, "compiler-options");
+            auto iter = optionsByUri.find(uri);
+            if (iter != optionsByUri.end()) {
+                optionsByUri.erase(iter);
+            }
+        }
+        {
+            auto accessLock = LSP_WRITE_LOCK(cacheAccessMutex, "cache-access");
+            auto iter = cacheAccessByDocumentId.find(document->id());
+            if (iter != cacheAccessByDocumentId.end()) {
+                cacheAccessByDocumentId.erase(iter);
+            }
+        }
         BaseLspLanguageServer::receiveTextDocument_didClose(notification, params);
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -64,6 +65,37 @@ namespace LCompilers::LanguageServerProtocol {
         > highlightsByDocumentId;
         std::shared_mutex highlightsMutex;
 
+        // Many events re-trigger validation without changing the document
+        // (saves, configuration reloads, watched-file events, undo back to a
+        // previously validated state). Cache the diagnostics from the most
+        // recent run, keyed by the exact text that produced them, so those
+        // re-validations skip the parse-and-semantics pipeline.
+        std::unordered_map<
+            std::size_t,
+            std::shared_ptr<std::pair<std::string, std::vector<lc::error_highlight>>>
+        > errorsByDocumentId;
+        std::shared_mutex errorsMutex;
+
+        // Symbol index powering document symbols, code completion and any
+        // other request that needs the full symbol listing. Indexing a
+        // document means compiling it, so the index is built off the request
+        // path by a background task scheduled alongside validation; requests
+        // against an already-indexed text are then served from memory.
+        std::unordered_map<
+            std::size_t,
+            std::shared_ptr<std::pair<std::string, std::vector<lc::document_symbols>>>
+        > symbolsByDocumentId;
+        std::shared_mutex symbolIndexMutex;
+
+        // Most recent use of each document's caches; when the process
+        // exceeds the configured memory ceiling, the caches of the
+        // least-recently-used documents are shed first:
+        std::unordered_map<
+            std::size_t,
+            std::chrono::steady_clock::time_point
+        > cacheAccessByDocumentId;
+        std::shared_mutex cacheAccessMutex;
+
         std::atomic_bool clientSupportsGotoDefinition = false;
         std::atomic_bool clientSupportsGotoDefinitionLinks = false;
         std::atomic_bool clientSupportsDocumentSymbols = false;
@@ -75,6 +107,7 @@ namespace LCompilers::LanguageServerProtocol {
         std::atomic_bool clientSupportsCodeCompletionContext = false;
         std::atomic_bool clientSupportsFormatting = false;
         std::atomic_bool clientSupportsRangeFormatting = false;
+        std::atomic_bool clientSupportsFoldingRanges = false;
 
         auto formatException(
             const std::string &heading,
@@ -116,10 +149,27 @@ namespace LCompilers::LanguageServerProtocol {
             LspTextDocument &document
         ) -> std::shared_ptr<std::pair<std::vector<FortranToken>, int>>;
 
+        auto touchDocumentCaches(std::size_t documentId) -> void;
+
+        auto reduceMemoryPressure() -> void;
+
+        auto computeFoldingRanges(
+            LspTextDocument &document,
+            const std::vector<FortranToken> &highlights
+        ) -> std::vector<FoldingRange>;
+
         virtual auto updateHighlights(
             std::shared_ptr<LspTextDocument> document
         ) -> void = 0;
 
+        auto getSymbolIndex(
+            LspTextDocument &document
+        ) -> std::shared_ptr<std::pair<std::string, std::vector<lc::document_symbols>>>;
+
+        virtual auto updateSymbolIndex(
+            std::shared_ptr<LspTextDocument> document
+        ) -> void = 0;
+
         auto getLFortranConfig(
             const DocumentUri &uri
         ) -> const std::shared_ptr<lsc::LFortranLspConfig>;
@@ -184,6 +234,11 @@ namespace LCompilers::LanguageServerProtocol {
             SemanticTokensParams &params
         ) -> TextDocument_SemanticTokens_FullResult override;
 
+        auto receiveTextDocument_foldingRange(
+            const RequestMessage &request,
+            FoldingRangeParams &params
+        ) -> TextDocument_FoldingRangeResult override;
+
         auto receiveTextDocument_completion(
             const RequestMessage &request,
             CompletionParams &params
@@ -1,8 +1,10 @@
 #include "bin/semantic_highlighter.h"
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include <server/lsp_exception.h>
 #include <server/lsp_specification.h>
@@ -103,6 +105,19 @@ namespace LCompilers::LanguageServerProtocol {
                 auto readLock = LSP_READ_LOCK(document->mutex(), "document:" + document->uri());
                 const std::string &uri = document->uri();
                 readLock.unlock();
+                // Wait for the document to settle before validating it;
+                // subsequent changes within the window cancel this task and
+                // coalesce into the validation they schedule:
+                unsigned int debounceMs = getLFortranConfig(uri)->validationDebounceMs;
+                if (debounceMs > 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(debounceMs));
+                    if (!*taskIsRunning) {
+                        logger.trace()  //<- trace instead of debug because this will happen often
+                            << "Validation canceled while debouncing."
+                            << std::endl;
+                        return;
+                    }
+                }
                 LFortranLspLanguageServer::validate(*document, *taskIsRunning);
                 readLock.lock();
                 auto writeLock = LSP_WRITE_LOCK(validationMutex, "validation");
@@ -161,4 +176,19 @@ namespace LCompilers::LanguageServerProtocol {
             });
     }
 
+    auto ParallelLFortranLspLanguageServer::updateSymbolIndex(
+        std::shared_ptr<LspTextDocument> document
+    ) -> void {
+        workerPool.execute([this, document = std::move(document)](
+            std::shared_ptr<std::atomic_bool> taskIsRunning
+        ) {
+            if (!*taskIsRunning) {
+                return;
+            }
+            // getSymbolIndex caches its result, so by the time an interactive
+            // request needs the index it is already built:
+            getSymbolIndex(*document);
+        });
+    }
+
 } // namespace LCompilers::LanguageServerProtocol
@@ -55,6 +55,10 @@ namespace LCompilers::LanguageServerProtocol {
         auto updateHighlights(
             std::shared_ptr<LspTextDocument> document
         ) -> void override;
+
+        auto updateSymbolIndex(
+            std::shared_ptr<LspTextDocument> document
+        ) -> void override;
     }; // class ParallelLFortranLspLanguageServer
 
 } // namespace LCompilers::LanguageServerProtocol
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <chrono>
+#include <lfortran/parser/parser.h>
+
+// Benchmarks the fixed-form tokenizer against the free-form one on
+// equivalent generated code: N copies of the same small subroutine,
+// written once in free-form and once in fixed-form layout. Reports the
+// prescan and tokenize+parse time of both variants.
+
+namespace {
+
+std::string construct_free(int N)
+{
+    std::string text;
+    for (int i = 0; i < N; i++) {
+        text.append("subroutine g" + std::to_string(i) + R"(
+    integer :: x, i
+    x = 1
+    do i = 1, 10
+        x = x*i
+    end do
+end subroutine
+
+)");
+    }
+    return text;
+}
+
+std::string construct_fixed(int N)
+{
+    std::string text;
+    for (int i = 0; i < N; i++) {
+        text.append("      subroutine g" + std::to_string(i) + R"(
+      integer x, i
+      x = 1
+      do 10 i = 1, 10
+      x = x*i
+   10 continue
+      end
+
+)");
+    }
+    return text;
+}
+
+int bench(const std::string &label, const std::string &text, bool fixed_form)
+{
+    Allocator al(64*1024*1024);
+    LCompilers::diag::Diagnostics diagnostics;
+    LCompilers::CompilerOptions co;
+    co.fixed_form = fixed_form;
+    LCompilers::LocationManager lm;
+    {
+        LCompilers::LocationManager::FileLocations fl;
+        fl.in_filename = "bench";
+        lm.files.push_back(fl);
+    }
+    std::vector<std::filesystem::path> include_dirs;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    std::string code = LCompilers::LFortran::prescan(text, lm, fixed_form,
+        include_dirs);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto result = LCompilers::LFortran::parse(al, code, diagnostics, co);
+    auto t3 = std::chrono::high_resolution_clock::now();
+    if (!result.ok) {
+        std::cout << label << ": parse failed" << std::endl;
+        return 1;
+    }
+    std::cout << label << std::endl;
+    std::cout << "  Number of units: " << result.result->n_items << std::endl;
+    std::cout << "  Prescan:         " <<
+        std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count()
+        << "ms" << std::endl;
+    std::cout << "  Tokenize+parse:  " <<
+        std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count()
+        << "ms" << std::endl;
+    std::cout << "  String size (bytes):     " << text.size() << std::endl;
+    std::cout << "  Allocator usage (bytes): " << al.size_current() << std::endl;
+    std::cout << "  Allocator chunks: " << al.num_chunks() << std::endl;
+    return 0;
+}
+
+} // anonymous namespace
+
+int main()
+{
+    int N = 10000;
+    std::cout << "Construct" << std::endl;
+    std::string free_form_text = construct_free(N);
+    std::string fixed_form_text = construct_fixed(N);
+    int ret = bench("Free-form", free_form_text, false);
+    ret += bench("Fixed-form", fixed_form_text, true);
+    return ret;
+}
@@ -316,7 +316,7 @@ public:
                 }
             }
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Module(const Module_t &x) {
@@ -344,7 +344,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_Submodule(const Submodule_t &x) {
         std::string r = "";
@@ -404,7 +404,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_BlockData(const BlockData_t &x) {
@@ -450,7 +450,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Program(const Program_t &x) {
@@ -477,7 +477,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Subroutine(const Subroutine_t &x) {
@@ -522,7 +522,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Procedure(const Procedure_t &x) {
@@ -562,7 +562,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_DerivedType(const DerivedType_t &x) {
@@ -616,7 +616,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_DerivedTypeProc(const DerivedTypeProc_t &x) {
         std::string r;
@@ -645,7 +645,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_GenericOperator(const GenericOperator_t &x) {
         std::string r;
@@ -668,7 +668,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_GenericDefinedOperator(const GenericDefinedOperator_t &x) {
         std::string r;
@@ -695,7 +695,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_GenericAssignment(const GenericAssignment_t &x) {
         std::string r;
@@ -717,7 +717,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_GenericName(const GenericName_t &x) {
         std::string r;
@@ -741,7 +741,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_GenericWrite(const GenericWrite_t &x) {
@@ -768,7 +768,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_GenericRead(const GenericRead_t &x) {
@@ -795,7 +795,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_FinalName(const FinalName_t &x) {
@@ -809,7 +809,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Private(const Private_t &x) {
@@ -822,7 +822,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Enum(const Enum_t & x) {
@@ -857,7 +857,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Interface(const Interface_t &x) {
@@ -891,7 +891,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_InterfaceHeader(const InterfaceHeader_t &/* x */) {
@@ -957,14 +957,14 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_InterfaceProc(const InterfaceProc_t &x) {
         std::string r;
         this->visit_program_unit(*x.m_proc);
         r.append(s);
-        s = r;
+        s = std::move(r);
     }
 
     template <typename T>
@@ -1097,7 +1097,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Use(const Use_t &x) {
@@ -1133,7 +1133,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Import(const Import_t &x) {
@@ -1172,7 +1172,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ImplicitNone(const ImplicitNone_t &x) {
@@ -1194,7 +1194,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ImplicitNoneExternal(const ImplicitNoneExternal_t &/*x*/) {
@@ -1222,7 +1222,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
      void visit_ImplicitSpec(const ImplicitSpec_t &x) {
@@ -1238,7 +1238,7 @@ public:
             }
             r += ")";
         }
-	s = r;
+	s = std::move(r);
     }
 
     void visit_LetterSpec(const LetterSpec_t &x) {
@@ -1248,7 +1248,7 @@ public:
             r += "-";
         }
         r += x.m_end;
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Declaration(const Declaration_t &x) {
@@ -1311,7 +1311,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_var_sym(const var_sym_t &x) {
@@ -1372,7 +1372,7 @@ public:
             this->visit_decl_attribute(*x.m_spec);
             r.append(s);
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_DataStmt(const DataStmt_t &x) {
@@ -1401,7 +1401,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_DataImpliedDo(const DataImpliedDo_t &x) {
@@ -1431,7 +1431,7 @@ public:
             r.append(s);
         }
         r += ")";
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -1469,7 +1469,7 @@ public:
 	    }
 	    if (i < x.n_blks - 1) r.append(", ");
 	}
-	s = r;
+	s = std::move(r);
     }
 
     void visit_AttrEquivalence(const AttrEquivalence_t &x) {
@@ -1482,7 +1482,7 @@ public:
             r.append(s);
             if (i < x.n_args-1) r.append(", ");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_equi(const equi_t &x) {
@@ -1494,7 +1494,7 @@ public:
             if (i < x.n_set_list-1) r.append(", ");
         }
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 #define ATTRTYPE(x) \
             case (simple_attributeType::Attr##x) : \
@@ -1538,7 +1538,7 @@ public:
                 throw LCompilersException("Attribute type not implemented");
         }
         r += syn();
-        s = r;
+        s = std::move(r);
     }
 
 #define ATTRTYPE2(x, y) \
@@ -1624,7 +1624,7 @@ public:
         } else if(x.m_sym == symbolType::DoubleAsterisk){
             r.append("*(*)");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_kind_item(const kind_item_t &x) {
@@ -1634,7 +1634,7 @@ public:
             r.append("=");
         }
         r += kind_value(x.m_type, x.m_value);
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrIntent(const AttrIntent_t &x) {
@@ -1660,7 +1660,7 @@ public:
         }
         r += syn();
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrBind(const AttrBind_t &x) {
@@ -1675,7 +1675,7 @@ public:
         r += "(";
         r.append(x.m_name);
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrDimension(const AttrDimension_t &x) {
@@ -1692,7 +1692,7 @@ public:
             }
             r += ")";
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrCodimension(const AttrCodimension_t &x) {
@@ -1709,7 +1709,7 @@ public:
             }
             r += "]";
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrPass(const AttrPass_t &x) {
@@ -1722,7 +1722,7 @@ public:
             r.append(x.m_name);
             r += ")";
         }
-        s = r;
+        s = std::move(r);
     }
     void visit_AttrAssignment(const AttrAssignment_t &/*x*/) {
         s = "assignment (=)";
@@ -1744,14 +1744,14 @@ public:
         std::string r;
         r = "stat = ";
         r.append(x.m_variable);
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrErrmsg(const AttrErrmsg_t &x) {
         std::string r;
         r = "errmsg = ";
         r.append(x.m_variable);
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrNewIndex(const AttrNewIndex_t &x) {
@@ -1759,7 +1759,7 @@ public:
         r = "new_index = ";
         this->visit_expr(*x.m_value);
         r.append(s);
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AttrEventWaitKwArg(const AttrEventWaitKwArg_t &x) {
@@ -1768,7 +1768,7 @@ public:
         r += " = ";
         this->visit_expr(*x.m_value);
         r.append(s);
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Assign(const Assign_t &x) {
@@ -1783,7 +1783,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Assignment(const Assignment_t &x) {
@@ -1799,7 +1799,7 @@ public:
         } else {
             r += "\n";
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_InferAssignment(const InferAssignment_t &x) {
@@ -1815,7 +1815,7 @@ public:
         } else {
             r += "\n";
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_GoTo(const GoTo_t &x) {
@@ -1849,7 +1849,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Associate(const Associate_t &x) {
@@ -1865,7 +1865,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SubroutineCall(const SubroutineCall_t &x) {
@@ -1934,7 +1934,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Allocate(const Allocate_t &x) {
@@ -1973,7 +1973,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Deallocate(const Deallocate_t &x) {
@@ -2012,7 +2012,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_If(const If_t &x) {
@@ -2068,7 +2068,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_IfArithmetic(const IfArithmetic_t &x) {
@@ -2090,7 +2090,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Where(const Where_t &x) {
@@ -2141,7 +2141,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Entry(const Entry_t &x) {
@@ -2179,7 +2179,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Stop(const Stop_t &x) {
@@ -2201,7 +2201,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ErrorStop(const ErrorStop_t &x) {
@@ -2223,7 +2223,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_EventPost(const EventPost_t &x) {
@@ -2248,7 +2248,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_EventWait(const EventWait_t &x) {
@@ -2274,7 +2274,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SyncAll(const SyncAll_t &x) {
@@ -2297,7 +2297,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SyncImages(const SyncImages_t &x) {
@@ -2326,7 +2326,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SyncMemory(const SyncMemory_t &x) {
@@ -2349,7 +2349,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SyncTeam(const SyncTeam_t &x) {
@@ -2373,7 +2373,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_DoLoop(const DoLoop_t &x) {
@@ -2423,7 +2423,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ImpliedDoLoop(const ImpliedDoLoop_t &x) {
@@ -2447,7 +2447,7 @@ public:
             r.append(s);
         }
         r.append(")");
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -2467,7 +2467,7 @@ public:
             visit_expr(*x.m_initializer);
             r += " => " + s;
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_AssociateBlock(const AssociateBlock_t &x) {
@@ -2504,7 +2504,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Block(const Block_t &x) {
@@ -2544,7 +2544,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ChangeTeam(const ChangeTeam_t &x) {
@@ -2600,7 +2600,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_CoarrayAssociation(const CoarrayAssociation_t &x) {
@@ -2610,7 +2610,7 @@ public:
         r += " => ";
         this->visit_expr(*x.m_selector);
         r.append(s);
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Critical(const Critical_t &x) {
@@ -2649,7 +2649,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_DoConcurrentLoop(const DoConcurrentLoop_t &x) {
@@ -2712,7 +2712,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ForAll(const ForAll_t &x) {
@@ -2759,7 +2759,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ForAllSingle(const ForAllSingle_t &x) {
@@ -2796,7 +2796,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ConcurrentControl(const ConcurrentControl_t &x) {
@@ -2819,7 +2819,7 @@ public:
             this->visit_expr(*x.m_increment);
             r.append(s);
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ConcurrentLocal(const ConcurrentLocal_t &x) {
@@ -2830,7 +2830,7 @@ public:
             if (i < x.n_vars-1) r.append(", ");
         }
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ConcurrentLocalInit(const ConcurrentLocalInit_t &x) {
@@ -2841,7 +2841,7 @@ public:
             if (i < x.n_vars-1) r.append(", ");
         }
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ConcurrentShared(const ConcurrentShared_t &x) {
@@ -2852,13 +2852,13 @@ public:
             if (i < x.n_vars-1) r.append(", ");
         }
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ConcurrentDefault(const ConcurrentDefault_t &/* x */ ) {
         std::string r;
         r += " default(none)";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ConcurrentReduce(const ConcurrentReduce_t &x) {
@@ -2869,7 +2869,7 @@ public:
             if (i < x.n_vars-1) r.append(", ");
         }
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     inline std::string visit_reduce_opType(const reduce_opType &x) {
@@ -2899,7 +2899,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Continue(const Continue_t &x) {
@@ -2913,7 +2913,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Exit(const Exit_t &x) {
@@ -2928,7 +2928,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Return(const Return_t &x) {
@@ -2946,7 +2946,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_WhileLoop(const WhileLoop_t &x) {
@@ -2980,7 +2980,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Print(const Print_t &x) {
@@ -3009,7 +3009,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Write(const Write_t &x) {
@@ -3053,7 +3053,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Read(const Read_t &x) {
@@ -3109,7 +3109,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Close(const Close_t &x) {
@@ -3137,7 +3137,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Open(const Open_t &x) {
@@ -3165,7 +3165,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Inquire(const Inquire_t &x) {
@@ -3201,7 +3201,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Rewind(const Rewind_t &x) {
@@ -3229,7 +3229,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Nullify(const Nullify_t &x) {
@@ -3257,7 +3257,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Backspace(const Backspace_t &x) {
@@ -3285,7 +3285,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Flush(const Flush_t &x) {
@@ -3313,7 +3313,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Endfile(const Endfile_t &x) {
@@ -3341,7 +3341,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Include(const Include_t& x)
@@ -3359,7 +3359,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     template <typename Node>
@@ -3401,7 +3401,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_FormTeam(const FormTeam_t &x) {
@@ -3427,7 +3427,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_BoolOp(const BoolOp_t &x) {
@@ -3682,7 +3682,7 @@ public:
             if (i < x.n_subargs-1) r.append(", ");
             r.append(")");
         }
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -3755,7 +3755,7 @@ public:
             if (i < x.n_cokw-1) r.append(", ");
         }
         r.append("]");
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -3775,7 +3775,7 @@ public:
             if (i < x.n_args-1) r.append(", ");
         }
         r.append("]");
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -3795,7 +3795,7 @@ public:
         this->visit_expr(*x.m_operand);
         r.append(s);
         r += ")";
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -3841,7 +3841,7 @@ public:
             if (i < x.n_args-1) r.append(", ");
         }
         r.append(")");
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -3864,7 +3864,7 @@ public:
         r.append(s);
         r += ")";
         r += syn();
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -3909,7 +3909,7 @@ public:
             }
         }
         r.append(std::string(x.m_id));
-        s = r;
+        s = std::move(r);
         last_expr_precedence = 13;
     }
 
@@ -4021,7 +4021,7 @@ public:
         r += "=";
         this->visit_expr(*x.m_value);
         r += s;
-        s = r;
+        s = std::move(r);
     }
 
     void visit_fnarg(const fnarg_t &x) {
@@ -4051,7 +4051,7 @@ public:
             this->visit_expr(*x.m_end);
             r = s;
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_coarrayarg(const coarrayarg_t &x) {
@@ -4085,7 +4085,7 @@ public:
             this->visit_expr(*x.m_end);
             r = s;
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_Bind(const Bind_t &x) {
@@ -4105,7 +4105,7 @@ public:
             if (i < x.n_kwargs-1) r.append(", ");
         }
         r += ")";
-        s = r;
+        s = std::move(r);
     }
 
     void visit_ArrayIndex(const ArrayIndex_t &x) {
@@ -4124,7 +4124,7 @@ public:
             this->visit_expr(*x.m_step);
             r += s;
         };
-        s = r;
+        s = std::move(r);
     }
 
     void visit_UseSymbol(const UseSymbol_t &x) {
@@ -4209,7 +4209,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_CaseStmt(const CaseStmt_t &x) {
@@ -4235,7 +4235,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
 
     void visit_CaseCondExpr(const CaseCondExpr_t &x) {
@@ -4253,7 +4253,7 @@ public:
             this->visit_expr(*x.m_end);
             r += s;
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_CaseStmt_Default(const CaseStmt_Default_t &x) {
@@ -4272,7 +4272,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SelectRank(const SelectRank_t &x) {
@@ -4310,7 +4310,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_RankExpr(const RankExpr_t &x) {
@@ -4333,7 +4333,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
 
     void visit_RankStar(const RankStar_t &x) {
@@ -4353,7 +4353,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
 
     void visit_RankDefault(const RankDefault_t &x) {
@@ -4372,7 +4372,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
 
     void visit_SelectType(const SelectType_t &x) {
@@ -4409,7 +4409,7 @@ public:
         } else {
             r.append("\n");
         }
-        s = r;
+        s = std::move(r);
     }
 
     void visit_TypeStmtName(const TypeStmtName_t &x) {
@@ -4433,7 +4433,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
     void visit_TypeStmtType(const TypeStmtType_t &x) {
         std::string r = indent;
@@ -4457,7 +4457,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
     void visit_ClassStmt(const ClassStmt_t &x) {
         std::string r = indent;
@@ -4480,7 +4480,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
     void visit_ClassDefault(const ClassDefault_t &x) {
         std::string r = indent;
@@ -4498,7 +4498,7 @@ public:
             r += s;
         }
         dec_indent();
-        s = r;
+        s = std::move(r);
     }
 };
 
@@ -4508,7 +4508,7 @@ std::string ast_to_src(AST::TranslationUnit_t &ast, bool color, int indent,
         bool indent_unit) {
     AST::ASTToSRCVisitor v(color, indent, indent_unit);
     v.visit_ast((AST::ast_t &)ast);
-    return v.s;
+    return std::move(v.s);
 }
 
 } // namespace LCompilers::LFortran
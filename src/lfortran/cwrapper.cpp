@@ -7,6 +7,13 @@
 #include <lfortran/parser/parser.h>
 #include <lfortran/pickle.h>
 
+#ifdef HAVE_LFORTRAN_LLVM
+#include <mutex>
+
+#include <lfortran/fortran_evaluator.h>
+#include <libasr/codegen/evaluator.h>
+#endif
+
 
 extern "C" {
 
@@ -90,4 +97,91 @@ lfortran_exceptions_t lfortran_str_free(char *str)
 }
 
 
+#ifdef HAVE_LFORTRAN_LLVM
+
+static LCompilers::CompilerOptions session_options()
+{
+    LCompilers::CompilerOptions co;
+    co.interactive = true;
+    return co;
+}
+
+struct LFortranCSession {
+    // FortranEvaluator keeps a reference to the options, so the session must
+    // own them at a stable address
+    LCompilers::CompilerOptions compiler_options;
+    LCompilers::FortranEvaluator e;
+    std::mutex mutex;
+    LFortranCSession() : compiler_options{session_options()},
+        e{compiler_options} {}
+};
+
+LFortranCSession *lfortran_session_new()
+{
+    // Serialize session construction: the JIT initializes process-wide LLVM
+    // state on first use
+    static std::mutex new_mutex;
+    std::lock_guard<std::mutex> lock(new_mutex);
+    return new LFortranCSession;
+}
+
+void lfortran_session_free(LFortranCSession *self)
+{
+    delete self;
+}
+
+lfortran_exceptions_t lfortran_session_eval(LFortranCSession *self,
+        const char *input)
+{
+    CWRAPPER_BEGIN
+
+    std::lock_guard<std::mutex> lock(self->mutex);
+    LCompilers::Result<LCompilers::FortranEvaluator::EvalResult> res
+        = self->e.evaluate2(input);
+    if (!res.ok) {
+        // evaluate2 fails for any stage (parsing, semantics, codegen), so
+        // report a generic compile error rather than a parser error
+        return LFORTRAN_COMPILE_ERROR;
+    }
+
+    CWRAPPER_END
+}
+
+lfortran_exceptions_t lfortran_session_get_function(LFortranCSession *self,
+        const char *name, void **fn)
+{
+    CWRAPPER_BEGIN
+
+    std::lock_guard<std::mutex> lock(self->mutex);
+    *fn = (void*)self->e.get_llvm_evaluator().get_symbol_address(name);
+
+    CWRAPPER_END
+}
+
+#else
+
+LFortranCSession *lfortran_session_new()
+{
+    return nullptr;
+}
+
+void lfortran_session_free(LFortranCSession * /*self*/)
+{
+}
+
+lfortran_exceptions_t lfortran_session_eval(LFortranCSession * /*self*/,
+        const char * /*input*/)
+{
+    return LFORTRAN_RUNTIME_ERROR;
+}
+
+lfortran_exceptions_t lfortran_session_get_function(
+        LFortranCSession * /*self*/, const char * /*name*/, void ** /*fn*/)
+{
+    return LFORTRAN_RUNTIME_ERROR;
+}
+
+#endif // HAVE_LFORTRAN_LLVM
+
+
 } // extern "C"
@@ -35,6 +35,24 @@ lfortran_exceptions_t lfortran_parser_pickle(lfortran_ast_t* ast,
 lfortran_exceptions_t lfortran_str_free(char *str);
 
 
+// Session-based batch evaluation API. A session holds compiler and JIT state
+// across calls: submit many sources with lfortran_session_eval() (later
+// sources can reference symbols defined by earlier ones) and retrieve
+// addresses of compiled functions with lfortran_session_get_function().
+// Every call on a session is internally synchronized, and independent
+// sessions can be used concurrently from different threads.
+// Requires an LLVM-enabled build; lfortran_session_new() returns NULL
+// otherwise.
+typedef struct LFortranCSession LFortranCSession;
+
+LFortranCSession *lfortran_session_new();
+void lfortran_session_free(LFortranCSession *self);
+lfortran_exceptions_t lfortran_session_eval(LFortranCSession *self,
+        const char *input);
+lfortran_exceptions_t lfortran_session_get_function(LFortranCSession *self,
+        const char *name, void **fn);
+
+
 #ifdef __cplusplus
 }
 #endif
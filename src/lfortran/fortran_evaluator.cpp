@@ -18,6 +18,7 @@
 #include <lfortran/pickle.h>
 #include <libasr/pickle.h>
 #include <libasr/utils.h>
+#include <libasr/profiler.h>
 #include <libasr/asr_lookup_name.h>
 
 
@@ -56,7 +57,16 @@ FortranEvaluator::~FortranEvaluator() = default;
 #ifdef HAVE_LFORTRAN_LLVM
 LLVMEvaluator &FortranEvaluator::get_llvm_evaluator() {
     if (!e) {
-        e = std::make_unique<LLVMEvaluator>(compiler_options.target);
+        e = std::make_unique<LLVMEvaluator>(compiler_options.target,
+            compiler_options.po.fast);
+        if (!compiler_options.object_cache_dir.empty()) {
+            e->set_object_cache_dir(compiler_options.object_cache_dir);
+        }
+        if (compiler_options.profile_generate
+                || !compiler_options.profile_use.empty()) {
+            e->set_pgo(compiler_options.profile_generate,
+                compiler_options.profile_use);
+        }
     }
     return *e;
 }
@@ -119,6 +129,70 @@ Result<FortranEvaluator::EvalResult> FortranEvaluator::evaluate(
         result.asr = pickle(*asr, true, false, false, false);
     }
 
+    // Interpreter tier: a snippet that is a single expression already
+    // folded to a constant by the compile-time evaluator needs no
+    // codegen at all, so answer straight from the ASR value. This keeps
+    // the first response for small interactive inputs well under the
+    // LLVM JIT setup cost.
+    if (!verbose && asr->n_items == 1 &&
+            asr->m_items[0]->type == ASR::asrType::expr) {
+        ASR::expr_t *value = ASRUtils::expr_value(ASRUtils::EXPR(asr->m_items[0]));
+        if (value != nullptr) {
+            bool handled = true;
+            if (ASR::is_a<ASR::IntegerConstant_t>(*value)) {
+                ASR::IntegerConstant_t *c = ASR::down_cast<ASR::IntegerConstant_t>(value);
+                int kind = ASRUtils::extract_kind_from_ttype_t(c->m_type);
+                if (kind == 4) {
+                    result.type = EvalResult::integer4;
+                    result.i32 = c->m_n;
+                } else if (kind == 8) {
+                    result.type = EvalResult::integer8;
+                    result.i64 = c->m_n;
+                } else {
+                    handled = false;
+                }
+            } else if (ASR::is_a<ASR::RealConstant_t>(*value)) {
+                ASR::RealConstant_t *c = ASR::down_cast<ASR::RealConstant_t>(value);
+                int kind = ASRUtils::extract_kind_from_ttype_t(c->m_type);
+                if (kind == 4) {
+                    result.type = EvalResult::real4;
+                    result.f32 = c->m_r;
+                } else if (kind == 8) {
+                    result.type = EvalResult::real8;
+                    result.f64 = c->m_r;
+                } else {
+                    handled = false;
+                }
+            } else if (ASR::is_a<ASR::ComplexConstant_t>(*value)) {
+                ASR::ComplexConstant_t *c = ASR::down_cast<ASR::ComplexConstant_t>(value);
+                int kind = ASRUtils::extract_kind_from_ttype_t(c->m_type);
+                if (kind == 4) {
+                    result.type = EvalResult::complex4;
+                    result.c32.re = c->m_re;
+                    result.c32.im = c->m_im;
+                } else if (kind == 8) {
+                    result.type = EvalResult::complex8;
+                    result.c64.re = c->m_re;
+                    result.c64.im = c->m_im;
+                } else {
+                    handled = false;
+                }
+            } else if (ASR::is_a<ASR::LogicalConstant_t>(*value)) {
+                result.type = EvalResult::boolean;
+                result.b = ASR::down_cast<ASR::LogicalConstant_t>(value)->m_value;
+            } else {
+                handled = false;
+            }
+            if (handled) {
+                // the item is fully consumed; drop it so the next
+                // snippet's wrap pass does not evaluate it again
+                asr->m_items = nullptr;
+                asr->n_items = 0;
+                return result;
+            }
+        }
+    }
+
     // ASR -> LLVM
     Result<std::unique_ptr<LLVMModule>> res3 = get_llvm3(*asr,
         pass_manager, diagnostics, lm, lm.files.back().in_filename,
@@ -246,6 +320,7 @@ Result<LFortran::AST::TranslationUnit_t*> FortranEvaluator::get_ast2(
         tmp = LFortran::prescan(*code, lm, compiler_options.fixed_form, include_dirs);
         code = &tmp;
     }
+    ProfileScope profile_scope(compiler_options.po, "parse", &al);
     Result<LFortran::AST::TranslationUnit_t*>
         res = LFortran::parse(al, *code, diagnostics, compiler_options);
     if (res.ok) {
@@ -312,13 +387,14 @@ Result<ASR::TranslationUnit_t*> FortranEvaluator::get_asr3(
     LFortran::AST::TranslationUnit_t &ast, diag::Diagnostics &diagnostics, LCompilers::LocationManager &lm)
 {
     ASR::TranslationUnit_t* asr;
+    ProfileScope profile_scope(compiler_options.po, "ast_to_asr", &al);
     // AST -> ASR
     // Remove the old execution function if it exists
     if (symbol_table) {
         if (symbol_table->get_symbol(run_fn) != nullptr) {
             symbol_table->erase_symbol(run_fn);
         }
-        symbol_table->mark_all_variables_external(al);
+        symbol_table->mark_all_variables_external(al, frozen_symbols);
     }
     auto res = LFortran::ast_to_asr(al, ast, diagnostics, symbol_table,
         compiler_options.symtab_only, compiler_options, lm);
@@ -400,20 +476,34 @@ Result<std::unique_ptr<LLVMModule>> FortranEvaluator::get_llvm3(
 
     // ASR -> LLVM
     std::unique_ptr<LCompilers::LLVMModule> m;
-    Result<std::unique_ptr<LCompilers::LLVMModule>> res
-        = asr_to_llvm(asr, diagnostics,
-            get_llvm_evaluator().get_context(), al, pass_manager,
-            compiler_options, run_fn, "", infile, lm);
-    if (res.ok) {
-        m = std::move(res.result);
-    } else {
-        LCOMPILERS_ASSERT(diagnostics.has_error())
-        return res.error;
+    {
+        ProfileScope profile_scope(compiler_options.po, "asr_to_llvm", &al);
+        Result<std::unique_ptr<LCompilers::LLVMModule>> res
+            = asr_to_llvm(asr, diagnostics,
+                get_llvm_evaluator().get_context(), al, pass_manager,
+                compiler_options, run_fn, "", infile, lm);
+        if (res.ok) {
+            m = std::move(res.result);
+        } else {
+            LCOMPILERS_ASSERT(diagnostics.has_error())
+            return res.error;
+        }
     }
 
-    if (compiler_options.po.fast) {
+    // PGO needs the LLVM pipeline even without --fast: instrumentation is
+    // inserted by it, and a profile is only consumed by it.
+    if (compiler_options.po.fast || compiler_options.profile_generate
+            || !compiler_options.profile_use.empty()) {
         auto t1 = std::chrono::high_resolution_clock::now();
-        get_llvm_evaluator().opt(*m->m_m);
+        {
+            ProfileScope profile_scope(compiler_options.po, "llvm_opt");
+            if (compiler_options.po.pass_jobs > 1) {
+                get_llvm_evaluator().opt_parallel(m->m_m,
+                    compiler_options.po.pass_jobs);
+            } else {
+                get_llvm_evaluator().opt(*m->m_m);
+            }
+        }
         auto t2 = std::chrono::high_resolution_clock::now();
         if (compiler_options.po.time_report && time_opt) {
             *time_opt = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
@@ -576,6 +666,12 @@ Result<std::unique_ptr<MLIRModule>> FortranEvaluator::get_mlir(
     LCompilers::PassManager pass_manager;
     if (ASR::is_a<ASR::unit_t>(asr)) {
         pass_manager.use_default_passes();
+        // Keep DoLoop structured for the MLIR backend: it lowers loops
+        // either to affine.for (so MLIR's loop optimizations apply) or
+        // to its own CFG, instead of the do_loops ASR pass rewriting
+        // them into while loops first
+        std::string mlir_pass_arg = "", mlir_skip_arg = "do_loops";
+        pass_manager.parse_pass_arg(mlir_pass_arg, mlir_skip_arg);
         pass_manager.apply_passes(al, (ASR::TranslationUnit_t *)&asr,
             compiler_options.po, diagnostics);
     }
@@ -615,6 +711,25 @@ Result<std::string> FortranEvaluator::get_fortran(const std::string &code,
     }
 }
 
+Result<std::vector<FortranProgramUnit>> FortranEvaluator::get_fortran_units(
+    const std::string &code, LocationManager &lm, diag::Diagnostics &diagnostics)
+{
+    // SRC -> AST -> ASR -> Fortran, one program unit at a time
+    SymbolTable *old_symbol_table = symbol_table;
+    symbol_table = nullptr;
+    Result<ASR::TranslationUnit_t*> asr = get_asr2(code, lm, diagnostics);
+    symbol_table = old_symbol_table;
+    if (asr.ok) {
+        LCompilers::PassManager pass_manager;
+        pass_manager.use_fortran_passes();
+        pass_manager.apply_passes(al, asr.result, compiler_options.po, diagnostics);
+        return asr_to_fortran_units(*asr.result, diagnostics, false, 4);
+    } else {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return asr.error;
+    }
+}
+
 Result<std::string> FortranEvaluator::get_fmt(const std::string &code,
     LocationManager &lm, diag::Diagnostics &diagnostics)
 {
@@ -13,6 +13,7 @@
 #include <libasr/diagnostics.h>
 #include <libasr/pass/pass_manager.h>
 #include <libasr/utils.h>
+#include <libasr/codegen/asr_to_fortran.h>
 
 namespace LCompilers {
 
@@ -112,6 +113,9 @@ public:
         ASR::asr_t &asr, diag::Diagnostics &diagnostics);
     Result<std::string> get_fortran(const std::string &code,
         LocationManager &lm, diag::Diagnostics &diagnostics);
+    Result<std::vector<FortranProgramUnit>> get_fortran_units(
+        const std::string &code, LocationManager &lm,
+        diag::Diagnostics &diagnostics);
     Result<std::string> get_fmt(const std::string &code, LocationManager &lm,
         diag::Diagnostics &diagnostics);
     Allocator &get_al() { return al; };
@@ -126,6 +130,10 @@ private:
     int eval_count;
 #endif
     SymbolTable *symbol_table;
+    // Symbols from earlier cells that were already frozen (marked
+    // external); lets each cell's externalization walk skip prior cells
+    // instead of re-walking the whole session
+    std::unordered_set<ASR::symbol_t*> frozen_symbols;
     std::string run_fn;
 };
 
@@ -295,8 +295,6 @@ const std::vector<std::string> declarators{
             "class"
         };
 
-std::vector<std::string> lines{};
-
 std::vector<std::string> io_names{ "open",  "read",    "write",  "format", "close",
                                    "print", "inquire", "rewind", "flush" };
 
@@ -386,7 +384,6 @@ struct FixedFormRecursiveDescent {
         std::string label;
         label.assign((char*)cur, reserved_cols);
         if (is_integer(label)) {
-            lines.push_back(label);
             YYSTYPE y;
             std::string::iterator end = std::remove(label.begin(), label.end(), ' ');
             label.erase(end, label.end());
@@ -471,7 +468,17 @@ struct FixedFormRecursiveDescent {
     void push_token_no_advance(unsigned char *cur, const std::string &token_str) {
 	auto it = identifier_token_map().find(token_str);
 	LCOMPILERS_ASSERT(it != identifier_token_map().end());
-        push_token_no_advance_token(cur, token_str, it->second);
+        YYSTYPE yy;
+        // The map is a function-local static, so its keys outlive all
+        // tokens; no arena copy of the keyword text is needed
+        yy.string.p = const_cast<char*>(it->first.data());
+        yy.string.n = it->first.size();
+        stypes.push_back(yy);
+        tokens.push_back(it->second);
+        Location loc;
+        loc.first = cur - string_start;
+        loc.last = cur - string_start + token_str.size();
+        locations.push_back(loc);
     }
 
     void push_integer_no_advance(unsigned char *cur, int32_t n) {
@@ -743,9 +750,6 @@ struct FixedFormRecursiveDescent {
      */
     void tokenize_until(unsigned char *end) {
         LCOMPILERS_ASSERT(t.cur < end)
-        // TODO: Is this needed?
-        std::string line{tostr(t.cur, end)};
-        lines.push_back(line);
         Location loc;
         ptrdiff_t len;
         while (t.cur < end) {
@@ -771,8 +775,10 @@ struct FixedFormRecursiveDescent {
                 // token_logical_kind() already extracted the kind suffix
                 // into y2.string; preserve it.
             } else {
-                std::string tk{tostr(t.tok, t.tok + len)};
-                y2.string.from_str(m_a, tk);
+                // Point into the tokenizer's buffer, like the free-form
+                // tokenizer's token() does; the buffer outlives the tokens
+                y2.string.p = (char*) t.tok;
+                y2.string.n = len;
             }
             stypes.push_back(y2);
             locations.push_back(loc);
@@ -1993,7 +1999,6 @@ bool FixedFormTokenizer::tokenize_input(diag::Diagnostics &diagnostics, Allocato
     try {
         FixedFormRecursiveDescent f(diagnostics, al);
         f.string_start = string_start;
-        //f.t.set_string(lines[lines.size()-1]);
         f.t.cur = string_start;
         f.t.string_start = string_start;
         f.t.cur_line = string_start;
@@ -1,3 +1,5 @@
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <cctype>
@@ -233,9 +235,82 @@ void fix_program_without_program_line(Allocator &al, AST::TranslationUnit_t &ast
     ast.n_items = global_items.size();
 }
 
+// Upper bound on parenthesis/bracket nesting the grammar will accept.
+// Each level occupies several slots of the parser stack and machine
+// generated sources have overflowed it; handwritten code stays in the tens.
+constexpr int max_nesting_depth = 2000;
+
+// Returns the offset of the opening parenthesis/bracket that exceeds
+// `limit` levels of nesting, or std::string::npos if the input is fine.
+// String literals and `!` comments are skipped so their brackets do not
+// count, and the depth is clamped at zero so unbalanced closing brackets
+// earlier in the file cannot mask a later overflow.
+static size_t find_excessive_nesting(const std::string &s, int limit)
+{
+    int depth = 0;
+    char quote = 0;
+    bool comment = false;
+    for (size_t i = 0; i < s.size(); i++) {
+        char c = s[i];
+        if (comment) {
+            if (c == '\n') comment = false;
+        } else if (quote) {
+            if (c == quote) {
+                // a doubled quote is an escaped quote, not a terminator
+                if (i + 1 < s.size() && s[i + 1] == quote) {
+                    i++;
+                } else {
+                    quote = 0;
+                }
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+        } else if (c == '!') {
+            comment = true;
+        } else if (c == '(' || c == '[') {
+            depth++;
+            if (depth > limit) return i;
+        } else if (c == ')' || c == ']') {
+            if (depth > 0) depth--;
+        }
+    }
+    return std::string::npos;
+}
+
 Result<AST::TranslationUnit_t*> parse(Allocator &al, const std::string &s,
         diag::Diagnostics &diagnostics, const CompilerOptions &co)
 {
+    // Validate the encoding up front (word-at-a-time over ASCII spans), so
+    // the tokenizers can trust the input and an invalid byte is reported at
+    // its exact offset instead of surfacing later as a confusing token error
+    size_t invalid = find_invalid_utf8(s);
+    if (invalid != std::string::npos) {
+        Location loc;
+        loc.first = invalid;
+        loc.last = invalid;
+        diagnostics.add(diag::Diagnostic(
+            "source is not valid UTF-8 (invalid byte at offset "
+                + std::to_string(invalid) + ")",
+            diag::Level::Error, diag::Stage::Tokenizer,
+            {diag::Label("", {loc})}));
+        return Error();
+    }
+    // Guard the recursive expression grammar: sources with thousands of
+    // nested parentheses exhaust the parser stack, so reject them up front
+    // with a precise location instead of crashing deep inside yyparse
+    size_t deep = find_excessive_nesting(s, max_nesting_depth);
+    if (deep != std::string::npos) {
+        Location loc;
+        loc.first = deep;
+        loc.last = deep;
+        diagnostics.add(diag::Diagnostic(
+            "expression nesting is too deep (more than "
+                + std::to_string(max_nesting_depth)
+                + " levels of parentheses or brackets)",
+            diag::Level::Error, diag::Stage::Parser,
+            {diag::Label("", {loc})}));
+        return Error();
+    }
     Parser p(al, diagnostics, co.fixed_form, co.continue_compilation, co.openmp);
     try {
         if (!p.parse(s)) {
@@ -272,14 +347,20 @@ Result<AST::TranslationUnit_t*> parse(Allocator &al, const std::string &s,
 
 bool Parser::parse(const std::string &input)
 {
-    inp = input;
-    if (inp.size() > 0) {
-        if (inp[inp.size()-1] != '\n') inp.append("\n");
-    } else {
+    // The tokenizers require newline-terminated input. When the caller's
+    // buffer already ends with one, tokenize it in place; copying what can
+    // be a very large source into `inp` is only needed to append the
+    // missing newline. All strings the
+    // AST retains are copied into the arena by the parser actions, so the
+    // buffer is not referenced after parsing.
+    const std::string *src = &input;
+    if (input.size() == 0 || input[input.size()-1] != '\n') {
+        inp = input;
         inp.append("\n");
+        src = &inp;
     }
     if (!fixed_form) {
-        m_tokenizer.set_string(inp);
+        m_tokenizer.set_string(*src);
         try {
             if (yyparse(*this) == 0) {
                 if (diag.has_error())
@@ -290,7 +371,7 @@ bool Parser::parse(const std::string &input)
             return false;
         }
     } else {
-        f_tokenizer.set_string(inp);
+        f_tokenizer.set_string(*src);
         if (!f_tokenizer.tokenize_input(diag, m_a, this->continue_compilation)) return false;
         if (yyparse(*this) == 0) {
             if (diag.has_error())
@@ -693,6 +774,58 @@ bool is_include(const std::string &s, uint32_t pos) {
     }
 }
 
+// Bytes on which the free-form prescanner loop below has to act (state
+// changes, bookkeeping or skipping); everything else is copied verbatim
+bool is_prescan_special(char c) {
+    return c == '\n' || c == '!' || c == '&' || c == '"' || c == '\'';
+}
+
+// Returns the position of the next special byte at or after `pos`, or
+// s.size(). Classifies eight bytes per step with word-at-a-time bit
+// tricks, so the hot skip loop runs vectorized without platform-specific
+// intrinsics.
+// Whether the free-form prescanner would return the input unchanged: with
+// no continuation character and no include line anywhere, the transformation
+// loop copies every byte through. The include check is a conservative
+// case-insensitive substring search; a false positive (the word inside a
+// comment or string) just takes the slow path.
+bool prescan_is_identity(const std::string &s) {
+    if (s.find('&') != std::string::npos) {
+        return false;
+    }
+    const char inc[] = "include";
+    for (size_t i = 0; i + 7 <= s.size(); i++) {
+        size_t j = 0;
+        while (j < 7 && std::tolower(
+            static_cast<unsigned char>(s[i+j])) == inc[j]) j++;
+        if (j == 7) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t find_next_prescan_special(const std::string &s, size_t pos) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t highs = 0x8080808080808080ULL;
+    // The classic zero-byte test applied to w xor-ed with the broadcast
+    // character: a high bit is set in every byte position that matches c
+    auto has_byte = [&](uint64_t w, char c) {
+        uint64_t x = w ^ (ones * (unsigned char)c);
+        return (x - ones) & ~x & highs;
+    };
+    while (pos + 8 <= s.size()) {
+        uint64_t w;
+        std::memcpy(&w, s.data() + pos, 8);
+        uint64_t m = has_byte(w, '\n') | has_byte(w, '!') | has_byte(w, '&')
+            | has_byte(w, '"') | has_byte(w, '\'');
+        if (m != 0) break;
+        pos += 8;
+    }
+    while (pos < s.size() && !is_prescan_special(s[pos])) pos++;
+    return pos;
+}
+
 /*
 The prescan phase includes:
 - Removal of whitespace (fixed-form only)
@@ -809,6 +942,14 @@ std::string prescan(const std::string &s, LocationManager &lm,
         lm.files.back().out_start.push_back(out.size());
         return out;
     } else {
+        // Most free-form sources contain no continuation lines and no
+        // include lines; for those the prescanner output is byte-identical
+        // to the input, so skip the transformation loop (and its per-byte
+        // string growth) and record the identity mapping directly:
+        if (prescan_is_identity(s)) {
+            lm.init_simple(s);
+            return s;
+        }
          // `pos` is the position in the original code `s`
         // `out` is the final code (outcome)
         lm.files.back().out_start.push_back(0);
@@ -822,6 +963,17 @@ std::string prescan(const std::string &s, LocationManager &lm,
         // used for that string
         char quote = '\0';
         while (pos < s.size()) {
+            if (!newline) {
+                // No state changes and no bookkeeping happen on ordinary
+                // bytes, so copy the whole run up to the next special byte
+                // at once instead of going through the loop per byte
+                size_t next = find_next_prescan_special(s, pos);
+                if (next > pos) {
+                    out.append(s, pos, next - pos);
+                    pos = next;
+                    if (pos >= s.size()) break;
+                }
+            }
             is_within_string(s, pos, quote, in_comment, in_string);
             if (newline && is_include(s, pos)) {
                 int col = 0; // doesn't matter
@@ -1698,6 +1698,7 @@ coarray_comp_decl
 statements
     : statements statement { $$ = $1; LIST_ADD($$, $2); }
     | %empty { LIST_NEW($$); }
+    | statements error sep_one { $$ = $1; }
     ;
 
 sep
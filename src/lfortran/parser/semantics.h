@@ -923,10 +923,10 @@ static inline char** REDUCE_ARGS(Allocator &al, const Vec<ast_t*> args)
 static inline reduce_opType convert_id_to_reduce_type(
         const Location &loc, const ast_t *id, LCompilers::diag::Diagnostics &diagnostics)
 {
-    std::string s_id = down_cast2<Name_t>(id)->m_id;
-    if (s_id == "MIN" ) {
+    std::string s_id = LCompilers::to_lower(down_cast2<Name_t>(id)->m_id);
+    if (s_id == "min" ) {
         return reduce_opType::ReduceMIN;
-    } else if (s_id == "MAX") {
+    } else if (s_id == "max") {
         return reduce_opType::ReduceMAX;
     } else {
         diagnostics.add(LCompilers::diag::Diagnostic(
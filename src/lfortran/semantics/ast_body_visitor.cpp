@@ -8519,12 +8519,19 @@ public:
         for (size_t i = 0; i < x.n_clauses; i++) {
             std::string clause = AST::down_cast<AST::String_t>(x.m_clauses[i])->m_s;
             std::string clause_name = clause.substr(0, clause.find('('));
-            if (clause_name == "private" || clause_name == "reduction" || clause_name == "shared" || clause_name == "firstprivate" || clause_name == "collapse" || clause_name == "num_teams" || clause_name == "thread_limit" || clause_name == "schedule" || clause_name == "num_threads" || clause_name == "map" || clause_name == "device") {
+            if (clause_name == "untied") {
+                clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(
+                    ASR::make_OMPUntied_t(al, loc)));
+                continue;
+            }
+            if (clause_name == "private" || clause_name == "reduction" || clause_name == "shared" || clause_name == "firstprivate" || clause_name == "collapse" || clause_name == "num_teams" || clause_name == "thread_limit" || clause_name == "schedule" || clause_name == "num_threads" || clause_name == "map" || clause_name == "device" || clause_name == "depend" || clause_name == "safelen" || clause_name == "aligned") {
                 std::string list = clause.substr(clause.find('(') + 1, clause.size() - clause_name.size() - 2);
                 Vec<ASR::expr_t*> vars;
                 vars.reserve(al, 1);
                 ASR::reduction_opType op = ASR::reduction_opType::ReduceAdd;
                 ASR::map_typeType map_type = ASR::map_typeType::To;
+                ASR::omp_depend_typeType depend_type = ASR::omp_depend_typeType::DependIn;
+                ASR::expr_t* aligned_alignment = nullptr;
                 if (clause_name == "reduction") {
                     std::string reduction_op = list.substr(0, list.find(':'));
                     if ( reduction_op == "+" ) {
@@ -8560,6 +8567,32 @@ public:
                         throw SemanticAbort();
                     }
                     list = list.substr(list.find(':')+1);
+                } else if (clause_name == "depend") {
+                    std::string depend_str = list.substr(0, list.find(':'));
+                    depend_str.erase(0, depend_str.find_first_not_of(" "));
+                    if (depend_str == "in") {
+                        depend_type = ASR::omp_depend_typeType::DependIn;
+                    } else if (depend_str == "out") {
+                        depend_type = ASR::omp_depend_typeType::DependOut;
+                    } else if (depend_str == "inout") {
+                        depend_type = ASR::omp_depend_typeType::DependInOut;
+                    } else {
+                        diag.add(Diagnostic("The depend type `" + depend_str + "` is not supported", Level::Error, Stage::Semantic, {Label("", {loc})}));
+                        throw SemanticAbort();
+                    }
+                    list = list.substr(list.find(':')+1);
+                } else if (clause_name == "aligned") {
+                    // aligned(a, b : 64) -- the alignment after the colon is optional
+                    if (list.find(':') != std::string::npos) {
+                        std::string align_str = list.substr(list.find(':')+1);
+                        int alignment = std::stoi(align_str.erase(0, align_str.find_first_not_of(" ")));
+                        aligned_alignment = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, alignment, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4))));
+                        list = list.substr(0, list.find(':'));
+                    }
+                } else if (clause_name == "safelen") {
+                    int safelen = std::stoi(list.erase(0, list.find_first_not_of(" "))); // Get the value of N
+                    clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPSafelen_t(al, loc, ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, safelen, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)))))));
+                    continue;
                 } else if (clause_name == "collapse") {
                     int collapse_value = std::stoi(list.erase(0, list.find_first_not_of(" "))); // Get the value of N
                     clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(ASR::make_OMPCollapse_t(al, loc, ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, collapse_value, ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 4)))))));
@@ -8666,6 +8699,12 @@ public:
                 } else if (clause_name == "map") {
                     clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(
                         ASR::make_OMPMap_t(al, loc, map_type, vars.p, vars.n)));
+                } else if (clause_name == "depend") {
+                    clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(
+                        ASR::make_OMPDepend_t(al, loc, depend_type, vars.p, vars.n)));
+                } else if (clause_name == "aligned") {
+                    clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(
+                        ASR::make_OMPAligned_t(al, loc, vars.p, vars.n, aligned_alignment)));
                 } else {
                     clauses.push_back(al, ASR::down_cast<ASR::omp_clause_t>(
                         ASR::make_OMPReduction_t(al, loc, op, vars.p, vars.n)));
@@ -8712,6 +8751,8 @@ public:
                     collect_omp_body(ASR::omp_region_typeType::Parallel);
                 } else if(LCompilers::startswith(x.m_construct_name, "do")) {
                     collect_omp_body(ASR::omp_region_typeType::Do);
+                } else if (LCompilers::startswith(x.m_construct_name, "simd")) {
+                    collect_omp_body(ASR::omp_region_typeType::Simd);
                 } else if (LCompilers::startswith(x.m_construct_name, "critical")) {
                     collect_omp_body(ASR::omp_region_typeType::Critical);
                 } else if (LCompilers::startswith(x.m_construct_name, "teams distribute")) {
@@ -8763,6 +8804,15 @@ public:
                 body.reserve(al, 0);
                 omp_region_body.push_back(ASRUtils::STMT(
                     ASR::make_OMPRegion_t(al, loc, ASR::omp_region_typeType::ParallelDo, clauses.p, clauses.n, body.p, body.n)));
+            } else if (to_lower(x.m_construct_name) == "simd") {
+                pragma_nesting_level_2++;
+                Vec<ASR::omp_clause_t*> clauses;
+                clauses = get_clauses(x);
+
+                Vec<ASR::stmt_t*> body;
+                body.reserve(al, 0);
+                omp_region_body.push_back(ASRUtils::STMT(
+                    ASR::make_OMPRegion_t(al, loc, ASR::omp_region_typeType::Simd, clauses.p, clauses.n, body.p, body.n)));
             } else if (to_lower(x.m_construct_name) == "sections") {
                 pragma_nesting_level_2++;
                 Vec<ASR::omp_clause_t*> clauses;
@@ -8973,6 +9023,14 @@ Result<ASR::TranslationUnit_t*> body_visitor(Allocator &al,
         instantiate_types, instantiate_symbols, entry_functions,
         entry_function_arguments_mapping, data_structure, lm
     );
+    // Program-unit bodies are visited serially. They look independent after
+    // the symbol-table pass, but visiting a body still mutates shared state:
+    // template instantiation and intrinsic module loading insert symbols into
+    // the translation-unit scope, every node comes from the single
+    // non-thread-safe arena `al`, and diagnostics share one sink. Until those
+    // are per-worker (see the sharded ASR passes driven by --pass-jobs for
+    // the per-worker arena + absorb pattern), a thread pool here would race
+    // on the global symbol table.
     try {
         b.is_body_visitor = true;
         b.visit_TranslationUnit(ast);
@@ -19,6 +19,7 @@
 #include <sstream>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <queue>
 #include <limits>
 
@@ -1654,7 +1655,7 @@ public:
         {AST::intrinsicopType::CONCAT, "~concat"}
     };
 
-    std::map<std::string, IntrinsicSignature> name2signature = {
+    std::unordered_map<std::string, IntrinsicSignature> name2signature = {
         {"any", IntrinsicSignature({"mask", "dim"}, 1, 2)},
         {"all", IntrinsicSignature({"mask", "dim"}, 1, 2)},
         {"iany", IntrinsicSignature({"array", "dim", "mask"}, 1, 3)},
@@ -1758,6 +1759,8 @@ public:
         {"co_sum", IntrinsicSignature({"a", "result_image", "stat", "errmsg"}, 1, 4)},
         {"move_alloc", IntrinsicSignature({"from", "to"}, 2, 2)},
         {"mvbits", IntrinsicSignature({"from", "frompos", "len", "to", "topos"}, 5, 5)},
+        {"lfortran_dump", IntrinsicSignature({"unit", "array"}, 2, 2)},
+        {"lfortran_restore", IntrinsicSignature({"unit", "array"}, 2, 2)},
         {"modulo", IntrinsicSignature({"a", "p"}, 2, 2)},
         {"bessel_jn", IntrinsicSignature({"n", "x"}, 2, 2)},
         {"bessel_yn", IntrinsicSignature({"n", "x"}, 2, 2)},
@@ -2017,6 +2020,12 @@ public:
     std::map<std::string, std::string> context_map;     // TODO: refactor treatment of context map
     std::map<uint32_t, std::map<std::string, std::pair<ASR::ttype_t*, ASR::symbol_t*>>> &instantiate_types;
     std::map<uint32_t, std::map<std::string, ASR::symbol_t*>> &instantiate_symbols;
+    // Instantiations already produced by handle_templated, keyed by the target
+    // scope, the template and the canonicalized instantiation arguments. Every
+    // implicit use of a templated procedure used to re-instantiate the symbol
+    // and its body from scratch; with the cache, repeated uses with identical
+    // arguments reuse the first instantiation.
+    std::map<std::string, std::string> instantiation_cache;
     std::map<uint32_t, std::vector<ASR::stmt_t*>> &data_structure;
     LCompilers::LocationManager &lm;
 
@@ -2977,6 +2986,45 @@ public:
         return element_size * array_size;
     }
 
+    // Canonical layout of one COMMON block struct member (for
+    // offset-based storage association lookups)
+    struct CommonBlockMemberLayout {
+        std::string name;
+        size_t offset;
+        size_t size;
+    };
+    // Per-block layout tables, built once per struct (and rebuilt only
+    // when further COMMON statements extend the block, detected via the
+    // member count). Offset-based member lookup consults this table
+    // instead of re-walking the struct and recomputing member sizes on
+    // every reference.
+    std::map<ASR::Struct_t*, std::pair<size_t, std::vector<CommonBlockMemberLayout>>>
+        common_block_layout_cache;
+
+    const std::vector<CommonBlockMemberLayout>& get_common_block_layout(
+            ASR::Struct_t* struct_type) {
+        std::pair<size_t, std::vector<CommonBlockMemberLayout>>& entry =
+            common_block_layout_cache[struct_type];
+        if (entry.first != struct_type->n_members || entry.second.empty()) {
+            entry.first = struct_type->n_members;
+            entry.second.clear();
+            entry.second.reserve(struct_type->n_members);
+            size_t offset = 0;
+            for (size_t i = 0; i < struct_type->n_members; i++) {
+                std::string member_name_str = struct_type->m_members[i];
+                ASR::symbol_t* mem_sym = struct_type->m_symtab->resolve_symbol(member_name_str);
+                size_t member_size = 0;
+                if (mem_sym && ASR::is_a<ASR::Variable_t>(*mem_sym)) {
+                    member_size = get_type_byte_size(
+                        ASR::down_cast<ASR::Variable_t>(mem_sym)->m_type);
+                }
+                entry.second.push_back({member_name_str, offset, member_size});
+                offset += member_size;
+            }
+        }
+        return entry.second;
+    }
+
     ASR::asr_t* create_StructInstanceMember(ASR::expr_t* target, ASR::Variable_t* target_var,
             SymbolTable* use_scope = nullptr) {
         uint64_t hash = get_hash((ASR::asr_t*) target_var);
@@ -3025,22 +3073,15 @@ public:
                 auto offset_it = common_variables_byte_offset.find(hash);
                 if (offset_it != common_variables_byte_offset.end()) {
                     size_t target_offset = offset_it->second;
-                    // Find the member whose byte range contains target_offset
-                    size_t current_offset = 0;
-                    for (size_t i = 0; i < struct_type->n_members; i++) {
-                        std::string member_name_str = struct_type->m_members[i];
-                        ASR::symbol_t* mem_sym = struct_type->m_symtab->resolve_symbol(member_name_str);
-                        if (mem_sym && ASR::is_a<ASR::Variable_t>(*mem_sym)) {
-                            ASR::Variable_t* mem_var = ASR::down_cast<ASR::Variable_t>(mem_sym);
-                            size_t member_size = get_type_byte_size(mem_var->m_type);
-                            // Check if target_offset falls within this member's range
-                            if (target_offset >= current_offset &&
-                                target_offset < current_offset + member_size) {
-                                actual_member_name = member_name_str;
-                                struct_member_sym = mem_sym;
-                                break;
-                            }
-                            current_offset += member_size;
+                    // Find the member whose precomputed byte range
+                    // [offset, offset + size) contains target_offset
+                    for (const CommonBlockMemberLayout& member:
+                            get_common_block_layout(struct_type)) {
+                        if (target_offset >= member.offset &&
+                            target_offset < member.offset + member.size) {
+                            actual_member_name = member.name;
+                            struct_member_sym = struct_type->m_symtab->resolve_symbol(member.name);
+                            break;
                         }
                     }
                 }
@@ -4032,6 +4073,9 @@ public:
 
     void mark_common_blocks_as_declared() {
         constexpr char BLANK_COMMON_BLOCK[] = "blank#block";
+        // Collect all size mismatches before aborting, so a file with
+        // several conflicting blocks reports them all at once
+        bool size_mismatch = false;
         for(auto &it: common_block_dictionary) {
             if(it.second.first) {
                 // Validate deferred size checks for blocks re-declared in this scope
@@ -4047,13 +4091,16 @@ public:
                             Level::Error, Stage::Semantic, {
                                 Label("", {deferred_it->second.second})
                             }));
-                        throw SemanticAbort();
+                        size_mismatch = true;
                     }
                     common_block_deferred_size_check.erase(deferred_it);
                 }
                 it.second.first = false;
             }
         }
+        if (size_mismatch) {
+            throw SemanticAbort();
+        }
     }
 
     ASR::symbol_t* create_common_module(Location loc, std::string common_block_name) {
@@ -14281,10 +14328,11 @@ public:
     }
 
     IntrinsicSignature get_intrinsic_signature(std::string& var_name) {
-        if( name2signature.find(var_name) == name2signature.end() ) {
+        auto it = name2signature.find(var_name);
+        if( it == name2signature.end() ) {
             return IntrinsicSignature({}, 1, 1);
         }
-        return name2signature[var_name];
+        return it->second;
     }
 
     bool is_intrinsic_registry_function(std::string var_name) {
@@ -17138,11 +17186,38 @@ public:
             target_scope = current_scope->parent;
         }
 
+        // The unique name below is minted per call, so the name-based reuse
+        // inside instantiate_symbol never fires for implicit instantiations.
+        // Canonicalize the instantiation arguments instead and reuse the
+        // instantiation produced for an identical earlier use:
+        std::string instantiation_key = target_scope->get_counter()
+            + "|" + ASRUtils::symbol_parent_symtab(sym)->get_counter()
+            + "|" + func_name;
+        for (auto const &type_sub: type_subs) {
+            instantiation_key += "|" + type_sub.first + ":"
+                + ASRUtils::get_type_code(type_sub.second.first);
+            if (type_sub.second.second) {
+                instantiation_key += "@" + std::string(
+                    ASRUtils::symbol_name(type_sub.second.second));
+            }
+        }
+        for (auto const &symbol_sub: symbol_subs) {
+            instantiation_key += "|" + symbol_sub.first + "="
+                + ASRUtils::symbol_parent_symtab(symbol_sub.second)->get_counter()
+                + ":" + std::string(ASRUtils::symbol_name(symbol_sub.second));
+        }
+        auto cached_instantiation = instantiation_cache.find(instantiation_key);
+        if (cached_instantiation != instantiation_cache.end()
+                && target_scope->get_symbol(cached_instantiation->second) != nullptr) {
+            return cached_instantiation->second;
+        }
+
         std::string new_func_name = target_scope->get_unique_name("__instantiated_" + func_name);
 
         ASR::symbol_t* new_s = instantiate_symbol(al, target_scope, type_subs, symbol_subs, new_func_name, s);
         instantiate_body(al, type_subs, symbol_subs, new_s, s);
 
+        instantiation_cache[instantiation_key] = new_func_name;
         return new_func_name;
     }
 
@@ -18994,8 +19069,21 @@ public:
         }
     }
 
+    // Cache for get_indirect_public_symbols: every program unit that does
+    // `use m` re-derives the same set, so a file with many units pays
+    // |units| x |module scope| for it. The key includes the module's scope
+    // size, so a module that gains symbols after being cached is recomputed.
+    std::map<std::pair<const ASR::Module_t*, size_t>, std::set<std::string>>
+        indirect_public_symbols_cache;
+
     void get_indirect_public_symbols(const ASR::Module_t* m,
                                     std::set<std::string> &indirect_public_symbols) {
+        auto key = std::make_pair(m, m->m_symtab->get_scope().size());
+        auto cached = indirect_public_symbols_cache.find(key);
+        if (cached != indirect_public_symbols_cache.end()) {
+            indirect_public_symbols = cached->second;
+            return;
+        }
         // Get all public symbols from the module
         for (auto &item : m->m_symtab->get_scope()) {
             if (ASR::is_a<ASR::Struct_t>(*item.second)) {
@@ -19023,6 +19111,7 @@ public:
                 }
             }
         }
+        indirect_public_symbols_cache[key] = indirect_public_symbols;
     }
 
     // Return true if every specific procedure of `incoming` resolves (past
@@ -19101,11 +19190,11 @@ public:
         //     use a
         std::set<std::string> indirect_public_symbols;
         get_indirect_public_symbols(m, indirect_public_symbols);
+        std::set<std::string> already_imported_with_renaming(
+            symbols_already_imported_with_renaming.begin(),
+            symbols_already_imported_with_renaming.end());
         for (auto &item : m->m_symtab->get_scope()) {
-            if ( symbols_already_imported_with_renaming.size() > 0 &&
-                 std::find(symbols_already_imported_with_renaming.begin(),
-                           symbols_already_imported_with_renaming.end(),
-                           item.first) != symbols_already_imported_with_renaming.end() ) {
+            if ( already_imported_with_renaming.count(item.first) > 0 ) {
                 continue;
             }
             if( current_scope->get_symbol(item.first) != nullptr) {
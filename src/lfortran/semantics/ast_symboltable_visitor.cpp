@@ -46,6 +46,27 @@ public:
 
     ASR::ttype_t *tmp_type;
 
+    // A unit's use statements load modfiles one at a time through
+    // visit_Use; warm the modfile byte cache for all of them in
+    // parallel first, so the serial loads only deserialize.
+    template <typename T>
+    void prefetch_used_modules(const T &x) {
+        std::vector<std::string> names;
+        for (size_t i=0; i<x.n_use; i++) {
+            if (AST::is_a<AST::Use_t>(*x.m_use[i])) {
+                std::string msym = to_lower(
+                    AST::down_cast<AST::Use_t>(x.m_use[i])->m_module);
+                if (msym == "ieee_arithmetic") {
+                    msym = "lfortran_intrinsic_" + msym;
+                }
+                if (current_scope->resolve_symbol(msym) == nullptr) {
+                    names.push_back(msym);
+                }
+            }
+        }
+        ASRUtils::prefetch_modfiles(names, compiler_options.po);
+    }
+
     static bool is_equivalence_declaration(AST::unit_decl2_t* decl) {
         if (AST::is_a<AST::Declaration_t>(*decl)) {
             AST::Declaration_t* d = AST::down_cast<AST::Declaration_t>(decl);
@@ -381,6 +402,7 @@ public:
                                                 false, false, false);
         }
         current_module_sym = ASR::down_cast<ASR::symbol_t>(tmp0);
+        prefetch_used_modules(x);
         for (size_t i=0; i<x.n_use; i++) {
             try {
                 visit_unit_decl1(*x.m_use[i]);
@@ -565,6 +587,7 @@ public:
         bool is_global_save_enabled_copy = is_global_save_enabled;
         check_if_global_save_is_enabled( x );
         in_program = true;
+        prefetch_used_modules(x);
         for (size_t i=0; i<x.n_use; i++) {
             try {
                 visit_unit_decl1(*x.m_use[i]);
@@ -1137,6 +1160,7 @@ public:
         ASR::expr_t* new_func_return_var = exprstmt_duplicator.duplicate_expr(proc_interface->m_return_var);
         ASR::ttype_t* new_func_signature = exprstmt_duplicator.duplicate_ttype(proc_interface->m_function_signature);
 
+        prefetch_used_modules(x);
         for (size_t i=0; i<x.n_use; i++) {
             try {
                 visit_unit_decl1(*x.m_use[i]);
@@ -1274,6 +1298,7 @@ public:
         // iterate over declarations and check if global save is present
         bool is_global_save_enabled_copy = is_global_save_enabled;
         check_if_global_save_is_enabled( x );
+        prefetch_used_modules(x);
         for (size_t i=0; i<x.n_use; i++) {
             try {
                 visit_unit_decl1(*x.m_use[i]);
@@ -1773,6 +1798,7 @@ public:
         // iterate over declarations and check if global save is present
         bool is_global_save_enabled_copy = is_global_save_enabled;
         check_if_global_save_is_enabled( x );
+        prefetch_used_modules(x);
         for (size_t i=0; i<x.n_use; i++) {
             try {
                 visit_unit_decl1(*x.m_use[i]);
@@ -20,8 +20,48 @@ void test_parse()
     LFORTRAN_C_ASSERT(r == LFORTRAN_NO_EXCEPTION);
 }
 
+void test_session()
+{
+#ifdef HAVE_LFORTRAN_LLVM
+    LFortranCSession *s;
+    s = lfortran_session_new();
+    LFORTRAN_C_ASSERT(s != NULL);
+    lfortran_exceptions_t r;
+    r = lfortran_session_eval(s,
+        "integer function add7(i)\n"
+        "integer, intent(in) :: i\n"
+        "add7 = i + 7\n"
+        "end function\n");
+    LFORTRAN_C_ASSERT(r == LFORTRAN_NO_EXCEPTION);
+    /* Later sources can use symbols defined by earlier ones */
+    r = lfortran_session_eval(s,
+        "integer function add14(i)\n"
+        "integer, intent(in) :: i\n"
+        "add14 = add7(add7(i))\n"
+        "end function\n");
+    LFORTRAN_C_ASSERT(r == LFORTRAN_NO_EXCEPTION);
+    void *p;
+    r = lfortran_session_get_function(s, "add14", &p);
+    LFORTRAN_C_ASSERT(r == LFORTRAN_NO_EXCEPTION);
+    LFORTRAN_C_ASSERT(p != NULL);
+    /* Scalar arguments are passed by reference */
+    int (*add14)(int*) = (int (*)(int*))p;
+    int i = 5;
+    LFORTRAN_C_ASSERT(add14(&i) == 19);
+    /* "integer function" would parse as a declaration of a variable named
+       `function` (Fortran has no reserved words), so use source that cannot
+       parse at all */
+    r = lfortran_session_eval(s, "integer ::");
+    LFORTRAN_C_ASSERT(r == LFORTRAN_COMPILE_ERROR);
+    lfortran_session_free(s);
+#else
+    LFORTRAN_C_ASSERT(lfortran_session_new() == NULL);
+#endif
+}
+
 int main()
 {
     test_parse();
+    test_session();
     return 0;
 }
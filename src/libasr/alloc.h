@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <mutex>
 #include <new>
 #include <stdexcept>
 #include <vector>
@@ -20,17 +21,87 @@ class Allocator
     void *start;
     size_t current_pos;
     size_t size;
+    // Bytes handed out from retired (full) chunks; together with
+    // size_current() this gives the lifetime allocation total. Updated
+    // only on the cold path (new_chunk/absorb/rewind), so keeping it
+    // costs nothing in alloc().
+    size_t committed = 0;
     std::vector<void*> blocks;
+
+    // Process-wide cache of retired arena chunks. Compiling many files in
+    // one driver invocation constructs and destroys one arena per file;
+    // recycling the big chunks here avoids that malloc/free churn. The
+    // cache is bounded by cache_max_bytes and protected by a mutex (only
+    // the construct/destroy cold path takes it, never alloc()).
+    struct CachedChunk {
+        void *ptr;
+        size_t size;
+    };
+    static inline std::mutex cache_mutex;
+    static inline std::vector<CachedChunk> chunk_cache;
+    static inline size_t cache_bytes = 0;
+    static constexpr size_t cache_max_bytes = 256*1024*1024;
+    // Only chunks this big are worth recycling; below it malloc is cheap
+    // and a small arena must not be handed a huge leftover chunk (its
+    // size_total() would no longer reflect what it asked for)
+    static constexpr size_t cache_min_chunk_bytes = 64*1024;
+
+    // Takes the smallest cached chunk of at least `s` bytes, updating `s`
+    // to the chunk's real size; returns nullptr when none fits
+    static void *take_cached(size_t &s) {
+        if (s < cache_min_chunk_bytes) return nullptr;
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        size_t best = chunk_cache.size();
+        for (size_t i = 0; i < chunk_cache.size(); i++) {
+            if (chunk_cache[i].size >= s && (best == chunk_cache.size()
+                    || chunk_cache[i].size < chunk_cache[best].size)) {
+                best = i;
+            }
+        }
+        if (best == chunk_cache.size()) return nullptr;
+        void *p = chunk_cache[best].ptr;
+        s = chunk_cache[best].size;
+        cache_bytes -= s;
+        chunk_cache.erase(chunk_cache.begin() + best);
+        return p;
+    }
+
+    static void offer_cached(void *p, size_t s) {
+        if (s >= cache_min_chunk_bytes) {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            if (cache_bytes + s <= cache_max_bytes) {
+                chunk_cache.push_back(CachedChunk{p, s});
+                cache_bytes += s;
+                return;
+            }
+        }
+        free(p);
+    }
+
 public:
     Allocator(size_t s) {
         s += ALIGNMENT;
-        start = malloc(s);
-        if (start == nullptr) throw std::runtime_error("malloc failed.");
+        start = take_cached(s);
+        if (start == nullptr) {
+            start = malloc(s);
+            if (start == nullptr) throw std::runtime_error("malloc failed.");
+        }
         current_pos = (size_t)start;
         current_pos = align(current_pos);
         size = s;
         blocks.push_back(start);
     }
+
+    // Returns all cached chunks to the OS; useful for long-running hosts
+    // (REPL, language server) to trim memory between compilations
+    static void trim_cache() {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        for (size_t i = 0; i < chunk_cache.size(); i++) {
+            free(chunk_cache[i].ptr);
+        }
+        chunk_cache.clear();
+        cache_bytes = 0;
+    }
     Allocator() = delete;
     Allocator(const Allocator&) = delete;
     Allocator& operator=(const Allocator&) = delete;
@@ -38,7 +109,14 @@ public:
     Allocator& operator=(const Allocator&&) = delete;
     ~Allocator() {
         for (size_t i = 0; i < blocks.size(); i++) {
-            if (blocks[i] != nullptr) free(blocks[i]);
+            if (blocks[i] == nullptr) continue;
+            if (blocks[i] == start) {
+                // The current chunk is the largest one (chunks double in
+                // size); recycle it for the next arena
+                offer_cached(blocks[i], size);
+            } else {
+                free(blocks[i]);
+            }
         }
     }
 
@@ -74,6 +152,9 @@ public:
     }
 
     void *new_chunk(size_t s) {
+        // alloc() advanced current_pos by align(s) before overflowing
+        // into here; subtract it to count only what the old chunk served
+        committed += current_pos - (size_t)start - align(s);
         size_t snew = std::max(s+ALIGNMENT, 2*size);
         start = malloc(snew);
         blocks.push_back(start);
@@ -112,10 +193,57 @@ public:
         //return new T(std::forward<Args>(args)...);
     }
 
+    // Takes ownership of all memory blocks of `other`; afterwards `other`
+    // must not be used for further allocation. Pointers into the absorbed
+    // memory stay valid for the lifetime of this allocator, so worker
+    // threads can allocate into private arenas and hand the results over.
+    void absorb(Allocator &other) {
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+        other.blocks.clear();
+        committed += other.size_allocated();
+        other.committed = 0;
+    }
+
+    // A snapshot of the allocator state, see checkpoint()/rewind()
+    struct Checkpoint {
+        size_t n_blocks;
+        void *start;
+        size_t current_pos;
+        size_t size;
+        size_t committed;
+    };
+
+    // Returns a checkpoint of the current allocator state. Everything
+    // allocated after the checkpoint is reclaimed by the matching rewind();
+    // everything allocated before it stays valid. Checkpoints must be
+    // rewound in LIFO order, and no pointer obtained after the checkpoint
+    // may be used after the rewind.
+    Checkpoint checkpoint() {
+        return Checkpoint{blocks.size(), start, current_pos, size, committed};
+    }
+
+    void rewind(const Checkpoint &cp) {
+        LCOMPILERS_ASSERT(cp.n_blocks >= 1 && cp.n_blocks <= blocks.size());
+        while (blocks.size() > cp.n_blocks) {
+            if (blocks.back() != nullptr) free(blocks.back());
+            blocks.pop_back();
+        }
+        start = cp.start;
+        current_pos = cp.current_pos;
+        size = cp.size;
+        committed = cp.committed;
+    }
+
     size_t size_current() {
         return current_pos - (size_t)start;
     }
 
+    // Total bytes handed out by alloc() over the lifetime of this
+    // allocator (including absorbed arenas)
+    size_t size_allocated() {
+        return committed + size_current();
+    }
+
     size_t size_total() {
         return size;
     }
@@ -302,6 +302,33 @@ class ASTVisitorVisitor1(ASDLVisitor):
             self.emit("}")
             self.emit("")
 
+class NodeNameVisitor(ASDLVisitor):
+    """Emits a `<base>_type_name()` function per node sum, mapping the
+    type enum to the node's name, for diagnostics and reports that need
+    node kinds as strings without instantiating a full visitor."""
+
+    def visitModule(self, mod):
+        self.emit("/" + "*"*78 + "/")
+        self.emit("// Node kind names")
+        self.emit("")
+        super(NodeNameVisitor, self).visitModule(mod)
+
+    def visitType(self, tp):
+        self.visit(tp.value, tp.name)
+
+    def visitSum(self, sum, base):
+        if not is_simple_sum(sum):
+            self.emit("static inline const char* %s_type_name(%sType x) {" \
+                    % (base, base))
+            self.emit(    "switch (x) {", 1)
+            for type_ in sum.types:
+                self.emit('        case %sType::%s: { return "%s"; }'
+                    % (base, type_.name, type_.name))
+            self.emit("    }")
+            self.emit('    return "";')
+            self.emit("}")
+            self.emit("")
+
 class ASTVisitorVisitor1b(ASDLVisitor):
 
     def visitModule(self, mod):
@@ -316,6 +343,15 @@ class ASTVisitorVisitor1b(ASDLVisitor):
         self.emit("")
 
 class ASTVisitorVisitor2(ASDLVisitor):
+    """Emits the BaseVisitor class.
+
+    All generated visitors dispatch statically: BaseVisitor is a CRTP
+    base (`self()` downcasts to the most derived visitor) and the
+    per-sum `visit_*_t()` helpers emitted by ASTVisitorVisitor1 select
+    the case with a switch on the node's type enum. There are no
+    virtual methods anywhere in the generated hierarchy, so the
+    compiler can inline the per-node handlers into hot pass loops.
+    """
 
     def visitModule(self, mod):
         self.emit("/" + "*"*78 + "/")
@@ -2318,8 +2354,9 @@ class SerializationVisitorVisitor(ASDLVisitor):
         self.emit("void visit_%s(const %s_t &x) {" % (name, name), 1)
         if cons:
             self.emit(    'self().write_int8(x.base.type);', 2)
-            self.emit(    'self().write_int64(x.base.base.loc.first);', 2)
-            self.emit(    'self().write_int64(x.base.base.loc.last);', 2)
+            # Locations are 32-bit (see location.h), so serialize them as such:
+            self.emit(    'self().write_int32(x.base.base.loc.first);', 2)
+            self.emit(    'self().write_int32(x.base.base.loc.last);', 2)
         self.used = False
         for n, field in enumerate(fields):
             self.visitField(field, cons, name)
@@ -2772,8 +2809,8 @@ class DeserializationVisitorVisitor(ASDLVisitor):
                     args.append("m_%s" % (f.name))
 
         self.emit(    'Location loc;', 2)
-        self.emit(    'loc.first = self().read_int64() + offset;', 2)
-        self.emit(    'loc.last = self().read_int64() + offset;', 2)
+        self.emit(    'loc.first = self().read_int32() + offset;', 2)
+        self.emit(    'loc.last = self().read_int32() + offset;', 2)
         for line in lines:
             self.emit(line, 2)
         self.emit(    'return %s::make_%s_t(%s);' % (subs["MOD"], name, ", ".join(args)), 2)
@@ -3088,7 +3125,8 @@ ast_visitors = [ASTNodeVisitor0, ASTNodeVisitor1, ASTNodeVisitor,
 
 asr_visitors = [ASTNodeVisitor0, ASTNodeVisitor1, ASTNodeVisitor]
 
-asr_base_visitor = [ASTVisitorVisitor1, ASTVisitorVisitor1b, ASTVisitorVisitor2]
+asr_base_visitor = [ASTVisitorVisitor1, NodeNameVisitor, ASTVisitorVisitor1b,
+        ASTVisitorVisitor2]
 
 asr_visitor_files = [
         ("serialization", SerializationVisitorVisitor),
@@ -35,7 +35,11 @@ class ASRBuilder {
         SetChar dep; dep.reserve(al, 1);
 
     // Symbols -----------------------------------------------------------------
-    ASR::expr_t *Variable(SymbolTable *symtab, std::string var_name,
+
+    // Declares `var_name` in `symtab` and hands back the created symbol
+    // itself; together with Var(sym) this lets callers reference what
+    // they just declared without ever resolving the name again.
+    ASR::symbol_t *VariableSymbol(SymbolTable *symtab, std::string var_name,
             ASR::ttype_t *type, ASR::intentType intent, ASR::symbol_t* type_decl=nullptr,
             ASR::abiType abi=ASR::abiType::Source, bool a_value_attr=false) {
         ASR::symbol_t* sym = ASR::down_cast<ASR::symbol_t>(
@@ -43,6 +47,14 @@ class ASRBuilder {
             intent, nullptr, nullptr, ASR::storage_typeType::Default, type, type_decl, abi,
             ASR::Public, ASR::presenceType::Required, a_value_attr));
         symtab->add_symbol(s2c(al, var_name), sym);
+        return sym;
+    }
+
+    ASR::expr_t *Variable(SymbolTable *symtab, std::string var_name,
+            ASR::ttype_t *type, ASR::intentType intent, ASR::symbol_t* type_decl=nullptr,
+            ASR::abiType abi=ASR::abiType::Source, bool a_value_attr=false) {
+        ASR::symbol_t* sym = VariableSymbol(symtab, var_name, type, intent,
+            type_decl, abi, a_value_attr);
         return ASRUtils::EXPR(ASR::make_Var_t(al, loc, sym));
     }
 
@@ -414,6 +426,15 @@ class ASRBuilder {
         return EXPR(ASR::make_Cast_t(al, loc, x, ASR::cast_kindType::ComplexToInteger, t, nullptr, nullptr));
     }
 
+    inline ASR::expr_t* l2i_t(ASR::expr_t* x, ASR::ttype_t* t) {
+        ASR::expr_t* value = ASRUtils::expr_value(x);
+        if ( value != nullptr ) {
+            bool val = ASR::down_cast<ASR::LogicalConstant_t>(value)->m_value;
+            value = i_t(val ? 1 : 0, t);
+        }
+        return EXPR(ASR::make_Cast_t(al, loc, x, ASR::cast_kindType::LogicalToInteger, t, value, nullptr));
+    }
+
     inline ASR::expr_t* c2c_t(ASR::expr_t* x, ASR::ttype_t* t) {
         return EXPR(ASR::make_Cast_t(al, loc, x, ASR::cast_kindType::ComplexToComplex, t, nullptr, nullptr));
     }
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <iomanip>
 #include <sstream>
 
@@ -19,11 +20,12 @@ std::string hexify(T i)
     return buf.str();
 }
 
-unsigned int symbol_table_counter = 0;
+// Atomic so that symbol tables can be created from worker threads (passes
+// sharded with --pass-jobs) without producing duplicate counter IDs
+std::atomic<unsigned int> symbol_table_counter{0};
 
 SymbolTable::SymbolTable(SymbolTable *parent) : parent{parent} {
-    symbol_table_counter++;
-    counter = symbol_table_counter;
+    counter = ++symbol_table_counter;
 }
 
 void SymbolTable::reset_global_counter() {
@@ -31,7 +33,21 @@ void SymbolTable::reset_global_counter() {
 }
 
 void SymbolTable::mark_all_variables_external(Allocator &al) {
+    mark_all_variables_external_impl(al, nullptr);
+}
+
+void SymbolTable::mark_all_variables_external(Allocator &al,
+        std::unordered_set<ASR::symbol_t*> &frozen) {
+    mark_all_variables_external_impl(al, &frozen);
+}
+
+void SymbolTable::mark_all_variables_external_impl(Allocator &al,
+        std::unordered_set<ASR::symbol_t*> *frozen) {
     for (auto &a : scope) {
+        if (frozen != nullptr && !frozen->insert(a.second).second) {
+            // already externalized by an earlier call and unchanged since
+            continue;
+        }
         switch (a.second->type) {
             case (ASR::symbolType::Variable) : {
                 ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(a.second);
@@ -74,8 +90,8 @@ ASR::symbol_t *SymbolTable::find_scoped_symbol(const std::string &name,
     const SymbolTable *s = this;
     for(size_t i=0; i < n_scope_names; i++) {
         std::string scope_name = m_scope_names[i];
-        if (s->scope.find(scope_name) != scope.end()) {
-            ASR::symbol_t *sym = s->scope.at(scope_name);
+        ASR::symbol_t *sym = s->get_symbol(scope_name);
+        if (sym != nullptr) {
             s = ASRUtils::symbol_symtab(sym);
             if (s == nullptr) {
                 // The m_scope_names[i] found in the appropriate symbol table,
@@ -88,9 +104,8 @@ ASR::symbol_t *SymbolTable::find_scoped_symbol(const std::string &name,
             return nullptr;
         }
     }
-    if (s->scope.find(name) != scope.end()) {
-        ASR::symbol_t *sym = s->scope.at(name);
-        LCOMPILERS_ASSERT(sym)
+    ASR::symbol_t *sym = s->get_symbol(name);
+    if (sym != nullptr) {
         return sym;
     } else {
         // The `name` not found in the appropriate symbol table
@@ -103,10 +118,19 @@ std::string SymbolTable::get_unique_name(const std::string &name, bool use_uniqu
     if( use_unique_id && !lcompilers_unique_ID_separate_compilation.empty()) {
         unique_name += "_" + lcompilers_unique_ID_separate_compilation;
     }
-    int counter = 1;
-    while (scope.find(unique_name) != scope.end()) {
-        unique_name = name + std::to_string(counter);
+    if (get_symbol(unique_name) == nullptr) {
+        return unique_name;
+    }
+    // Resume numbering where the previous request for this prefix left off;
+    // the suffixes below the memo are known to be taken:
+    int &counter = unique_name_suffix[name];
+    if (counter < 1) {
+        counter = 1;
+    }
+    unique_name = name + std::to_string(counter);
+    while (get_symbol(unique_name) != nullptr) {
         counter++;
+        unique_name = name + std::to_string(counter);
     }
     return unique_name;
 }
@@ -2,6 +2,9 @@
 #define LFORTRAN_SEMANTICS_ASR_SCOPES_H
 
 #include <map>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <libasr/alloc.h>
 #include <libasr/containers.h>
@@ -18,6 +21,19 @@ namespace ASR {
 struct SymbolTable {
     private:
     std::map<std::string, ASR::symbol_t*> scope;
+    // Hash index over `scope` for O(1) point lookups, which are on the hot
+    // path of semantics and every ASR pass. The string_view keys alias the
+    // `scope` map's keys, whose addresses are stable because std::map is
+    // node based. `scope` stays the canonical container, so iteration via
+    // get_scope() keeps its sorted, deterministic order.
+    std::unordered_map<std::string_view, ASR::symbol_t*> scope_index;
+    // Probe-start memo for get_unique_name(): the numeric suffix at which
+    // the last request for a given prefix found a free name. Passes mint
+    // thousands of temporaries with the same prefix per scope; resuming the
+    // probe here makes minting O(1) amortized instead of re-walking every
+    // taken suffix, while every candidate is still verified against the
+    // scope, so uniqueness never depends on the memo.
+    std::unordered_map<std::string, int> unique_name_suffix;
 
     public:
     SymbolTable *parent;
@@ -29,6 +45,9 @@ struct SymbolTable {
     unsigned int counter;
 
     SymbolTable(SymbolTable *parent);
+    // Not copyable: `scope_index` aliases the keys of `scope`
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
 
     // Determines a stable hash based on the content of the symbol table
     uint32_t get_hash_uint32(); // Returns the hash as an integer
@@ -40,14 +59,15 @@ struct SymbolTable {
     // Resolves the symbol `name` recursively in current and parent scopes.
     // Returns `nullptr` if symbol not found.
     ASR::symbol_t* resolve_symbol(const std::string &name) {
-        if (scope.find(name) == scope.end()) {
+        auto it = scope_index.find(std::string_view(name));
+        if (it == scope_index.end()) {
             if (parent) {
                 return parent->resolve_symbol(name);
             } else {
                 return nullptr;
             }
         }
-        return scope[name];
+        return it->second;
     }
 
     SymbolTable* get_global_scope() {
@@ -58,6 +78,11 @@ struct SymbolTable {
         return global_scope;
     }
 
+    // Ordered view of the scope. The name-sorted order of the returned
+    // map is a contract: codegen and the reference outputs depend on it
+    // for deterministic symbol emission, and it is already O(n) to
+    // iterate with no sorting or temporaries. Do not switch the backing
+    // container to one with a different (e.g. insertion) order.
     const std::map<std::string, ASR::symbol_t*>& get_scope() const {
         return scope;
     }
@@ -66,8 +91,8 @@ struct SymbolTable {
     // Returns `nullptr` if symbol not found.
     ASR::symbol_t* get_symbol(const std::string &name) const {
         //auto it = scope.find(to_lower(name));
-        auto it = scope.find(name);
-        if (it == scope.end()) {
+        auto it = scope_index.find(std::string_view(name));
+        if (it == scope_index.end()) {
             return nullptr;
         } else {
             return it->second;
@@ -77,30 +102,52 @@ struct SymbolTable {
     void erase_symbol(const std::string &name) {
         //auto it = scope.find(to_lower(name));
         LCOMPILERS_ASSERT(scope.find(name) != scope.end())
+        scope_index.erase(std::string_view(name));
         scope.erase(name);
     }
 
     // Add a new symbol that did not exist before
     void add_symbol(const std::string &name, ASR::symbol_t* symbol) {
         LCOMPILERS_ASSERT(scope.find(name) == scope.end())
-        scope[name] = symbol;
+        auto it = scope.emplace(name, symbol).first;
+        scope_index[std::string_view(it->first)] = symbol;
     }
 
     // Overwrite an existing symbol
     void overwrite_symbol(const std::string &name, ASR::symbol_t* symbol) {
         LCOMPILERS_ASSERT(scope.find(name) != scope.end())
-        scope[name] = symbol;
+        auto it = scope.find(name);
+        it->second = symbol;
+        scope_index[std::string_view(it->first)] = symbol;
     }
 
     // Use as the last resort, prefer to always either add a new symbol
     // or overwrite an existing one, not both
     void add_or_overwrite_symbol(const std::string &name, ASR::symbol_t* symbol) {
-        scope[name] = symbol;
+        auto it = scope.insert_or_assign(name, symbol).first;
+        scope_index[std::string_view(it->first)] = symbol;
     }
 
     // Marks all variables as external
     void mark_all_variables_external(Allocator &al);
 
+    // Same, but incremental: symbols already in `frozen` were fully
+    // externalized by an earlier call and have not changed since, so the
+    // walk skips them (including everything beneath them); every symbol
+    // processed now is added to the set. Interactive sessions call this
+    // once per cell, so without the set the walk revisits every previous
+    // cell's symbols and the per-cell cost grows with session length. A
+    // redefined symbol gets a new node, so its stale set entry simply
+    // never matches again.
+    void mark_all_variables_external(Allocator &al,
+        std::unordered_set<ASR::symbol_t*> &frozen);
+
+    private:
+    void mark_all_variables_external_impl(Allocator &al,
+        std::unordered_set<ASR::symbol_t*> *frozen);
+
+    public:
+
     ASR::symbol_t *find_scoped_symbol(const std::string &name,
         size_t n_scope_names, char **m_scope_names);
 
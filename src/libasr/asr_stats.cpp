@@ -0,0 +1,164 @@
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_stats.h>
+
+namespace LCompilers {
+
+namespace {
+
+// Counts every node by kind at the dispatcher level (visit_expr & co.),
+// so it never needs per-node handlers and stays O(nodes) with no
+// allocations besides the histogram maps.
+class StatsVisitor : public ASR::BaseWalkVisitor<StatsVisitor> {
+public:
+    std::map<std::string, size_t> symbol_hist, stmt_hist, expr_hist,
+        ttype_hist;
+    size_t n_symbols = 0, n_stmts = 0, n_exprs = 0, n_ttypes = 0;
+    size_t array_ops = 0;
+    int expr_depth = 0, max_expr_depth = 0;
+    size_t n_symtabs = 0, symtab_entries = 0, largest_symtab = 0;
+
+    struct FunctionStats {
+        std::string name;
+        size_t stmts;
+        int max_expr_depth;
+    };
+    std::vector<FunctionStats> functions;
+
+    // accumulators for the function currently being walked
+    size_t fn_stmts = 0;
+    int fn_max_expr_depth = 0;
+
+    // The generated walker reaches every statement and expression, but
+    // symbols are counted here by walking the scopes directly: the walk
+    // visitor dispatches scope members through the base visitor, which
+    // an override on visit_symbol would not intercept.
+    void count_symbols(SymbolTable &symtab) {
+        n_symtabs++;
+        size_t n = symtab.get_scope().size();
+        symtab_entries += n;
+        if (n > largest_symtab) {
+            largest_symtab = n;
+        }
+        for (auto &item : symtab.get_scope()) {
+            ASR::symbol_t *sym = item.second;
+            n_symbols++;
+            symbol_hist[ASR::symbol_type_name(sym->type)]++;
+            if (SymbolTable *nested = ASRUtils::symbol_symtab(sym)) {
+                count_symbols(*nested);
+            }
+        }
+    }
+
+    void visit_stmt(const ASR::stmt_t &x) {
+        n_stmts++;
+        fn_stmts++;
+        stmt_hist[ASR::stmt_type_name(x.type)]++;
+        ASR::BaseWalkVisitor<StatsVisitor>::visit_stmt(x);
+    }
+
+    void visit_expr(const ASR::expr_t &x) {
+        n_exprs++;
+        const char *name = ASR::expr_type_name(x.type);
+        expr_hist[name]++;
+        // Whole-array expressions and indexing dominate lowering cost
+        // (each one can expand into loops in the array passes).
+        if (strncmp(name, "Array", 5) == 0
+                || x.type == ASR::exprType::IntrinsicArrayFunction) {
+            array_ops++;
+        }
+        expr_depth++;
+        if (expr_depth > max_expr_depth) {
+            max_expr_depth = expr_depth;
+        }
+        if (expr_depth > fn_max_expr_depth) {
+            fn_max_expr_depth = expr_depth;
+        }
+        ASR::BaseWalkVisitor<StatsVisitor>::visit_expr(x);
+        expr_depth--;
+    }
+
+    void visit_ttype(const ASR::ttype_t &x) {
+        n_ttypes++;
+        ttype_hist[ASR::ttype_type_name(x.type)]++;
+        ASR::BaseWalkVisitor<StatsVisitor>::visit_ttype(x);
+    }
+
+    void visit_Function(const ASR::Function_t &x) {
+        size_t outer_stmts = fn_stmts;
+        int outer_max_depth = fn_max_expr_depth;
+        fn_stmts = 0;
+        fn_max_expr_depth = 0;
+        ASR::BaseWalkVisitor<StatsVisitor>::visit_Function(x);
+        functions.push_back({x.m_name, fn_stmts, fn_max_expr_depth});
+        // A nested function's statements also belong to its host's total.
+        fn_stmts += outer_stmts;
+        if (outer_max_depth > fn_max_expr_depth) {
+            fn_max_expr_depth = outer_max_depth;
+        }
+    }
+};
+
+void append_histogram(std::string &s, const std::string &key,
+        const std::map<std::string, size_t> &hist) {
+    s += "  \"" + key + "\": {";
+    bool first = true;
+    for (auto &entry : hist) {
+        if (!first) {
+            s += ",";
+        }
+        first = false;
+        s += "\n    \"" + entry.first + "\": "
+            + std::to_string(entry.second);
+    }
+    s += "\n  },\n";
+}
+
+} // anonymous namespace
+
+std::string asr_stats(const ASR::TranslationUnit_t &unit) {
+    StatsVisitor v;
+    v.count_symbols(*unit.m_symtab);
+    v.visit_TranslationUnit(unit);
+
+    std::string s = "{\n";
+    s += "  \"nodes\": {\n";
+    s += "    \"symbol\": " + std::to_string(v.n_symbols) + ",\n";
+    s += "    \"stmt\": " + std::to_string(v.n_stmts) + ",\n";
+    s += "    \"expr\": " + std::to_string(v.n_exprs) + ",\n";
+    s += "    \"ttype\": " + std::to_string(v.n_ttypes) + "\n";
+    s += "  },\n";
+    append_histogram(s, "symbol_histogram", v.symbol_hist);
+    append_histogram(s, "stmt_histogram", v.stmt_hist);
+    append_histogram(s, "expr_histogram", v.expr_hist);
+    append_histogram(s, "ttype_histogram", v.ttype_hist);
+    s += "  \"array_ops\": " + std::to_string(v.array_ops) + ",\n";
+    s += "  \"max_expr_depth\": " + std::to_string(v.max_expr_depth)
+        + ",\n";
+    s += "  \"symbol_tables\": {\n";
+    s += "    \"count\": " + std::to_string(v.n_symtabs) + ",\n";
+    s += "    \"entries\": " + std::to_string(v.symtab_entries) + ",\n";
+    s += "    \"largest\": " + std::to_string(v.largest_symtab) + "\n";
+    s += "  },\n";
+    s += "  \"functions\": [";
+    bool first = true;
+    for (auto &f : v.functions) {
+        if (!first) {
+            s += ",";
+        }
+        first = false;
+        s += "\n    {\"name\": \"" + f.name + "\", \"statements\": "
+            + std::to_string(f.stmts) + ", \"max_expr_depth\": "
+            + std::to_string(f.max_expr_depth) + "}";
+    }
+    s += "\n  ]\n";
+    s += "}\n";
+    return s;
+}
+
+} // namespace LCompilers
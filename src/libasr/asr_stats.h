@@ -0,0 +1,19 @@
+#ifndef LFORTRAN_ASR_STATS_H
+#define LFORTRAN_ASR_STATS_H
+
+#include <string>
+
+#include <libasr/asr.h>
+
+namespace LCompilers {
+
+    // Walks the ASR once and returns size and complexity statistics as
+    // JSON: node-kind histograms, per-function statement counts and
+    // maximum expression depth, array-operation counts and symbol table
+    // sizes. Meant for predicting compile cost and spotting generated
+    // files that need splitting, without dumping a full pickle.
+    std::string asr_stats(const ASR::TranslationUnit_t &unit);
+
+} // namespace LCompilers
+
+#endif // LFORTRAN_ASR_STATS_H
@@ -1,6 +1,17 @@
 #include "libasr/asr.h"
 #include <unordered_set>
+#include <unordered_map>
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <libasr/asr_utils.h>
 #include <libasr/string_utils.h>
 #include <libasr/serialization.h>
@@ -481,6 +492,18 @@ ASR::symbol_t* get_struct_sym_from_struct_expr(ASR::expr_t* expression)
             ASR::ArrayReshape_t* array_reshape = ASR::down_cast<ASR::ArrayReshape_t>(expression);
             return ASRUtils::symbol_get_past_external(ASRUtils::get_struct_sym_from_struct_expr(array_reshape->m_array));
         }
+        case ASR::exprType::IfExp: {
+            ASR::IfExp_t* if_exp = ASR::down_cast<ASR::IfExp_t>(expression);
+            ASR::symbol_t* body_struct_sym = ASRUtils::symbol_get_past_external(ASRUtils::get_struct_sym_from_struct_expr(if_exp->m_body));
+            ASR::symbol_t* orelse_struct_sym = ASRUtils::symbol_get_past_external(ASRUtils::get_struct_sym_from_struct_expr(if_exp->m_orelse));
+            if (body_struct_sym != nullptr) {
+                return body_struct_sym;
+            } else if (orelse_struct_sym != nullptr) {
+                return orelse_struct_sym;
+            } else {
+                return nullptr; // If no struct symbol found in either branch
+            }
+        }
         case ASR::exprType::ArraySize: {
             return nullptr;
         }
@@ -1080,13 +1103,27 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
         = ASR::down_cast2<ASR::TranslationUnit_t>(ASR::make_TranslationUnit_t(al, loc,
             symtab, nullptr, 0));
 
-    // Load any dependent modules recursively
-    bool rerun = true;
-    while (rerun) {
-        rerun = false;
-        std::vector<std::string> modules_list
-            = determine_module_dependencies(*tu);
-        for (auto &item : modules_list) {
+    // Load any dependent modules recursively. Only modules newly brought
+    // into the symbol table can introduce missing dependencies, so process
+    // a worklist seeded with the requested module instead of re-scanning
+    // every loaded module after each load; dependencies of unrelated,
+    // previously loaded modules are already present.
+    std::vector<ASR::Module_t*> worklist{mod2};
+    while (!worklist.empty()) {
+        ASR::Module_t *current = worklist.back();
+        worklist.pop_back();
+        // Warm the modfile byte cache for this module's missing
+        // dependencies in parallel; the loop below then only
+        // deserializes, in dependency order.
+        std::vector<std::string> missing_deps;
+        for (size_t i = 0; i < current->n_dependencies; i++) {
+            if (symtab->get_symbol(current->m_dependencies[i]) == nullptr) {
+                missing_deps.push_back(current->m_dependencies[i]);
+            }
+        }
+        prefetch_modfiles(missing_deps, pass_options);
+        for (size_t i = 0; i < current->n_dependencies; i++) {
+            std::string item = current->m_dependencies[i];
             if (symtab->get_symbol(item)
                     == nullptr) {
                 // A module that was loaded requires to load another
@@ -1096,12 +1133,12 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                 // in the ASR itself, or encode in the name in a robust way,
                 // such as using `module_name@intrinsic`:
                 bool is_intrinsic = startswith(item, "lfortran_intrinsic");
-                ASR::TranslationUnit_t *mod1 = nullptr;
+                ASR::TranslationUnit_t *dep_unit = nullptr;
                 Result<ASR::TranslationUnit_t*, ErrorMessage> res
                     = find_and_load_module(al, item, *symtab, is_intrinsic, pass_options, lm);
                 std::string error_message = "Module '" + item + "' modfile was not found";
                 if (res.ok) {
-                    mod1 = res.result;
+                    dep_unit = res.result;
                 } else {
                     error_message =  res.error.message;
                     if (!is_intrinsic) {
@@ -1112,7 +1149,7 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                                 = find_and_load_module(al, "lfortran_intrinsic_" + item,
                                 *symtab, true, pass_options, lm);
                             if (res.ok) {
-                                mod1 = res.result;
+                                dep_unit = res.result;
                             } else {
                                 error_message =  res.error.message;
                             }
@@ -1120,17 +1157,17 @@ ASR::Module_t* load_module(Allocator &al, SymbolTable *symtab,
                     }
                 }
 
-                if (mod1 == nullptr) {
+                if (dep_unit == nullptr) {
                     err(error_message, loc);
                 }
-                ASR::Module_t *mod2 = extract_module(*mod1);
-                symtab->add_symbol(item, (ASR::symbol_t*)mod2);
-                mod2->m_symtab->parent = symtab;
-                mod2->m_loaded_from_mod = true;
-                if ( generate_object_code && !startswith(mod2->m_name, "lfortran_intrinsic") ) {
-                    mod2->m_symtab->mark_all_variables_external(al);
+                ASR::Module_t *dep_mod = extract_module(*dep_unit);
+                symtab->add_symbol(item, (ASR::symbol_t*)dep_mod);
+                dep_mod->m_symtab->parent = symtab;
+                dep_mod->m_loaded_from_mod = true;
+                if ( generate_object_code && !startswith(dep_mod->m_name, "lfortran_intrinsic") ) {
+                    dep_mod->m_symtab->mark_all_variables_external(al);
                 }
-                rerun = true;
+                worklist.push_back(dep_mod);
             }
         }
     }
@@ -1237,6 +1274,13 @@ void load_dependent_submodules(Allocator &al, SymbolTable *symtab,
         rerun = false;
         std::vector<std::string> modules_list
             = determine_module_dependencies(*tu);
+        std::vector<std::string> missing_deps;
+        for (auto &item : modules_list) {
+            if (symtab->get_symbol(item) == nullptr) {
+                missing_deps.push_back(item);
+            }
+        }
+        prefetch_modfiles(missing_deps, pass_options);
         for (auto &item : modules_list) {
             if (symtab->get_symbol(item)
                     == nullptr) {
@@ -1338,6 +1382,185 @@ void set_intrinsic(ASR::TranslationUnit_t* trans_unit) {
     }
 }
 
+namespace {
+
+struct ModfileCacheEntry {
+    std::filesystem::file_time_type mtime;
+    // Either a shared read-only mapping of the file...
+    const char* map_addr = nullptr;
+    size_t map_len = 0;
+    // ...or, when mapping is unavailable, a private heap copy:
+    std::string contents;
+};
+
+std::mutex modfile_cache_mutex;
+std::unordered_map<std::string, ModfileCacheEntry> modfile_cache;
+uint64_t modfile_cache_mapped_bytes = 0;
+uint64_t modfile_cache_heap_bytes = 0;
+
+// Maps a modfile read-only and shared. Modfiles are immutable once
+// written (regeneration replaces the whole file), so a MAP_SHARED
+// PROT_READ mapping lets all compiler processes of a parallel build
+// share one physical copy of each modfile through the page cache,
+// instead of each holding a private heap copy for the process lifetime.
+bool map_modfile(const std::string &path, const char *&addr, size_t &len) {
+#if !defined(_WIN32)
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return false;
+    }
+    addr = static_cast<const char*>(p);
+    len = st.st_size;
+    return true;
+#else
+    (void)path; (void)addr; (void)len;
+    return false;
+#endif
+}
+
+// Reads a modfile (or submodule file) through a process-wide cache, so that
+// when many translation units are compiled in one driver invocation (possibly
+// from several worker threads) each modfile is read from disk only once. The
+// cache is keyed by path and invalidated on modification time, since the
+// driver can regenerate a modfile between two compilations in the same
+// process. Deserialization still happens per translation unit, because the
+// loaded ASR is owned by (and mutated through) the caller's allocator and
+// symbol table.
+bool read_modfile_cached(const std::string &path, std::string &out) {
+    std::error_code ec;
+    std::filesystem::file_time_type mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        // Cannot stat the file; fall back to an uncached read
+        return read_file(path, out);
+    }
+    {
+        std::lock_guard<std::mutex> lock(modfile_cache_mutex);
+        auto it = modfile_cache.find(path);
+        if (it != modfile_cache.end() && it->second.mtime == mtime) {
+            if (it->second.map_addr != nullptr) {
+                out.assign(it->second.map_addr, it->second.map_len);
+            } else {
+                out = it->second.contents;
+            }
+            return true;
+        }
+    }
+    const char *map_addr = nullptr;
+    size_t map_len = 0;
+    if (map_modfile(path, map_addr, map_len)) {
+        out.assign(map_addr, map_len);
+        std::lock_guard<std::mutex> lock(modfile_cache_mutex);
+        // A stale entry's old mapping is intentionally left mapped:
+        // another worker thread may still be copying from it, and a
+        // modfile changing mid-process is rare enough not to matter.
+        modfile_cache[path] = ModfileCacheEntry{mtime, map_addr, map_len, ""};
+        modfile_cache_mapped_bytes += map_len;
+        return true;
+    }
+    if (!read_file(path, out)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(modfile_cache_mutex);
+        modfile_cache[path] = ModfileCacheEntry{mtime, nullptr, 0, out};
+        modfile_cache_heap_bytes += out.size();
+    }
+    return true;
+}
+
+std::unordered_set<std::string> preloaded_modfile_dirs;
+
+// The runtime library's modfiles form a small, fixed prelude that nearly
+// every compilation loads part of. Read the whole directory into the byte
+// cache in one pass the first time it is consulted, so a cold start does a
+// single directory scan instead of a stat+open round-trip per module; the
+// per-entry mtime check still applies on later hits. Only worth doing for
+// the runtime directory, whose contents are few and almost always needed —
+// user include directories can be arbitrarily large.
+void preload_modfile_dir(const std::filesystem::path &dir) {
+    {
+        std::lock_guard<std::mutex> lock(modfile_cache_mutex);
+        if (!preloaded_modfile_dirs.insert(dir.string()).second) {
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::directory_iterator it(dir, ec), end;
+    for (; !ec && it != end; it.increment(ec)) {
+        std::string ext = it->path().extension().string();
+        if (ext == ".mod" || ext == ".smod") {
+            std::string contents;
+            read_modfile_cached(it->path().string(), contents);
+        }
+    }
+}
+
+} // anonymous namespace
+
+// Sizes held by the process-wide modfile byte cache, split into shared
+// file-backed mappings and private heap copies; shown by --time-report.
+void modfile_cache_stats(uint64_t &mapped_bytes, uint64_t &heap_bytes,
+        uint64_t &n_files) {
+    std::lock_guard<std::mutex> lock(modfile_cache_mutex);
+    mapped_bytes = modfile_cache_mapped_bytes;
+    heap_bytes = modfile_cache_heap_bytes;
+    n_files = modfile_cache.size();
+}
+
+// Deserialization must stay serial: the caller's allocator and the
+// symbol table id counter are shared mutable state. On a cold byte
+// cache, however, the open+read of each dependency's modfile dominates
+// loading, and those reads are independent, so warm the (thread-safe)
+// byte cache concurrently before the serial loads walk the dependency
+// order.
+void prefetch_modfiles(const std::vector<std::string> &module_names,
+        LCompilers::PassOptions &pass_options) {
+    if (module_names.size() < 2) {
+        return;
+    }
+    std::vector<std::filesystem::path> mod_files_dirs;
+    mod_files_dirs.push_back(std::filesystem::path(pass_options.runtime_library_dir));
+    mod_files_dirs.push_back(pass_options.mod_files_dir);
+    mod_files_dirs.insert(mod_files_dirs.end(),
+                          pass_options.include_dirs.begin(),
+                          pass_options.include_dirs.end());
+    unsigned n_workers = std::min({(unsigned) module_names.size(),
+        std::max(std::thread::hardware_concurrency(), 1u), 8u});
+    if (n_workers < 2) {
+        return;
+    }
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next.fetch_add(1)) < module_names.size()) {
+            std::filesystem::path filename {module_names[i] + ".mod"};
+            for (auto &dir : mod_files_dirs) {
+                std::string contents;
+                if (read_modfile_cached((dir / filename).string(), contents)) {
+                    break;
+                }
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < n_workers; t++) {
+        workers.emplace_back(worker);
+    }
+    for (auto &t : workers) {
+        t.join();
+    }
+}
+
 Result<ASR::TranslationUnit_t*, ErrorMessage> find_and_load_module(Allocator &al, const std::string &msym,
                                                 SymbolTable &symtab, bool intrinsic,
                                                 LCompilers::PassOptions& pass_options,
@@ -1346,6 +1569,8 @@ Result<ASR::TranslationUnit_t*, ErrorMessage> find_and_load_module(Allocator &al
     std::filesystem::path filename {msym + ".mod"};
     std::vector<std::filesystem::path> mod_files_dirs;
 
+    preload_modfile_dir(runtime_library_dir);
+
     mod_files_dirs.push_back( runtime_library_dir );
     mod_files_dirs.push_back( pass_options.mod_files_dir );
     mod_files_dirs.insert(mod_files_dirs.end(),
@@ -1356,7 +1581,7 @@ Result<ASR::TranslationUnit_t*, ErrorMessage> find_and_load_module(Allocator &al
     for (auto path : mod_files_dirs) {
         std::string modfile;
         std::filesystem::path full_path = path / filename;
-        if (read_file(full_path.string(), modfile)) {
+        if (read_modfile_cached(full_path.string(), modfile)) {
             if (modfile.empty()) {
                 found_empty_mod = true;
                 continue;
@@ -1385,7 +1610,7 @@ Result<ASR::TranslationUnit_t*, ErrorMessage> find_and_load_module(Allocator &al
                     fname.compare(fname.size() - smod_suffix.size(),
                                   smod_suffix.size(), smod_suffix) == 0) {
                     std::string smodfile;
-                    if (read_file(entry.path().string(), smodfile) && !smodfile.empty()) {
+                    if (read_modfile_cached(entry.path().string(), smodfile) && !smodfile.empty()) {
                         Result<ASR::TranslationUnit_t*, ErrorMessage> res = load_modfile(al, smodfile, false, symtab, lm);
                         if (res.ok) {
                             ASR::TranslationUnit_t* asr = res.result;
@@ -1427,7 +1652,7 @@ Result<std::vector<ASR::TranslationUnit_t*>, ErrorMessage> find_and_load_submodu
             std::string submod_filename = file.path().filename().string();
             if (startswith(submod_filename, smod_prefix) && endswith(submod_filename, ".smod")) {
                 std::string submodfile;
-                if (read_file(file.path().string(), submodfile) && !submodfile.empty()) {
+                if (read_modfile_cached(file.path().string(), submodfile) && !submodfile.empty()) {
                     Result<ASR::TranslationUnit_t*, ErrorMessage> sub_res = load_modfile(al, submodfile, false, symtab, lm);
                     if (sub_res.ok) {
                         ASR::TranslationUnit_t* asr = sub_res.result;
@@ -2950,9 +3175,16 @@ bool argument_types_match(const Vec<ASR::call_arg_t>& args,
                 }
 
                 if (!arg1_is_implicit) {
-                    Allocator al(512);
-                    if (!types_equal(arg1, arg2, args[i].m_value,
-                        ASRUtils::get_expr_from_sym(al, &f->base), false)) {
+                    // The expr built by get_expr_from_sym is only needed for
+                    // this comparison, so build it in a reused scratch arena
+                    // and rewind afterwards instead of constructing a fresh
+                    // Allocator per candidate argument
+                    thread_local Allocator scratch_al(512);
+                    Allocator::Checkpoint cp = scratch_al.checkpoint();
+                    bool match = types_equal(arg1, arg2, args[i].m_value,
+                        ASRUtils::get_expr_from_sym(scratch_al, &f->base), false);
+                    scratch_al.rewind(cp);
+                    if (!match) {
                         return false;
                     }
                 }
@@ -1,6 +1,8 @@
 #ifndef LFORTRAN_ASR_UTILS_H
 #define LFORTRAN_ASR_UTILS_H
 
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <map>
 #include <set>
@@ -86,23 +88,39 @@ void set_struct_sym_to_struct_expr(ASR::expr_t* expression, ASR::symbol_t* struc
 ASR::symbol_t* get_union_sym_from_union_expr(ASR::expr_t* expression);
 
 static inline std::string extract_real(const char *s) {
-    // TODO: this is inefficient. We should
-    // convert this in the tokenizer where we know most information
     std::string x = s;
     x = replace(x, "d", "e");
     x = replace(x, "D", "E");
     return x;
 }
 
+// Converts a Fortran real literal, rewriting the 'd'/'D' exponent marker to
+// 'e' in a stack buffer so the conversion is allocation free; every real
+// literal in a data-heavy file goes through here. Literals longer than the
+// buffer (only possible with pathological digit padding) take the
+// allocating path above.
+static inline double extract_real_impl(const char *s, bool single_precision) {
+    char buf[64];
+    std::size_t len = std::strlen(s);
+    if (len >= sizeof(buf)) {
+        std::string r_str = extract_real(s);
+        return single_precision ? std::strtof(r_str.c_str(), nullptr)
+            : std::strtod(r_str.c_str(), nullptr);
+    }
+    for (std::size_t i = 0; i <= len; i++) {
+        char c = s[i];
+        buf[i] = (c == 'd' || c == 'D') ? 'e' : c;
+    }
+    return single_precision ? std::strtof(buf, nullptr)
+        : std::strtod(buf, nullptr);
+}
+
 static inline double extract_real_4(const char *s) {
-    std::string r_str = ASRUtils::extract_real(s);
-    float r = std::strtof(r_str.c_str(), nullptr);
-    return r;
+    return extract_real_impl(s, true);
 }
 
 static inline double extract_real_8(const char *s) {
-    std::string r_str = ASRUtils::extract_real(s);
-    return std::strtod(r_str.c_str(), nullptr);
+    return extract_real_impl(s, false);
 }
 
 static inline ASR::expr_t* EXPR(const ASR::asr_t *f)
@@ -1381,6 +1399,14 @@ static inline SymbolTable *symbol_symtab(const ASR::symbol_t *f)
             return nullptr;
             //throw LCompilersException("GenericProcedure does not have a symtab");
         }
+        case ASR::symbolType::CustomOperator: {
+            return nullptr;
+            //throw LCompilersException("CustomOperator does not have a symtab");
+        }
+        case ASR::symbolType::Namelist: {
+            return nullptr;
+            //throw LCompilersException("Namelist does not have a symtab");
+        }
         case ASR::symbolType::Struct: {
             return ASR::down_cast<ASR::Struct_t>(f)->m_symtab;
         }
@@ -2784,6 +2810,18 @@ Result<ASR::TranslationUnit_t*, ErrorMessage> find_and_load_module(Allocator &al
                                                 LCompilers::PassOptions& pass_options,
                                                 LCompilers::LocationManager &lm);
 
+// Warms the modfile byte cache for a set of modules on a small thread
+// pool, so the serial loads that follow only deserialize. Names whose
+// modfile cannot be found are silently skipped; the regular load path
+// reports missing modfiles with proper errors.
+void prefetch_modfiles(const std::vector<std::string> &module_names,
+                       LCompilers::PassOptions &pass_options);
+
+// Sizes held by the process-wide modfile byte cache: bytes in shared
+// read-only file mappings, bytes in private heap copies, cached files
+void modfile_cache_stats(uint64_t &mapped_bytes, uint64_t &heap_bytes,
+                         uint64_t &n_files);
+
 Result<std::vector<ASR::TranslationUnit_t*>, ErrorMessage> find_and_load_submodules(Allocator &al, const std::string &msym,
                                                             SymbolTable &symtab,
                                                             LCompilers::PassOptions &pass_options,
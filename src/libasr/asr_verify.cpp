@@ -33,12 +33,15 @@ bool valid_name(const char *s) {
     return true;
 }
 
-class VerifyVisitor : public BaseWalkVisitor<VerifyVisitor>
+// `check_external` is a template parameter rather than a runtime flag so
+// that the external-symbol checks are compiled out of the walk entirely
+// when not requested, instead of being branched on per node
+template <bool check_external>
+class VerifyVisitor : public BaseWalkVisitor<VerifyVisitor<check_external>>
 {
 private:
     // For checking correct parent symbtab relationship
     SymbolTable *current_symtab;
-    bool check_external;
     diag::Diagnostics &diagnostics;
     std::string current_name;
 
@@ -65,7 +68,14 @@ private:
     const ASR::expr_t* current_expr {}; // current expression being visited 
 
 public:
-    VerifyVisitor(bool check_external, diag::Diagnostics &diagnostics) : check_external{check_external},
+    using Base = BaseWalkVisitor<VerifyVisitor<check_external>>;
+    using Base::visit_stmt;
+    using Base::visit_expr;
+    using Base::visit_ttype;
+    using Base::visit_symbol;
+    using Base::visit_array_index;
+
+    VerifyVisitor(diag::Diagnostics &diagnostics) :
         diagnostics{diagnostics}, non_global_symbol_visited{false}, _is_return_type_string{false} {}
 
     // Requires the condition `cond` to be true. Raise an exception otherwise.
@@ -105,6 +115,15 @@ public:
         return false;
     }
 
+    // Verifies a single symbol subtree instead of the whole translation
+    // unit. Invariants that span the entire tree (such as global symbol
+    // table ID uniqueness) are only checked within the subtree.
+    void verify_symbol_scoped(const symbol_t &sym) {
+        current_symtab = ASRUtils::symbol_parent_symtab(&sym);
+        this->visit_symbol(sym);
+        current_symtab = nullptr;
+    }
+
     void visit_TranslationUnit(const TranslationUnit_t &x) {
         current_symtab = x.m_symtab;
         require(x.m_symtab != nullptr,
@@ -145,7 +164,7 @@ public:
         require(fall_through == x.m_enable_fall_through,
             "Select_t::m_enable_fall_through should be " +
             std::to_string(x.m_enable_fall_through));
-        BaseWalkVisitor<VerifyVisitor>::visit_Select(x);
+        Base::visit_Select(x);
     }
 
     // --------------------------------------------------------
@@ -419,7 +438,7 @@ public:
             require(is_value_allocatable_array,
                 "Move assignment value must be an allocatable array");
         }
-        BaseWalkVisitor<VerifyVisitor>::visit_Assignment(x);
+        Base::visit_Assignment(x);
     }
 
     void visit_StructMethodDeclaration(const StructMethodDeclaration_t &x) {
@@ -848,7 +867,7 @@ public:
     void visit_expr(const expr_t &b){
         const ASR::expr_t* expr_tmp = current_expr;
         current_expr = &b;
-        BaseWalkVisitor<VerifyVisitor>::visit_expr(b);
+        Base::visit_expr(b);
         current_expr = expr_tmp;
     }
     
@@ -978,7 +997,7 @@ public:
 
     void visit_ImplicitDeallocate(const ImplicitDeallocate_t &x) {
         // TODO: check that every allocated variable is deallocated.
-        BaseWalkVisitor::visit_ImplicitDeallocate(x);
+        Base::visit_ImplicitDeallocate(x);
     }
 
     void check_var_external(const ASR::expr_t &x) {
@@ -1040,7 +1059,7 @@ public:
             require(ASRUtils::is_array(ASRUtils::expr_type(x.m_v)),
                 "ArraySize::m_v must be an array");
         }
-        BaseWalkVisitor<VerifyVisitor>::visit_ArraySize(x);
+        Base::visit_ArraySize(x);
     }
 
     void visit_DebugCheckArrayBounds(const ASR::DebugCheckArrayBounds_t& x) {
@@ -1058,7 +1077,7 @@ public:
                 require(ASRUtils::is_array(ASRUtils::expr_type(x.m_components[i])), "DebugCheckArrayBounds::m_components element must have an Array type");
             }
         }
-        BaseWalkVisitor<VerifyVisitor>::visit_DebugCheckArrayBounds(x);
+        Base::visit_DebugCheckArrayBounds(x);
     }
 
     void visit_ArraySection(const ArraySection_t &x) {
@@ -1275,7 +1294,7 @@ public:
     }
 
     void visit_ArrayPhysicalCast(const ASR::ArrayPhysicalCast_t& x) {
-        BaseWalkVisitor<VerifyVisitor>::visit_ArrayPhysicalCast(x);
+        Base::visit_ArrayPhysicalCast(x);
         if( x.m_old != ASR::array_physical_typeType::DescriptorArray ) {
             require(x.m_new != x.m_old, "ArrayPhysicalCast is redundant, "
                 "the old physical type and new physical type must be different.");
@@ -1414,7 +1433,7 @@ public:
 
     void visit_IntrinsicElementalFunction(const ASR::IntrinsicElementalFunction_t& x) {
         if( !check_external ) {
-            BaseWalkVisitor<VerifyVisitor>::visit_IntrinsicElementalFunction(x);
+            Base::visit_IntrinsicElementalFunction(x);
             return ;
         }
         ASRUtils::verify_function verify_ = ASRUtils::IntrinsicElementalFunctionRegistry
@@ -1423,13 +1442,13 @@ public:
         verify_(x, diagnostics);
         bool _inside_call_copy = _inside_call;
         _inside_call = true;
-        BaseWalkVisitor<VerifyVisitor>::visit_IntrinsicElementalFunction(x);
+        Base::visit_IntrinsicElementalFunction(x);
         _inside_call = _inside_call_copy;
     }
 
     void visit_IntrinsicArrayFunction(const ASR::IntrinsicArrayFunction_t& x) {
         if( !check_external ) {
-            BaseWalkVisitor<VerifyVisitor>::visit_IntrinsicArrayFunction(x);
+            Base::visit_IntrinsicArrayFunction(x);
             return ;
         }
         ASRUtils::verify_array_function verify_ = ASRUtils::IntrinsicArrayFunctionRegistry
@@ -1438,7 +1457,7 @@ public:
         verify_(x, diagnostics);
         bool _inside_call_copy = _inside_call;
         _inside_call = true;
-        BaseWalkVisitor<VerifyVisitor>::visit_IntrinsicArrayFunction(x);
+        Base::visit_IntrinsicArrayFunction(x);
         _inside_call = _inside_call_copy;
     }
 
@@ -1524,7 +1543,7 @@ public:
             require(ASR::is_a<ASR::Var_t>(*x.m_struct_var),
                 "ArrayConstructor::m_struct_vars must be nullptr or var to struct symbol");
         }
-        BaseWalkVisitor<VerifyVisitor>::visit_ArrayConstructor(x);
+        Base::visit_ArrayConstructor(x);
     }
 
     void visit_ArrayConstant(const ArrayConstant_t& x) {
@@ -1671,7 +1690,7 @@ public:
             require(current_expr && ASR::is_a<ASR::StringPhysicalCast_t>(*current_expr),
                 "Implicit length kind must appear in StringPhysicalCast expression.");
         }
-        BaseWalkVisitor<VerifyVisitor>::visit_String(x);
+        Base::visit_String(x);
     }
     void visit_StringPhysicalCast(const StringPhysicalCast_t &x){
         require(x.m_type, "x.m_type cannot be nullptr");
@@ -1683,7 +1702,7 @@ public:
             "(Length should be implicit).")
         require(str->m_len_kind == ImplicitLength,
             "StringPhysicalCast expression should have length kind of \"ImplicitLength\".")
-        BaseWalkVisitor<VerifyVisitor>::visit_StringPhysicalCast(x);
+        Base::visit_StringPhysicalCast(x);
     }
     void visit_StringSection(const StringSection_t &x){
         require(x.m_start, "StringSection start member must be provided")
@@ -1691,7 +1710,7 @@ public:
         require(x.m_step, "StringSection step member must be provided")
         require(ASR::is_a<ASR::String_t>(*x.m_type), "StringSection return type must be a string")
         require(ASRUtils::get_string_type(x.m_type)->m_len, "StringSection's string-return node must have length expression (NOT nullptr)")
-        BaseWalkVisitor<VerifyVisitor>::visit_StringSection(x);
+        Base::visit_StringSection(x);
     }
 
 
@@ -1728,7 +1747,7 @@ public:
             }
         }
 
-        BaseWalkVisitor<VerifyVisitor>::visit_Allocate(x);
+        Base::visit_Allocate(x);
     }
 
     void visit_DoConcurrentLoop(const DoConcurrentLoop_t &x) {
@@ -1740,7 +1759,7 @@ public:
             require(ASR::is_a<ASR::Var_t>(*x.m_shared[i]),
                 "DoConcurrentLoop::m_shared must be a Var");
         }
-        BaseWalkVisitor<VerifyVisitor>::visit_DoConcurrentLoop(x);
+        Base::visit_DoConcurrentLoop(x);
     }
 
 };
@@ -1750,9 +1769,31 @@ public:
 
 bool asr_verify(const ASR::TranslationUnit_t &unit, bool check_external,
             diag::Diagnostics &diagnostics) {
-    ASR::VerifyVisitor v(check_external, diagnostics);
     try {
-        v.visit_TranslationUnit(unit);
+        if (check_external) {
+            ASR::VerifyVisitor<true> v(diagnostics);
+            v.visit_TranslationUnit(unit);
+        } else {
+            ASR::VerifyVisitor<false> v(diagnostics);
+            v.visit_TranslationUnit(unit);
+        }
+    } catch (const ASRUtils::VerifyAbort &) {
+        LCOMPILERS_ASSERT(diagnostics.has_error())
+        return false;
+    }
+    return true;
+}
+
+bool asr_verify(const ASR::symbol_t &sym, bool check_external,
+            diag::Diagnostics &diagnostics) {
+    try {
+        if (check_external) {
+            ASR::VerifyVisitor<true> v(diagnostics);
+            v.verify_symbol_scoped(sym);
+        } else {
+            ASR::VerifyVisitor<false> v(diagnostics);
+            v.verify_symbol_scoped(sym);
+        }
     } catch (const ASRUtils::VerifyAbort &) {
         LCOMPILERS_ASSERT(diagnostics.has_error())
         return false;
@@ -38,6 +38,13 @@ namespace LCompilers {
     bool asr_verify(const ASR::TranslationUnit_t &unit,
         bool check_external, diag::Diagnostics &diagnostics);
 
+    // Scoped variant: verifies only the given symbol's subtree. Cheaper
+    // than whole-tree verification, but tree-wide invariants (e.g. symbol
+    // table ID uniqueness across units) are only checked within the
+    // subtree, so it complements rather than replaces the overload above.
+    bool asr_verify(const ASR::symbol_t &sym,
+        bool check_external, diag::Diagnostics &diagnostics);
+
 } // namespace LCompilers
 
 #endif // LFORTRAN_ASR_VERIFY_H
@@ -3,6 +3,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <string_view>
 
 #include <libasr/asr_utils.h>
 #include <libasr/exception.h>
@@ -125,25 +126,48 @@ class BinaryWriter
 private:
     std::string s;
 public:
+    // Moves the buffer out; the writer must not be used afterwards.
     std::string get_str() {
-        return s;
+        return std::move(s);
+    }
+
+    // Reserve ahead of a batch of writes so the buffer is not re-grown
+    // (and recopied) while they are appended.
+    void reserve(size_t n) {
+        s.reserve(s.size() + n);
     }
 
     void write_int8(uint8_t i) {
-        char c=i;
-        s.append(std::string(&c, 1));
+        s.push_back((char)i);
     }
 
     void write_int16(uint16_t i) {
-        s.append(uint16_to_string(i));
+        char b[2] = {
+            (char)((i >>  8) & 0xFF),
+            (char)( i        & 0xFF)};
+        s.append(b, sizeof(b));
     }
 
     void write_int32(uint32_t i) {
-        s.append(uint32_to_string(i));
+        char b[4] = {
+            (char)((i >> 24) & 0xFF),
+            (char)((i >> 16) & 0xFF),
+            (char)((i >>  8) & 0xFF),
+            (char)( i        & 0xFF)};
+        s.append(b, sizeof(b));
     }
 
     void write_int64(uint64_t i) {
-        s.append(uint64_to_string(i));
+        char b[8] = {
+            (char)((i >> 56) & 0xFF),
+            (char)((i >> 48) & 0xFF),
+            (char)((i >> 40) & 0xFF),
+            (char)((i >> 32) & 0xFF),
+            (char)((i >> 24) & 0xFF),
+            (char)((i >> 16) & 0xFF),
+            (char)((i >>  8) & 0xFF),
+            (char)( i        & 0xFF)};
+        s.append(b, sizeof(b));
     }
 
     void write_string(const std::string &t) {
@@ -158,14 +182,11 @@ public:
     }
 
     void write_uintptr(uintptr_t i) {
-        s.append(uintptr_to_string(i));
+        write_int64((uint64_t)i);
     }
 
     void write_void(void *p, int64_t n_data) {
-        for (int64_t i = 0; i < n_data; i++) {
-            uint8_t* p_i8 = (uint8_t*)p;
-            write_int8(p_i8[i]);
-        }
+        s.append((const char*)p, (size_t)n_data);
     }
 
 };
@@ -173,10 +194,12 @@ public:
 class BinaryReader
 {
 private:
-    std::string s;
+    // A view so that constructing a reader does not copy the buffer; the
+    // buffer must outlive the reader.
+    std::string_view s;
     size_t pos;
 public:
-    BinaryReader(const std::string &s) : s{s}, pos{0} {}
+    BinaryReader(std::string_view s) : s{s}, pos{0} {}
 
     uint8_t read_int8() {
         if (pos+1 > s.size()) {
@@ -215,11 +238,17 @@ public:
     }
 
     std::string read_string() {
+        return std::string(read_string_view());
+    }
+
+    // Like read_string(), but returns a view into the underlying buffer
+    // instead of copying. The view is only valid while the buffer is alive.
+    std::string_view read_string_view() {
         size_t n = read_int64();
         if (pos+n > s.size()) {
             throw LCompilersException("read_string: String is too short for deserialization.");
         }
-        std::string r = std::string(&s[pos], n);
+        std::string_view r = s.substr(pos, n);
         pos += n;
         return r;
     }
@@ -259,6 +288,10 @@ public:
         return s;
     }
 
+    void reserve(size_t n) {
+        s.reserve(s.size() + n);
+    }
+
     void write_int8(uint8_t i) {
         s.append(std::to_string(i));
         s += " ";
@@ -309,10 +342,12 @@ public:
 class TextReader
 {
 private:
-    std::string s;
+    // A view so that constructing a reader does not copy the buffer; the
+    // buffer must outlive the reader.
+    std::string_view s;
     size_t pos;
 public:
-    TextReader(const std::string &s) : s{s}, pos{0} {}
+    TextReader(std::string_view s) : s{s}, pos{0} {}
 
     uint8_t read_int8() {
         uint64_t n = read_int64();
@@ -373,13 +408,19 @@ public:
     }
 
     std::string read_string() {
+        return std::string(read_string_view());
+    }
+
+    // Like read_string(), but returns a view into the underlying buffer
+    // instead of copying. The view is only valid while the buffer is alive.
+    std::string_view read_string_view() {
         size_t n = read_int64();
         if (pos+n > s.size()) {
             throw LCompilersException("read_string: String is too short for deserialization.");
         }
-        std::string r = std::string(&s[pos], n);
+        std::string_view r = s.substr(pos, n);
         pos += n;
-        if (s[pos] != ' ') {
+        if (pos >= s.size() || s[pos] != ' ') {
             throw LCompilersException("read_string: Space expected.");
         }
         pos ++;
@@ -15,6 +15,7 @@
 
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ExecutionEngine/JITSymbol.h"
+#include "llvm/ExecutionEngine/ObjectCache.h"
 #include "llvm/ExecutionEngine/Orc/CompileUtils.h"
 #include "llvm/ExecutionEngine/Orc/Core.h"
 #include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
@@ -23,6 +24,11 @@
 #include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
 #endif
 #include "llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h"
+#if LLVM_VERSION_MAJOR >= 10 && LLVM_VERSION_MAJOR < 21
+#include "llvm/ExecutionEngine/Orc/CompileOnDemandLayer.h"
+#include "llvm/ExecutionEngine/Orc/IndirectionUtils.h"
+#include "llvm/ExecutionEngine/Orc/LazyReexports.h"
+#endif
 #include "llvm/ExecutionEngine/SectionMemoryManager.h"
 #include "llvm/IR/DataLayout.h"
 #include "llvm/IR/LLVMContext.h"
@@ -57,6 +63,14 @@ private:
   std::unique_ptr<ExecutionSession> ES;
   RTDyldObjectLinkingLayer ObjectLayer;
   IRCompileLayer CompileLayer;
+#if LLVM_VERSION_MAJOR >= 10 && LLVM_VERSION_MAJOR < 21
+  // Lazy compilation: functions added through the CODLayer are materialized
+  // only when first called, so interactive sessions do not pay codegen for
+  // helpers a cell never executes. Both stay null on targets without
+  // lazy call-through support, in which case addModule() compiles eagerly.
+  std::unique_ptr<LazyCallThroughManager> LCTM;
+  std::unique_ptr<CompileOnDemandLayer> CODLayer;
+#endif
 
   DataLayout DL;
   MangleAndInterner Mangle;
@@ -112,7 +126,35 @@ public:
       ObjectLayer.setOverrideObjectFlagsWithResponsibilityFlags(true);
       ObjectLayer.setAutoClaimResponsibilityForObjectSymbols(true);
     }
+#if LLVM_VERSION_MAJOR >= 10 && LLVM_VERSION_MAJOR < 21
+    // LLVM 21 reworked the lazy reexports API; until the port is done it
+    // keeps the eager path, as do targets without call-through support.
+    auto LCTM_P = createLocalLazyCallThroughManager(
+        JTMB.getTargetTriple(), *this->ES, 0);
+    if (LCTM_P) {
+      LCTM = std::move(*LCTM_P);
+      CODLayer = std::make_unique<CompileOnDemandLayer>(
+          *this->ES, CompileLayer, *LCTM,
+          createLocalIndirectStubsManagerBuilder(JTMB.getTargetTriple()));
+    } else {
+      consumeError(LCTM_P.takeError());
+    }
+#endif
   }
+  ~KaleidoscopeJIT() {
+#if LLVM_VERSION_MAJOR >= 13
+    // End the session while the layers are still alive: materialized code
+    // (including lazy call-through stubs) holds registered EH frames and
+    // resource trackers that the object layer must deregister. Without
+    // this, destroying the JIT leaves stale frame entries behind and a
+    // later throw crashes inside _Unwind_Find_FDE.
+    if (ES) {
+      if (auto Err = ES->endSession())
+        ES->reportError(std::move(Err));
+    }
+#endif
+  }
+
 #else
   // LLVM 7: Constructor takes TargetMachine directly, different API structure
   KaleidoscopeJIT(std::unique_ptr<TargetMachine> TM_)
@@ -126,7 +168,9 @@ public:
   }
 #endif
 
-  static Expected<std::unique_ptr<KaleidoscopeJIT>> Create() {
+  // `fast` selects the codegen tier: aggressive instruction selection for
+  // optimized builds, CodeGenOpt::None for fast turnaround otherwise.
+  static Expected<std::unique_ptr<KaleidoscopeJIT>> Create(bool fast = false) {
 #if LLVM_VERSION_MAJOR >= 13
     auto EPC = SelfExecutorProcessControl::Create();
     if (!EPC)
@@ -151,10 +195,18 @@ public:
       return make_error<StringError>("Could not create target machine",
                                      inconvertibleErrorCode());
     
+    (void) fast;
     return std::make_unique<KaleidoscopeJIT>(std::unique_ptr<TargetMachine>(JTMB));
 #endif
 
 #if LLVM_VERSION_MAJOR >= 8
+#if LLVM_VERSION_MAJOR >= 18
+    JTMB.setCodeGenOptLevel(fast ? CodeGenOptLevel::Aggressive
+                                 : CodeGenOptLevel::None);
+#else
+    JTMB.setCodeGenOptLevel(fast ? CodeGenOpt::Aggressive
+                                 : CodeGenOpt::None);
+#endif
     auto DL = JTMB.getDefaultDataLayoutForTarget();
     if (!DL)
       return DL.takeError();
@@ -166,8 +218,28 @@ public:
 
   const DataLayout &getDataLayout() const { return DL; }
 
+  // Installs an object cache on the IR compiler; compiled objects are
+  // offered to the cache and cache hits skip codegen entirely. No-op on
+  // LLVM versions whose compile layer does not expose its compiler.
+  void setObjectCache(ObjectCache *Cache) {
+#if LLVM_VERSION_MAJOR >= 11
+    static_cast<ConcurrentIRCompiler &>(CompileLayer.getCompiler())
+        .setObjectCache(Cache);
+#else
+    (void) Cache;
+#endif
+  }
+
 #if LLVM_VERSION_MAJOR >= 8
   Error addModule(std::unique_ptr<Module> M, std::unique_ptr<LLVMContext> &Ctx) {
+#if LLVM_VERSION_MAJOR >= 10 && LLVM_VERSION_MAJOR < 21
+    if (CODLayer) {
+      auto res = CODLayer->add(JITDL,
+                              ThreadSafeModule(std::move(M), std::move(Ctx)));
+      Ctx = std::make_unique<LLVMContext>();
+      return res;
+    }
+#endif
     auto res =  CompileLayer.add(JITDL,
                             ThreadSafeModule(std::move(M), std::move(Ctx)));
     Ctx = std::make_unique<LLVMContext>();
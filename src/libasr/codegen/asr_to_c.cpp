@@ -95,7 +95,8 @@ public:
                              bool declare_value, bool is_fixed_size,
                              bool is_pointer,
                              ASR::abiType m_abi,
-                             bool is_simd_array) {
+                             bool is_simd_array,
+                             bool no_alias) {
         std::string indent(indentation_level*indentation_spaces, ' ');
         std::string type_name_copy = type_name;
         std::string original_type_name = type_name;
@@ -154,7 +155,14 @@ public:
             if( m_abi == ASR::abiType::BindC ) {
                 sub = format_type_c("", type_name_copy, v_m_name + "[]", use_ref, dummy);
             } else {
-                sub = format_type_c("", type_name, v_m_name, use_ref, dummy);
+                std::string qualified_type_name = type_name;
+                if( dummy && no_alias && !is_pointer ) {
+                    // Fortran forbids dummy arguments from aliasing each
+                    // other unless they carry the pointer or target
+                    // attribute, so let the C compiler know
+                    qualified_type_name += " restrict";
+                }
+                sub = format_type_c("", qualified_type_name, v_m_name, use_ref, dummy);
             }
         }
     }
@@ -232,7 +240,8 @@ public:
                                     v.m_intent != ASRUtils::intent_out &&
                                     v.m_intent != ASRUtils::intent_unspecified &&
                                     !is_struct_type_member && !is_module_var) || force_declare,
-                                    is_fixed_size, false, ASR::abiType::Source, is_simd_array);
+                                    is_fixed_size, false, ASR::abiType::Source, is_simd_array,
+                                    !v.m_target_attr);
             }
         } else {
             bool is_fixed_size = true;
@@ -242,7 +251,14 @@ public:
                 v_m_name = const_name;
             }
             dims = convert_dims_c(n_dims, m_dims, v_m_type, is_fixed_size);
-            sub = format_type_c(dims, type_name, v_m_name, use_ref, dummy);
+            if( use_ref && dummy && !v.m_target_attr ) {
+                // intent(out)/intent(inout) scalars are passed by pointer
+                // and cannot alias any other argument either
+                sub = format_type_c(dims, type_name + " *restrict", v_m_name,
+                                    false, dummy);
+            } else {
+                sub = format_type_c(dims, type_name, v_m_name, use_ref, dummy);
+            }
         }
     }
 
@@ -306,7 +322,8 @@ public:
                                         v.m_intent != ASRUtils::intent_in &&
                                         v.m_intent != ASRUtils::intent_inout &&
                                         v.m_intent != ASRUtils::intent_out &&
-                                        v.m_intent != ASRUtils::intent_unspecified, is_fixed_size, true, ASR::abiType::Source, false);
+                                        v.m_intent != ASRUtils::intent_unspecified, is_fixed_size, true, ASR::abiType::Source, false,
+                                        false);
                 } else {
                     bool is_fixed_size = true;
                     std::string dims = convert_dims_c(n_dims, m_dims, v_m_type, is_fixed_size);
@@ -329,7 +346,8 @@ public:
                                         v.m_intent != ASRUtils::intent_inout &&
                                         v.m_intent != ASRUtils::intent_out &&
                                         v.m_intent != ASRUtils::intent_unspecified,
-                                        is_fixed_size, true, ASR::abiType::Source, false);
+                                        is_fixed_size, true, ASR::abiType::Source, false,
+                                        false);
                 } else {
                     bool is_fixed_size = true;
                     std::string dims = convert_dims_c(n_dims, m_dims, v_m_type, is_fixed_size);
@@ -365,7 +383,8 @@ public:
                                         v.m_intent != ASRUtils::intent_inout &&
                                         v.m_intent != ASRUtils::intent_out &&
                                         v.m_intent != ASRUtils::intent_unspecified,
-                                        is_fixed_size, true, ASR::abiType::Source, is_simd_array);
+                                        is_fixed_size, true, ASR::abiType::Source, is_simd_array,
+                                        false);
                 } else {
                     bool is_fixed_size = true;
                     std::string dims = convert_dims_c(n_dims, m_dims, v_m_type, is_fixed_size);
@@ -385,7 +404,8 @@ public:
                                         v.m_intent != ASRUtils::intent_inout &&
                                         v.m_intent != ASRUtils::intent_out &&
                                         v.m_intent != ASRUtils::intent_unspecified,
-                                        is_fixed_size, false, ASR::abiType::Source, false);
+                                        is_fixed_size, false, ASR::abiType::Source, false,
+                                        false);
                  } else {
                     std::string ptr_char = "*";
                     if( !use_ptr_for_derived_type ) {
@@ -456,7 +476,8 @@ public:
                                         v.m_intent != ASRUtils::intent_inout &&
                                         v.m_intent != ASRUtils::intent_out &&
                                         v.m_intent != ASRUtils::intent_unspecified,
-                                        is_fixed_size, false, ASR::abiType::Source, false);
+                                        is_fixed_size, false, ASR::abiType::Source, false,
+                                        !v.m_target_attr);
                 } else if( v.m_intent == ASRUtils::intent_local && pre_initialise_derived_type) {
                     bool is_fixed_size = true;
                     dims = convert_dims_c(n_dims, m_dims, v_m_type, is_fixed_size);
@@ -518,7 +539,8 @@ public:
                                         v.m_intent != ASRUtils::intent_out &&
                                         v.m_intent != ASRUtils::intent_unspecified, is_fixed_size,
                                         false,
-                                        ASR::abiType::Source, false);
+                                        ASR::abiType::Source, false,
+                                        !v.m_target_attr);
                 } else {
                     bool is_fixed_size = true;
                     dims = convert_dims_c(n_dims, m_dims, v_m_type, is_fixed_size);
@@ -169,6 +169,20 @@ public:
         src << ") {\n";
         indent_level++;
 
+        // Reduce-clause kernels carry trailing GpuReduction statements;
+        // each needs a shared-memory scratch array sized to the launch
+        // block size for the tree combine
+        for (size_t i = 0; i < x.n_body; i++) {
+            if (!ASR::is_a<ASR::GpuReduction_t>(*x.m_body[i])) continue;
+            ASR::GpuReduction_t *red =
+                ASR::down_cast<ASR::GpuReduction_t>(x.m_body[i]);
+            std::string target_name(ASRUtils::symbol_name(
+                ASR::down_cast<ASR::Var_t>(red->m_target)->m_v));
+            src << get_indent() << "__shared__ "
+                << cuda_type(ASRUtils::expr_type(red->m_value))
+                << " __red_scratch_" << target_name << "[256];\n";
+        }
+
         // Declare local variables (non-argument variables in kernel scope)
         for (auto &item : x.m_symtab->get_scope()) {
             if (ASR::is_a<ASR::Variable_t>(*item.second)) {
@@ -259,11 +273,112 @@ public:
                 src << get_indent() << "return;\n";
                 break;
             }
+            case ASR::stmtType::GpuReduction: {
+                emit_gpu_reduction(ASR::down_cast<ASR::GpuReduction_t>(stmt));
+                break;
+            }
             default:
                 break;
         }
     }
 
+    // Block-level tree reduction in shared memory followed by a single
+    // atomic combine per block into the 1-element device result buffer
+    void emit_gpu_reduction(ASR::GpuReduction_t *red) {
+        std::string target_name(ASRUtils::symbol_name(
+            ASR::down_cast<ASR::Var_t>(red->m_target)->m_v));
+        std::string scratch = "__red_scratch_" + target_name;
+        std::string lhs = scratch + "[threadIdx.x]";
+        std::string rhs = scratch + "[threadIdx.x + __s]";
+        ASR::ttype_t *vtype = ASRUtils::expr_type(red->m_value);
+        bool is_int = ASRUtils::is_integer(*vtype);
+        int kind = ASRUtils::extract_kind_from_ttype_t(vtype);
+
+        src << get_indent() << lhs << " = ";
+        visit_expr(red->m_value);
+        src << ";\n";
+        src << get_indent() << "__syncthreads();\n";
+        src << get_indent()
+            << "for (unsigned int __s = blockDim.x / 2; __s > 0; __s >>= 1) {\n";
+        indent_level++;
+        src << get_indent() << "if (threadIdx.x < __s) {\n";
+        indent_level++;
+        src << get_indent() << lhs << " = ";
+        switch (red->m_op) {
+            case ASR::reduction_opType::ReduceAdd:
+                src << lhs << " + " << rhs; break;
+            case ASR::reduction_opType::ReduceMIN:
+                src << "min(" << lhs << ", " << rhs << ")"; break;
+            default:
+                src << "max(" << lhs << ", " << rhs << ")"; break;
+        }
+        src << ";\n";
+        indent_level--;
+        src << get_indent() << "}\n";
+        src << get_indent() << "__syncthreads();\n";
+        indent_level--;
+        src << get_indent() << "}\n";
+
+        src << get_indent() << "if (threadIdx.x == 0) {\n";
+        indent_level++;
+        if (red->m_op == ASR::reduction_opType::ReduceAdd) {
+            src << get_indent() << "atomicAdd(&" << target_name << "[0], "
+                << scratch << "[0]);\n";
+        } else if (is_int) {
+            const char *fn = red->m_op == ASR::reduction_opType::ReduceMIN
+                ? "atomicMin" : "atomicMax";
+            if (kind == 8) {
+                src << get_indent() << fn << "((long long*)&" << target_name
+                    << "[0], (long long)" << scratch << "[0]);\n";
+            } else {
+                src << get_indent() << fn << "(&" << target_name << "[0], "
+                    << scratch << "[0]);\n";
+            }
+        } else {
+            // No native float/double atomicMin/Max: compare-and-swap on
+            // the bit pattern until this block's partial is folded in
+            const char *cmb = red->m_op == ASR::reduction_opType::ReduceMIN
+                ? "min" : "max";
+            if (kind == 8) {
+                src << get_indent()
+                    << "unsigned long long *__dst = (unsigned long long*)&"
+                    << target_name << "[0];\n";
+                src << get_indent()
+                    << "unsigned long long __old = *__dst, __assumed;\n";
+                src << get_indent() << "do {\n";
+                indent_level++;
+                src << get_indent() << "__assumed = __old;\n";
+                src << get_indent()
+                    << "double __new = " << cmb
+                    << "(__longlong_as_double(__assumed), " << scratch
+                    << "[0]);\n";
+                src << get_indent()
+                    << "__old = atomicCAS(__dst, __assumed, "
+                    << "__double_as_longlong(__new));\n";
+                indent_level--;
+                src << get_indent() << "} while (__old != __assumed);\n";
+            } else {
+                src << get_indent() << "unsigned int *__dst = (unsigned int*)&"
+                    << target_name << "[0];\n";
+                src << get_indent()
+                    << "unsigned int __old = *__dst, __assumed;\n";
+                src << get_indent() << "do {\n";
+                indent_level++;
+                src << get_indent() << "__assumed = __old;\n";
+                src << get_indent()
+                    << "float __new = " << cmb
+                    << "(__uint_as_float(__assumed), " << scratch << "[0]);\n";
+                src << get_indent()
+                    << "__old = atomicCAS(__dst, __assumed, "
+                    << "__float_as_uint(__new));\n";
+                indent_level--;
+                src << get_indent() << "} while (__old != __assumed);\n";
+            }
+        }
+        indent_level--;
+        src << get_indent() << "}\n";
+    }
+
     void emit_intrinsic(ASR::IntrinsicElementalFunction_t *f) {
         using IEF = ASRUtils::IntrinsicElementalFunctions;
         int64_t id = f->m_intrinsic_id;
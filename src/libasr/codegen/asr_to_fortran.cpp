@@ -372,7 +372,9 @@ public:
                 r += src;
             }
         }
-        src = r;
+        // The buffer holds the whole output at this point; move it instead
+        // of copying to keep the peak memory usage down on large inputs
+        src = std::move(r);
     }
 
     /********************************* Symbol *********************************/
@@ -450,7 +452,7 @@ public:
         r += " ";
         r.append(x.m_name);
         r += "\n";
-        src = r;
+        src = std::move(r);
     }
 
     void visit_Module(const ASR::Module_t &x) {
@@ -554,7 +556,7 @@ public:
         r += " ";
         r.append(x.m_name);
         r += "\n";
-        src = r;
+        src = std::move(r);
     }
 
     void visit_Function(const ASR::Function_t &x) {
@@ -2342,6 +2344,24 @@ public:
         std::string intrinsic_func_name = ASRUtils::get_array_intrinsic_name(static_cast<int64_t>(x.m_arr_intrinsic_id));
         if(intrinsic_func_name == "DotProduct") intrinsic_func_name = "dot_product";
         if(intrinsic_func_name == "Reduce") intrinsic_func_name = "reduce";
+        if (intrinsic_func_name == "MatMul" &&
+                x.m_overload_id >= 4 && x.m_overload_id <= 6) {
+            // Overload ids 4-6 mark operands whose transpose() was folded
+            // into the matmul at creation; reprint it so the emitted source
+            // keeps the original semantics.
+            visit_expr(*x.m_args[0]);
+            std::string left = src;
+            if (x.m_overload_id != 5) {
+                left = "transpose(" + left + ")";
+            }
+            visit_expr(*x.m_args[1]);
+            std::string right = src;
+            if (x.m_overload_id != 4) {
+                right = "transpose(" + right + ")";
+            }
+            src = "matmul(" + left + ", " + right + ")";
+            return;
+        }
         if(intrinsic_func_name == "Spread" && x.m_overload_id == -1){
             ASR::ArrayPhysicalCast_t *arr_physical = ASR::down_cast<ASR::ArrayPhysicalCast_t>(x.m_args[0]);
             if(ASR::is_a<ASR::ArrayConstant_t>(*arr_physical->m_arg)){
@@ -3127,7 +3147,54 @@ Result<std::string> asr_to_fortran(ASR::TranslationUnit_t &asr,
         diagnostics.diagnostics.push_back(e.d);
         return Error();
     }
-    return v.src;
+    return std::move(v.src);
+}
+
+Result<std::vector<FortranProgramUnit>> asr_to_fortran_units(
+        ASR::TranslationUnit_t &asr, diag::Diagnostics &diagnostics,
+        bool color, int indent) {
+    ASRToFortranVisitor v(color, indent);
+    std::vector<FortranProgramUnit> units;
+    try {
+        // Same unit order as visit_TranslationUnit: modules in build order,
+        // then the main programs; each unit is moved out of the visitor as
+        // soon as it is finished, so at no point does the text of more than
+        // one unit live in the buffer
+        std::vector<std::string> build_order
+            = ASRUtils::determine_module_dependencies(asr);
+        for (auto &item : build_order) {
+            LCOMPILERS_ASSERT(asr.m_symtab->get_symbol(item) != nullptr);
+            ASR::symbol_t *mod = asr.m_symtab->get_symbol(item);
+            v.src.clear();
+            v.visit_symbol(*mod);
+            // Skipped intrinsic modules leave the buffer empty
+            if (!v.src.empty()) {
+                units.push_back({item, std::move(v.src)});
+            }
+        }
+
+        v.tu_functions = "";
+        for (auto &item : asr.m_symtab->get_scope()) {
+            if (is_a<ASR::Function_t>(*item.second)
+                    || is_a<ASR::GpuKernelFunction_t>(*item.second)) {
+                v.visit_symbol(*item.second);
+                v.tu_functions += v.src;
+                v.tu_functions += "\n";
+            }
+        }
+
+        for (auto &item : asr.m_symtab->get_scope()) {
+            if (is_a<ASR::Program_t>(*item.second)) {
+                v.src.clear();
+                v.visit_symbol(*item.second);
+                units.push_back({item.first, std::move(v.src)});
+            }
+        }
+    } catch (const CodeGenError &e) {
+        diagnostics.diagnostics.push_back(e.d);
+        return Error();
+    }
+    return units;
 }
 
 } // namespace LCompilers
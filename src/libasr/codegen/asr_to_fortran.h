@@ -1,6 +1,8 @@
 #ifndef LFORTRAN_ASR_TO_FORTRAN_H
 #define LFORTRAN_ASR_TO_FORTRAN_H
 
+#include <vector>
+
 #include <libasr/asr.h>
 #include <libasr/asr_utils.h>
 
@@ -10,6 +12,21 @@ namespace LCompilers {
     Result<std::string> asr_to_fortran(ASR::TranslationUnit_t &asr,
             diag::Diagnostics &diagnostics, bool color, int indent);
 
+    // One top-level program unit (module or program) of the generated
+    // Fortran source
+    struct FortranProgramUnit {
+        std::string name;
+        std::string source;
+    };
+
+    // Converts ASR to Fortran source code, one program unit at a time.
+    // Modules come first in build order, then programs; the text of the
+    // whole translation unit is never concatenated, so callers can write
+    // each unit to its own file and keep memory usage flat on large inputs
+    Result<std::vector<FortranProgramUnit>> asr_to_fortran_units(
+            ASR::TranslationUnit_t &asr, diag::Diagnostics &diagnostics,
+            bool color, int indent);
+
 } // namespace LCompilers
 
 #endif // LFORTRAN_ASR_TO_FORTRAN_H
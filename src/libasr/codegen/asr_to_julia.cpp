@@ -1964,12 +1964,22 @@ public:
         switch (x.m_arr_intrinsic_id) {
             SET_ARR_INTRINSIC_NAME(Sum, "sum");
             case (static_cast<int64_t>(ASRUtils::IntrinsicArrayFunctions::MatMul)) : {
+                // Overload ids 4-6 mark operands whose transpose() was
+                // folded into the matmul at creation; reprint it here.
                 visit_expr(*x.m_args[0]);
                 std::string left = std::move(src);
                 int left_precedence = last_expr_precedence;
+                if (x.m_overload_id == 4 || x.m_overload_id == 6) {
+                    left = "transpose(" + left + ")";
+                    left_precedence = julia_prec::Base;
+                }
                 visit_expr(*x.m_args[1]);
                 std::string right = std::move(src);
                 int right_precedence = last_expr_precedence;
+                if (x.m_overload_id == 5 || x.m_overload_id == 6) {
+                    right = "transpose(" + right + ")";
+                    right_precedence = julia_prec::Base;
+                }
                 last_expr_precedence = julia_prec::Mul;
                 src = format_binop(left, "*", right, left_precedence, right_precedence);
                 return;
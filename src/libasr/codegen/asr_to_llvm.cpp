@@ -271,6 +271,8 @@ public:
 
     llvm::Value *tmp;
     llvm::BasicBlock *proc_return;
+    // whether the current procedure opened an arena region on entry
+    bool emit_arena_region = false;
     std::string mangle_prefix;
     bool prototype_only;
     llvm::StructType *complex_type_4, *complex_type_8;
@@ -289,12 +291,12 @@ public:
     std::map<std::string, std::string> dertype2parent;
     std::map<std::string, std::map<std::string, int>> name2memidx;
 
-    std::map<uint64_t, llvm::Value*> llvm_symtab; // llvm_symtab_value
+    std::unordered_map<uint64_t, llvm::Value*> llvm_symtab; // llvm_symtab_value
     std::map<std::pair<uint64_t, SymbolTable*>, llvm::Value*> llvm_symtab_deep_copy;
-    std::map<uint64_t, llvm::Function*> llvm_symtab_fn;
+    std::unordered_map<uint64_t, llvm::Function*> llvm_symtab_fn;
     std::map<std::string, uint64_t> llvm_symtab_fn_names;
-    std::map<uint64_t, llvm::Value*> llvm_symtab_fn_arg;
-    std::map<uint64_t, llvm::BasicBlock*> llvm_goto_targets;
+    std::unordered_map<uint64_t, llvm::Value*> llvm_symtab_fn_arg;
+    std::unordered_map<uint64_t, llvm::BasicBlock*> llvm_goto_targets;
     std::unordered_map<const ASR::symbol_t*, llvm::BasicBlock*> symbol_to_returnBlock; /// Get Symbol's Return Block -- Used for Finalization. See LLVMFinalize
     std::set<uint32_t> global_string_allocated;
     const ASR::Function_t *parent_function = nullptr;
@@ -356,6 +358,9 @@ public:
     std::unique_ptr<LLVMSetInterface> set_api_sc;
     std::unique_ptr<LLVMArrUtils::Descriptor> arr_descr;
     Vec<llvm::Value*> strings_to_be_deallocated;
+    // bumped whenever a spill-buffer string temporary is emitted, so
+    // DeallocateStringsScope knows whether its mark call is needed
+    uint64_t string_spill_temp_count = 0;
     Vec<llvm::Value*> heap_fixed_size_arrays;  // Heap-allocated large fixed-size arrays for cleanup
     bool in_block_context = false;  // Flag to track if we're inside a BLOCK construct
     // Tracks allocatable/pointer array args in bind(C) functions that need
@@ -516,6 +521,10 @@ public:
               LLVMArrUtils::DESCR_TYPE::_SimpleCMODescriptor, compiler_options_))
     {
         LLVM::set_memory_debug(compiler_options.detect_leaks);
+        LLVM::set_memory_profile(compiler_options.memory_profile &&
+            !compiler_options.detect_leaks);
+        LLVM::set_arena_allocator(compiler_options.arena_allocator &&
+            !compiler_options.detect_leaks && !compiler_options.memory_profile);
         llvm_utils->tuple_api = tuple_api.get();
         llvm_utils->list_api = list_api.get();
         llvm_utils->struct_api = struct_api.get();
@@ -530,7 +539,7 @@ public:
         strings_to_be_deallocated.reserve(al, 1);
         heap_fixed_size_arrays.reserve(al, 1);
 
-        if (compiler_options.po.fast && !compiler_options.po.no_fast_math) {
+        if ((compiler_options.po.fast || compiler_options.po.fast_math) && !compiler_options.po.no_fast_math) {
             llvm::FastMathFlags fmf;
             fmf.setFast();
             builder->setFastMathFlags(fmf);
@@ -1275,6 +1284,30 @@ public:
             result_imag = builder->CreateFAdd(ad, bc);
         } else if (runtime_func_name == "_lfortran_complex_div_32" ||
                    runtime_func_name == "_lfortran_complex_div_64") {
+            if ((compiler_options.po.fast || compiler_options.po.fast_math)
+                    && !compiler_options.po.no_fast_math) {
+                // Branchless textbook division; the scaled (Smith) variant
+                // below only guards against intermediate overflow, which
+                // fast-math gives up anyway. This keeps the loop body
+                // straight-line so it can vectorize.
+                // (a+bi)/(c+di) = ((ac+bd) + (bc-ad)i) / (cc+dd)
+                llvm::Value* denom = builder->CreateFAdd(
+                    builder->CreateFMul(right_real, right_real),
+                    builder->CreateFMul(right_imag, right_imag));
+                llvm::Value* num_real = builder->CreateFAdd(
+                    builder->CreateFMul(left_real, right_real),
+                    builder->CreateFMul(left_imag, right_imag));
+                llvm::Value* num_imag = builder->CreateFSub(
+                    builder->CreateFMul(left_imag, right_real),
+                    builder->CreateFMul(left_real, right_imag));
+                result_real = builder->CreateFDiv(num_real, denom);
+                result_imag = builder->CreateFDiv(num_imag, denom);
+                llvm::Value* result = llvm::UndefValue::get(complex_type);
+                result = builder->CreateInsertValue(result, result_real, {0});
+                result = builder->CreateInsertValue(result, result_imag, {1});
+                return result;
+            }
+
             auto create_fabs = [&](llvm::Value* value) -> llvm::Value* {
 #if LLVM_VERSION_MAJOR >= 12
                 return builder->CreateUnaryIntrinsic(llvm::Intrinsic::fabs, value);
@@ -1391,7 +1424,7 @@ public:
             fn = llvm::Function::Create(function_type,
                     llvm::Function::ExternalLinkage, runtime_func_name, module.get());
         }
-        llvm::Value* allocator = llvm_utils->get_allocator(module.get());
+        llvm::Value* allocator = llvm_utils->get_string_temp_allocator(module.get());
         std::vector<llvm::Value*> args = {allocator, left_arg, left_len, right_arg, right_len};
         return builder->CreateCall(fn, args);
     }
@@ -1430,7 +1463,7 @@ public:
             fn = llvm::Function::Create(function_type,
                     llvm::Function::ExternalLinkage, runtime_func_name, module.get());
         }
-        llvm::Value* allocator = llvm_utils->get_allocator(module.get());
+        llvm::Value* allocator = llvm_utils->get_string_temp_allocator(module.get());
         llvm::AllocaInst *pleft_arg = llvm_utils->CreateAlloca(*builder, character_type);
         builder->CreateStore(left_arg, pleft_arg);
         llvm::AllocaInst *presult = llvm_utils->CreateAlloca(*builder, character_type);
@@ -1841,6 +1874,14 @@ public:
 
     template <typename T>
     void visit_AllocateUtil(const T& x, ASR::expr_t* m_stat, bool realloc, ASR::expr_t* m_source = nullptr) {
+        if (LLVM::use_memory_profile()) {
+            // attribute the allocations of this statement to its source
+            // location in the profiling allocator's report
+            uint32_t line = 0, column = 0;
+            debug_get_line_column(x.base.base.loc.first, line, column);
+            call_instrument_hook("_lfortran_memory_profile_set_site",
+                infile + ":" + std::to_string(line));
+        }
         for( size_t i = 0; i < x.n_args; i++ ) {
             ASR::alloc_arg_t curr_arg = x.m_args[i];
             ASR::expr_t* tmp_expr = x.m_args[i].m_a;
@@ -4113,6 +4154,45 @@ public:
         tmp = concat_tuple;
     }
 
+    // True when every subscript of the access has a compile-time value that
+    // provably lies inside that dimension's compile-time bounds. Such an
+    // access can never trip the runtime bounds check, so the check (a load
+    // of the bounds, two compares and a branch per dimension) is not
+    // emitted. Any index or bound that is not a compile-time constant keeps
+    // the check.
+    bool indices_provably_in_bounds(const ASR::ArrayItem_t& x,
+            ASR::dimension_t* m_dims, size_t n_dims) {
+        if (n_dims < x.n_args) {
+            return false;
+        }
+        for (size_t r = 0; r < x.n_args; r++) {
+            if (x.m_args[r].m_right == nullptr) {
+                return false;
+            }
+            int64_t index = 0;
+            if (!ASRUtils::is_value_constant(
+                    ASRUtils::expr_value(x.m_args[r].m_right), index)) {
+                return false;
+            }
+            int64_t lbound = 1;
+            if (m_dims[r].m_start &&
+                !ASRUtils::is_value_constant(
+                    ASRUtils::expr_value(m_dims[r].m_start), lbound)) {
+                return false;
+            }
+            int64_t length = 0;
+            if (m_dims[r].m_length == nullptr ||
+                !ASRUtils::is_value_constant(
+                    ASRUtils::expr_value(m_dims[r].m_length), length)) {
+                return false;
+            }
+            if (index < lbound || index > lbound + length - 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void visit_ArrayItem(const ASR::ArrayItem_t& x) {
         if (x.m_value) {
             this->visit_expr_wrapper(x.m_value, true);
@@ -4196,7 +4276,8 @@ public:
 
             Vec<llvm::Value*> llvm_diminfo;
             llvm_diminfo.reserve(al, 2 * x.n_args + 1);
-            bool check_for_bounds = compiler_options.po.bounds_checking;
+            bool check_for_bounds = compiler_options.po.bounds_checking &&
+                !indices_provably_in_bounds(x, m_dims, n_dims);
             if( array_t->m_physical_type == ASR::array_physical_typeType::PointerArray ||
                 array_t->m_physical_type == ASR::array_physical_typeType::UnboundedPointerArray ||
                 array_t->m_physical_type == ASR::array_physical_typeType::FixedSizeArray ||
@@ -5956,7 +6037,7 @@ public:
                 llvm::Type::getInt32Ty(context), command_line_args, false);
         llvm::Function *F = llvm::Function::Create(function_type,
                 llvm::Function::ExternalLinkage, "main", module.get());
-        if (compiler_options.po.fast && !compiler_options.po.no_fast_math) {
+        if ((compiler_options.po.fast || compiler_options.po.fast_math) && !compiler_options.po.no_fast_math) {
             F->addFnAttr("no-nans-fp-math", "true");
             F->addFnAttr("no-infs-fp-math", "true");
             F->addFnAttr("no-signed-zeros-fp-math", "true");
@@ -6076,6 +6157,9 @@ public:
             set_VariableInital_value(var_to_initalize.v, var_to_initalize.target_var);
         }
         proc_return = llvm::BasicBlock::Create(context, "return");
+        if (compiler_options.instrument_functions) {
+            call_instrument_hook("_lfortran_instrument_enter", x.m_name);
+        }
         predeclare_goto_targets(F, x.m_body, x.n_body);
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
@@ -6118,6 +6202,9 @@ public:
             }
             builder->CreateCall(fn, {});
         }
+        if (compiler_options.instrument_functions) {
+            call_instrument_hook("_lfortran_instrument_exit", x.m_name);
+        }
         llvm::Value *ret_val2 = llvm::ConstantInt::get(context,
             llvm::APInt(32, 0));
         builder->CreateRet(ret_val2);
@@ -7151,6 +7238,7 @@ public:
                         } else {
                             ptr = llvm_utils->CreateAlloca(*builder, type_, array_size,
                                 v->m_name, is_llvm_ptr);
+                            align_small_vector_array(ptr, v->m_type);
                         }
 #else
                         if (is_array_type && !is_list &&
@@ -7160,6 +7248,7 @@ public:
                             ptr = arr_descr->create_descriptor_alloca(type, v->m_name);
                         } else {
                             ptr = llvm_utils->CreateAlloca(*builder, type, array_size, v->m_name);
+                            align_small_vector_array(ptr, v->m_type);
                         }
 #endif
                     }
@@ -7460,6 +7549,18 @@ public:
                     ASR::Variable_t *arg = EXPR2VAR(x.m_args[asr_arg_idx]);
                     LCOMPILERS_ASSERT(is_arg_dummy(arg->m_intent));
 
+                    // Fortran argument aliasing rules: unless a dummy has the
+                    // POINTER or TARGET attribute, a write through it cannot
+                    // be observed through another argument, which is exactly
+                    // LLVM's noalias guarantee. bind(c) procedures are
+                    // skipped since C callers are not bound by these rules.
+                    if (llvm_arg.getType()->isPointerTy() &&
+                        ASRUtils::get_FunctionType(x)->m_abi != ASR::abiType::BindC &&
+                        !arg->m_target_attr && !arg->m_is_volatile &&
+                        !ASRUtils::is_pointer(arg->m_type)) {
+                        llvm_arg.addAttr(llvm::Attribute::NoAlias);
+                    }
+
                     llvm::Value* llvm_sym = &llvm_arg;
                     // For bind(C) allocatable/pointer array parameters, the
                     // function signature receives %array* (single pointer),
@@ -7733,12 +7834,21 @@ public:
         convert_call_args_depth = 0;
         list_call_arg_to_finalize.clear();
         bindc_stride_exits.clear();
-        if (compiler_options.po.fast && !compiler_options.po.no_fast_math) {
+        if ((compiler_options.po.fast || compiler_options.po.fast_math) && !compiler_options.po.no_fast_math) {
             F->addFnAttr("no-nans-fp-math", "true");
             F->addFnAttr("no-infs-fp-math", "true");
             F->addFnAttr("no-signed-zeros-fp-math", "true");
             F->addFnAttr("unsafe-fp-math", "true");
         }
+        // Procedures that unconditionally terminate (error-reporting
+        // helpers ending in stop/error stop) are cold: keep them out of
+        // their callers and out of the hot code layout
+        if (x.n_body > 0 &&
+            (ASR::is_a<ASR::ErrorStop_t>(*x.m_body[x.n_body - 1]) ||
+             ASR::is_a<ASR::Stop_t>(*x.m_body[x.n_body - 1]))) {
+            F->addFnAttr(llvm::Attribute::NoInline);
+            F->addFnAttr(llvm::Attribute::Cold);
+        }
         if (compiler_options.emit_debug_info) {
             llvm::DISubprogram *SP = nullptr;
             debug_emit_function(x, SP);
@@ -7970,6 +8080,159 @@ public:
             // in the prologue above. No additional stride conversion needed.
         }
         declare_local_vars(x);
+        emit_arena_region = LLVM::use_arena_allocator();
+        if (emit_arena_region) {
+            // A procedure that could leak region memory to its caller gets
+            // a suspended region instead, which also shields whatever
+            // region its caller may have opened
+            call_arena_region(procedure_gets_arena_region(x) ?
+                "_lfortran_arena_region_begin" :
+                "_lfortran_arena_region_begin_suspended");
+        }
+        if (compiler_options.instrument_functions) {
+            call_instrument_hook("_lfortran_instrument_enter", x.m_name);
+        }
+    }
+
+    // Call a runtime profiling hook taking a single name string: the
+    // --instrument entry/exit recorders and the --memory-profile
+    // allocation-site setter.
+    void call_instrument_hook(const char* hook, const std::string& name) {
+        llvm::Function *fn = module->getFunction(hook);
+        if (!fn) {
+            llvm::FunctionType *ft = llvm::FunctionType::get(
+                llvm::Type::getVoidTy(context), {character_type}, false);
+            fn = llvm::Function::Create(ft,
+                llvm::Function::ExternalLinkage, hook, module.get());
+        }
+        builder->CreateCall(fn, {builder->CreateGlobalStringPtr(name)});
+    }
+
+    // Call one of the parameterless arena region runtime functions
+    void call_arena_region(const char* name) {
+        llvm::Function *fn = module->getFunction(name);
+        if (!fn) {
+            llvm::FunctionType *ft = llvm::FunctionType::get(
+                llvm::Type::getVoidTy(context), {}, false);
+            fn = llvm::Function::Create(ft,
+                llvm::Function::ExternalLinkage, name, module.get());
+        }
+        builder->CreateCall(fn, {});
+    }
+
+    // Detects allocations whose destination does not belong to `symtab`:
+    // allocate/realloc of module or host variables and of struct members,
+    // and move_alloc into them. Such memory outlives the invocation and
+    // must not come from the procedure's own arena region.
+    class NonLocalAllocationDetector:
+        public ASR::BaseWalkVisitor<NonLocalAllocationDetector> {
+        public:
+        SymbolTable* symtab;
+        bool found = false;
+        NonLocalAllocationDetector(SymbolTable* symtab_) : symtab(symtab_) {}
+        bool is_local(ASR::expr_t* target) {
+            return ASR::is_a<ASR::Var_t>(*target) &&
+                ASRUtils::symbol_parent_symtab(
+                    ASR::down_cast<ASR::Var_t>(target)->m_v) == symtab;
+        }
+        void visit_Allocate(const ASR::Allocate_t& x) {
+            for (size_t i = 0; i < x.n_args; i++) {
+                if (!is_local(x.m_args[i].m_a)) {
+                    found = true;
+                }
+            }
+        }
+        void visit_ReAlloc(const ASR::ReAlloc_t& x) {
+            for (size_t i = 0; i < x.n_args; i++) {
+                if (!is_local(x.m_args[i].m_a)) {
+                    found = true;
+                }
+            }
+        }
+        void visit_Assignment(const ASR::Assignment_t& x) {
+            if (x.m_move_allocation && !is_local(x.m_target)) {
+                found = true;
+            }
+            ASR::BaseWalkVisitor<NonLocalAllocationDetector>::visit_Assignment(x);
+        }
+    };
+
+    // Under --arena-allocator a procedure gets its own region only when
+    // nothing allocated inside it can outlive the invocation: no
+    // allocatable or pointer result, no dummy the procedure may allocate
+    // into (allocatable, pointer, or a struct with such components), no
+    // saved allocatable or pointer local, and no allocation whose
+    // destination lives outside the procedure's own scope
+    bool procedure_gets_arena_region(const ASR::Function_t& x) {
+        auto may_escape = [](ASR::ttype_t* type) {
+            return ASRUtils::is_allocatable(type) || ASRUtils::is_pointer(type);
+        };
+        if (x.m_return_var && may_escape(ASRUtils::expr_type(x.m_return_var))) {
+            return false;
+        }
+        for (size_t i = 0; i < x.n_args; i++) {
+            ASR::Variable_t* arg = EXPR2VAR(x.m_args[i]);
+            if (arg->m_intent != ASRUtils::intent_in &&
+                (may_escape(arg->m_type) ||
+                 ASR::is_a<ASR::StructType_t>(*ASRUtils::extract_type(arg->m_type)))) {
+                return false;
+            }
+        }
+        for (auto& item : x.m_symtab->get_scope()) {
+            if (ASR::is_a<ASR::Variable_t>(*item.second)) {
+                ASR::Variable_t* var = ASR::down_cast<ASR::Variable_t>(item.second);
+                if (var->m_storage == ASR::storage_typeType::Save &&
+                    may_escape(var->m_type)) {
+                    return false;
+                }
+            }
+        }
+        NonLocalAllocationDetector detector(x.m_symtab);
+        for (size_t i = 0; i < x.n_body; i++) {
+            detector.visit_stmt(*x.m_body[i]);
+        }
+        return !detector.found;
+    }
+
+    // Record a statement-lifetime string temporary. With the spill
+    // allocator its memory is reclaimed wholesale by the enclosing
+    // DeallocateStringsScope's release, so no per-string free is emitted;
+    // under --detect-leaks the temporary is heap-tracked and freed
+    // individually as before.
+    inline void track_string_temp(llvm::Value* str_desc) {
+        if (LLVM::use_string_spill_allocator()) {
+            string_spill_temp_count++;
+        } else {
+            strings_to_be_deallocated.push_back(al, str_desc);
+        }
+    }
+
+    // Emit a call recording the current spill-buffer offset.
+    llvm::CallInst* emit_string_spill_mark() {
+        std::string func_name = "_lfortran_string_spill_mark";
+        llvm::Function *fn = module->getFunction(func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                llvm::Type::getInt64Ty(context), {}, false);
+            fn = llvm::Function::Create(function_type,
+                llvm::Function::ExternalLinkage, func_name, module.get());
+        }
+        return builder->CreateCall(fn, {});
+    }
+
+    // Emit a call releasing the spill buffer back to `mark`; heap spills
+    // made after the mark are freed by the runtime.
+    void emit_string_spill_release(llvm::Value* mark) {
+        std::string func_name = "_lfortran_string_spill_release";
+        llvm::Function *fn = module->getFunction(func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                llvm::Type::getVoidTy(context),
+                {llvm::Type::getInt64Ty(context)}, false);
+            fn = llvm::Function::Create(function_type,
+                llvm::Function::ExternalLinkage, func_name, module.get());
+        }
+        builder->CreateCall(fn, {mark});
     }
 
     inline void free_strings_to_be_deallocated(size_t start_n) {
@@ -7985,13 +8248,43 @@ public:
     struct DeallocateStringsScope {
         ASRToLLVMVisitor* visitor;
         size_t start_n;
+        // mark call emitted at scope entry; erased again in the destructor
+        // if the statement produced no spill-buffer temporaries
+        llvm::CallInst* spill_mark;
+        uint64_t start_spill_count;
         DeallocateStringsScope(ASRToLLVMVisitor* visitor)
-            : visitor(visitor), start_n(visitor->strings_to_be_deallocated.n) {}
+            : visitor(visitor), start_n(visitor->strings_to_be_deallocated.n),
+              spill_mark(nullptr),
+              start_spill_count(visitor->string_spill_temp_count) {
+            if (LLVM::use_string_spill_allocator()) {
+                spill_mark = visitor->emit_string_spill_mark();
+            }
+        }
         ~DeallocateStringsScope() {
             visitor->free_strings_to_be_deallocated(start_n);
+            if (spill_mark) {
+                if (visitor->string_spill_temp_count != start_spill_count) {
+                    visitor->emit_string_spill_release(spill_mark);
+                } else {
+                    spill_mark->eraseFromParent();
+                }
+            }
         }
     };
 
+    // Vector-align the storage of small fixed-shape arrays so whole-array
+    // moves and vectorized element operations use aligned accesses
+    void align_small_vector_array(llvm::Value* ptr, ASR::ttype_t* type) {
+        if (!LLVMArrUtils::is_small_vector_array(type)) {
+            return;
+        }
+        if (llvm::AllocaInst* alloca_inst = llvm::dyn_cast<llvm::AllocaInst>(ptr)) {
+            if (alloca_inst->getAlign().value() < 16) {
+                alloca_inst->setAlignment(llvm::Align(16));
+            }
+        }
+    }
+
     inline void free_heap_fixed_size_arrays() {
         // Free all heap-allocated large fixed-size arrays
         for (size_t i = 0; i < heap_fixed_size_arrays.n; i++) {
@@ -8032,6 +8325,12 @@ public:
             finalize_list_call_arg_allocas();
             free_heap_fixed_size_arrays();
             convert_bindc_strides_to_byte();
+            if (emit_arena_region) {
+                call_arena_region("_lfortran_arena_region_end");
+            }
+            if (compiler_options.instrument_functions) {
+                call_instrument_hook("_lfortran_instrument_exit", x.m_name);
+            }
             llvm::Function* fn = builder->GetInsertBlock()->getParent();
             if (fn->getReturnType()->isVoidTy()) {
                 // On Windows, complex(kind=8) returns use the "pass-as-subroutine" ABI:
@@ -8110,6 +8409,12 @@ public:
             finalize_list_call_arg_allocas();
             free_heap_fixed_size_arrays();
             convert_bindc_strides_to_byte();
+            if (emit_arena_region) {
+                call_arena_region("_lfortran_arena_region_end");
+            }
+            if (compiler_options.instrument_functions) {
+                call_instrument_hook("_lfortran_instrument_exit", x.m_name);
+            }
             builder->CreateRetVoid();
         }
     }
@@ -8935,7 +9240,7 @@ public:
         // Fill the descriptor with the value's data and the target's bounds
         // Dims are inline at FIELD_DIMS - get pointer to first dim element
         llvm::Value* dim_des_val = arr_descr->get_pointer_to_dimension_descriptor_array(
-            target_type_llvm, new_desc, false);
+            target_type_llvm, new_desc);
         
         // Get value data pointer
         llvm::Value* value_data = nullptr;
@@ -9986,7 +10291,9 @@ public:
                                   bool is_volatile = false) {
         llvm::Type* t = llvm_utils->get_type_from_ttype_t_util(
             x, ASRUtils::expr_type(x), module.get());
-        return llvm_utils->CreateLoad2(t, ptr, is_volatile);
+        llvm::Value* v = llvm_utils->CreateLoad2(t, ptr, is_volatile);
+        llvm_utils->tbaa_annotate(v, ASRUtils::expr_type(x));
+        return v;
     }
 
     void visit_Assignment(const ASR::Assignment_t &x) {
@@ -11449,15 +11756,33 @@ public:
                 }
             }
             if( is_value_fixed_sized_array && is_target_fixed_sized_array ) {
-                ASR::dimension_t* asr_dims = nullptr;
-                size_t asr_n_dims = ASRUtils::extract_dimensions_from_ttype(target_type, asr_dims);
-                int64_t size = ASRUtils::get_fixed_size_of_array(asr_dims, asr_n_dims);
-                llvm::DataLayout data_layout(module->getDataLayout());
-                uint64_t data_size = data_layout.getTypeAllocSize(target_el_type);
-                llvm::Value* llvm_size = llvm::ConstantInt::get(context, llvm::APInt(32, size));
-                llvm_size = builder->CreateMul(llvm_size,
-                    llvm::ConstantInt::get(context, llvm::APInt(32, data_size)));
-                builder->CreateMemCpy(target, llvm::MaybeAlign(), value, llvm::MaybeAlign(), llvm_size);
+                llvm::Type* target_llvm_type = llvm_utils->get_type_from_ttype_t_util(
+                    x.m_target, target_type, module.get());
+                llvm::Type* value_llvm_type = llvm_utils->get_type_from_ttype_t_util(
+                    x.m_value, value_type, module.get());
+                if( LLVMArrUtils::is_small_vector_array(target_type) &&
+                    target_llvm_type == value_llvm_type ) {
+                    // Move the whole [N x T] value as a first-class SSA
+                    // aggregate instead of a memcpy; mem2reg can then keep
+                    // these small arrays in registers across operations.
+                    // An ArrayConstant value is a pointer to the first
+                    // element of its constant global, so adjust the
+                    // pointer type before loading the aggregate.
+                    builder->CreateStore(
+                        llvm_utils->CreateLoad2(target_llvm_type,
+                            builder->CreateBitCast(value,
+                                target_llvm_type->getPointerTo())), target);
+                } else {
+                    ASR::dimension_t* asr_dims = nullptr;
+                    size_t asr_n_dims = ASRUtils::extract_dimensions_from_ttype(target_type, asr_dims);
+                    int64_t size = ASRUtils::get_fixed_size_of_array(asr_dims, asr_n_dims);
+                    llvm::DataLayout data_layout(module->getDataLayout());
+                    uint64_t data_size = data_layout.getTypeAllocSize(target_el_type);
+                    llvm::Value* llvm_size = llvm::ConstantInt::get(context, llvm::APInt(32, size));
+                    llvm_size = builder->CreateMul(llvm_size,
+                        llvm::ConstantInt::get(context, llvm::APInt(32, data_size)));
+                    builder->CreateMemCpy(target, llvm::MaybeAlign(), value, llvm::MaybeAlign(), llvm_size);
+                }
             } else if( is_value_descriptor_based_array && is_target_fixed_sized_array ) {
                 value = llvm_utils->CreateLoad2(value_el_type->getPointerTo(), arr_descr->get_pointer_to_data(x.m_value, value_type, value, module.get()));
                 llvm::Type* target_llvm_type = llvm_utils->get_type_from_ttype_t_util(x.m_target, target_type, module.get());
@@ -11683,9 +12008,11 @@ public:
                 llvm::Type* target_ptr_type = llvm_utils->get_type_from_ttype_t_util(x.m_target, ASRUtils::expr_type(x.m_target), module.get());
                 target = llvm_utils->CreateLoad2(target_ptr_type, target);
             }
-            builder->CreateStore(value, target);
+            llvm::Value* store = builder->CreateStore(value, target);
+            llvm_utils->tbaa_annotate(store, ASRUtils::expr_type(x.m_target));
         } else {
-            builder->CreateStore(value, target);
+            llvm::Value* store = builder->CreateStore(value, target);
+            llvm_utils->tbaa_annotate(store, ASRUtils::expr_type(x.m_target));
         }
     }
 
@@ -13752,7 +14079,7 @@ public:
         right_val = llvm_utils->convert_kind(right_val, llvm::Type::getInt64Ty(context));
         tmp = llvm_utils->create_string_descriptor(tmp,
             builder->CreateMul(left_len, right_val), "strRepeat_desc");
-        strings_to_be_deallocated.push_back(al, tmp);
+        track_string_temp(tmp);
     }
 
     void visit_StringConcat(const ASR::StringConcat_t &x) {
@@ -13767,7 +14094,7 @@ public:
         tmp = lfortran_strConcat(left_val, left_len, right_val, right_len);
         tmp = llvm_utils->create_string_descriptor(tmp,
             builder->CreateAdd(left_len, right_len), "strConcat_desc");
-        strings_to_be_deallocated.push_back(al, tmp);
+        track_string_temp(tmp);
     }
 
     void visit_StringLen(const ASR::StringLen_t &x) {
@@ -14829,6 +15156,7 @@ public:
                 llvm::Type* x_llvm_type = llvm_utils->get_type_from_ttype_t_util(ASRUtils::EXPR(ASR::make_Var_t(
                     al, x->base.base.loc, &x->base)), x->m_type, module.get());
                 tmp = llvm_utils->CreateLoad2(x_llvm_type, tmp);
+                llvm_utils->tbaa_annotate(tmp, x->m_type);
             }
         }
     }
@@ -15031,7 +15359,7 @@ public:
             builder->CreateStore(incremented_offset, arr_descr->get_offset(des_real_type, des_real_arr, false));
         }
         int n_dims = ASRUtils::extract_n_dims_from_ttype(t.m_type);
-        llvm::Value* dim_des_real_arr = arr_descr->get_pointer_to_dimension_descriptor_array(des_real_type, des_real_arr, true);
+        llvm::Value* dim_des_real_arr = arr_descr->get_pointer_to_dimension_descriptor_array(des_real_type, des_real_arr);
         for (int i = 0; i < n_dims; i++) {
             llvm::Value* dim_idx = llvm::ConstantInt::get(context, llvm::APInt(32, i));
             llvm::Value* dim_des_real_arr_idx = arr_descr->get_pointer_to_dimension_descriptor(dim_des_real_arr, dim_idx);
@@ -23526,7 +23854,7 @@ public:
                 // Copy dimension descriptors from source to target
                 llvm::Value* actual_dim_des = 
                     arr_descr->get_pointer_to_dimension_descriptor_array(actual_array_type, dt);
-                llvm::Value* target_dim_des_ptr = arr_descr->get_pointer_to_dimension_descriptor_array(target_array_type, class_array, false);
+                llvm::Value* target_dim_des_ptr = arr_descr->get_pointer_to_dimension_descriptor_array(target_array_type, class_array);
                 builder->CreateStore(actual_dim_des, target_dim_des_ptr);
                 
                 // Copy rank and offset
@@ -8,6 +8,7 @@
 #include <libasr/string_utils.h>
 #include <libasr/pass/intrinsic_functions.h>
 #include <libasr/pass/intrinsic_function_registry.h>
+#include <libasr/pass/dependence_analysis.h>
 
 #include <sstream>
 #include <map>
@@ -126,6 +127,22 @@ public:
     // Used by emit_struct_member_data_ptrs/sizes to offset into flat buffers.
     std::map<std::string, std::pair<std::string, std::string>> struct_from_array_elem;
 
+    // Threadgroup-memory tiling of read-only stencil inputs in 1-D GPU
+    // kernels. Keyed by kernel argument name; halo offsets are element
+    // offsets relative to the thread's own element, so a 3-point
+    // stencil a(i-1), a(i), a(i+1) gives halo_lo = -1, halo_hi = 1.
+    // Populated per kernel by visit_GpuKernelFunction and consumed by
+    // the ArrayItem emission to serve reads from the tile.
+    struct StencilTile {
+        std::string elem_type;
+        std::string size_expr;
+        int64_t halo_lo;
+        int64_t halo_hi;
+    };
+    std::map<std::string, StencilTile> stencil_tiles;
+    ASR::symbol_t *stencil_loop_var = nullptr;
+    ASR::expr_t *stencil_start_expr = nullptr;
+
     // Tracks allocatable out parameters emitted as thread pointers
     // in the current inline function. Used by the Assignment handler
     // to dereference the pointer when assigning to these params.
@@ -2707,6 +2724,17 @@ public:
             }
         }
 
+        // Reduce-clause kernels carry trailing GpuReduction statements;
+        // they need the threadgroup-local thread index and size in the
+        // signature plus one threadgroup scratch array per reduction
+        std::vector<const ASR::GpuReduction_t*> reductions;
+        for (size_t i = 0; i < x.n_body; i++) {
+            if (ASR::is_a<ASR::GpuReduction_t>(*x.m_body[i])) {
+                reductions.push_back(
+                    ASR::down_cast<ASR::GpuReduction_t>(x.m_body[i]));
+            }
+        }
+
         struct ArgInfo {
             std::string name;
             ASR::ttype_t *type;
@@ -2739,6 +2767,162 @@ public:
 
         bool packed_mode = gpu_kernel_needs_buffer_packing(x);
 
+        // Threadgroup-memory tiling for 1-D stencil kernels. When the
+        // body reads a device array at several small constant offsets
+        // around the thread's own element (a(i-1), a(i), a(i+1), ...),
+        // neighbouring threads keep re-fetching the same elements from
+        // device memory. Stage the threadgroup's window plus its halo
+        // into threadgroup memory with one cooperative load and serve
+        // those reads from the tile instead. Only the flat 1-D kernel
+        // shape is tiled; packed, VLA and reduction kernels keep the
+        // direct device-memory path.
+        stencil_tiles.clear();
+        stencil_loop_var = nullptr;
+        stencil_start_expr = nullptr;
+        if (!packed_mode && reductions.empty() && current_vla_infos.empty() &&
+                x.n_body >= 4) {
+            // The offload pass emits: range-guard If, __flat_idx =
+            // <thread id>, then one decode assignment per loop
+            // dimension. For 1-D the decode is `i = __flat_idx + start`;
+            // multi-dimensional kernels decode through div/mod chains
+            // whose value is not a plain Var + start and do not match.
+            ASR::symbol_t *flat_sym = nullptr;
+            ASR::symbol_t *loop_sym = nullptr;
+            ASR::expr_t *start_expr = nullptr;
+            if (ASR::is_a<ASR::If_t>(*x.m_body[0]) &&
+                    ASR::is_a<ASR::Assignment_t>(*x.m_body[1]) &&
+                    ASR::is_a<ASR::Assignment_t>(*x.m_body[2])) {
+                ASR::Assignment_t *flat_assign =
+                    ASR::down_cast<ASR::Assignment_t>(x.m_body[1]);
+                ASR::Assignment_t *decode =
+                    ASR::down_cast<ASR::Assignment_t>(x.m_body[2]);
+                if (ASR::is_a<ASR::Var_t>(*flat_assign->m_target) &&
+                        ASR::is_a<ASR::Var_t>(*decode->m_target) &&
+                        ASR::is_a<ASR::IntegerBinOp_t>(*decode->m_value)) {
+                    ASR::symbol_t *fsym = ASR::down_cast<ASR::Var_t>(
+                        flat_assign->m_target)->m_v;
+                    ASR::IntegerBinOp_t *decode_op =
+                        ASR::down_cast<ASR::IntegerBinOp_t>(
+                            decode->m_value);
+                    if (decode_op->m_op == ASR::binopType::Add &&
+                            ASR::is_a<ASR::Var_t>(*decode_op->m_left) &&
+                            ASR::down_cast<ASR::Var_t>(
+                                decode_op->m_left)->m_v == fsym) {
+                        flat_sym = fsym;
+                        loop_sym = ASR::down_cast<ASR::Var_t>(
+                            decode->m_target)->m_v;
+                        start_expr = decode_op->m_right;
+                    }
+                }
+            }
+            bool has_block_call = false;
+            for (size_t i = 3; i < x.n_body; i++) {
+                if (ASR::is_a<ASR::BlockCall_t>(*x.m_body[i])) {
+                    has_block_call = true;
+                    break;
+                }
+            }
+            if (loop_sym && !has_block_call) {
+                DependenceAnalysis::AccessSet access_set =
+                    DependenceAnalysis::collect_array_accesses(
+                        x.m_body + 3, x.n_body - 3, {loop_sym});
+                bool uses_flat = false;
+                for (auto &acc : access_set.accesses) {
+                    if (acc.base == flat_sym) {
+                        uses_flat = true;
+                        break;
+                    }
+                }
+                if (access_set.analyzable && !uses_flat) {
+                    for (size_t i = 0; i < args.size(); i++) {
+                        if (!args[i].is_array || args[i].is_struct ||
+                                !args[i].struct_name.empty()) continue;
+                        if (args[i].name.substr(0, 2) == "__") continue;
+                        ASR::Var_t *v = ASR::down_cast<ASR::Var_t>(
+                            x.m_args[i]);
+                        ASR::symbol_t *arg_sym =
+                            ASRUtils::symbol_get_past_external(v->m_v);
+                        ASR::ttype_t *past_alloc =
+                            ASRUtils::type_get_past_allocatable(
+                                ASR::down_cast<ASR::Variable_t>(
+                                    arg_sym)->m_type);
+                        if (!ASR::is_a<ASR::Array_t>(*past_alloc)) {
+                            continue;
+                        }
+                        ASR::Array_t *arr =
+                            ASR::down_cast<ASR::Array_t>(past_alloc);
+                        if (arr->n_dims != 1) continue;
+                        if (!ASR::is_a<ASR::Integer_t>(*arr->m_type) &&
+                                !ASR::is_a<ASR::Real_t>(*arr->m_type)) {
+                            continue;
+                        }
+                        // The tile index math assumes a lower bound of 1
+                        if (arr->m_dims[0].m_start &&
+                                !(ASR::is_a<ASR::IntegerConstant_t>(
+                                      *arr->m_dims[0].m_start) &&
+                                  ASR::down_cast<ASR::IntegerConstant_t>(
+                                      arr->m_dims[0].m_start)->m_n == 1)) {
+                            continue;
+                        }
+                        // Element count for the load-phase bounds check:
+                        // a compile-time constant for explicit-shape
+                        // arrays, the synthesized size scalar for
+                        // assumed-shape ones.
+                        std::string size_expr;
+                        if (arr->m_dims[0].m_length &&
+                                ASR::is_a<ASR::IntegerConstant_t>(
+                                    *arr->m_dims[0].m_length)) {
+                            size_expr = std::to_string(
+                                ASR::down_cast<ASR::IntegerConstant_t>(
+                                    arr->m_dims[0].m_length)->m_n);
+                        } else if (!arr->m_dims[0].m_length) {
+                            size_expr = "__size_" + args[i].name
+                                + "_dim1";
+                        } else {
+                            continue;
+                        }
+                        bool read_only = true;
+                        bool all_affine = true;
+                        bool seen = false;
+                        std::set<int64_t> offsets;
+                        for (auto &acc : access_set.accesses) {
+                            if (acc.base != arg_sym) continue;
+                            seen = true;
+                            if (acc.is_write) {
+                                read_only = false;
+                                break;
+                            }
+                            if (acc.subscripts.size() != 1 ||
+                                    !acc.subscripts[0].affine ||
+                                    acc.subscripts[0].loop_var !=
+                                        loop_sym ||
+                                    acc.subscripts[0].coeff != 1) {
+                                all_affine = false;
+                                break;
+                            }
+                            offsets.insert(acc.subscripts[0].constant);
+                        }
+                        // Tiling only pays off when neighbouring threads
+                        // share elements: require at least two distinct
+                        // offsets and a modest halo
+                        if (!seen || !read_only || !all_affine ||
+                                offsets.size() < 2) {
+                            continue;
+                        }
+                        int64_t lo = *offsets.begin();
+                        int64_t hi = *offsets.rbegin();
+                        if (hi - lo > 32) continue;
+                        stencil_tiles[args[i].name] = {
+                            metal_type(arr->m_type), size_expr, lo, hi};
+                    }
+                    if (!stencil_tiles.empty()) {
+                        stencil_loop_var = loop_sym;
+                        stencil_start_expr = start_expr;
+                    }
+                }
+            }
+        }
+
         // Collect scalar args for packing into a single struct buffer
         struct ScalarArg {
             std::string name;
@@ -3062,10 +3246,33 @@ public:
 
         if (has_prev) src << ",\n";
         src << "    uint __thread_id [[thread_position_in_grid]]";
+        if (!reductions.empty() || !stencil_tiles.empty()) {
+            src << ",\n    uint __local_id [[thread_position_in_threadgroup]]";
+            src << ",\n    uint __tg_size [[threads_per_threadgroup]]";
+        }
 
         src << ")\n{\n";
         indent_level++;
 
+        // Threadgroup scratch for the reduction tree combine, sized to
+        // the fixed 256-thread launch block
+        for (auto *red : reductions) {
+            std::string target_name = sanitize_metal_name(
+                ASRUtils::symbol_name(ASR::down_cast<ASR::Var_t>(
+                    red->m_target)->m_v));
+            src << get_indent() << "threadgroup "
+                << metal_type(ASRUtils::expr_type(red->m_value))
+                << " __red_scratch_" << target_name << "[256];\n";
+        }
+
+        // Threadgroup tiles for stencil inputs, sized to the fixed
+        // 256-thread launch block plus the halo on both sides
+        for (auto &[tile_name, tile] : stencil_tiles) {
+            src << get_indent() << "threadgroup " << tile.elem_type
+                << " __tile_" << tile_name << "["
+                << (256 + tile.halo_hi - tile.halo_lo) << "];\n";
+        }
+
         // Unpack scalar args from the struct into local variables
         for (auto &sa : scalar_args) {
             src << get_indent() << sa.metal_type_str << " "
@@ -3286,12 +3493,135 @@ public:
             }
         }
 
+        // Cooperative load phase: every thread strides across each tile
+        // so the whole window plus halo is fetched from device memory
+        // once per threadgroup. This runs before the range guard so that
+        // every thread of the threadgroup reaches the barrier; threads
+        // past the iteration space retire right afterwards.
+        if (!stencil_tiles.empty()) {
+            for (auto &[tile_name, tile] : stencil_tiles) {
+                int64_t tile_len = 256 + tile.halo_hi - tile.halo_lo;
+                src << get_indent() << "{\n";
+                indent_level++;
+                src << get_indent()
+                    << "int __tile_base = (int)(__thread_id - __local_id)"
+                    << " + (int)(";
+                visit_expr(stencil_start_expr);
+                src << ") - 1 + (" << tile.halo_lo << ");\n";
+                src << get_indent() << "for (uint __t = __local_id; __t < "
+                    << tile_len << "u; __t += __tg_size) {\n";
+                indent_level++;
+                src << get_indent() << "int __g = __tile_base + (int)__t;\n";
+                src << get_indent() << "if (__g >= 0 && __g < "
+                    << tile.size_expr << ") {\n";
+                indent_level++;
+                src << get_indent() << "__tile_" << tile_name << "[__t] = "
+                    << tile_name << "[__g];\n";
+                indent_level--;
+                src << get_indent() << "}\n";
+                indent_level--;
+                src << get_indent() << "}\n";
+                indent_level--;
+                src << get_indent() << "}\n";
+            }
+            src << get_indent()
+                << "threadgroup_barrier(mem_flags::mem_threadgroup);\n";
+        }
+
         for (size_t i = 0; i < x.n_body; i++) {
             visit_stmt(x.m_body[i]);
         }
 
         indent_level--;
         src << "}\n\n";
+
+        stencil_tiles.clear();
+        stencil_loop_var = nullptr;
+        stencil_start_expr = nullptr;
+    }
+
+    // Threadgroup-level tree reduction followed by a single atomic
+    // combine per threadgroup into the 1-element device result buffer.
+    // Integer reductions and float sums use the MSL atomic fetch ops
+    // (atomic_float needs MSL 2.4, available on Apple silicon); float
+    // min/max have no atomic form and fall back to a compare-and-swap
+    // loop on the bit pattern.
+    void emit_gpu_reduction(ASR::GpuReduction_t *red) {
+        std::string target_name = sanitize_metal_name(
+            ASRUtils::symbol_name(ASR::down_cast<ASR::Var_t>(
+                red->m_target)->m_v));
+        std::string scratch = "__red_scratch_" + target_name;
+        std::string lhs = scratch + "[__local_id]";
+        std::string rhs = scratch + "[__local_id + __s]";
+        bool is_int = ASRUtils::is_integer(*ASRUtils::expr_type(red->m_value));
+
+        src << get_indent() << lhs << " = ";
+        visit_expr(red->m_value);
+        src << ";\n";
+        src << get_indent()
+            << "threadgroup_barrier(mem_flags::mem_threadgroup);\n";
+        src << get_indent()
+            << "for (uint __s = __tg_size / 2; __s > 0; __s >>= 1) {\n";
+        indent_level++;
+        src << get_indent() << "if (__local_id < __s) {\n";
+        indent_level++;
+        src << get_indent() << lhs << " = ";
+        switch (red->m_op) {
+            case ASR::reduction_opType::ReduceAdd:
+                src << lhs << " + " << rhs; break;
+            case ASR::reduction_opType::ReduceMIN:
+                src << "min(" << lhs << ", " << rhs << ")"; break;
+            default:
+                src << "max(" << lhs << ", " << rhs << ")"; break;
+        }
+        src << ";\n";
+        indent_level--;
+        src << get_indent() << "}\n";
+        src << get_indent()
+            << "threadgroup_barrier(mem_flags::mem_threadgroup);\n";
+        indent_level--;
+        src << get_indent() << "}\n";
+
+        src << get_indent() << "if (__local_id == 0) {\n";
+        indent_level++;
+        if (is_int) {
+            const char *fn = red->m_op == ASR::reduction_opType::ReduceAdd
+                ? "atomic_fetch_add_explicit"
+                : red->m_op == ASR::reduction_opType::ReduceMIN
+                    ? "atomic_fetch_min_explicit"
+                    : "atomic_fetch_max_explicit";
+            src << get_indent() << fn << "((device atomic_int*)&"
+                << target_name << "[0], " << scratch
+                << "[0], memory_order_relaxed);\n";
+        } else if (red->m_op == ASR::reduction_opType::ReduceAdd) {
+            src << get_indent()
+                << "atomic_fetch_add_explicit((device atomic_float*)&"
+                << target_name << "[0], " << scratch
+                << "[0], memory_order_relaxed);\n";
+        } else {
+            const char *cmb = red->m_op == ASR::reduction_opType::ReduceMIN
+                ? "min" : "max";
+            src << get_indent()
+                << "device atomic_uint* __dst = (device atomic_uint*)&"
+                << target_name << "[0];\n";
+            src << get_indent()
+                << "uint __old = atomic_load_explicit(__dst, "
+                << "memory_order_relaxed);\n";
+            src << get_indent() << "while (true) {\n";
+            indent_level++;
+            src << get_indent() << "float __new = " << cmb
+                << "(as_type<float>(__old), " << scratch << "[0]);\n";
+            src << get_indent()
+                << "if (as_type<uint>(__new) == __old) break;\n";
+            src << get_indent()
+                << "if (atomic_compare_exchange_weak_explicit(__dst, "
+                << "&__old, as_type<uint>(__new), memory_order_relaxed, "
+                << "memory_order_relaxed)) break;\n";
+            indent_level--;
+            src << get_indent() << "}\n";
+        }
+        indent_level--;
+        src << get_indent() << "}\n";
     }
 
     void visit_stmt(ASR::stmt_t *stmt) {
@@ -3982,6 +4312,10 @@ public:
                 src << get_indent() << "return;\n";
                 break;
             }
+            case ASR::stmtType::GpuReduction: {
+                emit_gpu_reduction(ASR::down_cast<ASR::GpuReduction_t>(stmt));
+                break;
+            }
             case ASR::stmtType::WhileLoop: {
                 ASR::WhileLoop_t *wl = ASR::down_cast<ASR::WhileLoop_t>(stmt);
                 src << get_indent() << "while (";
@@ -4803,6 +5137,33 @@ public:
             }
             case ASR::exprType::ArrayItem: {
                 ASR::ArrayItem_t *ai = ASR::down_cast<ASR::ArrayItem_t>(expr);
+                // Reads of tiled stencil inputs are served from the
+                // threadgroup tile loaded in the kernel prologue. The
+                // subscript is i + c for the kernel's loop variable and
+                // a constant offset c, which maps to tile slot
+                // __local_id + (c - halo_lo).
+                if (!stencil_tiles.empty() &&
+                        ASR::is_a<ASR::Var_t>(*ai->m_v) && ai->n_args == 1 &&
+                        !ai->m_args[0].m_left && !ai->m_args[0].m_step &&
+                        ai->m_args[0].m_right) {
+                    std::string base_name = ASRUtils::symbol_name(
+                        ASR::down_cast<ASR::Var_t>(ai->m_v)->m_v);
+                    auto tit = stencil_tiles.find(base_name);
+                    if (tit != stencil_tiles.end()) {
+                        DependenceAnalysis::AffineSubscript sub =
+                            DependenceAnalysis::extract_affine_subscript(
+                                ai->m_args[0].m_right, {stencil_loop_var});
+                        if (sub.affine &&
+                                sub.loop_var == stencil_loop_var &&
+                                sub.coeff == 1) {
+                            src << "__tile_" << base_name
+                                << "[__local_id + "
+                                << (sub.constant - tit->second.halo_lo)
+                                << "]";
+                            break;
+                        }
+                    }
+                }
                 // For allocatable struct member access like s%a(i),
                 // use the separate data pointer parameter instead of
                 // the struct member (which is not a valid array in Metal).
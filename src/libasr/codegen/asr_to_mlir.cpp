@@ -1,6 +1,9 @@
 #include <mlir/IR/BuiltinOps.h>
 #include <mlir/IR/BuiltinTypes.h>
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/Arith/IR/Arith.h>
 #include <mlir/Dialect/LLVMIR/LLVMDialect.h>
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
 #include <mlir/Dialect/OpenMP/OpenMPDialect.h>
 #include <mlir/IR/Verifier.h>
 #include <mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h>
@@ -40,6 +43,65 @@ public:
 };
 
 
+// Scans a program/function body to decide which local arrays may be
+// emitted as memrefs. An array stays eligible only while every use is a
+// plain element access: any whole-array use (call argument, physical
+// cast, array section) or an element passed by reference to a callee
+// aliases the storage, and such arrays keep the LLVM-dialect alloca
+// path.
+class MemrefUseScanner : public ASR::BaseWalkVisitor<MemrefUseScanner> {
+public:
+    std::set<uint64_t> disqualified;
+
+    void disqualify(ASR::symbol_t *sym) {
+        sym = ASRUtils::symbol_get_past_external(sym);
+        if (ASR::is_a<ASR::Variable_t>(*sym)) {
+            disqualified.insert(get_hash((ASR::asr_t*)
+                down_cast<ASR::Variable_t>(sym)));
+        }
+    }
+
+    void visit_ArrayItem(const ASR::ArrayItem_t &x) {
+        if (ASR::is_a<ASR::Var_t>(*x.m_v) && x.n_args == 1 &&
+                x.m_args[0].m_right && !x.m_args[0].m_left &&
+                !x.m_args[0].m_step) {
+            // Indexed element access keeps the base eligible; only the
+            // subscript is a further use
+            visit_expr(*x.m_args[0].m_right);
+        } else {
+            ASR::BaseWalkVisitor<MemrefUseScanner>::visit_ArrayItem(x);
+        }
+    }
+
+    void visit_Var(const ASR::Var_t &x) {
+        disqualify(x.m_v);
+    }
+
+    template <typename T>
+    void disqualify_reference_args(const T &x) {
+        for (size_t i = 0; i < x.n_args; i++) {
+            ASR::expr_t *arg = x.m_args[i].m_value;
+            if (arg && ASR::is_a<ASR::ArrayItem_t>(*arg)) {
+                ASR::ArrayItem_t *item = down_cast<ASR::ArrayItem_t>(arg);
+                if (ASR::is_a<ASR::Var_t>(*item->m_v)) {
+                    // The callee may write through the reference
+                    disqualify(down_cast<ASR::Var_t>(item->m_v)->m_v);
+                }
+            }
+        }
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t &x) {
+        disqualify_reference_args(x);
+        ASR::BaseWalkVisitor<MemrefUseScanner>::visit_FunctionCall(x);
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t &x) {
+        disqualify_reference_args(x);
+        ASR::BaseWalkVisitor<MemrefUseScanner>::visit_SubroutineCall(x);
+    }
+};
+
 class ASRToMLIRVisitor : public ASR::BaseVisitor<ASRToMLIRVisitor>
 {
 public:
@@ -56,6 +118,28 @@ public:
 
     std::map<uint64_t, mlir::Value> mlir_symtab; // Used for variables
 
+    // Arrays emitted as memref.alloca instead of llvm.alloca, so that
+    // element accesses become affine/memref loads and stores
+    std::set<uint64_t> memref_vars;
+    // Arrays the MemrefUseScanner found aliased in the current
+    // program/function body
+    std::set<uint64_t> memref_disqualified;
+    // Induction values of the enclosing affine.for loops, keyed by the
+    // hash of the Fortran loop variable; subscripts that are affine in
+    // one of these lower to affine.load/affine.store
+    std::map<uint64_t, mlir::Value> affine_loop_vars;
+    // Set by the memref ArrayItem path when `tmp` already holds the
+    // element value rather than an address
+    bool tmp_is_value = false;
+
+    // Branch targets of the enclosing CFG-lowered loops for exit/cycle
+    struct LoopBlocks {
+        std::string name;
+        mlir::Block *cycle_block;
+        mlir::Block *exit_block;
+    };
+    std::vector<LoopBlocks> loop_blocks;
+
 public:
     ASRToMLIRVisitor(Allocator &al)
         : al{al},
@@ -66,6 +150,9 @@ public:
             // Load MLIR Dialects
             context->getOrLoadDialect<mlir::LLVM::LLVMDialect>();
             context->getOrLoadDialect<mlir::omp::OpenMPDialect>();
+            context->getOrLoadDialect<mlir::affine::AffineDialect>();
+            context->getOrLoadDialect<mlir::memref::MemRefDialect>();
+            context->getOrLoadDialect<mlir::arith::ArithDialect>();
 
             // Initialize values
             voidPtr = mlir::LLVM::LLVMPointerType::get(context.get());
@@ -120,11 +207,105 @@ public:
     }
 
     void visit_expr2(ASR::expr_t &x) {
+        tmp_is_value = false;
         this->visit_expr(x);
-        if (ASR::is_a<ASR::Var_t>(x) || ASR::is_a<ASR::ArrayItem_t>(x)) {
+        if ((ASR::is_a<ASR::Var_t>(x) || ASR::is_a<ASR::ArrayItem_t>(x))
+                && !tmp_is_value) {
             mlir::Type type = getType(ASRUtils::expr_type(&x));
             tmp = builder->create<mlir::LLVM::LoadOp>(loc, type, tmp);
         }
+        tmp_is_value = false;
+    }
+
+    bool is_memref_array_item(const ASR::ArrayItem_t &x) {
+        if (!ASR::is_a<ASR::Var_t>(*x.m_v) || x.n_args != 1 ||
+                !x.m_args[0].m_right || x.m_args[0].m_left ||
+                x.m_args[0].m_step) {
+            return false;
+        }
+        uint64_t h = get_hash((ASR::asr_t*) ASRUtils::EXPR2VAR(x.m_v));
+        return memref_vars.count(h) > 0;
+    }
+
+    // Fixed-size 1-D integer/real local arrays with lower bound 1 whose
+    // every use is a plain element access become memrefs, so that the
+    // affine/memref optimizations apply to them
+    bool is_memref_eligible(const ASR::Variable_t &v) {
+        if (v.m_intent != ASR::intentType::Local) return false;
+        if (v.m_symbolic_value) return false;
+        if (v.m_storage == ASR::storage_typeType::Parameter) return false;
+        if (!ASR::is_a<ASR::Array_t>(*v.m_type)) return false;
+        ASR::Array_t *arr = down_cast<ASR::Array_t>(v.m_type);
+        if (arr->n_dims != 1) return false;
+        if (!ASRUtils::is_integer(*arr->m_type) &&
+                !ASRUtils::is_real(*arr->m_type)) {
+            return false;
+        }
+        int kind = ASRUtils::extract_kind_from_ttype_t(arr->m_type);
+        if (kind != 4 && kind != 8) return false;
+        int64_t start = 1, length = 0;
+        if (arr->m_dims[0].m_start &&
+                !ASRUtils::extract_value(arr->m_dims[0].m_start, start)) {
+            return false;
+        }
+        if (start != 1) return false;
+        if (!arr->m_dims[0].m_length ||
+                !ASRUtils::extract_value(arr->m_dims[0].m_length, length) ||
+                length <= 0) {
+            return false;
+        }
+        uint64_t h = get_hash((ASR::asr_t*) &v);
+        return memref_disqualified.count(h) == 0;
+    }
+
+    // Returns true and fills `iv`/`map` when the 1-based subscript is
+    // loop_var + constant for an enclosing affine.for loop; the map
+    // also folds in the shift to 0-based indexing
+    bool get_affine_access(ASR::expr_t *idx, mlir::Value &iv,
+            mlir::AffineMap &map) {
+        int64_t offset = 0;
+        ASR::expr_t *base = idx;
+        if (ASR::is_a<ASR::IntegerBinOp_t>(*idx)) {
+            ASR::IntegerBinOp_t *binop = down_cast<ASR::IntegerBinOp_t>(idx);
+            int64_t c = 0;
+            if (binop->m_op == ASR::binopType::Add &&
+                    ASRUtils::extract_value(binop->m_right, c)) {
+                base = binop->m_left;
+                offset = c;
+            } else if (binop->m_op == ASR::binopType::Sub &&
+                    ASRUtils::extract_value(binop->m_right, c)) {
+                base = binop->m_left;
+                offset = -c;
+            } else if (binop->m_op == ASR::binopType::Add &&
+                    ASRUtils::extract_value(binop->m_left, c)) {
+                base = binop->m_right;
+                offset = c;
+            }
+        }
+        if (!ASR::is_a<ASR::Var_t>(*base)) return false;
+        uint64_t h = get_hash((ASR::asr_t*) ASRUtils::EXPR2VAR(base));
+        auto it = affine_loop_vars.find(h);
+        if (it == affine_loop_vars.end()) return false;
+        iv = it->second;
+        mlir::AffineExpr d0 = builder->getAffineDimExpr(0);
+        map = mlir::AffineMap::get(1, 0, d0 + (offset - 1));
+        return true;
+    }
+
+    // Evaluates a 1-based subscript at runtime and converts it to a
+    // 0-based index value
+    mlir::Value compute_memref_index(ASR::expr_t *idx) {
+        this->visit_expr2(*idx);
+        mlir::Value v = tmp;
+        if (v.getType() != builder->getI64Type()) {
+            v = builder->create<mlir::LLVM::SExtOp>(loc,
+                builder->getI64Type(), v);
+        }
+        mlir::Value one = builder->create<mlir::LLVM::ConstantOp>(loc,
+            builder->getI64Type(), builder->getI64IntegerAttr(1));
+        v = builder->create<mlir::LLVM::SubOp>(loc, v, one);
+        return builder->create<mlir::arith::IndexCastOp>(loc,
+            builder->getIndexType(), v);
     }
 
     /******************************** Visitors ********************************/
@@ -205,6 +386,17 @@ public:
             mlir_symtab[h] = fn.getArgument(i);
         }
 
+        // Find the local arrays whose uses allow the memref form
+        memref_vars.clear();
+        memref_disqualified.clear();
+        {
+            MemrefUseScanner scanner;
+            for (size_t i = 0; i < x.n_body; i++) {
+                scanner.visit_stmt(*x.m_body[i]);
+            }
+            memref_disqualified = std::move(scanner.disqualified);
+        }
+
         // Declare only the Local and ReturnVar symbols
         for (auto &item : x.m_symtab->get_scope()) {
             if (is_a<ASR::Variable_t>(*item.second)) {
@@ -246,6 +438,17 @@ public:
         builder = std::make_unique<mlir::OpBuilder>(mlir::OpBuilder::atBlockBegin(
             &entryBlock));
 
+        // Find the local arrays whose uses allow the memref form
+        memref_vars.clear();
+        memref_disqualified.clear();
+        {
+            MemrefUseScanner scanner;
+            for (size_t i = 0; i < x.n_body; i++) {
+                scanner.visit_stmt(*x.m_body[i]);
+            }
+            memref_disqualified = std::move(scanner.disqualified);
+        }
+
         // Visit all the Variables
         for (auto &item : x.m_symtab->get_scope()) {
             if (is_a<ASR::Variable_t>(*item.second)) {
@@ -274,6 +477,16 @@ public:
             handle_string_variable(h);
             return;
         }
+        if (is_memref_eligible(x)) {
+            ASR::Array_t *arr = down_cast<ASR::Array_t>(x.m_type);
+            mlir::MemRefType memrefType = mlir::MemRefType::get(
+                {ASRUtils::get_fixed_size_of_array(x.m_type)},
+                getType(arr->m_type));
+            mlir_symtab[h] = builder->create<mlir::memref::AllocaOp>(loc,
+                memrefType);
+            memref_vars.insert(h);
+            return;
+        }
         mlir::Value size = builder->create<mlir::LLVM::ConstantOp>(loc,
             builder->getI32Type(), builder->getI64IntegerAttr(1));
         mlir_symtab[h] = builder->create<mlir::LLVM::AllocaOp>(loc,
@@ -426,6 +639,27 @@ public:
     }
 
     void visit_Assignment(const ASR::Assignment_t &x) {
+        if (ASR::is_a<ASR::ArrayItem_t>(*x.m_target)) {
+            ASR::ArrayItem_t *item = down_cast<ASR::ArrayItem_t>(x.m_target);
+            if (is_memref_array_item(*item)) {
+                this->visit_expr2(*x.m_value);
+                mlir::Value value = tmp;
+                uint64_t h = get_hash((ASR::asr_t*) ASRUtils::EXPR2VAR(
+                    item->m_v));
+                mlir::Value memref = mlir_symtab[h];
+                mlir::Value iv;
+                mlir::AffineMap map;
+                if (get_affine_access(item->m_args[0].m_right, iv, map)) {
+                    builder->create<mlir::affine::AffineStoreOp>(loc, value,
+                        memref, map, mlir::ValueRange{iv});
+                } else {
+                    builder->create<mlir::memref::StoreOp>(loc, value,
+                        memref, mlir::ValueRange{
+                            compute_memref_index(item->m_args[0].m_right)});
+                }
+                return;
+            }
+        }
         this->visit_expr(*x.m_target);
         mlir::Value target = tmp;
         this->visit_expr2(*x.m_value);
@@ -698,6 +932,25 @@ public:
     }
 
     void visit_ArrayItem(const ASR::ArrayItem_t &x) {
+        if (is_memref_array_item(x)) {
+            // Memref arrays load the element value directly: an
+            // affine.load when the subscript is affine in an enclosing
+            // affine.for, a memref.load with a computed index otherwise
+            uint64_t h = get_hash((ASR::asr_t*) ASRUtils::EXPR2VAR(x.m_v));
+            mlir::Value memref = mlir_symtab[h];
+            mlir::Value iv;
+            mlir::AffineMap map;
+            if (get_affine_access(x.m_args[0].m_right, iv, map)) {
+                tmp = builder->create<mlir::affine::AffineLoadOp>(loc,
+                    memref, map, mlir::ValueRange{iv});
+            } else {
+                tmp = builder->create<mlir::memref::LoadOp>(loc, memref,
+                    mlir::ValueRange{
+                        compute_memref_index(x.m_args[0].m_right)});
+            }
+            tmp_is_value = true;
+            return;
+        }
         this->visit_expr(*x.m_v);
         mlir::Value m_v = tmp;
 
@@ -763,6 +1016,15 @@ public:
         builder->setInsertionPointToStart(contBlock);
     }
 
+    // True when the current insertion block already ends in a
+    // terminator (e.g. the unreachable from an error stop), so no
+    // branch may be appended to it
+    bool block_terminated() {
+        mlir::Block *b = builder->getBlock();
+        return !b->empty() &&
+            b->back().hasTrait<mlir::OpTrait::IsTerminator>();
+    }
+
     void visit_WhileLoop(const ASR::WhileLoop_t &x) {
         mlir::Block *thisBlock = builder->getBlock();
         mlir::Block *headBlock = builder->createBlock(thisBlock->getParent());
@@ -777,14 +1039,196 @@ public:
         builder->create<mlir::LLVM::CondBrOp>(loc, tmp, bodyBlock, contBlock);
 
         builder->setInsertionPointToStart(bodyBlock);
+        loop_blocks.push_back({x.m_name ? std::string(x.m_name) : "",
+            headBlock, contBlock});
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
         }
+        loop_blocks.pop_back();
+        if (!block_terminated()) {
+            builder->create<mlir::LLVM::BrOp>(loc, mlir::ValueRange{},
+                headBlock);
+        }
+
+        builder->setInsertionPointToStart(contBlock);
+    }
+
+    // A statement list fits the single-block body of an affine.for only
+    // when it needs no internal control flow: plain assignments and
+    // nested affine-eligible do loops. Anything else (if, while,
+    // exit/cycle, error stop, calls through visit_Call, ...) takes the
+    // generic CFG lowering.
+    bool is_affine_body(ASR::stmt_t **body, size_t n_body) {
+        for (size_t i = 0; i < n_body; i++) {
+            if (ASR::is_a<ASR::Assignment_t>(*body[i])) {
+                continue;
+            }
+            if (ASR::is_a<ASR::DoLoop_t>(*body[i])) {
+                ASR::DoLoop_t *dl = down_cast<ASR::DoLoop_t>(body[i]);
+                int64_t start = 0, end = 0, step = 1;
+                if (!ASRUtils::extract_value(dl->m_head.m_start, start) ||
+                        !ASRUtils::extract_value(dl->m_head.m_end, end)) {
+                    return false;
+                }
+                if (dl->m_head.m_increment &&
+                        !ASRUtils::extract_value(dl->m_head.m_increment,
+                            step)) {
+                    return false;
+                }
+                if (step <= 0) return false;
+                if (!is_affine_body(dl->m_body, dl->n_body)) return false;
+                continue;
+            }
+            return false;
+        }
+        return true;
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        ASR::Variable_t *lv = ASRUtils::EXPR2VAR(x.m_head.m_v);
+        uint64_t h = get_hash((ASR::asr_t*) lv);
+        mlir::Type lvType = getType(lv->m_type);
+        int64_t start_val = 0, end_val = 0, step_val = 1;
+        bool const_bounds =
+            ASRUtils::extract_value(x.m_head.m_start, start_val) &&
+            ASRUtils::extract_value(x.m_head.m_end, end_val);
+        if (x.m_head.m_increment) {
+            const_bounds = const_bounds &&
+                ASRUtils::extract_value(x.m_head.m_increment, step_val);
+        }
+        if (const_bounds && step_val > 0 &&
+                is_affine_body(x.m_body, x.n_body)) {
+            // Structured form: MLIR's affine passes (invariant motion,
+            // tiling, fusion) only apply to affine.for, so emit it
+            // whenever the bounds are compile-time constants and the
+            // body is a single straight-line block. The upper bound of
+            // affine.for is exclusive.
+            mlir::affine::AffineForOp forOp =
+                builder->create<mlir::affine::AffineForOp>(loc,
+                    start_val, end_val + 1, step_val);
+            mlir::OpBuilder::InsertionGuard ipGuard(*builder);
+            builder->setInsertionPointToStart(forOp.getBody());
+            // Keep the loop variable's memory slot in sync for scalar
+            // uses of it inside the body
+            mlir::Value ivInt = builder->create<mlir::arith::IndexCastOp>(
+                loc, lvType, forOp.getInductionVar());
+            builder->create<mlir::LLVM::StoreOp>(loc, ivInt, mlir_symtab[h]);
+            affine_loop_vars[h] = forOp.getInductionVar();
+            for (size_t i = 0; i < x.n_body; i++) {
+                this->visit_stmt(*x.m_body[i]);
+            }
+            affine_loop_vars.erase(h);
+            return;
+        }
+
+        // Generic CFG lowering, equivalent to what the do_loops ASR
+        // pass used to produce for this backend:
+        //   i = start
+        //   while (step > 0 ? i <= end : i >= end) { body; i += step }
+        this->visit_expr2(*x.m_head.m_start);
+        builder->create<mlir::LLVM::StoreOp>(loc, tmp, mlir_symtab[h]);
+
+        mlir::Block *thisBlock = builder->getBlock();
+        mlir::Block *headBlock = builder->createBlock(thisBlock->getParent());
+        mlir::Block *bodyBlock = builder->createBlock(thisBlock->getParent());
+        mlir::Block *latchBlock = builder->createBlock(thisBlock->getParent());
+        mlir::Block *contBlock = builder->createBlock(thisBlock->getParent());
+
+        builder->setInsertionPointToEnd(thisBlock);
         builder->create<mlir::LLVM::BrOp>(loc, mlir::ValueRange{}, headBlock);
 
+        builder->setInsertionPointToStart(headBlock);
+        mlir::Value i = builder->create<mlir::LLVM::LoadOp>(loc, lvType,
+            mlir_symtab[h]);
+        this->visit_expr2(*x.m_head.m_end);
+        mlir::Value end = tmp;
+        mlir::Value step;
+        if (x.m_head.m_increment) {
+            this->visit_expr2(*x.m_head.m_increment);
+            step = tmp;
+        } else {
+            step = builder->create<mlir::LLVM::ConstantOp>(loc, lvType,
+                builder->getIntegerAttr(lvType, 1));
+        }
+        mlir::Value zero = builder->create<mlir::LLVM::ConstantOp>(loc,
+            lvType, builder->getIntegerAttr(lvType, 0));
+        mlir::Value up = builder->create<mlir::LLVM::ICmpOp>(loc,
+            mlir::LLVM::ICmpPredicate::sle, i, end);
+        mlir::Value down = builder->create<mlir::LLVM::ICmpOp>(loc,
+            mlir::LLVM::ICmpPredicate::sge, i, end);
+        mlir::Value positive = builder->create<mlir::LLVM::ICmpOp>(loc,
+            mlir::LLVM::ICmpPredicate::sgt, step, zero);
+        mlir::Value cond = builder->create<mlir::LLVM::SelectOp>(loc,
+            positive, up, down);
+        builder->create<mlir::LLVM::CondBrOp>(loc, cond, bodyBlock,
+            contBlock);
+
+        builder->setInsertionPointToStart(bodyBlock);
+        loop_blocks.push_back({x.m_name ? std::string(x.m_name) : "",
+            latchBlock, contBlock});
+        for (size_t i2 = 0; i2 < x.n_body; i2++) {
+            this->visit_stmt(*x.m_body[i2]);
+        }
+        loop_blocks.pop_back();
+        if (!block_terminated()) {
+            builder->create<mlir::LLVM::BrOp>(loc, mlir::ValueRange{},
+                latchBlock);
+        }
+
+        builder->setInsertionPointToStart(latchBlock);
+        mlir::Value cur = builder->create<mlir::LLVM::LoadOp>(loc, lvType,
+            mlir_symtab[h]);
+        mlir::Value next = builder->create<mlir::LLVM::AddOp>(loc, cur,
+            step);
+        builder->create<mlir::LLVM::StoreOp>(loc, next, mlir_symtab[h]);
+        builder->create<mlir::LLVM::BrOp>(loc, mlir::ValueRange{},
+            headBlock);
+
         builder->setInsertionPointToStart(contBlock);
     }
 
+    const LoopBlocks *find_loop_blocks(char *stmt_name,
+            const Location &l) {
+        if (loop_blocks.empty()) {
+            throw CodeGenError("exit/cycle outside of a loop", l);
+        }
+        if (!stmt_name) {
+            return &loop_blocks.back();
+        }
+        for (auto it = loop_blocks.rbegin(); it != loop_blocks.rend();
+                ++it) {
+            if (it->name == stmt_name) {
+                return &*it;
+            }
+        }
+        throw CodeGenError("no enclosing loop named '" +
+            std::string(stmt_name) + "'", l);
+    }
+
+    void visit_Exit(const ASR::Exit_t &x) {
+        const LoopBlocks *target = find_loop_blocks(x.m_stmt_name,
+            x.base.base.loc);
+        mlir::Block *thisBlock = builder->getBlock();
+        builder->create<mlir::LLVM::BrOp>(loc, mlir::ValueRange{},
+            target->exit_block);
+        // Anything after the branch is unreachable; give it its own
+        // block so emission can continue
+        mlir::Block *deadBlock = builder->createBlock(
+            thisBlock->getParent());
+        builder->setInsertionPointToStart(deadBlock);
+    }
+
+    void visit_Cycle(const ASR::Cycle_t &x) {
+        const LoopBlocks *target = find_loop_blocks(x.m_stmt_name,
+            x.base.base.loc);
+        mlir::Block *thisBlock = builder->getBlock();
+        builder->create<mlir::LLVM::BrOp>(loc, mlir::ValueRange{},
+            target->cycle_block);
+        mlir::Block *deadBlock = builder->createBlock(
+            thisBlock->getParent());
+        builder->setInsertionPointToStart(deadBlock);
+    }
+
     void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t &x) {
         //
         // The following source code:
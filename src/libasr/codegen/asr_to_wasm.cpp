@@ -2610,6 +2610,49 @@ class ASRToWASMVisitor : public ASR::BaseVisitor<ASRToWASMVisitor> {
     void visit_ArrayConstant(const ASR::ArrayConstant_t &x) {
         // Todo: Add a check here if there is memory available to store the
         // given string
+        ASR::ttype_t* el_type = ASRUtils::type_get_past_array(x.m_type);
+        if ((ASR::is_a<ASR::Integer_t>(*el_type) ||
+                ASR::is_a<ASR::Real_t>(*el_type) ||
+                ASR::is_a<ASR::Logical_t>(*el_type)) && x.m_n_data > 0) {
+            // numeric constants are stored little-endian in m_data, which
+            // matches wasm linear memory, so materialize them with a single
+            // bulk-memory instruction instead of one store per element
+            const uint8_t* bytes = (const uint8_t*)x.m_data;
+            uint32_t nbytes = (uint32_t)x.m_n_data;
+            uint32_t dest_mem_loc = avail_mem_loc;
+            avail_mem_loc += nbytes;
+
+            bool all_bytes_same = true;
+            for (uint32_t i = 1; i < nbytes; i++) {
+                if (bytes[i] != bytes[0]) {
+                    all_bytes_same = false;
+                    break;
+                }
+            }
+            if (all_bytes_same) {
+                // common case of zero (or otherwise uniform) initializers:
+                // no data segment needed at all
+                m_wa.emit_i32_const(dest_mem_loc);
+                m_wa.emit_i32_const(bytes[0]);
+                m_wa.emit_i32_const(nbytes);
+                m_wa.emit_memory_fill();
+            } else {
+                // place the constant bytes in a data segment and copy them
+                // into the working location on each evaluation, matching the
+                // re-materialization the per-element stores used to do
+                uint32_t data_seg_loc = avail_mem_loc;
+                avail_mem_loc += nbytes;
+                m_wa.emit_data_str(data_seg_loc,
+                    std::string((const char*)bytes, nbytes));
+                m_wa.emit_i32_const(dest_mem_loc);
+                m_wa.emit_i32_const(data_seg_loc);
+                m_wa.emit_i32_const(nbytes);
+                m_wa.emit_memory_copy();
+            }
+            // leave array location in memory on the stack
+            m_wa.emit_i32_const(dest_mem_loc);
+            return;
+        }
         uint32_t cur_mem_loc = avail_mem_loc;
         for (size_t i = 0; i < (size_t) ASRUtils::get_fixed_size_of_array(x.m_type); i++) {
             // emit memory location to store array element
@@ -3576,12 +3619,13 @@ class ASRToWASMVisitor : public ASR::BaseVisitor<ASRToWASMVisitor> {
     }
 };
 
-Result<Vec<uint8_t>> asr_to_wasm_bytes_stream(ASR::TranslationUnit_t &asr,
-                                              Allocator &al,
-                                              diag::Diagnostics &diagnostics,
-                                              CompilerOptions &co) {
-    ASRToWASMVisitor v(al, diagnostics);
-
+// Applies the wasm pass pipeline and runs the visitor; on success the
+// finished sections are in v.m_wa, ready to be fetched or streamed out.
+static Result<int> asr_to_wasm_visit(ASRToWASMVisitor &v,
+                                     ASR::TranslationUnit_t &asr,
+                                     Allocator &al,
+                                     diag::Diagnostics &diagnostics,
+                                     CompilerOptions &co) {
     co.po.always_run = true;
     std::vector<std::string> passes = {"pass_array_by_data", "array_op",
                 "implied_do_loops", "print_arr", "do_loops", "select_case",
@@ -3602,7 +3646,18 @@ Result<Vec<uint8_t>> asr_to_wasm_bytes_stream(ASR::TranslationUnit_t &asr,
         diagnostics.diagnostics.push_back(e.d);
         return Error();
     }
+    return 0;
+}
 
+Result<Vec<uint8_t>> asr_to_wasm_bytes_stream(ASR::TranslationUnit_t &asr,
+                                              Allocator &al,
+                                              diag::Diagnostics &diagnostics,
+                                              CompilerOptions &co) {
+    ASRToWASMVisitor v(al, diagnostics);
+    Result<int> res = asr_to_wasm_visit(v, asr, al, diagnostics, co);
+    if (!res.ok) {
+        return res.error;
+    }
     return v.m_wa.get_wasm();
 }
 
@@ -3612,18 +3667,22 @@ Result<int> asr_to_wasm(ASR::TranslationUnit_t &asr, Allocator &al,
     int time_visit_asr = 0;
     int time_save = 0;
 
+    ASRToWASMVisitor v(al, diagnostics);
+
     auto t1 = std::chrono::high_resolution_clock::now();
-    Result<Vec<uint8_t>> wasm = asr_to_wasm_bytes_stream(asr, al, diagnostics, co);
+    Result<int> res = asr_to_wasm_visit(v, asr, al, diagnostics, co);
     auto t2 = std::chrono::high_resolution_clock::now();
     time_visit_asr =
         std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
-    if (!wasm.ok) {
-        return wasm.error;
+    if (!res.ok) {
+        return res.error;
     }
 
     {
+        // stream the sections straight to the file; this avoids
+        // materializing a second copy of the whole binary in memory
         auto t1 = std::chrono::high_resolution_clock::now();
-        wasm::save_bin(wasm.result, filename);
+        v.m_wa.save_wasm(filename);
         auto t2 = std::chrono::high_resolution_clock::now();
         time_save =
             std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1)
@@ -273,11 +273,59 @@ public:
         }
     }
 
+    // If `e` is a leaf expression (constant or variable), emits a load of
+    // its value directly into register `r` and returns true; such loads
+    // cannot clobber any register other than `r`. Returns false otherwise.
+    bool try_emit_leaf_expr(X86Reg r, ASR::expr_t *e) {
+        if (ASR::is_a<ASR::IntegerConstant_t>(*e)) {
+            m_a.asm_mov_r32_imm32(r, down_cast<ASR::IntegerConstant_t>(e)->m_n);
+            return true;
+        }
+        if (ASR::is_a<ASR::LogicalConstant_t>(*e)) {
+            m_a.asm_mov_r32_imm32(r,
+                down_cast<ASR::LogicalConstant_t>(e)->m_value ? 1 : 0);
+            return true;
+        }
+        if (ASR::is_a<ASR::Var_t>(*e)) {
+            ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(
+                down_cast<ASR::Var_t>(e)->m_v);
+            uint32_t h = get_hash((ASR::asr_t*)v);
+            LCOMPILERS_ASSERT(x86_symtab.find(h) != x86_symtab.end());
+            Sym s = x86_symtab[h];
+            X86Reg base = X86Reg::ebp;
+            // mov r, [ebp-s.stack_offset]
+            m_a.asm_mov_r32_m32(r, &base, nullptr, 1, -s.stack_offset);
+            if (s.pointer) {
+                base = r;
+                // Dereference a pointer
+                // mov r, [r]
+                m_a.asm_mov_r32_m32(r, &base, nullptr, 1, 0);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // Evaluates the left operand into eax and the right operand into ecx.
+    // When the right operand is a leaf, the left operand is computed first
+    // and the right one loaded straight into ecx, avoiding the push/pop
+    // round-trip through memory that the general case needs.
+    void emit_binop_operands(ASR::expr_t *left, ASR::expr_t *right) {
+        if (ASR::is_a<ASR::IntegerConstant_t>(*right) ||
+                ASR::is_a<ASR::LogicalConstant_t>(*right) ||
+                ASR::is_a<ASR::Var_t>(*right)) {
+            this->visit_expr(*left);
+            try_emit_leaf_expr(X86Reg::ecx, right);
+        } else {
+            this->visit_expr(*right);
+            m_a.asm_push_r32(X86Reg::eax);
+            this->visit_expr(*left);
+            m_a.asm_pop_r32(X86Reg::ecx);
+        }
+    }
+
     void visit_IntegerBinOp(const ASR::IntegerBinOp_t &x) {
-        this->visit_expr(*x.m_right);
-        m_a.asm_push_r32(X86Reg::eax);
-        this->visit_expr(*x.m_left);
-        m_a.asm_pop_r32(X86Reg::ecx);
+        emit_binop_operands(x.m_left, x.m_right);
         // The left operand is in eax, the right operand is in ecx
         // Leave the result in eax.
         switch (x.m_op) {
@@ -312,10 +360,7 @@ public:
 
     void visit_IntegerCompare(const ASR::IntegerCompare_t &x) {
         std::string id = std::to_string(get_hash((ASR::asr_t*)&x));
-        this->visit_expr(*x.m_right);
-        m_a.asm_push_r32(X86Reg::eax);
-        this->visit_expr(*x.m_left);
-        m_a.asm_pop_r32(X86Reg::ecx);
+        emit_binop_operands(x.m_left, x.m_right);
         // The left operand is in eax, the right operand is in ecx
         // Leave the result in eax.
         m_a.asm_cmp_r32_r32(X86Reg::eax, X86Reg::ecx);
@@ -427,10 +472,8 @@ public:
         std::string id = std::to_string(get_hash((ASR::asr_t*)&x));
         this->visit_expr(*x.m_test);
         // eax contains the logical value (true=1, false=0) of the if condition
-        m_a.asm_cmp_r32_imm8(X86Reg::eax, 1);
-        m_a.asm_je_label(".then" + id);
-        m_a.asm_jmp_label(".else" + id);
-        m_a.add_label(".then" + id);
+        m_a.asm_cmp_r32_imm8(X86Reg::eax, 0);
+        m_a.asm_je_label(".else" + id);
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
         }
@@ -449,12 +492,10 @@ public:
         m_a.add_label(".loop.head" + id);
         this->visit_expr(*x.m_test);
         // eax contains the logical value (true=1, false=0) of the while condition
-        m_a.asm_cmp_r32_imm8(X86Reg::eax, 1);
-        m_a.asm_je_label(".loop.body" + id);
-        m_a.asm_jmp_label(".loop.end" + id);
+        m_a.asm_cmp_r32_imm8(X86Reg::eax, 0);
+        m_a.asm_je_label(".loop.end" + id);
 
         // body
-        m_a.add_label(".loop.body" + id);
         for (size_t i=0; i<x.n_body; i++) {
             this->visit_stmt(*x.m_body[i]);
         }
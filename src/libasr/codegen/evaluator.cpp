@@ -1,5 +1,8 @@
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <set>
+#include <thread>
 
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/ADT/STLExtras.h>
@@ -45,6 +48,12 @@
 #include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Path.h>
 #include <llvm/AsmParser/Parser.h>
+#include <llvm/Analysis/ModuleSummaryAnalysis.h>
+#include <llvm/Analysis/ProfileSummaryInfo.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/ADT/StringRef.h>
 #include <llvm/Target/TargetOptions.h>
@@ -56,6 +65,8 @@
 #if LLVM_VERSION_MAJOR >= 17
     // TODO: removed from LLVM 17
     #include <llvm/Passes/PassBuilder.h>
+    #include <llvm/Support/PGOOptions.h>
+    #include <llvm/Support/VirtualFileSystem.h>
 #else
 #    include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #endif
@@ -75,6 +86,14 @@
 
 #ifdef HAVE_LFORTRAN_MLIR
 #include <mlir/IR/BuiltinOps.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Transforms/Passes.h>
+#include <mlir/Conversion/AffineToStandard/AffineToStandard.h>
+#include <mlir/Conversion/SCFToControlFlow/SCFToControlFlow.h>
+#include <mlir/Conversion/MemRefToLLVM/MemRefToLLVM.h>
+#include <mlir/Conversion/ArithToLLVM/ArithToLLVM.h>
+#include <mlir/Conversion/ControlFlowToLLVM/ControlFlowToLLVM.h>
+#include <mlir/Conversion/ReconcileUnrealizedCasts/ReconcileUnrealizedCasts.h>
 #include <mlir/Target/LLVMIR/Export.h>
 #endif
 
@@ -183,6 +202,34 @@ std::string MLIRModule::llvm_str() {
 }
 
 void MLIRModule::mlir_to_llvm(llvm::LLVMContext &ctx) {
+    // Modules with structured loops and arrays carry affine, memref and
+    // arith ops: optimize them while they are still structured, then
+    // lower everything to the LLVM dialect. Modules that only use the
+    // LLVM and OpenMP dialects skip the pipeline so their IR stays
+    // unchanged.
+    bool needs_lowering = false;
+    mlir_m->walk([&](mlir::Operation *op) {
+        llvm::StringRef dialect = op->getName().getDialectNamespace();
+        if (dialect == "affine" || dialect == "memref" ||
+                dialect == "arith" || dialect == "scf" || dialect == "cf") {
+            needs_lowering = true;
+        }
+    });
+    if (needs_lowering) {
+        mlir::PassManager pm(mlir_ctx.get());
+        pm.addPass(mlir::createCanonicalizerPass());
+        pm.addPass(mlir::createLoopInvariantCodeMotionPass());
+        pm.addPass(mlir::createLowerAffinePass());
+        pm.addPass(mlir::createConvertSCFToCFPass());
+        pm.addPass(mlir::createFinalizeMemRefToLLVMConversionPass());
+        pm.addPass(mlir::createArithToLLVMConversionPass());
+        pm.addPass(mlir::createConvertControlFlowToLLVMPass());
+        pm.addPass(mlir::createReconcileUnrealizedCastsPass());
+        if (mlir::failed(pm.run(*mlir_m))) {
+            throw LCompilersException(
+                "Failed to lower MLIR to the LLVM dialect");
+        }
+    }
     std::unique_ptr<llvm::Module> llvmModule = mlir::translateModuleToLLVMIR(
         *mlir_m, ctx);
     if (llvmModule) {
@@ -199,33 +246,77 @@ float _lfortran_stan(float x);
 
 }
 
-LLVMEvaluator::LLVMEvaluator(const std::string &t)
+// Registers only the backend that can codegen for `triple`. Registration
+// is idempotent but not free (target, MC layer, asm printer and parser per
+// backend), and it runs in every compiler process, so cross-compiles
+// register just the backend they need instead of everything compiled in.
+// An arch we cannot classify falls back to registering all compiled-in
+// backends and lets TargetRegistry::lookupTarget() report unsupported
+// triples.
+static void initialize_target_for(const std::string &triple)
 {
-    llvm::InitializeNativeTarget();
-    llvm::InitializeNativeTargetAsmPrinter();
-    llvm::InitializeNativeTargetAsmParser();
-
+    std::string arch = triple.substr(0, triple.find('-'));
+#ifdef HAVE_TARGET_AARCH64
+    if (arch == "aarch64" || arch == "arm64") {
+        LLVMInitializeAArch64TargetInfo();
+        LLVMInitializeAArch64Target();
+        LLVMInitializeAArch64TargetMC();
+        LLVMInitializeAArch64AsmPrinter();
+        LLVMInitializeAArch64AsmParser();
+        return;
+    }
+#endif
+#ifdef HAVE_TARGET_X86
+    if (arch == "x86_64" || arch == "i386" || arch == "i686") {
+        LLVMInitializeX86TargetInfo();
+        LLVMInitializeX86Target();
+        LLVMInitializeX86TargetMC();
+        LLVMInitializeX86AsmPrinter();
+        LLVMInitializeX86AsmParser();
+        return;
+    }
+#endif
+#ifdef HAVE_TARGET_WASM
+    if (arch == "wasm32" || arch == "wasm64") {
+        LLVMInitializeWebAssemblyTargetInfo();
+        LLVMInitializeWebAssemblyTarget();
+        LLVMInitializeWebAssemblyTargetMC();
+        LLVMInitializeWebAssemblyAsmPrinter();
+        LLVMInitializeWebAssemblyAsmParser();
+        return;
+    }
+#endif
 #ifdef HAVE_TARGET_AARCH64
-    LLVMInitializeAArch64Target();
     LLVMInitializeAArch64TargetInfo();
+    LLVMInitializeAArch64Target();
     LLVMInitializeAArch64TargetMC();
     LLVMInitializeAArch64AsmPrinter();
     LLVMInitializeAArch64AsmParser();
 #endif
 #ifdef HAVE_TARGET_X86
-    LLVMInitializeX86Target();
     LLVMInitializeX86TargetInfo();
+    LLVMInitializeX86Target();
     LLVMInitializeX86TargetMC();
     LLVMInitializeX86AsmPrinter();
     LLVMInitializeX86AsmParser();
 #endif
 #ifdef HAVE_TARGET_WASM
-    LLVMInitializeWebAssemblyTarget();
     LLVMInitializeWebAssemblyTargetInfo();
+    LLVMInitializeWebAssemblyTarget();
     LLVMInitializeWebAssemblyTargetMC();
     LLVMInitializeWebAssemblyAsmPrinter();
     LLVMInitializeWebAssemblyAsmParser();
 #endif
+}
+
+LLVMEvaluator::LLVMEvaluator(const std::string &t, bool fast) : fast{fast}
+{
+    // The JIT always executes on the host, so the native backend is
+    // always needed; an explicit cross --target additionally registers
+    // just its own backend.
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
 
     context = std::make_unique<llvm::LLVMContext>();
 
@@ -234,23 +325,14 @@ LLVMEvaluator::LLVMEvaluator(const std::string &t)
     else
         target_triple = LLVMGetDefaultTargetTriple();
 
-    std::string Error;
-    const llvm::Target *target = llvm::TargetRegistry::lookupTarget(target_triple, Error);
-    if (!target) {
-        throw LCompilersException(Error);
+    if (t != "" && t != LLVMGetDefaultTargetTriple()) {
+        initialize_target_for(target_triple);
     }
-    std::string CPU = "generic";
-    std::string features = "";
-    llvm::TargetOptions opt;
+
 #if LLVM_VERSION_MAJOR >= 8
-    RM_OPTIONAL_TYPE<llvm::Reloc::Model> RM = llvm::Reloc::Model::PIC_;
-    TM = target->createTargetMachine(
-#if LLVM_VERSION_MAJOR >= 21
-        llvm::Triple(target_triple),
-#else
-        target_triple,
-#endif
-        CPU, features, opt, RM);
+    // The target machine is created lazily in get_target_machine():
+    // JIT-only runs and object-cache hits never pay for backend setup.
+    TM = nullptr;
 #else
     // LLVM 7: Use EngineBuilder with setRelocationModel to avoid ABI issues
     // with Optional parameters while still specifying PIC relocation model
@@ -264,7 +346,7 @@ LLVMEvaluator::LLVMEvaluator(const std::string &t)
 #endif
 
     // For some reason the JIT requires a different TargetMachine
-    jit = cantFail(llvm::orc::KaleidoscopeJIT::Create());
+    jit = cantFail(llvm::orc::KaleidoscopeJIT::Create(fast));
 
     _lfortran_stan(0.5);
 }
@@ -275,6 +357,101 @@ LLVMEvaluator::~LLVMEvaluator()
     context.reset();
 }
 
+// On-disk object cache for the JIT, keyed by a content hash of the module
+// IR, so re-compiling unchanged code reuses the stored object instead of
+// running LLVM codegen again. Cache failures (unwritable directory, missing
+// file) silently fall back to compiling.
+class LLVMObjectCache : public llvm::ObjectCache {
+public:
+    LLVMObjectCache(const std::string &dir, bool fast)
+        : m_dir{dir}, m_fast{fast} {}
+
+    void notifyObjectCompiled(const llvm::Module *m,
+            llvm::MemoryBufferRef obj) override {
+        std::error_code ec = llvm::sys::fs::create_directories(m_dir);
+        if (ec) {
+            return;
+        }
+        llvm::raw_fd_ostream out(cache_filename(*m), ec, llvm::sys::fs::OF_None);
+        if (ec) {
+            return;
+        }
+        out << obj.getBuffer();
+    }
+
+    std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module *m) override {
+        llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buf =
+            llvm::MemoryBuffer::getFile(cache_filename(*m));
+        if (!buf) {
+            return nullptr;
+        }
+        return std::move(*buf);
+    }
+
+private:
+    std::string m_dir;
+    bool m_fast;
+
+    std::string cache_filename(const llvm::Module &m) {
+        std::string ir;
+        llvm::raw_string_ostream os(ir);
+        m.print(os, nullptr);
+        // The printed IR covers the target triple and data layout; the
+        // codegen tier has to go into the name separately.
+        return m_dir + "/" + fnv1a_hash64_hex(os.str()) + "-"
+            + std::to_string(ir.size()) + (m_fast ? "-fast" : "") + ".o";
+    }
+};
+
+void LLVMEvaluator::set_object_cache_dir(const std::string &dir) {
+    object_cache = std::make_unique<LLVMObjectCache>(dir, fast);
+    jit->setObjectCache(object_cache.get());
+}
+
+llvm::TargetMachine *LLVMEvaluator::create_target_machine()
+{
+#if LLVM_VERSION_MAJOR >= 8
+    std::string Error;
+    const llvm::Target *target = llvm::TargetRegistry::lookupTarget(target_triple, Error);
+    if (!target) {
+        throw LCompilersException(Error);
+    }
+    std::string CPU = "generic";
+    std::string features = "";
+    llvm::TargetOptions opt;
+    // Debug tier: skip instruction scheduling and selection-DAG work and
+    // let FastISel pick instructions; release tier (--fast) keeps the
+    // aggressive backend.
+    opt.EnableFastISel = !fast;
+#if LLVM_VERSION_MAJOR >= 18
+    llvm::CodeGenOptLevel opt_level = fast
+        ? llvm::CodeGenOptLevel::Aggressive : llvm::CodeGenOptLevel::None;
+#else
+    llvm::CodeGenOpt::Level opt_level = fast
+        ? llvm::CodeGenOpt::Aggressive : llvm::CodeGenOpt::None;
+#endif
+    RM_OPTIONAL_TYPE<llvm::Reloc::Model> RM = llvm::Reloc::Model::PIC_;
+    return target->createTargetMachine(
+#if LLVM_VERSION_MAJOR >= 21
+        llvm::Triple(target_triple),
+#else
+        target_triple,
+#endif
+        CPU, features, opt, RM,
+        RM_OPTIONAL_TYPE<llvm::CodeModel::Model>(), opt_level);
+#else
+    throw LCompilersException("create_target_machine() requires LLVM >= 8");
+#endif
+}
+
+llvm::TargetMachine *LLVMEvaluator::get_target_machine()
+{
+    if (TM == nullptr) {
+        TM = create_target_machine();
+    }
+    return TM;
+}
+
 std::unique_ptr<llvm::Module> LLVMEvaluator::parse_module(const std::string &source, const std::string &filename="")
 {
     llvm::SMDiagnostic err;
@@ -416,7 +593,7 @@ std::string LLVMEvaluator::get_asm(llvm::Module &m)
 #endif
     llvm::SmallVector<char, 128> buf;
     llvm::raw_svector_ostream dest(buf);
-    if (TM->addPassesToEmitFile(pass, dest, nullptr, ft)) {
+    if (get_target_machine()->addPassesToEmitFile(pass, dest, nullptr, ft)) {
         throw std::runtime_error("TargetMachine can't emit a file of this type");
     }
     pass.run(m);
@@ -434,7 +611,7 @@ void LLVMEvaluator::save_object_file(llvm::Module &m, const std::string &filenam
 #else
     m.setTargetTriple(target_triple);
 #endif
-    m.setDataLayout(TM->createDataLayout());
+    m.setDataLayout(get_target_machine()->createDataLayout());
 
     llvm::legacy::PassManager pass;
 #if LLVM_VERSION_MAJOR < 10
@@ -449,33 +626,62 @@ void LLVMEvaluator::save_object_file(llvm::Module &m, const std::string &filenam
     if (EC) {
         throw std::runtime_error("raw_fd_ostream failed");
     }
-    if (TM->addPassesToEmitFile(pass, dest, nullptr, ft)) {
+    if (get_target_machine()->addPassesToEmitFile(pass, dest, nullptr, ft)) {
         throw std::runtime_error("TargetMachine can't emit a file of this type");
     }
     pass.run(m);
     dest.flush();
 }
 
-void LLVMEvaluator::create_empty_object_file(const std::string &filename) {
-    std::string source;
-    std::unique_ptr<llvm::Module> module = parse_module(source);
-    save_object_file(*module, filename);
-}
-
-void LLVMEvaluator::opt(llvm::Module &m) {
+void LLVMEvaluator::save_bitcode_file(llvm::Module &m, const std::string &filename) {
 #if LLVM_VERSION_MAJOR >= 21
     m.setTargetTriple(llvm::Triple(target_triple));
 #else
     m.setTargetTriple(target_triple);
 #endif
-    m.setDataLayout(TM->createDataLayout());
+    m.setDataLayout(get_target_machine()->createDataLayout());
+
+    std::error_code EC;
+    llvm::raw_fd_ostream dest(filename, EC, llvm::sys::fs::OF_None);
+    if (EC) {
+        throw std::runtime_error("raw_fd_ostream failed");
+    }
+    // The summary index lets the linker run the ThinLTO backend instead of
+    // falling back to monolithic LTO.
+    llvm::ProfileSummaryInfo PSI(m);
+    llvm::ModuleSummaryIndex index = llvm::buildModuleSummaryIndex(
+        m, nullptr, &PSI);
+    llvm::WriteBitcodeToFile(m, dest, false, &index, true);
+    dest.flush();
+}
+
+void LLVMEvaluator::create_empty_object_file(const std::string &filename) {
+    std::string source;
+    std::unique_ptr<llvm::Module> module = parse_module(source);
+    save_object_file(*module, filename);
+}
 
+// Runs the default O3 pipeline on `m`. Factored out of opt() so that
+// opt_parallel() can run the same pipeline on several modules concurrently,
+// each with its own TargetMachine. `pgo_generate`/`pgo_use` select
+// instrumentation-based profile generation or consumption.
+static void run_opt_passes(llvm::Module &m, llvm::TargetMachine *TM,
+        bool pgo_generate, const std::string &pgo_use) {
 #if LLVM_VERSION_MAJOR >= 17
     llvm::LoopAnalysisManager LAM;
     llvm::FunctionAnalysisManager FAM;
     llvm::CGSCCAnalysisManager CGAM;
     llvm::ModuleAnalysisManager MAM;
-    llvm::PassBuilder PB = llvm::PassBuilder(TM);
+    std::optional<llvm::PGOOptions> PGOOpt;
+    if (pgo_generate) {
+        PGOOpt = llvm::PGOOptions("", "", "", "",
+            llvm::vfs::getRealFileSystem(), llvm::PGOOptions::IRInstr);
+    } else if (!pgo_use.empty()) {
+        PGOOpt = llvm::PGOOptions(pgo_use, "", "", "",
+            llvm::vfs::getRealFileSystem(), llvm::PGOOptions::IRUse);
+    }
+    llvm::PassBuilder PB = llvm::PassBuilder(TM,
+        llvm::PipelineTuningOptions(), PGOOpt);
     PB.registerModuleAnalyses(MAM);
     PB.registerCGSCCAnalyses(CGAM);
     PB.registerFunctionAnalyses(FAM);
@@ -500,6 +706,11 @@ void LLVMEvaluator::opt(llvm::Module &m) {
     builder.DisableUnrollLoops = false;
     builder.LoopVectorize = true;
     builder.SLPVectorize = true;
+    if (pgo_generate) {
+        builder.EnablePGOInstrGen = true;
+    } else if (!pgo_use.empty()) {
+        builder.PGOInstrUse = pgo_use;
+    }
     builder.populateFunctionPassManager(fpm);
     builder.populateModulePassManager(mpm);
     fpm.doInitialization();
@@ -512,6 +723,208 @@ void LLVMEvaluator::opt(llvm::Module &m) {
 #endif
 }
 
+void LLVMEvaluator::opt(llvm::Module &m) {
+#if LLVM_VERSION_MAJOR >= 21
+    m.setTargetTriple(llvm::Triple(target_triple));
+#else
+    m.setTargetTriple(target_triple);
+#endif
+    m.setDataLayout(get_target_machine()->createDataLayout());
+    run_opt_passes(m, get_target_machine(), pgo_generate, pgo_use);
+}
+
+void LLVMEvaluator::set_pgo(bool generate, const std::string &use_file) {
+    pgo_generate = generate;
+    pgo_use = use_file;
+}
+
+void LLVMEvaluator::opt_parallel(std::unique_ptr<llvm::Module> &m, int jobs) {
+#if LLVM_VERSION_MAJOR >= 8
+    // Collect the functions worth distributing: only definitions count.
+    std::vector<llvm::Function*> defined;
+    for (llvm::Function &f : *m) {
+        if (!f.isDeclaration()) {
+            defined.push_back(&f);
+        }
+    }
+    size_t n_partitions = std::min((size_t) jobs, defined.size());
+    if (n_partitions < 2) {
+        opt(*m);
+        return;
+    }
+    // Aliases and ifuncs need their aliasee in the same partition; the
+    // frontend does not generate them, so just fall back if they show up.
+    if (!m->alias_empty() || !m->ifunc_empty()) {
+        opt(*m);
+        return;
+    }
+#if LLVM_VERSION_MAJOR >= 21
+    m->setTargetTriple(llvm::Triple(target_triple));
+#else
+    m->setTargetTriple(target_triple);
+#endif
+    m->setDataLayout(get_target_machine()->createDataLayout());
+
+    // Promote local symbols to external linkage with unique names so that a
+    // partition can reference definitions that live in another partition.
+    // The original visibility is restored after the partitions are linked
+    // back together, so no extra symbols leak into the final object file.
+    std::vector<std::string> promoted;
+    size_t promoted_counter = 0;
+    auto promote = [&](llvm::GlobalValue &gv) {
+        if (gv.isDeclaration() || !gv.hasLocalLinkage()) {
+            return;
+        }
+        gv.setName(gv.getName().str() + ".lpar."
+            + std::to_string(promoted_counter++));
+        gv.setLinkage(llvm::GlobalValue::ExternalLinkage);
+        promoted.push_back(gv.getName().str());
+    };
+    for (llvm::Function &f : *m) {
+        promote(f);
+    }
+    for (llvm::GlobalVariable &g : m->globals()) {
+        promote(g);
+    }
+
+    // Greedy partitioning by instruction count: largest functions first,
+    // each into the currently smallest partition.
+    std::sort(defined.begin(), defined.end(),
+        [](llvm::Function *a, llvm::Function *b) {
+            return a->getInstructionCount() > b->getInstructionCount();
+        });
+    std::vector<std::set<std::string>> partitions(n_partitions);
+    std::vector<uint64_t> partition_size(n_partitions, 0);
+    for (llvm::Function *f : defined) {
+        size_t smallest = 0;
+        for (size_t k = 1; k < n_partitions; k++) {
+            if (partition_size[k] < partition_size[smallest]) {
+                smallest = k;
+            }
+        }
+        partitions[smallest].insert(f->getName().str());
+        partition_size[smallest] += f->getInstructionCount();
+    }
+
+    // One bitcode serialization of the whole module; every worker reparses
+    // it into its own LLVMContext, which is what makes the threads
+    // independent (an LLVMContext is not thread safe).
+    std::string bitcode;
+    {
+        llvm::raw_string_ostream os(bitcode);
+        llvm::WriteBitcodeToFile(*m, os);
+    }
+
+    std::vector<std::string> optimized(n_partitions);
+    std::vector<std::string> errors(n_partitions);
+    auto worker = [&](size_t k) {
+        try {
+            llvm::LLVMContext ctx;
+            llvm::Expected<std::unique_ptr<llvm::Module>> mod_or_err =
+                llvm::parseBitcodeFile(
+                    llvm::MemoryBufferRef(bitcode, "partition"), ctx);
+            if (!mod_or_err) {
+                errors[k] = llvm::toString(mod_or_err.takeError());
+                return;
+            }
+            std::unique_ptr<llvm::Module> mod = std::move(*mod_or_err);
+            // Strip the bodies of functions this partition does not own;
+            // they stay visible as declarations.
+            for (llvm::Function &f : *mod) {
+                if (!f.isDeclaration()
+                        && partitions[k].count(f.getName().str()) == 0) {
+                    f.deleteBody();
+                }
+            }
+            // Partition 0 keeps the global variable definitions; the others
+            // keep constants as available_externally (so loads can still be
+            // folded) and demote the rest to declarations. Appending-linkage
+            // arrays (llvm.global_ctors etc.) would be concatenated by the
+            // linker, so only partition 0 keeps those too.
+            if (k != 0) {
+                std::vector<llvm::GlobalVariable*> appending;
+                for (llvm::GlobalVariable &g : mod->globals()) {
+                    if (g.isDeclaration()) {
+                        continue;
+                    }
+                    if (g.hasAppendingLinkage()) {
+                        appending.push_back(&g);
+                    } else if (g.isConstant()) {
+                        g.setLinkage(
+                            llvm::GlobalValue::AvailableExternallyLinkage);
+                    } else {
+                        g.setInitializer(nullptr);
+                    }
+                }
+                for (llvm::GlobalVariable *g : appending) {
+                    g->eraseFromParent();
+                }
+            }
+            // TargetMachines are not thread safe, so each worker gets its
+            // own; the registry lookup itself is read-only after the
+            // initialization in the constructor.
+            std::unique_ptr<llvm::TargetMachine> worker_tm(
+                create_target_machine());
+            run_opt_passes(*mod, worker_tm.get(), pgo_generate, pgo_use);
+            llvm::raw_string_ostream os(optimized[k]);
+            llvm::WriteBitcodeToFile(*mod, os);
+        } catch (const std::exception &e) {
+            errors[k] = e.what();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t k = 0; k < n_partitions; k++) {
+        threads.emplace_back(worker, k);
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+    for (size_t k = 0; k < n_partitions; k++) {
+        if (!errors[k].empty()) {
+            throw LCompilersException("opt_parallel() worker failed: "
+                + errors[k]);
+        }
+    }
+
+    // Link the optimized partitions back into one module in this
+    // evaluator's context; partition 0 holds the strong definitions of the
+    // shared globals, the others contribute only their function bodies.
+    auto reparse = [&](size_t k) {
+        llvm::Expected<std::unique_ptr<llvm::Module>> mod_or_err =
+            llvm::parseBitcodeFile(
+                llvm::MemoryBufferRef(optimized[k], "partition"), *context);
+        if (!mod_or_err) {
+            throw LCompilersException("opt_parallel() failed to reparse an "
+                "optimized partition: " + llvm::toString(mod_or_err.takeError()));
+        }
+        return std::move(*mod_or_err);
+    };
+    std::unique_ptr<llvm::Module> merged = reparse(0);
+    llvm::Linker linker(*merged);
+    for (size_t k = 1; k < n_partitions; k++) {
+        if (linker.linkInModule(reparse(k))) {
+            throw LCompilersException("opt_parallel() failed to link the "
+                "optimized partitions back together");
+        }
+    }
+    // Restore the original visibility of the promoted symbols.
+    for (const std::string &name : promoted) {
+        llvm::GlobalValue *gv = merged->getNamedValue(name);
+        if (gv && !gv->isDeclaration()) {
+            gv->setLinkage(llvm::GlobalValue::InternalLinkage);
+        }
+    }
+    if (llvm::verifyModule(*merged)) {
+        throw LCompilersException("opt_parallel(): merged module failed "
+            "verification.");
+    }
+    m = std::move(merged);
+#else
+    (void) jobs;
+    opt(*m);
+#endif
+}
+
 std::string LLVMEvaluator::module_to_string(llvm::Module &m) {
     std::string buf;
     llvm::raw_string_ostream os(buf);
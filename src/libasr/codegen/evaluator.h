@@ -21,6 +21,7 @@ namespace llvm {
     class GlobalVariable;
     class TargetMachine;
     class DataLayout;
+    class ObjectCache;
     namespace orc {
         class KaleidoscopeJIT;
     }
@@ -67,8 +68,20 @@ private:
     std::unique_ptr<llvm::LLVMContext> context;
     std::string target_triple;
     llvm::TargetMachine *TM;
+    std::unique_ptr<llvm::ObjectCache> object_cache;
+    // Selects the codegen tier: the release tier (--fast) uses aggressive
+    // instruction selection, the debug tier uses CodeGenOpt::None with
+    // FastISel for the fastest possible turnaround.
+    bool fast;
+    // Instrumentation-based PGO state, see set_pgo()
+    bool pgo_generate = false;
+    std::string pgo_use;
+    llvm::TargetMachine *create_target_machine();
+    // Creates TM on first use; JIT-only runs and object-cache hits never
+    // construct a codegen target machine at all.
+    llvm::TargetMachine *get_target_machine();
 public:
-    LLVMEvaluator(const std::string &t = "");
+    LLVMEvaluator(const std::string &t = "", bool fast = false);
     ~LLVMEvaluator();
     std::unique_ptr<llvm::Module> parse_module(const std::string &source, const std::string &filename);
     std::unique_ptr<LLVMModule> parse_module2(const std::string &source, const std::string &filename);
@@ -79,11 +92,32 @@ public:
     std::string get_asm(llvm::Module &m);
     void save_asm_file(llvm::Module &m, const std::string &filename);
     void save_object_file(llvm::Module &m, const std::string &filename);
+    // Writes `m` as LLVM bitcode with a ThinLTO module summary, for -c
+    // --lto builds whose objects are combined by the linker's LTO backend
+    void save_bitcode_file(llvm::Module &m, const std::string &filename);
     void create_empty_object_file(const std::string &filename);
     void opt(llvm::Module &m);
+    // Optimizes `m` with the same pipeline as opt(), but splits the work
+    // across `jobs` worker threads. The module is partitioned by function,
+    // each partition is optimized in its own LLVMContext, and the results
+    // are linked back into a single module that replaces `m` (still owned
+    // by this evaluator's context). Falls back to opt() when the module is
+    // too small to be worth splitting. Cross-partition inlining does not
+    // happen; the speedup comes from running the rest of the O3 pipeline
+    // and the per-function passes concurrently.
+    void opt_parallel(std::unique_ptr<llvm::Module> &m, int jobs);
     static std::string module_to_string(llvm::Module &m);
     static void print_version_message();
     static std::string llvm_version();
+    // Enables the on-disk object cache for JIT compilations: objects are
+    // stored in `dir` keyed by a content hash of the module IR, and
+    // compiling an unchanged module reuses the cached object instead of
+    // running codegen again. No-op on LLVM versions without the hook.
+    void set_object_cache_dir(const std::string &dir);
+    // Configures instrumentation-based PGO for opt()/opt_parallel():
+    // `generate` adds profiling counters to the generated code, a non-empty
+    // `use_file` optimizes with the given merged .profdata profile.
+    void set_pgo(bool generate, const std::string &use_file);
     llvm::LLVMContext &get_context();
     const llvm::DataLayout &get_jit_data_layout();
     static void print_targets();
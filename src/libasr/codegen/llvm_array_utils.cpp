@@ -12,9 +12,7 @@ namespace LCompilers {
         static llvm::Value* get_allocator(llvm::LLVMContext &context,
                 llvm::Module &module, llvm::IRBuilder<> &builder) {
             llvm::Type* i8_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
-            std::string func_name = LLVM::use_memory_debug()
-                ? "_lfortran_get_compiler_mem_dbg_allocator"
-                : "_lfortran_get_default_allocator";
+            std::string func_name = LLVM::get_allocator_function_name();
             llvm::Function *fn = module.getFunction(func_name);
             if (!fn) {
                 llvm::FunctionType *ft = llvm::FunctionType::get(i8_ptr_type, {}, false);
@@ -101,6 +99,26 @@ namespace LCompilers {
             return compile_time_dimensions_t(m_dims, n_dims);
         }
 
+        bool is_small_vector_array(ASR::ttype_t* type) {
+            type = ASRUtils::type_get_past_allocatable_pointer(type);
+            if( !ASRUtils::is_array(type) ||
+                ASRUtils::extract_physical_type(type) !=
+                    ASR::array_physical_typeType::FixedSizeArray ) {
+                return false;
+            }
+            ASR::dimension_t* m_dims = nullptr;
+            size_t n_dims = ASRUtils::extract_dimensions_from_ttype(type, m_dims);
+            int64_t n_elements = ASRUtils::get_fixed_size_of_array(m_dims, n_dims);
+            if( n_elements < 1 || n_elements > 16 ) {
+                return false;
+            }
+            ASR::ttype_t* element_type = ASRUtils::extract_type(type);
+            return ASR::is_a<ASR::Integer_t>(*element_type) ||
+                   ASR::is_a<ASR::UnsignedInteger_t>(*element_type) ||
+                   ASR::is_a<ASR::Real_t>(*element_type) ||
+                   ASR::is_a<ASR::Logical_t>(*element_type);
+        }
+
         std::unique_ptr<Descriptor>
         Descriptor::get_descriptor
         (llvm::LLVMContext& context, llvm::IRBuilder<>* builder,
@@ -329,7 +347,7 @@ namespace LCompilers {
         }
 
         llvm::Value* SimpleCMODescriptor::
-        get_pointer_to_dimension_descriptor_array(llvm::Type* type, llvm::Value* arr, bool /*load*/) {
+        get_pointer_to_dimension_descriptor_array(llvm::Type* type, llvm::Value* arr) {
             // Dims are always inlined at FIELD_DIMS. Return pointer to first element.
             llvm::StructType* arr_ty = llvm::dyn_cast<llvm::StructType>(type);
             LCOMPILERS_ASSERT(arr_ty != nullptr);
@@ -640,6 +658,51 @@ namespace LCompilers {
             }
         }
 
+        llvm::Value* SimpleCMODescriptor::section_dim_length(llvm::Value* lb,
+            llvm::Value* ub, llvm::Value* step) {
+            unsigned index_bit_width = index_type->getIntegerBitWidth();
+            llvm::Value* zero = llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 0));
+            llvm::Value* one = llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 1));
+            if( llvm::ConstantInt* step_const = llvm::dyn_cast<llvm::ConstantInt>(step) ) {
+                int64_t step_value = step_const->getSExtValue();
+                if( step_value == 1 ) {
+                    // ub - lb + 1, clamped at zero for an empty section;
+                    // no division or step sign analysis needed
+                    llvm::Value* raw_dim_length = builder->CreateAdd(
+                        builder->CreateSub(ub, lb), one);
+                    return builder->CreateSelect(builder->CreateICmpSLT(ub, lb),
+                        zero, raw_dim_length);
+                } else if( step_value != 0 ) {
+                    llvm::Value* raw_dim_length = builder->CreateAdd(
+                        builder->CreateSDiv(builder->CreateSub(ub, lb), step), one);
+                    llvm::Value* empty = step_value > 0 ?
+                        builder->CreateICmpSLT(ub, lb) :
+                        builder->CreateICmpSGT(ub, lb);
+                    return builder->CreateSelect(empty, zero, raw_dim_length);
+                }
+            }
+            llvm::Value* raw_dim_length = builder->CreateAdd(
+                builder->CreateSDiv(builder->CreateSub(ub, lb), step), one);
+            llvm::Value* step_pos = builder->CreateICmpSGT(step, zero);
+            llvm::Value* step_neg = builder->CreateICmpSLT(step, zero);
+            llvm::Value* ub_lt_lb = builder->CreateICmpSLT(ub, lb);
+            llvm::Value* ub_gt_lb = builder->CreateICmpSGT(ub, lb);
+            llvm::Value* pos_step_empty = builder->CreateAnd(step_pos, ub_lt_lb);
+            llvm::Value* neg_step_empty = builder->CreateAnd(step_neg, ub_gt_lb);
+            llvm::Value* use_zero = builder->CreateOr(pos_step_empty, neg_step_empty);
+            return builder->CreateSelect(use_zero, zero, raw_dim_length);
+        }
+
+        llvm::Value* SimpleCMODescriptor::section_dim_stride(llvm::Value* stride,
+            llvm::Value* step) {
+            if( llvm::ConstantInt* step_const = llvm::dyn_cast<llvm::ConstantInt>(step) ) {
+                if( step_const->getSExtValue() == 1 ) {
+                    return stride;
+                }
+            }
+            return builder->CreateMul(stride, step);
+        }
+
         void SimpleCMODescriptor::fill_descriptor_for_array_section(
             llvm::Value* value_desc, llvm::Type *value_el_type, ASR::ttype_t* value_type,
             llvm::Type* value_desc_type,
@@ -704,25 +767,12 @@ namespace LCompilers {
                     llvm::Value* ubsi = builder->CreateSExtOrTrunc(load_if_pointer(ubs[i], index_type, builder, llvm_utils), index_type);
                     llvm::Value* lbsi = builder->CreateSExtOrTrunc(load_if_pointer(lbs[i], index_type, builder, llvm_utils), index_type);
                     llvm::Value* dsi = builder->CreateSExtOrTrunc(load_if_pointer(ds[i], index_type, builder, llvm_utils), index_type);
-                    llvm::Value* raw_dim_length = builder->CreateAdd(
-                        builder->CreateSDiv(builder->CreateSub(ubsi, lbsi), dsi),
-                        llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 1))
-                        );
-                    llvm::Value* zero = llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 0));
-                    llvm::Value* step_pos = builder->CreateICmpSGT(dsi, zero);
-                    llvm::Value* step_neg = builder->CreateICmpSLT(dsi, zero);
-                    llvm::Value* ub_lt_lb = builder->CreateICmpSLT(ubsi, lbsi);
-                    llvm::Value* ub_gt_lb = builder->CreateICmpSGT(ubsi, lbsi);
-                    llvm::Value* pos_step_empty = builder->CreateAnd(step_pos, ub_lt_lb);
-                    llvm::Value* neg_step_empty = builder->CreateAnd(step_neg, ub_gt_lb);
-                    llvm::Value* use_zero = builder->CreateOr(pos_step_empty, neg_step_empty);
-                    llvm::Value* dim_length = builder->CreateSelect(use_zero, zero, raw_dim_length);
+                    llvm::Value* dim_length = section_dim_length(lbsi, ubsi, dsi);
                     llvm::Value* value_dim_des = llvm_utils->create_ptr_gep2(dim_des, value_dim_des_array, i);
                     llvm::Value* target_dim_des = llvm_utils->create_ptr_gep2(dim_des, target_dim_des_array, j);
                     llvm::Value* value_stride = get_stride(value_dim_des, true);
                     llvm::Value* target_stride = get_stride(target_dim_des, false);
-                    builder->CreateStore(builder->CreateMul(value_stride, builder->CreateSExtOrTrunc(
-                        load_if_pointer(ds[i], index_type, builder, llvm_utils), index_type)), target_stride);
+                    builder->CreateStore(section_dim_stride(value_stride, dsi), target_stride);
                     // Diverges from LPython, 0 should be stored there.
                     builder->CreateStore(llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 1)),
                                          get_lower_bound(target_dim_des, false));
@@ -798,22 +848,9 @@ namespace LCompilers {
                     llvm::Value* ubsi = builder->CreateSExtOrTrunc(load_if_pointer(ubs[i], index_type, builder, llvm_utils), index_type);
                     llvm::Value* lbsi = builder->CreateSExtOrTrunc(load_if_pointer(lbs[i], index_type, builder, llvm_utils), index_type);
                     llvm::Value* dsi = builder->CreateSExtOrTrunc(load_if_pointer(ds[i], index_type, builder, llvm_utils), index_type);
-                    llvm::Value* raw_dim_length = builder->CreateAdd(
-                        builder->CreateSDiv(builder->CreateSub(ubsi, lbsi), dsi),
-                        llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 1))
-                        );
-                    llvm::Value* zero = llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 0));
-                    llvm::Value* step_pos = builder->CreateICmpSGT(dsi, zero);
-                    llvm::Value* step_neg = builder->CreateICmpSLT(dsi, zero);
-                    llvm::Value* ub_lt_lb = builder->CreateICmpSLT(ubsi, lbsi);
-                    llvm::Value* ub_gt_lb = builder->CreateICmpSGT(ubsi, lbsi);
-                    llvm::Value* pos_step_empty = builder->CreateAnd(step_pos, ub_lt_lb);
-                    llvm::Value* neg_step_empty = builder->CreateAnd(step_neg, ub_gt_lb);
-                    llvm::Value* use_zero = builder->CreateOr(pos_step_empty, neg_step_empty);
-                    llvm::Value* dim_length = builder->CreateSelect(use_zero, zero, raw_dim_length);
+                    llvm::Value* dim_length = section_dim_length(lbsi, ubsi, dsi);
                     llvm::Value* target_dim_des = llvm_utils->create_ptr_gep2(dim_des, target_dim_des_array, j);
-                    builder->CreateStore(builder->CreateMul(stride, builder->CreateSExtOrTrunc(
-                        load_if_pointer(ds[i], index_type, builder, llvm_utils), index_type)), get_stride(target_dim_des, false));
+                    builder->CreateStore(section_dim_stride(stride, dsi), get_stride(target_dim_des, false));
                     builder->CreateStore(llvm::ConstantInt::get(context, llvm::APInt(index_bit_width, 1)),
                                          get_lower_bound(target_dim_des, false));
                     builder->CreateStore(dim_length,
@@ -821,6 +858,11 @@ namespace LCompilers {
                     j++;
                     }
                 }
+                if( j == target_rank ) {
+                    // the accumulated stride only feeds later sliced
+                    // dimensions and none are left to fill
+                    break;
+                }
                 // Convert dimension info to index_type to match descriptor stride format
                 stride = builder->CreateMul(stride,
                     builder->CreateSExtOrTrunc(load_if_pointer(llvm_diminfo[r], index_type, builder, llvm_utils), index_type));
@@ -1651,7 +1693,7 @@ namespace LCompilers {
             unsigned index_bit_width = index_type->getIntegerBitWidth();
             // Get dimension bounds from the descriptor first
             llvm::Value* dim_des_array = get_pointer_to_dimension_descriptor_array(
-                source_llvm_type, source_desc, true);
+                source_llvm_type, source_desc);
             // Collect bounds and compute actual number of elements to copy
             std::vector<llvm::Value*> extents(rank);
             // Calculate number of elements as product of (ub - lb + 1) for each dimension
@@ -1721,7 +1763,7 @@ namespace LCompilers {
             unsigned index_bit_width = index_type->getIntegerBitWidth();
 
             llvm::Value* dim_des_array = get_pointer_to_dimension_descriptor_array(
-                dest_llvm_type, dest_desc, true);
+                dest_llvm_type, dest_desc);
 
             std::vector<llvm::Value*> extents(rank);
             llvm::Value* num_elements = llvm::ConstantInt::get(
@@ -43,6 +43,15 @@ namespace LCompilers {
         */
         bool is_explicit_shape(ASR::Variable_t* v);
 
+        /*
+        * True for fixed-shape arrays of at most 16 scalar elements
+        * (3-vectors, 3x3 tensors and the like). Such arrays are lowered
+        * register-friendly: their storage is vector-aligned and whole-array
+        * copies move the [N x T] value as a first-class SSA aggregate, so
+        * LLVM can promote them out of memory entirely.
+        */
+        bool is_small_vector_array(ASR::ttype_t* type);
+
         /*
         * Available descriptors are listed
         * under this enum.
@@ -182,8 +191,9 @@ namespace LCompilers {
                     llvm::Value** llvm_diminfo, int value_rank, int target_rank, LocationManager& lm) = 0;
 
                 /*
-                * Allocates a descriptor on the heap, zero-initializes it,
-                * sets up the dimension descriptor array pointer and rank.
+                * Allocates a descriptor on the heap as a single flat block
+                * (dimension slots are inline, so no second allocation is
+                * needed), sets the rank and nulls the data pointer.
                 * Returns a pointer to the descriptor.
                 */
                 virtual
@@ -275,12 +285,12 @@ namespace LCompilers {
                 void set_rank(llvm::Type* type, llvm::Value* arr, llvm::Value* rank) = 0;
 
                 /*
-                * Returns pointer to dimension descriptor array
+                * Returns pointer to the inline dimension descriptor array
                 * in the input array descriptor according to the rules
                 * implemented by current class.
                 */
                 virtual
-                llvm::Value* get_pointer_to_dimension_descriptor_array(llvm::Type *type, llvm::Value* arr, bool load=true) = 0;
+                llvm::Value* get_pointer_to_dimension_descriptor_array(llvm::Type *type, llvm::Value* arr) = 0;
 
 
                 /*
@@ -437,6 +447,15 @@ namespace LCompilers {
                     llvm::Value** llvm_diminfo, std::vector<llvm::Value*>& m_args,
                     int n_args, bool check_for_bounds, LocationManager& lm, bool is_unbounded_pointer_to_data = false, std::string array_name = "", std::string infile = "", Location loc = {0, 0});
 
+                // Extent of one sliced section dimension; emits the full
+                // division and sign analysis only when the step is not a
+                // compile-time constant
+                llvm::Value* section_dim_length(llvm::Value* lb, llvm::Value* ub,
+                    llvm::Value* step);
+
+                // stride * step, folded away for the common unit step
+                llvm::Value* section_dim_stride(llvm::Value* stride, llvm::Value* step);
+
             public:
 
                 SimpleCMODescriptor(llvm::LLVMContext& _context,
@@ -568,7 +587,7 @@ namespace LCompilers {
                     bool load=true);
 
                 virtual
-                llvm::Value* get_pointer_to_dimension_descriptor_array(llvm::Type* type, llvm::Value* arr, bool load=true);
+                llvm::Value* get_pointer_to_dimension_descriptor_array(llvm::Type* type, llvm::Value* arr);
 
                 virtual
                 llvm::Value* get_pointer_to_dimension_descriptor(llvm::Value* dim_des_arr,
@@ -3,6 +3,7 @@
 #include <libasr/codegen/llvm_array_utils.h>
 #include <libasr/asr_utils.h>
 #include <libasr/codegen/llvm_compat.h>
+#include <llvm/IR/MDBuilder.h>
 #include <llvm/Support/raw_ostream.h>
 
 namespace LCompilers {
@@ -10,6 +11,8 @@ namespace LCompilers {
     namespace LLVM {
 
         static bool memory_debug_enabled = false;
+        static bool arena_allocator_enabled = false;
+        static bool memory_profile_enabled = false;
 
         llvm::Value* CreateStore(llvm::IRBuilder<> &builder, llvm::Value *x, llvm::Value *y) {
             LCOMPILERS_ASSERT(y->getType()->isPointerTy());
@@ -17,9 +20,33 @@ namespace LCompilers {
         }
 
         const char* get_allocator_function_name() {
-            return use_memory_debug()
-                ? "_lfortran_get_compiler_mem_dbg_allocator"
-                : "_lfortran_get_default_allocator";
+            // leak checking takes precedence: arena memory is not
+            // individually tracked, so the report would be useless
+            if (use_memory_debug()) {
+                return "_lfortran_get_compiler_mem_dbg_allocator";
+            }
+            // profiling also outranks the arena: bulk-freed region memory
+            // would make the residency accounting meaningless
+            if (use_memory_profile()) {
+                return "_lfortran_get_memory_profile_allocator";
+            }
+            if (use_arena_allocator()) {
+                return "_lfortran_get_arena_allocator";
+            }
+            return "_lfortran_get_default_allocator";
+        }
+
+        const char* get_string_temp_allocator_function_name() {
+            // leak checking and profiling take precedence, as with the
+            // global allocator: spill-buffer memory is not individually
+            // tracked
+            if (use_memory_debug()) {
+                return "_lfortran_get_compiler_mem_dbg_allocator";
+            }
+            if (use_memory_profile()) {
+                return "_lfortran_get_memory_profile_allocator";
+            }
+            return "_lfortran_get_string_spill_allocator";
         }
 
         static llvm::Value* get_allocator(llvm::LLVMContext &context,
@@ -42,6 +69,26 @@ namespace LCompilers {
             return memory_debug_enabled;
         }
 
+        void set_arena_allocator(bool state) {
+            arena_allocator_enabled = state;
+        }
+
+        bool use_arena_allocator() {
+            return arena_allocator_enabled;
+        }
+
+        void set_memory_profile(bool state) {
+            memory_profile_enabled = state;
+        }
+
+        bool use_memory_profile() {
+            return memory_profile_enabled;
+        }
+
+        bool use_string_spill_allocator() {
+            return !use_memory_debug() && !use_memory_profile();
+        }
+
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* arg_size) {
             std::string func_name = "_lfortran_malloc_alloc";
@@ -195,7 +242,7 @@ namespace LCompilers {
         CompilerOptions &compiler_options_,
         std::unordered_map<std::uint32_t, std::unordered_map<std::string, llvm::Type*>>& arr_arg_type_cache_,
         std::map<std::string, std::pair<llvm::Type*, llvm::Type*>>& fname2arg_type_,
-        std::map<uint64_t, llvm::Value*> &llvm_symtab_):
+        std::unordered_map<uint64_t, llvm::Value*> &llvm_symtab_):
         context(context), builder(std::move(_builder)), str_cmp_itr(nullptr), der_type_name(der_type_name_),
         name2dertype(name2dertype_), name2dercontext(name2dercontext_),
         struct_type_stack(struct_type_stack_), dertype2parent(dertype2parent_), name2memidx(name2memidx_),
@@ -333,6 +380,35 @@ namespace LCompilers {
         return allocator_instance;
     }
 
+    llvm::Value* LLVMUtils::get_string_temp_allocator(llvm::Module* mod) {
+        // Same per-function caching as get_allocator, but for the allocator
+        // used for statement-lifetime string temporaries.
+        llvm::Function* current_fn = builder->GetInsertBlock()->getParent();
+        if (string_temp_allocator_instance) {
+            if (auto* inst = llvm::dyn_cast<llvm::Instruction>(string_temp_allocator_instance)) {
+                if (inst->getFunction() == current_fn) {
+                    return string_temp_allocator_instance;
+                }
+            }
+        }
+
+        llvm::Type* allocator_ptr_type = llvm::Type::getInt8Ty(context)->getPointerTo();
+
+        std::string func_name = LLVM::get_string_temp_allocator_function_name();
+        llvm::Function *fn = mod->getFunction(func_name);
+        if (!fn) {
+            llvm::FunctionType *function_type = llvm::FunctionType::get(
+                allocator_ptr_type, {}, false);
+            fn = llvm::Function::Create(function_type,
+                llvm::Function::ExternalLinkage, func_name, mod);
+        }
+        // Insert at the entry block so the value dominates all basic blocks
+        llvm::BasicBlock& entry_bb = current_fn->getEntryBlock();
+        llvm::IRBuilder<> entry_builder(&entry_bb, entry_bb.getFirstInsertionPt());
+        string_temp_allocator_instance = entry_builder.CreateCall(fn, {});
+        return string_temp_allocator_instance;
+    }
+
     llvm::Value* LLVMUtils::string_format_fortran(const std::vector<llvm::Value*> &args, llvm::Value* decimal_mode, llvm::Value* sign_mode, llvm::Value* round_mode)
     {
         llvm::Function *fn_printf = module->getFunction("_lcompilers_string_format_fortran");
@@ -1921,6 +1997,90 @@ namespace LCompilers {
 #endif
     }
 
+    llvm::MDNode* LLVMUtils::get_tbaa_type_node(ASR::ttype_t* type) {
+        type = ASRUtils::type_get_past_allocatable(
+            ASRUtils::type_get_past_pointer(type));
+        std::string name;
+        switch (type->type) {
+            case ASR::ttypeType::Integer: {
+                name = "integer(" + std::to_string(
+                    ASRUtils::extract_kind_from_ttype_t(type)) + ")";
+                break;
+            }
+            case ASR::ttypeType::UnsignedInteger: {
+                name = "unsigned(" + std::to_string(
+                    ASRUtils::extract_kind_from_ttype_t(type)) + ")";
+                break;
+            }
+            case ASR::ttypeType::Real: {
+                name = "real(" + std::to_string(
+                    ASRUtils::extract_kind_from_ttype_t(type)) + ")";
+                break;
+            }
+            case ASR::ttypeType::Logical: {
+                name = "logical(" + std::to_string(
+                    ASRUtils::extract_kind_from_ttype_t(type)) + ")";
+                break;
+            }
+            case ASR::ttypeType::CPtr: {
+                name = "any pointer";
+                break;
+            }
+            default: {
+                // Arrays, strings and aggregates stay untagged: their loads
+                // move descriptors and data pointers whose types do not
+                // follow the declared element type
+                return nullptr;
+            }
+        }
+        auto it = tbaa_type_nodes.find(name);
+        if (it != tbaa_type_nodes.end()) {
+            return it->second;
+        }
+        llvm::MDBuilder md(context);
+        if (tbaa_root == nullptr) {
+            tbaa_root = md.createTBAARoot("Fortran TBAA");
+        }
+        llvm::MDNode* node = md.createTBAANode(name, tbaa_root);
+        tbaa_type_nodes[name] = node;
+        return node;
+    }
+
+    void LLVMUtils::tbaa_annotate(llvm::Value* inst, ASR::ttype_t* type) {
+        if (!compiler_options.po.fast || type == nullptr ||
+                ASRUtils::is_array(type)) {
+            return;
+        }
+        llvm::Instruction* i = llvm::dyn_cast_or_null<llvm::Instruction>(inst);
+        if (i == nullptr) {
+            return;
+        }
+        // Only tag accesses that really move the declared scalar type;
+        // descriptor and pointer-slot accesses come through these sites too
+        // and must not be claimed as scalar data
+        bool is_cptr = ASR::is_a<ASR::CPtr_t>(*ASRUtils::type_get_past_allocatable(
+            ASRUtils::type_get_past_pointer(type)));
+        if (llvm::LoadInst* li = llvm::dyn_cast<llvm::LoadInst>(i)) {
+            if (li->getType()->isPointerTy() != is_cptr || li->isVolatile()) {
+                return;
+            }
+        } else if (llvm::StoreInst* si = llvm::dyn_cast<llvm::StoreInst>(i)) {
+            if (si->getValueOperand()->getType()->isPointerTy() != is_cptr ||
+                    si->isVolatile()) {
+                return;
+            }
+        } else {
+            return;
+        }
+        llvm::MDNode* node = get_tbaa_type_node(type);
+        if (node == nullptr) {
+            return;
+        }
+        llvm::MDBuilder md(context);
+        i->setMetadata(llvm::LLVMContext::MD_tbaa,
+            md.createTBAAStructTagNode(node, node, 0));
+    }
+
     llvm::Value* LLVMUtils::CreateBitCastForStore(llvm::Value* value, [[maybe_unused]] llvm::Value* target_ptr) {
 #if LLVM_VERSION_MAJOR < 15
         if (value->getType()->isPointerTy() && target_ptr->getType()->isPointerTy()) {
@@ -2660,6 +2820,37 @@ namespace LCompilers {
             }
         }
 
+        // Known-short fixed-length assignment: copy and pad inline so LLVM
+        // can lower it to a few moves instead of a runtime call.
+        if (!is_dest_allocatable
+                && dest_str_type->m_len_kind != ASR::string_length_kindType::DeferredLength
+                && dest_str_type->m_physical_type != ASR::CChar
+                && src_str_type->m_physical_type != ASR::CChar
+                && dest_str_type->m_len && src_str_type->m_len
+                && ASRUtils::is_value_constant(dest_str_type->m_len)
+                && ASRUtils::is_value_constant(src_str_type->m_len)) {
+            int64_t dest_len = -1, src_len = -1;
+            ASRUtils::extract_value(dest_str_type->m_len, dest_len);
+            ASRUtils::extract_value(src_str_type->m_len, src_len);
+            if (dest_len >= 0 && src_len >= 0 && dest_len <= 32 && src_len <= 32) {
+                llvm::Value* dest_ptr = builder->CreateLoad(character_type, lhs_data);
+                int64_t copy_len = std::min(dest_len, src_len);
+                if (copy_len > 0) {
+                    builder->CreateMemCpy(dest_ptr, llvm::MaybeAlign(),
+                        rhs_data, llvm::MaybeAlign(), copy_len);
+                }
+                if (dest_len > copy_len) {
+                    llvm::Value* pad_ptr = builder->CreateGEP(
+                        llvm::Type::getInt8Ty(context), dest_ptr,
+                        llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), copy_len));
+                    builder->CreateMemSet(pad_ptr,
+                        llvm::ConstantInt::get(context, llvm::APInt(8, ' ')),
+                        dest_len - copy_len, llvm::MaybeAlign());
+                }
+                return dest_ptr;
+            }
+        }
+
         return lfortran_str_copy_with_data(lhs_data, lhs_len, rhs_data, rhs_len,
                                            dest_str_type->m_len_kind == ASR::string_length_kindType::DeferredLength,
                                            is_dest_allocatable);
@@ -3685,8 +3876,8 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
                             create_gep2(llvm_str_desc_type, dest_str_desc, 1));
                         // Copy dimension descriptors
                         llvm::DataLayout data_layout(module->getDataLayout());
-                        llvm::Value* src_dim_ptr = arr_api->get_pointer_to_dimension_descriptor_array(llvm_array_type, src, true);
-                        llvm::Value* dest_dim_ptr = arr_api->get_pointer_to_dimension_descriptor_array(llvm_array_type, dest, true);
+                        llvm::Value* src_dim_ptr = arr_api->get_pointer_to_dimension_descriptor_array(llvm_array_type, src);
+                        llvm::Value* dest_dim_ptr = arr_api->get_pointer_to_dimension_descriptor_array(llvm_array_type, dest);
                         llvm::Value* n_dims = arr_api->get_rank(llvm_array_type, src, false);
                         llvm::Type* dim_des = arr_api->get_dimension_descriptor_type(false);
                         llvm::Value* total_dim_bytes = builder->CreateMul(
@@ -3854,7 +4045,7 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
     LLVMStruct::LLVMStruct(llvm::LLVMContext& context_,
         LLVMUtils* llvm_utils_,
         llvm::IRBuilder<>* builder_, 
-        std::map<uint64_t, llvm::Function*>& llvm_symtab_fn_,
+        std::unordered_map<uint64_t, llvm::Function*>& llvm_symtab_fn_,
         std::function<void(ASR::Struct_t*, llvm::Value*, ASR::ttype_t*, bool)> allocate_arr_mem_struct,
         LLVMFinalize &finalizer_instnace_):
         context(context_),
@@ -5907,13 +6098,23 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         // as much as possible in LLVM directly.
         switch( key_asr_type->type ) {
             case ASR::ttypeType::Integer: {
-                // Simple modulo with the capacity of the dict.
-                // We can update it later to do a better hash function
-                // which produces lesser collisions.
-
+                // Scramble the key with the splitmix64 finalizer before
+                // reducing modulo capacity. Plain `key % capacity` clusters
+                // consecutive or strided keys into long probe chains in the
+                // linear-probing tables; the multiply-xorshift mix spreads
+                // them across the table for a few cheap ALU ops.
+                llvm::Type* i64 = llvm::Type::getInt64Ty(context);
+                llvm::Value* z = builder->CreateZExtOrTrunc(key, i64);
+                z = builder->CreateXor(z, builder->CreateLShr(z, 30));
+                z = builder->CreateMul(z, llvm::ConstantInt::get(i64,
+                        0xbf58476d1ce4e5b9ULL));
+                z = builder->CreateXor(z, builder->CreateLShr(z, 27));
+                z = builder->CreateMul(z, llvm::ConstantInt::get(i64,
+                        0x94d049bb133111ebULL));
+                z = builder->CreateXor(z, builder->CreateLShr(z, 31));
                 llvm::Value* int_hash = builder->CreateZExtOrTrunc(
-                    builder->CreateURem(key,
-                    builder->CreateZExtOrTrunc(capacity, key->getType())),
+                    builder->CreateURem(z,
+                        builder->CreateZExt(capacity, i64)),
                     capacity->getType()
                 );
                 return int_hash;
@@ -10069,10 +10270,10 @@ llvm::Value* LLVMUtils::handle_global_nonallocatable_stringArray(Allocator& al,
         llvm::DataLayout data_layout(module->getDataLayout());
         llvm::Type* i32_ty = llvm_utils->getIntType(4);
         llvm::Value* src_dim_des_val = llvm_utils->arr_api->get_pointer_to_dimension_descriptor_array(
-            llvm_array_type, src, true);
+            llvm_array_type, src);
         llvm::Value* n_dims = llvm_utils->arr_api->get_rank(llvm_array_type, src, false);
         llvm::Value* dest_dim_des_val = llvm_utils->arr_api->get_pointer_to_dimension_descriptor_array(
-            llvm_array_type, dest, true);
+            llvm_array_type, dest);
         llvm::Type* dim_des = llvm_utils->arr_api->get_dimension_descriptor_type(false);
         uint64_t dim_des_size = data_layout.getTypeAllocSize(dim_des);
         unsigned index_bit_width = llvm_utils->arr_api->get_index_type()->getIntegerBitWidth();
@@ -7,6 +7,7 @@
 #include <llvm/IR/Value.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/MDBuilder.h>
 #include <libasr/asr.h>
 
 #include <llvm/Support/Casting.h>
@@ -224,6 +225,16 @@ class ASRToLLVMVisitor;
         llvm::Value* CreateStore(llvm::IRBuilder<> &builder, llvm::Value *x, llvm::Value *y);
         void set_memory_debug(bool state);
         bool use_memory_debug();
+        // true when string temporaries go through the spill-buffer allocator
+        bool use_string_spill_allocator();
+        void set_arena_allocator(bool state);
+        bool use_arena_allocator();
+        void set_memory_profile(bool state);
+        bool use_memory_profile();
+        // name of the runtime getter for the currently selected allocator
+        const char* get_allocator_function_name();
+        // name of the runtime getter for the string-temporary allocator
+        const char* get_string_temp_allocator_function_name();
         llvm::Value* lfortran_malloc(llvm::LLVMContext &context, llvm::Module &module,
                 llvm::IRBuilder<> &builder, llvm::Value* arg_size);
         llvm::Value* lfortran_malloc_alloc(llvm::LLVMContext &context, llvm::Module &module,
@@ -286,7 +297,7 @@ class ASRToLLVMVisitor;
             LLVMSetInterface* set_api_sc;
 
             CompilerOptions &compiler_options;
-            std::map<uint64_t, llvm::Value*> &llvm_symtab; // llvm_symtab_value
+            std::unordered_map<uint64_t, llvm::Value*> &llvm_symtab; // llvm_symtab_value
 
 
             llvm::StructType *complex_type_4, *complex_type_8;
@@ -300,6 +311,16 @@ class ASRToLLVMVisitor;
             // Allocator support: the allocator is an opaque struct pointer
             // passed to runtime functions for compiler-controlled allocation.
             llvm::Value* allocator_instance = nullptr; // cached global allocator ptr
+            // cached spill-buffer allocator ptr for string temporaries
+            llvm::Value* string_temp_allocator_instance = nullptr;
+
+            // Type-based alias analysis metadata (emitted under --fast):
+            // scalar accesses are tagged with one TBAA node per Fortran
+            // type+kind so LLVM can disambiguate e.g. integer index loads
+            // from real array data. Assumes no cross-type EQUIVALENCE
+            // overlays, which --fast already takes as given.
+            llvm::MDNode* tbaa_root = nullptr;
+            std::map<std::string, llvm::MDNode*> tbaa_type_nodes;
 
 #if LLVM_VERSION_MAJOR >= 17
             llvm::PointerType* i8_ptr = llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context));
@@ -317,7 +338,7 @@ class ASRToLLVMVisitor;
                 CompilerOptions &compiler_options_,
                 std::unordered_map<std::uint32_t, std::unordered_map<std::string, llvm::Type*>>& arr_arg_type_cache_,
                 std::map<std::string, std::pair<llvm::Type*, llvm::Type*>>& fname2arg_type_,
-                std::map<uint64_t, llvm::Value*> &llvm_symtab_);
+                std::unordered_map<uint64_t, llvm::Value*> &llvm_symtab_);
                 
             llvm::Value* lfortran_free(llvm::Value* ptr);
             // lfortran_free_nocheck is a variant of lfortran_free that does not check for null pointers before freeing.
@@ -326,6 +347,9 @@ class ASRToLLVMVisitor;
 
             // Get or create the cached global allocator pointer
             llvm::Value* get_allocator(llvm::Module* mod);
+            // Get or create the cached allocator pointer for
+            // statement-lifetime string temporaries (spill buffer)
+            llvm::Value* get_string_temp_allocator(llvm::Module* mod);
 
             llvm::Value* string_format_fortran(const std::vector<llvm::Value*> &args, llvm::Value* decimal_mode=nullptr, llvm::Value* sign_mode=nullptr, llvm::Value* round_mode=nullptr);
             llvm::Value* create_gep2(llvm::Type *t, llvm::Value* ds, llvm::Value* idx);
@@ -335,6 +359,13 @@ class ASRToLLVMVisitor;
             llvm::Value* create_ptr_gep2(llvm::Type* type, llvm::Value* ptr, llvm::Value* idx);
 
             llvm::Value* CreateLoad2(llvm::Type *t, llvm::Value *x, bool is_volatile = false);
+
+            // TBAA node for a scalar type; nullptr for types that must stay
+            // untagged (arrays, strings, aggregates)
+            llvm::MDNode* get_tbaa_type_node(ASR::ttype_t* type);
+            // Attach a !tbaa access tag to a load or store of `type`; no-op
+            // unless --fast is enabled and the access is a plain scalar one
+            void tbaa_annotate(llvm::Value* inst, ASR::ttype_t* type);
             llvm::Value* CreateBitCastForStore(llvm::Value* value, llvm::Value* target_ptr);
             llvm::Value* get_array_descriptor_ptr(llvm::Value* value, llvm::Type* arr_type,
                                                   bool is_character_array);
@@ -394,7 +425,12 @@ class ASRToLLVMVisitor;
                 llvm::BasicBlock *thenBB = llvm::BasicBlock::Create(context, "then", fn);
                 llvm::BasicBlock *mergeBB = llvm::BasicBlock::Create(context, "ifcont");
 
-                builder->CreateCondBr(cond, thenBB, mergeBB);
+                // Mark the error branch as very unlikely so the optimizer
+                // sinks the cold reporting code out of hot loops and keeps
+                // strength-reducing the surrounding address arithmetic.
+                llvm::MDBuilder md_builder(context);
+                builder->CreateCondBr(cond, thenBB, mergeBB,
+                    md_builder.createBranchWeights(1, 1 << 20));
                 builder->SetInsertPoint(thenBB); {
                         llvm::Type *span_type = llvm::StructType::get(context, llvm::ArrayRef<llvm::Type *>({
                             llvm::Type::getInt8Ty(context)->getPointerTo(),
@@ -477,6 +513,7 @@ class ASRToLLVMVisitor;
                                 true);
                             print_error_fn = llvm::Function::Create(error_fn_type,
                                 llvm::Function::ExternalLinkage, "_lcompilers_runtime_error", module);
+                            print_error_fn->addFnAttr(llvm::Attribute::Cold);
                         }
 
                         std::vector<llvm::Value*> vec = {get_allocator(module), LLVMUtils::CreateGEP2(label_arr_type, labels_v, 0), llvm::ConstantInt::get(context, llvm::APInt(32, labels.size())), formatted_msg, args...};
@@ -490,6 +527,8 @@ class ASRToLLVMVisitor;
                                 false);
                             exit_fn = llvm::Function::Create(exit_fn_type,
                                 llvm::Function::ExternalLinkage, "exit", module);
+                            exit_fn->addFnAttr(llvm::Attribute::NoReturn);
+                            exit_fn->addFnAttr(llvm::Attribute::Cold);
                         }
 
                         builder->CreateCall(exit_fn, {llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), 1)});
@@ -990,13 +1029,13 @@ class ASRToLLVMVisitor;
         std::unique_ptr<llvm::IRBuilder<>>                          &builder_;
         Allocator                                                   &al_;
         ASRToLLVMVisitor                                            &asr_to_llvm_visitor_;
-        std::map<uint64_t, llvm::Function*>                         &llvm_symtab_fn_;
+        std::unordered_map<uint64_t, llvm::Function*>               &llvm_symtab_fn_;
         std::unordered_map<std::string, llvm::Function*>            type_finalizer_cache_;
 
     public:
         LLVMFinalize(ASRToLLVMVisitor &asr_to_llvm_visitor,
             std::unique_ptr<LLVMUtils> &llvm_utils, std::unique_ptr<llvm::IRBuilder<>> &builder, Allocator& al,
-            std::map<uint64_t, llvm::Function*> &llvm_symtab_fn)  
+            std::unordered_map<uint64_t, llvm::Function*> &llvm_symtab_fn)  
         :   llvm_utils_(llvm_utils), builder_(builder), al_(al), asr_to_llvm_visitor_(asr_to_llvm_visitor),
             llvm_symtab_fn_(llvm_symtab_fn){}
 
@@ -2773,7 +2812,7 @@ class ASRToLLVMVisitor;
             LLVMUtils* llvm_utils;
             llvm::IRBuilder<>* builder;
             std::map<ASR::symbol_t*, llvm::Type*> newclass2vtabtype;
-            std::map<uint64_t, llvm::Function*>& llvm_symtab_fn;
+            std::unordered_map<uint64_t, llvm::Function*>& llvm_symtab_fn;
             std::function<void(ASR::Struct_t*, llvm::Value*, ASR::ttype_t*, bool)> allocate_struct_array_members;
             LLVMFinalize &finalizer_instnace;
 
@@ -2786,7 +2825,7 @@ class ASRToLLVMVisitor;
             std::map<ASR::symbol_t*, std::map<std::string, int64_t>> struct_vtab_function_offset;
 
             LLVMStruct(llvm::LLVMContext& context_, LLVMUtils* llvm_utils,
-                     llvm::IRBuilder<>* builder, std::map<uint64_t, llvm::Function*>& llvm_symtab_fn_,
+                     llvm::IRBuilder<>* builder, std::unordered_map<uint64_t, llvm::Function*>& llvm_symtab_fn_,
                       std::function<void(ASR::Struct_t*, llvm::Value*, ASR::ttype_t*, bool)> allocate_arr_mem_struct,
                       LLVMFinalize &finalizer_instance_);
     
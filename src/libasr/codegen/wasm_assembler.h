@@ -175,6 +175,29 @@ class WASMAssembler: public WASM_INSTS_VISITOR::WASMInstsAssembler<WASMAssembler
         return code;
     }
 
+    // Streams the finished module straight to `filename`, writing the
+    // header and each section buffer in turn. Unlike save_bin(get_wasm()),
+    // this never concatenates the sections into a second in-memory copy of
+    // the whole binary, so peak memory stays at the size of the section
+    // buffers themselves.
+    void save_wasm(const std::string &filename) {
+        std::ofstream out(filename);
+        Vec<uint8_t> header;
+        header.reserve(m_al, 8U);
+        emit_header(header);
+        out.write((const char *)header.p, header.size());
+        write_section(out, m_type_section, 1U, no_of_types);
+        write_section(out, m_import_section, 2U, no_of_imports);
+        write_section(out, m_func_section, 3U, no_of_functions);
+        write_section(out, m_memory_section, 5U, no_of_memories);
+        write_section(out, m_global_section, 6U, no_of_globals);
+        write_section(out, m_export_section, 7U, no_of_exports);
+        write_section(out, m_code_section, 10U, no_of_functions);
+        write_section(out, m_data_section, 11U, no_of_data_segs);
+        out.close();
+        wasm::save_js_glue_wasi(filename);
+    }
+
     void emit_if_else(std::function<void()> test_cond, std::function<void()> if_block, std::function<void()> else_block) {
         test_cond();
         wasm::emit_b8(m_code_section, m_al, 0x04);  // emit if start
@@ -297,6 +320,21 @@ class WASMAssembler: public WASM_INSTS_VISITOR::WASMInstsAssembler<WASMAssembler
         }
     }
 
+    void write_section(std::ofstream &out, Vec<uint8_t> &section_content,
+                       uint32_t section_id,
+                       uint32_t no_of_elements) {
+        // same encoding as encode_section, but only the small section
+        // prefix is materialized; the contents are written out directly
+        Vec<uint8_t> prefix;
+        prefix.reserve(m_al, 16U);
+        wasm::emit_u32(prefix, m_al, section_id);
+        wasm::emit_u32(prefix, m_al, 4U /* size of no_of_elements */ + section_content.size());
+        uint32_t len_idx = wasm::emit_len_placeholder(prefix, m_al);
+        wasm::emit_u32_b32_idx(prefix, m_al, len_idx, no_of_elements);
+        out.write((const char *)prefix.p, prefix.size());
+        out.write((const char *)section_content.p, section_content.size());
+    }
+
     void emit_func_body(uint32_t func_idx, std::string func_name, std::vector<wasm::var_type> &locals, std::function<void()> func_body) {
         /*** Reference Function Prototype ***/
         wasm::emit_u32(m_func_section, m_al, func_idx);
@@ -365,6 +403,25 @@ class WASMAssembler: public WASM_INSTS_VISITOR::WASMInstsAssembler<WASMAssembler
         return no_of_globals++;
     }
 
+    // bulk-memory proposal instructions (0xFC-prefixed). The trailing
+    // zero immediates are memory indices; the modules we emit only ever
+    // declare or import a single linear memory.
+
+    // stack: [dest, src, size] -> []
+    void emit_memory_copy() {
+        wasm::emit_b8(m_code_section, m_al, 0xFC);
+        wasm::emit_u32(m_code_section, m_al, 0x0A);
+        wasm::emit_b8(m_code_section, m_al, 0x00);  // destination memory index
+        wasm::emit_b8(m_code_section, m_al, 0x00);  // source memory index
+    }
+
+    // stack: [dest, byte_value, size] -> []
+    void emit_memory_fill() {
+        wasm::emit_b8(m_code_section, m_al, 0xFC);
+        wasm::emit_u32(m_code_section, m_al, 0x0B);
+        wasm::emit_b8(m_code_section, m_al, 0x00);  // memory index
+    }
+
     uint32_t emit_local_vars(std::vector<wasm::var_type> locals) {
         uint32_t no_of_locals = 0;
         for (auto v:locals) {
@@ -87,6 +87,51 @@ def bname(base, cmd, filename):
         return f"{base}-{h}"
 
 
+def _sha256_file(path):
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for block in iter(lambda: f.read(1 << 20), b""):
+            h.update(block)
+    return h.hexdigest()
+
+
+def _reference_digest():
+    # Hashing the content of every reference file on each run would cost
+    # more than the cache saves; name/size/mtime is enough to notice that
+    # references were updated underneath an unchanged test
+    h = hashlib.sha256()
+    ref_dir = os.path.join(ROOT_DIR, "tests", "reference")
+    if os.path.isdir(ref_dir):
+        for name in sorted(os.listdir(ref_dir)):
+            st = os.stat(os.path.join(ref_dir, name))
+            h.update(f"{name}:{st.st_size}:{st.st_mtime_ns};".encode())
+    return h.hexdigest()
+
+
+def test_cache_key(test, compiler_hash, reference_digest, run_config):
+    """
+    Content-addressed key for one tests.toml entry: the test sources, the
+    toml entry itself, the compiler binary, the reference results and the
+    run configuration (backend selection etc.). A test whose key matches a
+    previously passing run would produce the same results and can be
+    skipped. Returns None if a source file is missing (never cached).
+    """
+    h = hashlib.sha256()
+    h.update(json.dumps(test, sort_keys=True, default=str).encode())
+    h.update(compiler_hash.encode())
+    h.update(reference_digest.encode())
+    h.update(json.dumps(run_config, sort_keys=True).encode())
+    filenames = [test["filename"]]
+    if "extrafiles" in test:
+        filenames += [f.strip() for f in test["extrafiles"].split(",")]
+    for filename in filenames:
+        path = os.path.join(ROOT_DIR, "tests", filename)
+        if not os.path.exists(path):
+            return None
+        h.update(_sha256_file(path).encode())
+    return h.hexdigest()
+
+
 def _compare_eq_dict(
     left: Mapping[Any, Any], right: Mapping[Any, Any], verbose: int = 0
 ) -> List[str]:
@@ -542,6 +587,8 @@ def tester_main(compiler, single_test, is_lcompilers_executable_installed=False)
                         help="Run all tests sequentially")
     parser.add_argument("--no-color", action="store_true",
                     help="Turn off colored tests output")
+    parser.add_argument("--no-cache", action="store_true",
+                    help="Do not skip unchanged tests that passed on a previous run")
     args = parser.parse_args()
     update_reference = args.update
     verify_hash = args.verify_hash
@@ -595,6 +642,50 @@ def tester_main(compiler, single_test, is_lcompilers_executable_installed=False)
         filtered_tests = [test for test in filtered_tests if any(
             b not in excluded_backends and b != "filename" for b in test)]
 
+    # Content-addressed result cache: a test whose sources, toml entry,
+    # references, run configuration and compiler binary are all unchanged
+    # since the last passing run is skipped. Updating or verifying
+    # references always runs everything, as does --no-cache.
+    cache_path = os.path.join(ROOT_DIR, "tests", ".result_cache.json")
+    use_cache = not args.no_cache and not update_reference \
+        and not verify_hash and not list_tests
+    cache = {}
+    new_cache_keys = []
+    if use_cache:
+        compiler_bin = shutil.which(compiler.lower())
+        use_cache = compiler_bin is not None
+    if use_cache:
+        if os.path.exists(cache_path):
+            try:
+                cache = json.load(open(cache_path))
+            except json.decoder.JSONDecodeError:
+                cache = {}
+        compiler_hash = _sha256_file(compiler_bin)
+        reference_digest = _reference_digest()
+        run_config = {
+            "backends":
+                sorted(specific_backends) if specific_backends else None,
+            "excluded_backends":
+                sorted(excluded_backends) if excluded_backends else None,
+            "no_llvm": args.no_llvm,
+            "skip_run_with_dbg": args.skip_run_with_dbg,
+        }
+        remaining = []
+        for test in filtered_tests:
+            key = test_cache_key(test, compiler_hash, reference_digest,
+                                 run_config)
+            if key is not None and key in cache:
+                log.debug(f"SKIP (cached): {test['filename']}")
+                continue
+            if key is not None:
+                new_cache_keys.append(key)
+            remaining.append(test)
+        n_cached = len(filtered_tests) - len(remaining)
+        if n_cached:
+            log.info(f"Skipping {n_cached} unchanged test(s) "
+                     "(pass --no-cache to rerun them)")
+        filtered_tests = remaining
+
     for test in filtered_tests:
         if 'extrafiles' in test:
             single_test(test,
@@ -639,6 +730,14 @@ def tester_main(compiler, single_test, is_lcompilers_executable_installed=False)
     if list_tests:
         return
 
+    # Only record results once the whole selection has passed; a failing
+    # test raises out of the loops above before this point is reached
+    if use_cache and new_cache_keys:
+        for key in new_cache_keys:
+            cache[key] = True
+        with open(cache_path, "w") as f:
+            json.dump(cache, f)
+
     if update_reference:
         log.info("Test references updated.")
     elif verify_hash:
@@ -0,0 +1,113 @@
+#ifndef LIBASR_CONSTANT_POOL_H
+#define LIBASR_CONSTANT_POOL_H
+
+#include <cstring>
+#include <map>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+
+namespace LCompilers {
+
+// Hash-consed pool of scalar compile-time constants. Constant folding and
+// propagation create the same IntegerConstant_t / RealConstant_t /
+// LogicalConstant_t values over and over (parameter-heavy code references a
+// handful of values from thousands of use sites); interning them through the
+// pool shares one node per (kind, value) instead of allocating a copy each
+// time.
+//
+// Pooled nodes are shared across use sites and keep the location of the node
+// first interned, so they are only suitable where the location is not
+// user-facing: compile-time values (`expr_value`) and pass-generated
+// constants. Allocate normally when a diagnostic may need to point at the
+// node.
+class ConstantPool {
+private:
+
+    Allocator &al;
+    // keyed by (kind, value bits); reals are stored by bit pattern so that
+    // e.g. -0.0 and 0.0 stay distinct
+    std::map<std::pair<int, uint64_t>, ASR::expr_t*> int_pool;
+    std::map<std::pair<int, uint64_t>, ASR::expr_t*> real_pool;
+    std::map<std::pair<int, uint64_t>, ASR::expr_t*> logical_pool;
+
+public:
+
+    ConstantPool(Allocator &al) : al{al} {}
+
+    ASR::expr_t* integer_constant(int64_t value, ASR::ttype_t* type,
+            const Location &loc) {
+        int kind = ASRUtils::extract_kind_from_ttype_t(type);
+        auto r = int_pool.emplace(
+            std::make_pair(kind, (uint64_t) value), nullptr);
+        if (r.second) {
+            r.first->second = ASRUtils::EXPR(
+                ASR::make_IntegerConstant_t(al, loc, value, type));
+        }
+        return r.first->second;
+    }
+
+    ASR::expr_t* real_constant(double value, ASR::ttype_t* type,
+            const Location &loc) {
+        int kind = ASRUtils::extract_kind_from_ttype_t(type);
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        auto r = real_pool.emplace(std::make_pair(kind, bits), nullptr);
+        if (r.second) {
+            r.first->second = ASRUtils::EXPR(
+                ASR::make_RealConstant_t(al, loc, value, type));
+        }
+        return r.first->second;
+    }
+
+    ASR::expr_t* logical_constant(bool value, ASR::ttype_t* type,
+            const Location &loc) {
+        int kind = ASRUtils::extract_kind_from_ttype_t(type);
+        auto r = logical_pool.emplace(
+            std::make_pair(kind, (uint64_t) value), nullptr);
+        if (r.second) {
+            r.first->second = ASRUtils::EXPR(
+                ASR::make_LogicalConstant_t(al, loc, value, type));
+        }
+        return r.first->second;
+    }
+
+    // Interns an already constructed constant, returning the canonical node
+    // for its (kind, value); expressions that are not poolable scalar
+    // constants are returned unchanged.
+    ASR::expr_t* intern(ASR::expr_t* x) {
+        switch (x->type) {
+            case ASR::exprType::IntegerConstant: {
+                ASR::IntegerConstant_t* c =
+                    ASR::down_cast<ASR::IntegerConstant_t>(x);
+                if (!ASR::is_a<ASR::Integer_t>(*c->m_type)) {
+                    return x;
+                }
+                return integer_constant(c->m_n, c->m_type, x->base.loc);
+            }
+            case ASR::exprType::RealConstant: {
+                ASR::RealConstant_t* c =
+                    ASR::down_cast<ASR::RealConstant_t>(x);
+                if (!ASR::is_a<ASR::Real_t>(*c->m_type)) {
+                    return x;
+                }
+                return real_constant(c->m_r, c->m_type, x->base.loc);
+            }
+            case ASR::exprType::LogicalConstant: {
+                ASR::LogicalConstant_t* c =
+                    ASR::down_cast<ASR::LogicalConstant_t>(x);
+                if (!ASR::is_a<ASR::Logical_t>(*c->m_type)) {
+                    return x;
+                }
+                return logical_constant(c->m_value, c->m_type, x->base.loc);
+            }
+            default: {
+                return x;
+            }
+        }
+    }
+};
+
+} // namespace LCompilers
+
+#endif // LIBASR_CONSTANT_POOL_H
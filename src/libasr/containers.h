@@ -2,6 +2,7 @@
 #define LFORTRAN_CONTAINERS_H
 
 #include <cstring>
+#include <vector>
 #include <libasr/alloc.h>
 
 namespace LCompilers {
@@ -198,6 +199,70 @@ struct Vec {
 static_assert(std::is_standard_layout<Vec<int>>::value);
 static_assert(std::is_trivial<Vec<int>>::value);
 
+// Gap-buffer style rewriter of an existing array, used by ASR passes to
+// splice statements into procedure bodies. The caller walks the original
+// array with a cursor, calling keep()/skip() for each original element and
+// insert() for new elements in front of the cursor. Nothing is allocated
+// until the first edit, so bodies a pass leaves unchanged are not copied,
+// and an edited body is rebuilt in one sweep instead of one copy per
+// insertion.
+template <typename T>
+struct VecRewriter {
+    T* orig_p;
+    size_t orig_n;
+    size_t cursor; // next original element to consume
+    bool edited;
+    Vec<T> out; // rewritten prefix, only valid once `edited`
+
+    void start(T* p, size_t n) {
+        orig_p = p;
+        orig_n = n;
+        cursor = 0;
+        edited = false;
+    }
+
+    // Inserts `x` in front of the original element at the cursor
+    void insert(Allocator &al, T x) {
+        materialize(al);
+        out.push_back(al, x);
+    }
+
+    // Keeps the original element at the cursor and advances past it
+    void keep(Allocator &al) {
+        LCOMPILERS_ASSERT(cursor < orig_n);
+        if (edited) {
+            out.push_back(al, orig_p[cursor]);
+        }
+        cursor++;
+    }
+
+    // Drops the original element at the cursor and advances past it
+    void skip(Allocator &al) {
+        LCOMPILERS_ASSERT(cursor < orig_n);
+        materialize(al);
+        cursor++;
+    }
+
+    // Updates `p` and `n` to the rewritten array; if no edits were made
+    // they are left pointing at the untouched original
+    void finish(T*& p, size_t& n) {
+        LCOMPILERS_ASSERT(cursor == orig_n);
+        if (edited) {
+            p = out.p;
+            n = out.size();
+        }
+    }
+
+    void materialize(Allocator &al) {
+        if (edited) return;
+        out.reserve(al, orig_n + 1);
+        for (size_t i = 0; i < cursor; i++) {
+            out.push_back(al, orig_p[i]);
+        }
+        edited = true;
+    }
+};
+
 /*
 SetChar emulates the std::set<std::string> API
 so that it acts as a drop in replacement.
@@ -303,6 +368,75 @@ struct Str {
 static_assert(std::is_standard_layout<Str>::value);
 static_assert(std::is_trivial<Str>::value);
 
+// Hash-consing table for identifier strings. intern() copies a string into
+// the Allocator at most once and always returns the same char* for equal
+// contents, so interned identifiers can be compared by pointer and repeated
+// identifiers (for example while deserializing modfiles) are stored only
+// once. The table itself only holds pointers; the string storage lives in
+// the Allocator, so an interner must not outlive the Allocator it is used
+// with.
+struct StringInterner {
+
+    char* intern(Allocator &al, const char *s, size_t n) {
+        if (table.empty()) {
+            table.resize(init_size, nullptr);
+        }
+        uint64_t h = hash(s, n);
+        size_t mask = table.size() - 1;
+        size_t i = h & mask;
+        while (table[i] != nullptr) {
+            if (std::strlen(table[i]) == n
+                    && std::memcmp(table[i], s, n) == 0) {
+                return table[i];
+            }
+            i = (i + 1) & mask;
+        }
+        char *p = al.allocate<char>(n + 1);
+        std::memcpy(p, s, n);
+        p[n] = '\0';
+        table[i] = p;
+        count++;
+        // Keep the load factor below 0.7
+        if (10 * count > 7 * table.size()) {
+            grow();
+        }
+        return p;
+    }
+
+    char* intern(Allocator &al, const std::string &s) {
+        return intern(al, s.data(), s.size());
+    }
+
+private:
+    static const size_t init_size = 64;
+    std::vector<char*> table; // open addressing, power-of-two size
+    size_t count = 0;
+
+    // FNV-1a
+    static uint64_t hash(const char *s, size_t n) {
+        uint64_t h = 14695981039346656037ULL;
+        for (size_t i = 0; i < n; i++) {
+            h ^= (unsigned char) s[i];
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    void grow() {
+        std::vector<char*> old = std::move(table);
+        table.assign(old.size() * 2, nullptr);
+        size_t mask = table.size() - 1;
+        for (char *p : old) {
+            if (p == nullptr) continue;
+            size_t i = hash(p, std::strlen(p)) & mask;
+            while (table[i] != nullptr) {
+                i = (i + 1) & mask;
+            }
+            table[i] = p;
+        }
+    }
+};
+
 template <typename ...Args>
 std::string string_format(const std::string& format, Args && ...args)
 {
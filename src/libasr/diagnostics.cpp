@@ -1,4 +1,5 @@
 #include <iomanip>
+#include <map>
 #include <sstream>
 
 #include <libasr/diagnostics.h>
@@ -12,6 +13,12 @@ namespace LCompilers::diag {
 const static std::string redon  = ColorsANSI::RED;
 const static std::string redoff = ColorsANSI::RESET;
 
+std::string render_diagnostic_human(Diagnostic &d, const LocationManager &lm,
+    bool use_colors, bool show_stacktrace,
+    std::map<std::string, std::string> &file_cache);
+std::string render_diagnostic_short(Diagnostic &d, const LocationManager &lm,
+    std::map<std::string, std::string> &file_cache);
+
 std::string highlight_line(const std::string &line,
         const size_t first_column,
         const size_t last_column,
@@ -79,17 +86,20 @@ bool Diagnostics::has_style() const {
 std::string Diagnostics::render(LocationManager &lm,
         const CompilerOptions &compiler_options) {
     std::string out;
+    // Shared across all rendered diagnostics so that each referenced source
+    // file is read from disk at most once
+    std::map<std::string, std::string> file_cache;
     for (auto &d : this->diagnostics) {
         if (compiler_options.error_format == "human") {
             if ((!compiler_options.show_style_suggestions && d.level == Level::Style) || (!compiler_options.show_warnings && d.level == Level::Warning)) {
                 out += "";
             } else {
                 out += render_diagnostic_human(d, lm, compiler_options.use_colors,
-                    compiler_options.show_stacktrace);
+                    compiler_options.show_stacktrace, file_cache);
                 if (&d != &this->diagnostics.back()) out += "\n";
             }
         } else if (compiler_options.error_format == "short") {
-            out += render_diagnostic_short(d, lm);
+            out += render_diagnostic_short(d, lm, file_cache);
         } else {
             throw LCompilersException("Error format not supported.");
         }
@@ -123,17 +133,29 @@ std::string Diagnostics::render2() {
     return out;
 }
 
-std::string get_line(std::string str, int n)
+// Extracts lines `first` to `last` (1-based, inclusive) of `input` in a
+// single scan; missing lines past the end of the input come out empty
+static void get_lines(const std::string &input, uint32_t first, uint32_t last,
+        std::vector<std::string> &lines)
 {
-    std::string line;
-    std::stringstream s(str);
-    for (int i=0; i < n; i++) {
-        std::getline(s, line);
+    uint32_t line = 1;
+    size_t start = 0;
+    for (size_t pos = 0; pos <= input.size() && line <= last; pos++) {
+        if (pos == input.size() || input[pos] == '\n') {
+            if (line >= first) {
+                lines.push_back(input.substr(start, pos - start));
+            }
+            start = pos + 1;
+            line++;
+        }
+    }
+    while (lines.size() < (size_t)(last - first + 1)) {
+        lines.push_back("");
     }
-    return line;
 }
 
-void populate_span(diag::Span &s, const LocationManager &lm) {
+void populate_span(diag::Span &s, const LocationManager &lm,
+        std::map<std::string, std::string> &file_cache) {
     std::string first_filename, last_filename;
     lm.pos_to_linecol(lm.output_to_input_pos(s.loc.first, false),
         s.first_line, s.first_column, first_filename);
@@ -147,50 +169,69 @@ void populate_span(diag::Span &s, const LocationManager &lm) {
         s.last_line = s.first_line;
         s.last_column = s.first_column;
     }
-    std::string input;
-    if (read_file(s.filename, input)) {
-        for (uint32_t i = s.first_line; i <= s.last_line; i++) {
-            s.source_code.push_back(get_line(input, i));
+    auto it = file_cache.find(s.filename);
+    if (it == file_cache.end()) {
+        std::string input;
+        if (!read_file(s.filename, input)) {
+            s.source_code.push_back("File not found.\n");
+            return;
         }
-    } else {
-        s.source_code.push_back("File not found.\n");
+        it = file_cache.emplace(s.filename, std::move(input)).first;
     }
+    get_lines(it->second, s.first_line, s.last_line, s.source_code);
     LCOMPILERS_ASSERT(s.source_code.size() > 0)
 }
 
 // Loop over all labels and their spans, populate all of them
-void populate_spans(diag::Diagnostic &d, const LocationManager &lm) {
+void populate_spans(diag::Diagnostic &d, const LocationManager &lm,
+        std::map<std::string, std::string> &file_cache) {
     for (auto &l : d.labels) {
         for (auto &s : l.spans) {
-            populate_span(s, lm);
+            populate_span(s, lm, file_cache);
         }
     }
 }
 
-// Fills Diagnostic with span details and renders it
+// Fills Diagnostic with span details and renders it. The file cache keeps
+// the contents of each referenced source file so that rendering many
+// diagnostics reads every file at most once
 std::string render_diagnostic_human(Diagnostic &d, const LocationManager &lm,
-        bool use_colors, bool show_stacktrace) {
+        bool use_colors, bool show_stacktrace,
+        std::map<std::string, std::string> &file_cache) {
     std::string out;
     if (show_stacktrace) {
         out += error_stacktrace(d.stacktrace);
     }
     // Convert to line numbers and get source code strings
-    populate_spans(d, lm);
+    populate_spans(d, lm, file_cache);
     // Render the message
     out += render_diagnostic_human(d, use_colors);
     return out;
 }
 
+std::string render_diagnostic_human(Diagnostic &d, const LocationManager &lm,
+        bool use_colors, bool show_stacktrace) {
+    std::map<std::string, std::string> file_cache;
+    return render_diagnostic_human(d, lm, use_colors, show_stacktrace,
+        file_cache);
+}
+
 // Fills Diagnostic with span details and renders it
-std::string render_diagnostic_short(Diagnostic &d, const LocationManager &lm) {
+std::string render_diagnostic_short(Diagnostic &d, const LocationManager &lm,
+        std::map<std::string, std::string> &file_cache) {
     std::string out;
     // Convert to line numbers and get source code strings
-    populate_spans(d, lm);
+    populate_spans(d, lm, file_cache);
     // Render the message
     out += render_diagnostic_short(d);
     return out;
 }
 
+std::string render_diagnostic_short(Diagnostic &d, const LocationManager &lm) {
+    std::map<std::string, std::string> file_cache;
+    return render_diagnostic_short(d, lm, file_cache);
+}
+
 std::string render_diagnostic_human(const Diagnostic &d, bool use_colors) {
     std::string bold  = ColorsANSI::BOLD;
     std::string red_bold  = ColorsANSI::BOLDCYAN;
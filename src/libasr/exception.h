@@ -12,6 +12,7 @@ typedef enum {
     LFORTRAN_PARSER_ERROR    = 4,
     LFORTRAN_ASSERT_FAILED   = 7,
     LFORTRAN_ASSEMBLER_ERROR = 8,
+    LFORTRAN_COMPILE_ERROR   = 9,
 } lfortran_exceptions_t;
 
 #ifdef __cplusplus
@@ -1,26 +1,71 @@
 #include <string>
+#include <string_view>
 
 #include <libasr/config.h>
 #include <libasr/asr_utils.h>
 #include <libasr/asr_verify.h>
 #include <libasr/modfile.h>
 #include <libasr/serialization.h>
+#include <libasr/string_utils.h>
 #include <libasr/bwriter.h>
 
 namespace LCompilers {
 
 const std::string lfortran_modfile_type_string = "LCompilers Modfile";
 
+static void strip_function_bodies(SymbolTable &symtab,
+        std::vector<std::tuple<ASR::Function_t*, ASR::stmt_t**, size_t>> &stripped) {
+    for (auto &item : symtab.get_scope()) {
+        ASR::symbol_t *sym = item.second;
+        if (ASR::is_a<ASR::Function_t>(*sym)) {
+            ASR::Function_t *f = ASR::down_cast<ASR::Function_t>(sym);
+            stripped.emplace_back(f, f->m_body, f->n_body);
+            f->m_body = nullptr;
+            f->n_body = 0;
+        }
+        SymbolTable *nested = ASRUtils::symbol_symtab(sym);
+        if (nested != nullptr) {
+            strip_function_bodies(*nested, stripped);
+        }
+    }
+}
+
+// Hash of the module with every procedure body stripped. It stays stable
+// across body-only edits, so the build driver can skip recompiling
+// dependents whose interface did not change. Local declarations inside
+// procedures still perturb the hash, which errs on the safe side (an
+// extra recompile, never a stale interface).
+std::string modfile_interface_hash(const ASR::TranslationUnit_t &m) {
+    std::vector<std::tuple<ASR::Function_t*, ASR::stmt_t**, size_t>> stripped;
+    strip_function_bodies(*m.m_symtab, stripped);
+    std::string hash = fnv1a_hash64_hex(serialize(m));
+    for (auto &entry : stripped) {
+        std::get<0>(entry)->m_body = std::get<1>(entry);
+        std::get<0>(entry)->n_body = std::get<2>(entry);
+    }
+    return hash;
+}
+
 inline void save_asr(const ASR::TranslationUnit_t &m, std::string& asr_string, LCompilers::LocationManager lm) {
     #ifdef WITH_LFORTRAN_BINARY_MODFILES
     BinaryWriter b;
 #else
     TextWriter b;
 #endif
+    // Serialize the ASR up front: its size dominates the modfile, so the
+    // writer can reserve the whole output once instead of re-growing the
+    // buffer (and recopying the blob) while the sections are appended.
+    std::string asr = serialize(m);
+    b.reserve(asr.size() + 64*1024);
+
     // Header
     b.write_string(lfortran_modfile_type_string);
     b.write_string(LFORTRAN_VERSION);
 
+    // Interface hash: stable across procedure-body-only edits; the build
+    // driver compares it to decide whether dependents must be recompiled.
+    b.write_string(modfile_interface_hash(m));
+
     // AST section: Original module source code:
     // Currently empty.
     // Note: in the future we can save here:
@@ -99,7 +144,7 @@ inline void save_asr(const ASR::TranslationUnit_t &m, std::string& asr_string, L
     }
 
     // Full ASR:
-    b.write_string(serialize(m));
+    b.write_string(asr);
 
     asr_string = b.get_str();
 }
@@ -134,7 +179,32 @@ std::string save_pycfile(const ASR::TranslationUnit_t &m, LCompilers::LocationMa
     return asr_string;
 }
 
-inline bool load_serialised_asr(const std::string &s, std::string& asr_binary,
+// Extracts the interface hash from raw modfile bytes without
+// deserializing the ASR. Returns "" for an unreadable modfile or a
+// version mismatch, so a caller comparing hashes always sees a change.
+std::string modfile_read_interface_hash(const std::string &s) {
+    if (s.empty()) {
+        return "";
+    }
+#ifdef WITH_LFORTRAN_BINARY_MODFILES
+    BinaryReader b(s);
+#else
+    TextReader b(s);
+#endif
+    try {
+        if (b.read_string() != lfortran_modfile_type_string) {
+            return "";
+        }
+        if (b.read_string() != LFORTRAN_VERSION) {
+            return "";
+        }
+        return b.read_string();
+    } catch (const LCompilersException &) {
+        return "";
+    }
+}
+
+inline bool load_serialised_asr(const std::string &s, std::string_view& asr_binary,
                                 LCompilers::LocationManager &lm, std::string& error_message) {
     if (s.empty()) {
         error_message = "Modfile is empty";
@@ -156,6 +226,9 @@ inline bool load_serialised_asr(const std::string &s, std::string& asr_binary,
                         + version + "', but current LFortran version is '" + LFORTRAN_VERSION + "'";
         return false;  // Error code for incompatible version
     }
+    // Interface hash; only the build driver uses it (see
+    // modfile_read_interface_hash), skip it here:
+    b.read_string();
     LCompilers::LocationManager serialized_lm;
     int32_t n_files = b.read_int32();
     std::vector<LCompilers::LocationManager::FileLocations> files;
@@ -229,13 +302,15 @@ inline bool load_serialised_asr(const std::string &s, std::string& asr_binary,
     lm.files.push_back(adjusted_file);
     lm.file_ends.push_back(serialized_lm.file_ends[0] + offset);
 
-    asr_binary = b.read_string();
+    // A view into `s`, which the caller keeps alive while the ASR section
+    // is deserialized; this avoids copying the (large) ASR blob.
+    asr_binary = b.read_string_view();
     return true;
 }
 
 Result<ASR::TranslationUnit_t*, ErrorMessage> load_modfile(Allocator &al, const std::string &s,
         bool load_symtab_id, SymbolTable &symtab, LCompilers::LocationManager &lm) {
-    std::string asr_binary;
+    std::string_view asr_binary;
     std::string error_message;
     if (!load_serialised_asr(s, asr_binary, lm, error_message)) {
         return ErrorMessage(error_message);
@@ -253,7 +328,7 @@ Result<ASR::TranslationUnit_t*, ErrorMessage> load_modfile(Allocator &al, const
 
 Result<ASR::TranslationUnit_t*, ErrorMessage> load_pycfile(Allocator &al, const std::string &s,
         bool load_symtab_id, LCompilers::LocationManager &lm) {
-    std::string asr_binary;
+    std::string_view asr_binary;
     std::string error_message;
     if (!load_serialised_asr(s, asr_binary, lm, error_message)) {
         return ErrorMessage(error_message);
@@ -8,6 +8,14 @@ namespace LCompilers {
     // Save a module to a modfile
     std::string save_modfile(const ASR::TranslationUnit_t &m, LCompilers::LocationManager lm);
 
+    // Hash of the module's interface (procedure bodies excluded); stored
+    // in the modfile header by save_modfile
+    std::string modfile_interface_hash(const ASR::TranslationUnit_t &m);
+
+    // Read the stored interface hash back from raw modfile bytes;
+    // returns "" if the modfile is unreadable or from another version
+    std::string modfile_read_interface_hash(const std::string &s);
+
     std::string save_pycfile(const ASR::TranslationUnit_t &m, LCompilers::LocationManager lm);
 
     // Load a module from a modfile
@@ -0,0 +1,490 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/aos_to_soa.h>
+#include <libasr/pass/pass_utils.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace LCompilers {
+
+using ASR::down_cast;
+using ASR::is_a;
+
+/*
+
+Opt-in array-of-structs to struct-of-arrays conversion. For derived
+types named in PassOptions::soa_structs, a local
+
+    type(t), allocatable :: a(:)
+
+whose every use is a(i)%f, allocate/deallocate of a, or size/bound
+queries, is split into one allocatable array per member
+
+    real, allocatable :: a_x(:), a_y(:)
+    ...
+    a(i)%x  ->  a_x(i)
+
+so that a kernel streaming one field no longer drags the other fields
+through the cache. The conversion is per variable and bails out the
+moment a use is not analyzable: whole-element or whole-array access,
+passing the array to a procedure, pointer/target attributes, or module
+scope (other translation units see the declared layout there). Member
+accesses keep their indices untouched, so vectorization and dependence
+analysis downstream see the same subscripts on contiguous arrays.
+
+Eligible types must be plain containers: default ABI, no inheritance,
+not packed, and every member a scalar integer, real, complex or
+logical. Everything else keeps the declared interleaved layout.
+
+*/
+
+// True for `a(i)` with a single plain subscript on a Var base
+static bool is_simple_array_ref(ASR::expr_t* expr, ASR::symbol_t*& var_sym) {
+    if( expr == nullptr || !is_a<ASR::ArrayItem_t>(*expr) ) {
+        return false;
+    }
+    ASR::ArrayItem_t* item = down_cast<ASR::ArrayItem_t>(expr);
+    if( !is_a<ASR::Var_t>(*item->m_v) || item->n_args != 1 ||
+        item->m_args[0].m_left != nullptr ||
+        item->m_args[0].m_step != nullptr ||
+        item->m_args[0].m_right == nullptr ) {
+        return false;
+    }
+    var_sym = down_cast<ASR::Var_t>(item->m_v)->m_v;
+    return true;
+}
+
+// Counts every reference to the candidate symbols and, separately, the
+// references that the rewrite understands. A candidate survives only if
+// the two counts match, so any construct this pass does not model
+// (whole-element assignment, argument passing, printing the array, ...)
+// automatically disables the conversion for that variable.
+class UsageAnalysis: public ASR::BaseWalkVisitor<UsageAnalysis> {
+    public:
+
+        const std::set<ASR::symbol_t*>& candidates;
+        std::map<ASR::symbol_t*, int> total_uses, supported_uses;
+
+        UsageAnalysis(const std::set<ASR::symbol_t*>& candidates_):
+            candidates(candidates_) {}
+
+        void visit_Var(const ASR::Var_t& x) {
+            if( candidates.count(x.m_v) ) {
+                total_uses[x.m_v] += 1;
+            }
+        }
+
+        void visit_StructInstanceMember(const ASR::StructInstanceMember_t& x) {
+            ASR::symbol_t* var_sym = nullptr;
+            if( is_simple_array_ref(x.m_v, var_sym) && candidates.count(var_sym) ) {
+                supported_uses[var_sym] += 1;
+            }
+            ASR::BaseWalkVisitor<UsageAnalysis>::visit_StructInstanceMember(x);
+        }
+
+        void visit_Allocate(const ASR::Allocate_t& x) {
+            for( size_t i = 0; i < x.n_args; i++ ) {
+                if( is_a<ASR::Var_t>(*x.m_args[i].m_a) &&
+                    x.m_args[i].m_len_expr == nullptr &&
+                    x.m_args[i].m_sym_subclass == nullptr ) {
+                    ASR::symbol_t* sym = down_cast<ASR::Var_t>(x.m_args[i].m_a)->m_v;
+                    if( candidates.count(sym) ) {
+                        supported_uses[sym] += 1;
+                    }
+                }
+            }
+            ASR::BaseWalkVisitor<UsageAnalysis>::visit_Allocate(x);
+        }
+
+        template <typename T>
+        void count_deallocate(const T& x) {
+            for( size_t i = 0; i < x.n_vars; i++ ) {
+                if( is_a<ASR::Var_t>(*x.m_vars[i]) ) {
+                    ASR::symbol_t* sym = down_cast<ASR::Var_t>(x.m_vars[i])->m_v;
+                    if( candidates.count(sym) ) {
+                        supported_uses[sym] += 1;
+                    }
+                }
+            }
+        }
+
+        void visit_ExplicitDeallocate(const ASR::ExplicitDeallocate_t& x) {
+            count_deallocate(x);
+            ASR::BaseWalkVisitor<UsageAnalysis>::visit_ExplicitDeallocate(x);
+        }
+
+        void visit_ImplicitDeallocate(const ASR::ImplicitDeallocate_t& x) {
+            count_deallocate(x);
+            ASR::BaseWalkVisitor<UsageAnalysis>::visit_ImplicitDeallocate(x);
+        }
+
+        void visit_ArraySize(const ASR::ArraySize_t& x) {
+            if( is_a<ASR::Var_t>(*x.m_v) &&
+                candidates.count(down_cast<ASR::Var_t>(x.m_v)->m_v) ) {
+                supported_uses[down_cast<ASR::Var_t>(x.m_v)->m_v] += 1;
+            }
+            ASR::BaseWalkVisitor<UsageAnalysis>::visit_ArraySize(x);
+        }
+
+        void visit_ArrayBound(const ASR::ArrayBound_t& x) {
+            if( is_a<ASR::Var_t>(*x.m_v) &&
+                candidates.count(down_cast<ASR::Var_t>(x.m_v)->m_v) ) {
+                supported_uses[down_cast<ASR::Var_t>(x.m_v)->m_v] += 1;
+            }
+            ASR::BaseWalkVisitor<UsageAnalysis>::visit_ArrayBound(x);
+        }
+};
+
+// One converted variable: the member arrays in member declaration order
+struct SoaFields {
+    std::vector<std::string> member_names;
+    std::vector<ASR::symbol_t*> field_syms;
+
+    ASR::symbol_t* field_for(const std::string& member) const {
+        for( size_t i = 0; i < member_names.size(); i++ ) {
+            if( member_names[i] == member ) {
+                return field_syms[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+class SoaExprReplacer: public ASR::BaseExprReplacer<SoaExprReplacer> {
+    public:
+
+        Allocator& al;
+        const std::map<ASR::symbol_t*, SoaFields>& fields;
+
+        SoaExprReplacer(Allocator& al_,
+            const std::map<ASR::symbol_t*, SoaFields>& fields_):
+            al(al_), fields(fields_) {}
+
+        void replace_StructInstanceMember(ASR::StructInstanceMember_t* x) {
+            ASR::BaseExprReplacer<SoaExprReplacer>::replace_StructInstanceMember(x);
+            ASR::symbol_t* var_sym = nullptr;
+            if( !is_simple_array_ref(x->m_v, var_sym) ) {
+                return;
+            }
+            auto field = fields.find(var_sym);
+            if( field == fields.end() ) {
+                return;
+            }
+            std::string member = ASRUtils::symbol_name(
+                ASRUtils::symbol_get_past_external(x->m_m));
+            ASR::symbol_t* field_sym = field->second.field_for(member);
+            if( field_sym == nullptr ) {
+                return;
+            }
+            ASR::ArrayItem_t* item = down_cast<ASR::ArrayItem_t>(x->m_v);
+            ASR::expr_t* base = ASRUtils::EXPR(ASR::make_Var_t(
+                al, item->m_v->base.loc, field_sym));
+            *current_expr = ASRUtils::EXPR(ASRUtils::make_ArrayItem_t_util(
+                al, x->base.base.loc, base, item->m_args, item->n_args,
+                x->m_type, item->m_storage_format, nullptr));
+        }
+
+        // Size and bound queries stay valid against any one member array
+        void replace_ArraySize(ASR::ArraySize_t* x) {
+            ASR::BaseExprReplacer<SoaExprReplacer>::replace_ArraySize(x);
+            retarget_array_query(x->m_v);
+        }
+
+        void replace_ArrayBound(ASR::ArrayBound_t* x) {
+            ASR::BaseExprReplacer<SoaExprReplacer>::replace_ArrayBound(x);
+            retarget_array_query(x->m_v);
+        }
+
+    private:
+
+        void retarget_array_query(ASR::expr_t*& v) {
+            if( !is_a<ASR::Var_t>(*v) ) {
+                return;
+            }
+            auto field = fields.find(down_cast<ASR::Var_t>(v)->m_v);
+            if( field == fields.end() || field->second.field_syms.empty() ) {
+                return;
+            }
+            v = ASRUtils::EXPR(ASR::make_Var_t(al, v->base.loc,
+                field->second.field_syms[0]));
+        }
+};
+
+class SoaTransformVisitor:
+    public ASR::CallReplacerOnExpressionsVisitor<SoaTransformVisitor>
+{
+    public:
+
+        Allocator& al;
+        const std::map<ASR::symbol_t*, SoaFields>& fields;
+        SoaExprReplacer replacer;
+        ASRUtils::ExprStmtDuplicator duplicator;
+
+        SoaTransformVisitor(Allocator& al_,
+            const std::map<ASR::symbol_t*, SoaFields>& fields_):
+            al(al_), fields(fields_), replacer(al_, fields_), duplicator(al_) {}
+
+        void call_replacer() {
+            replacer.current_expr = current_expr;
+            replacer.replace_expr(*current_expr);
+        }
+
+        void visit_Allocate(const ASR::Allocate_t& x) {
+            ASR::CallReplacerOnExpressionsVisitor<SoaTransformVisitor>
+                ::visit_Allocate(x);
+            bool has_converted_arg = false;
+            for( size_t i = 0; i < x.n_args; i++ ) {
+                if( is_a<ASR::Var_t>(*x.m_args[i].m_a) &&
+                    fields.count(down_cast<ASR::Var_t>(x.m_args[i].m_a)->m_v) ) {
+                    has_converted_arg = true;
+                    break;
+                }
+            }
+            if( !has_converted_arg ) {
+                return;
+            }
+            ASR::Allocate_t& xx = const_cast<ASR::Allocate_t&>(x);
+            Vec<ASR::alloc_arg_t> args;
+            args.reserve(al, x.n_args);
+            for( size_t i = 0; i < x.n_args; i++ ) {
+                ASR::alloc_arg_t arg = x.m_args[i];
+                auto field = is_a<ASR::Var_t>(*arg.m_a) ?
+                    fields.find(down_cast<ASR::Var_t>(arg.m_a)->m_v) :
+                    fields.end();
+                if( field == fields.end() ) {
+                    args.push_back(al, arg);
+                    continue;
+                }
+                for( size_t j = 0; j < field->second.field_syms.size(); j++ ) {
+                    ASR::alloc_arg_t field_arg;
+                    field_arg.loc = arg.loc;
+                    field_arg.m_a = ASRUtils::EXPR(ASR::make_Var_t(
+                        al, arg.m_a->base.loc, field->second.field_syms[j]));
+                    field_arg.m_dims = j == 0 ? arg.m_dims
+                        : duplicate_dims(arg.m_dims, arg.n_dims);
+                    field_arg.n_dims = arg.n_dims;
+                    field_arg.m_len_expr = nullptr;
+                    field_arg.m_sym_subclass = nullptr;
+                    field_arg.m_type = nullptr;
+                    args.push_back(al, field_arg);
+                }
+            }
+            xx.m_args = args.p;
+            xx.n_args = args.size();
+        }
+
+        template <typename T>
+        void expand_deallocate(const T& x) {
+            bool has_converted_var = false;
+            for( size_t i = 0; i < x.n_vars; i++ ) {
+                if( is_a<ASR::Var_t>(*x.m_vars[i]) &&
+                    fields.count(down_cast<ASR::Var_t>(x.m_vars[i])->m_v) ) {
+                    has_converted_var = true;
+                    break;
+                }
+            }
+            if( !has_converted_var ) {
+                return;
+            }
+            T& xx = const_cast<T&>(x);
+            Vec<ASR::expr_t*> vars;
+            vars.reserve(al, x.n_vars);
+            for( size_t i = 0; i < x.n_vars; i++ ) {
+                auto field = is_a<ASR::Var_t>(*x.m_vars[i]) ?
+                    fields.find(down_cast<ASR::Var_t>(x.m_vars[i])->m_v) :
+                    fields.end();
+                if( field == fields.end() ) {
+                    vars.push_back(al, x.m_vars[i]);
+                    continue;
+                }
+                for( ASR::symbol_t* field_sym : field->second.field_syms ) {
+                    vars.push_back(al, ASRUtils::EXPR(ASR::make_Var_t(
+                        al, x.m_vars[i]->base.loc, field_sym)));
+                }
+            }
+            xx.m_vars = vars.p;
+            xx.n_vars = vars.size();
+        }
+
+        void visit_ExplicitDeallocate(const ASR::ExplicitDeallocate_t& x) {
+            ASR::CallReplacerOnExpressionsVisitor<SoaTransformVisitor>
+                ::visit_ExplicitDeallocate(x);
+            expand_deallocate(x);
+        }
+
+        void visit_ImplicitDeallocate(const ASR::ImplicitDeallocate_t& x) {
+            ASR::CallReplacerOnExpressionsVisitor<SoaTransformVisitor>
+                ::visit_ImplicitDeallocate(x);
+            expand_deallocate(x);
+        }
+
+    private:
+
+        ASR::dimension_t* duplicate_dims(ASR::dimension_t* dims, size_t n_dims) {
+            Vec<ASR::dimension_t> new_dims;
+            new_dims.reserve(al, n_dims);
+            for( size_t i = 0; i < n_dims; i++ ) {
+                ASR::dimension_t dim;
+                dim.loc = dims[i].loc;
+                dim.m_start = dims[i].m_start ?
+                    duplicator.duplicate_expr(dims[i].m_start) : nullptr;
+                dim.m_length = dims[i].m_length ?
+                    duplicator.duplicate_expr(dims[i].m_length) : nullptr;
+                new_dims.push_back(al, dim);
+            }
+            return new_dims.p;
+        }
+};
+
+// A type can be split only when every member is a plain scalar of
+// intrinsic numeric/logical type and the layout carries no ABI or
+// inheritance obligations
+static bool is_soa_eligible_struct(ASR::Struct_t* st) {
+    if( st->m_abi != ASR::abiType::Source || st->m_parent != nullptr ||
+        st->m_is_packed || st->n_members == 0 ) {
+        return false;
+    }
+    for( size_t i = 0; i < st->n_members; i++ ) {
+        ASR::symbol_t* member = st->m_symtab->get_symbol(st->m_members[i]);
+        if( member == nullptr || !is_a<ASR::Variable_t>(*member) ) {
+            return false;
+        }
+        ASR::ttype_t* t = down_cast<ASR::Variable_t>(member)->m_type;
+        if( !(is_a<ASR::Integer_t>(*t) || is_a<ASR::Real_t>(*t) ||
+              is_a<ASR::Complex_t>(*t) || is_a<ASR::Logical_t>(*t)) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Local 1-D allocatable array of an eligible type named in soa_structs
+static bool is_soa_candidate_var(ASR::Variable_t* var,
+        const std::vector<std::string>& soa_structs, ASR::Struct_t*& st) {
+    if( var->m_intent != ASR::intentType::Local ||
+        var->m_storage != ASR::storage_typeType::Default ||
+        !is_a<ASR::Allocatable_t>(*var->m_type) ) {
+        return false;
+    }
+    ASR::ttype_t* inner = ASRUtils::type_get_past_allocatable(var->m_type);
+    if( !is_a<ASR::Array_t>(*inner) ) {
+        return false;
+    }
+    ASR::Array_t* arr = down_cast<ASR::Array_t>(inner);
+    if( arr->n_dims != 1 || !is_a<ASR::StructType_t>(*arr->m_type) ||
+        var->m_type_declaration == nullptr ) {
+        return false;
+    }
+    ASR::symbol_t* struct_sym = ASRUtils::symbol_get_past_external(
+        var->m_type_declaration);
+    if( struct_sym == nullptr || !is_a<ASR::Struct_t>(*struct_sym) ) {
+        return false;
+    }
+    st = down_cast<ASR::Struct_t>(struct_sym);
+    std::string name = to_lower(st->m_name);
+    if( std::find(soa_structs.begin(), soa_structs.end(), name) ==
+            soa_structs.end() ) {
+        return false;
+    }
+    return is_soa_eligible_struct(st);
+}
+
+// Collects candidate variables from every procedure scope. Module-level
+// variables are skipped: their layout is visible to other translation
+// units through the modfile.
+static void collect_candidates(SymbolTable& symtab,
+        const std::vector<std::string>& soa_structs,
+        std::set<ASR::symbol_t*>& candidates,
+        std::map<ASR::symbol_t*, ASR::Struct_t*>& var_struct) {
+    for( auto& item: symtab.get_scope() ) {
+        ASR::symbol_t* sym = item.second;
+        bool is_procedure = is_a<ASR::Function_t>(*sym) ||
+            is_a<ASR::Program_t>(*sym);
+        if( is_procedure ) {
+            SymbolTable* scope = ASRUtils::symbol_symtab(sym);
+            for( auto& local: scope->get_scope() ) {
+                if( !is_a<ASR::Variable_t>(*local.second) ) {
+                    continue;
+                }
+                ASR::Variable_t* var = down_cast<ASR::Variable_t>(local.second);
+                ASR::Struct_t* st = nullptr;
+                if( is_soa_candidate_var(var, soa_structs, st) ) {
+                    candidates.insert(local.second);
+                    var_struct[local.second] = st;
+                }
+            }
+        }
+        if( SymbolTable* nested = ASRUtils::symbol_symtab(sym) ) {
+            collect_candidates(*nested, soa_structs, candidates, var_struct);
+        }
+    }
+}
+
+void pass_aos_to_soa(Allocator &al, ASR::TranslationUnit_t &unit,
+                     const PassOptions &pass_options) {
+    if( pass_options.soa_structs.empty() ) {
+        return ;
+    }
+
+    std::set<ASR::symbol_t*> candidates;
+    std::map<ASR::symbol_t*, ASR::Struct_t*> var_struct;
+    collect_candidates(*unit.m_symtab, pass_options.soa_structs,
+        candidates, var_struct);
+    if( candidates.empty() ) {
+        return ;
+    }
+
+    UsageAnalysis usage(candidates);
+    usage.visit_TranslationUnit(unit);
+
+    std::map<ASR::symbol_t*, SoaFields> fields;
+    for( ASR::symbol_t* sym: candidates ) {
+        if( usage.total_uses[sym] == 0 ||
+            usage.total_uses[sym] != usage.supported_uses[sym] ) {
+            continue;
+        }
+        ASR::Variable_t* var = down_cast<ASR::Variable_t>(sym);
+        ASR::Struct_t* st = var_struct[sym];
+        SymbolTable* scope = var->m_parent_symtab;
+        SoaFields var_fields;
+        for( size_t i = 0; i < st->n_members; i++ ) {
+            std::string member_name = st->m_members[i];
+            ASR::Variable_t* member = down_cast<ASR::Variable_t>(
+                st->m_symtab->get_symbol(member_name));
+            std::string field_name = scope->get_unique_name(
+                std::string(var->m_name) + "_" + member_name);
+            // same allocatable 1-D shape, element type swapped for the
+            // member's scalar type
+            ASR::ttype_t* field_type = ASRUtils::duplicate_type(al, var->m_type);
+            ASR::Array_t* field_arr = down_cast<ASR::Array_t>(
+                ASRUtils::type_get_past_allocatable(field_type));
+            field_arr->m_type = ASRUtils::duplicate_type(al, member->m_type);
+            ASR::symbol_t* field_sym = down_cast<ASR::symbol_t>(
+                ASR::make_Variable_t(al, var->base.base.loc,
+                    scope, s2c(al, field_name), nullptr, 0,
+                    ASR::intentType::Local, nullptr, nullptr,
+                    ASR::storage_typeType::Default, field_type, nullptr,
+                    ASR::abiType::Source, ASR::accessType::Public,
+                    ASR::presenceType::Required, false, false, false,
+                    nullptr, false, false,
+                    ASR::pass_attrType::NotMethod, nullptr, 0));
+            scope->add_symbol(field_name, field_sym);
+            var_fields.member_names.push_back(member_name);
+            var_fields.field_syms.push_back(field_sym);
+        }
+        fields[sym] = var_fields;
+    }
+    if( fields.empty() ) {
+        return ;
+    }
+
+    SoaTransformVisitor transform(al, fields);
+    transform.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
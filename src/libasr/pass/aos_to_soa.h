@@ -0,0 +1,14 @@
+#ifndef LIBASR_PASS_AOS_TO_SOA_H
+#define LIBASR_PASS_AOS_TO_SOA_H
+
+#include <libasr/asr.h>
+#include <libasr/utils.h>
+
+namespace LCompilers {
+
+    void pass_aos_to_soa(Allocator &al, ASR::TranslationUnit_t &unit,
+                         const PassOptions &pass_options);
+
+} // namespace LCompilers
+
+#endif // LIBASR_PASS_AOS_TO_SOA_H
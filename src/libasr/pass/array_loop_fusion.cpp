@@ -0,0 +1,536 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/exception.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_verify.h>
+#include <libasr/pass/array_loop_fusion.h>
+#include <libasr/pass/pass_utils.h>
+
+#include <cstring>
+#include <set>
+#include <string>
+
+
+namespace LCompilers {
+
+using ASR::down_cast;
+using ASR::is_a;
+
+/*
+
+This ASR pass fuses the element loops that the array lowering produces
+for compound array expressions. For `a = b*c + d*e` the earlier passes
+materialize each sub-expression into a compiler temporary with its own
+loop:
+
+    do i = 1, n
+        tmp(i) = b(i)*c(i)
+    end do
+    do i = 1, n
+        a(i) = tmp(i) + d(i)*e(i)
+    end do
+
+This pass forwards the temporary's defining expression into the consumer
+loop and drops the producer loop, so the whole expression is evaluated in
+a single pass over the data with no intermediate array traffic:
+
+    do i = 1, n
+        a(i) = b(i)*c(i) + d(i)*e(i)
+    end do
+
+Only compiler-created temporaries (`__libasr_created_*`) with exactly one
+write and one read are forwarded, the two loops must have identical
+bounds, the forwarded expression must be pure, and it must not read
+anything the consumer loop writes — real aliasing therefore keeps the
+temporary and both loops. Both do loops and the while loops that the
+do_loops pass lowers them into are recognized, since under --fast this
+pass runs after that lowering.
+
+*/
+
+// The normalized shape of a candidate loop: the loop variable, the
+// statements that make up the element computation, and the expressions
+// that must match between producer and consumer for fusion to be legal
+struct FusibleLoop {
+    ASR::symbol_t* loop_var = nullptr;
+    ASR::stmt_t** body = nullptr;
+    size_t n_body = 0;
+    // WhileLoop form (from the do_loops lowering)
+    ASR::expr_t* test = nullptr;
+    ASR::expr_t* increment = nullptr;
+    // DoLoop form
+    ASR::expr_t* start = nullptr;
+    ASR::expr_t* end = nullptr;
+    ASR::expr_t* step = nullptr;
+};
+
+// Structural equality of two expressions where `sym1` in `x` matches
+// `sym2` in `y` (the two loop variables); anything unrecognized is
+// conservatively unequal
+static bool expr_equal_mapped(ASR::expr_t* x, ASR::expr_t* y,
+        ASR::symbol_t* sym1, ASR::symbol_t* sym2) {
+    if( x == nullptr || y == nullptr ) {
+        return x == y;
+    }
+    if( x->type != y->type ) {
+        return false;
+    }
+    if( ASR::is_a<ASR::Var_t>(*x) ) {
+        ASR::symbol_t* xs = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(x)->m_v);
+        ASR::symbol_t* ys = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(y)->m_v);
+        return xs == ys || (xs == sym1 && ys == sym2);
+    } else if( ASR::is_a<ASR::IntegerConstant_t>(*x) ) {
+        return ASR::down_cast<ASR::IntegerConstant_t>(x)->m_n ==
+               ASR::down_cast<ASR::IntegerConstant_t>(y)->m_n;
+    } else if( ASR::is_a<ASR::RealConstant_t>(*x) ) {
+        return ASR::down_cast<ASR::RealConstant_t>(x)->m_r ==
+               ASR::down_cast<ASR::RealConstant_t>(y)->m_r;
+    } else if( ASR::is_a<ASR::LogicalConstant_t>(*x) ) {
+        return ASR::down_cast<ASR::LogicalConstant_t>(x)->m_value ==
+               ASR::down_cast<ASR::LogicalConstant_t>(y)->m_value;
+    } else if( ASR::is_a<ASR::IntegerBinOp_t>(*x) ) {
+        ASR::IntegerBinOp_t* bx = ASR::down_cast<ASR::IntegerBinOp_t>(x);
+        ASR::IntegerBinOp_t* by = ASR::down_cast<ASR::IntegerBinOp_t>(y);
+        return bx->m_op == by->m_op &&
+               expr_equal_mapped(bx->m_left, by->m_left, sym1, sym2) &&
+               expr_equal_mapped(bx->m_right, by->m_right, sym1, sym2);
+    } else if( ASR::is_a<ASR::IntegerCompare_t>(*x) ) {
+        ASR::IntegerCompare_t* cx = ASR::down_cast<ASR::IntegerCompare_t>(x);
+        ASR::IntegerCompare_t* cy = ASR::down_cast<ASR::IntegerCompare_t>(y);
+        return cx->m_op == cy->m_op &&
+               expr_equal_mapped(cx->m_left, cy->m_left, sym1, sym2) &&
+               expr_equal_mapped(cx->m_right, cy->m_right, sym1, sym2);
+    } else if( ASR::is_a<ASR::LogicalBinOp_t>(*x) ) {
+        ASR::LogicalBinOp_t* lx = ASR::down_cast<ASR::LogicalBinOp_t>(x);
+        ASR::LogicalBinOp_t* ly = ASR::down_cast<ASR::LogicalBinOp_t>(y);
+        return lx->m_op == ly->m_op &&
+               expr_equal_mapped(lx->m_left, ly->m_left, sym1, sym2) &&
+               expr_equal_mapped(lx->m_right, ly->m_right, sym1, sym2);
+    } else if( ASR::is_a<ASR::IntegerUnaryMinus_t>(*x) ) {
+        return expr_equal_mapped(ASR::down_cast<ASR::IntegerUnaryMinus_t>(x)->m_arg,
+            ASR::down_cast<ASR::IntegerUnaryMinus_t>(y)->m_arg, sym1, sym2);
+    } else if( ASR::is_a<ASR::Cast_t>(*x) ) {
+        ASR::Cast_t* cx = ASR::down_cast<ASR::Cast_t>(x);
+        ASR::Cast_t* cy = ASR::down_cast<ASR::Cast_t>(y);
+        return cx->m_kind == cy->m_kind &&
+               expr_equal_mapped(cx->m_arg, cy->m_arg, sym1, sym2);
+    }
+    return false;
+}
+
+// Extracts the `i = i + c` increment that the do_loops lowering places
+// first in a while loop body; returns the loop variable or nullptr
+static ASR::symbol_t* extract_while_increment(ASR::stmt_t* stmt,
+        ASR::expr_t*& increment) {
+    if( !ASR::is_a<ASR::Assignment_t>(*stmt) ) {
+        return nullptr;
+    }
+    ASR::Assignment_t* assign = ASR::down_cast<ASR::Assignment_t>(stmt);
+    if( !ASR::is_a<ASR::Var_t>(*assign->m_target) ||
+        !ASR::is_a<ASR::IntegerBinOp_t>(*assign->m_value) ) {
+        return nullptr;
+    }
+    ASR::symbol_t* var = ASRUtils::symbol_get_past_external(
+        ASR::down_cast<ASR::Var_t>(assign->m_target)->m_v);
+    ASR::IntegerBinOp_t* binop = ASR::down_cast<ASR::IntegerBinOp_t>(assign->m_value);
+    if( binop->m_op != ASR::binopType::Add ||
+        !ASR::is_a<ASR::Var_t>(*binop->m_left) ||
+        ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(binop->m_left)->m_v) != var ) {
+        return nullptr;
+    }
+    increment = binop->m_right;
+    return var;
+}
+
+static bool extract_fusible_loop(ASR::stmt_t* stmt, FusibleLoop& loop) {
+    if( ASR::is_a<ASR::DoLoop_t>(*stmt) ) {
+        ASR::DoLoop_t* do_loop = ASR::down_cast<ASR::DoLoop_t>(stmt);
+        if( do_loop->n_orelse > 0 || do_loop->m_head.m_v == nullptr ||
+            !ASR::is_a<ASR::Var_t>(*do_loop->m_head.m_v) ) {
+            return false;
+        }
+        loop.loop_var = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(do_loop->m_head.m_v)->m_v);
+        loop.start = do_loop->m_head.m_start;
+        loop.end = do_loop->m_head.m_end;
+        loop.step = do_loop->m_head.m_increment;
+        loop.body = do_loop->m_body;
+        loop.n_body = do_loop->n_body;
+        return true;
+    } else if( ASR::is_a<ASR::WhileLoop_t>(*stmt) ) {
+        ASR::WhileLoop_t* while_loop = ASR::down_cast<ASR::WhileLoop_t>(stmt);
+        if( while_loop->n_orelse > 0 || while_loop->n_body < 1 ) {
+            return false;
+        }
+        loop.loop_var = extract_while_increment(while_loop->m_body[0],
+            loop.increment);
+        if( loop.loop_var == nullptr ) {
+            return false;
+        }
+        loop.test = while_loop->m_test;
+        loop.body = while_loop->m_body + 1;
+        loop.n_body = while_loop->n_body - 1;
+        return true;
+    }
+    return false;
+}
+
+static bool loop_heads_equal(const FusibleLoop& producer,
+        const FusibleLoop& consumer) {
+    if( (producer.test != nullptr) != (consumer.test != nullptr) ) {
+        return false;
+    }
+    if( producer.test ) {
+        return expr_equal_mapped(producer.test, consumer.test,
+                   producer.loop_var, consumer.loop_var) &&
+               expr_equal_mapped(producer.increment, consumer.increment,
+                   producer.loop_var, consumer.loop_var);
+    }
+    return expr_equal_mapped(producer.start, consumer.start,
+               producer.loop_var, consumer.loop_var) &&
+           expr_equal_mapped(producer.end, consumer.end,
+               producer.loop_var, consumer.loop_var) &&
+           expr_equal_mapped(producer.step, consumer.step,
+               producer.loop_var, consumer.loop_var);
+}
+
+// Collects the base symbols of every Var below an expression and flags
+// anything with side effects (calls), which blocks forwarding
+class ExprSymbolCollector: public ASR::BaseWalkVisitor<ExprSymbolCollector> {
+
+    public:
+
+    std::set<ASR::symbol_t*> symbols;
+    bool impure = false;
+
+    void visit_Var(const ASR::Var_t& x) {
+        symbols.insert(ASRUtils::symbol_get_past_external(x.m_v));
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t& /*x*/) { impure = true; }
+    void visit_SubroutineCall(const ASR::SubroutineCall_t& /*x*/) { impure = true; }
+
+};
+
+// Collects the symbols a statement list assigns to; anything it cannot
+// account for makes the list unsafe for fusion
+class BodyWriteCollector: public ASR::BaseWalkVisitor<BodyWriteCollector> {
+
+    public:
+
+    std::set<ASR::symbol_t*> written;
+    bool unsafe = false;
+
+    void note_written(ASR::expr_t* target) {
+        if( ASR::is_a<ASR::Var_t>(*target) ) {
+            written.insert(ASRUtils::symbol_get_past_external(
+                ASR::down_cast<ASR::Var_t>(target)->m_v));
+        } else if( ASR::is_a<ASR::ArrayItem_t>(*target) ) {
+            note_written(ASR::down_cast<ASR::ArrayItem_t>(target)->m_v);
+        } else if( ASR::is_a<ASR::ArraySection_t>(*target) ) {
+            note_written(ASR::down_cast<ASR::ArraySection_t>(target)->m_v);
+        } else if( ASR::is_a<ASR::StructInstanceMember_t>(*target) ) {
+            note_written(ASR::down_cast<ASR::StructInstanceMember_t>(target)->m_v);
+        } else {
+            unsafe = true;
+        }
+    }
+
+    void visit_Assignment(const ASR::Assignment_t& x) {
+        note_written(x.m_target);
+        ASR::BaseWalkVisitor<BodyWriteCollector>::visit_Assignment(x);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t& x) {
+        note_written(x.m_head.m_v);
+        ASR::BaseWalkVisitor<BodyWriteCollector>::visit_DoLoop(x);
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t& /*x*/) { unsafe = true; }
+    void visit_Allocate(const ASR::Allocate_t& /*x*/) { unsafe = true; }
+    void visit_ExplicitDeallocate(const ASR::ExplicitDeallocate_t& /*x*/) { unsafe = true; }
+    void visit_ImplicitDeallocate(const ASR::ImplicitDeallocate_t& /*x*/) { unsafe = true; }
+    void visit_Associate(const ASR::Associate_t& /*x*/) { unsafe = true; }
+    void visit_FileRead(const ASR::FileRead_t& /*x*/) { unsafe = true; }
+
+};
+
+// Counts Var references to one symbol
+class SymbolUseCounter: public ASR::BaseWalkVisitor<SymbolUseCounter> {
+
+    public:
+
+    ASR::symbol_t* symbol;
+    size_t count = 0;
+
+    SymbolUseCounter(ASR::symbol_t* symbol_): symbol(symbol_) {}
+
+    void visit_Var(const ASR::Var_t& x) {
+        if( ASRUtils::symbol_get_past_external(x.m_v) == symbol ) {
+            count++;
+        }
+    }
+
+};
+
+// Renames one symbol to another below a subtree (used to retarget the
+// forwarded expression from the producer's loop variable to the
+// consumer's)
+class SymbolRenamer: public ASR::BaseWalkVisitor<SymbolRenamer> {
+
+    public:
+
+    ASR::symbol_t* from;
+    ASR::symbol_t* to;
+
+    SymbolRenamer(ASR::symbol_t* from_, ASR::symbol_t* to_):
+        from(from_), to(to_) {}
+
+    void visit_Var(const ASR::Var_t& x) {
+        ASR::Var_t& xx = const_cast<ASR::Var_t&>(x);
+        if( ASRUtils::symbol_get_past_external(xx.m_v) == from ) {
+            xx.m_v = to;
+        }
+    }
+
+};
+
+// Replaces the single `tmp(loop_var)` read in the consumer body with the
+// forwarded expression
+class TempReadReplacer: public ASR::BaseExprReplacer<TempReadReplacer> {
+
+    public:
+
+    ASR::symbol_t* temp_symbol = nullptr;
+    ASR::expr_t* replacement = nullptr;
+    bool replaced = false;
+
+    void replace_ArrayItem(ASR::ArrayItem_t* x) {
+        if( ASR::is_a<ASR::Var_t>(*x->m_v) &&
+            ASRUtils::symbol_get_past_external(
+                ASR::down_cast<ASR::Var_t>(x->m_v)->m_v) == temp_symbol ) {
+            *current_expr = replacement;
+            replaced = true;
+            return ;
+        }
+        ASR::BaseExprReplacer<TempReadReplacer>::replace_ArrayItem(x);
+    }
+
+};
+
+class TempReadReplaceVisitor: public ASR::CallReplacerOnExpressionsVisitor<TempReadReplaceVisitor> {
+
+    public:
+
+    TempReadReplacer replacer;
+
+    void call_replacer() {
+        replacer.current_expr = current_expr;
+        replacer.replace_expr(*current_expr);
+    }
+
+};
+
+class ArrayLoopFusionVisitor: public ASR::BaseWalkVisitor<ArrayLoopFusionVisitor> {
+
+    private:
+
+    Allocator& al;
+    // The body of the procedure being visited, for whole-procedure use
+    // counts of candidate temporaries
+    ASR::stmt_t*** proc_body = nullptr;
+    size_t* proc_n_body = nullptr;
+
+    public:
+
+    ArrayLoopFusionVisitor(Allocator& al_): al(al_) {}
+
+    // The producer loop must compute exactly `tmp(i) = expr` into a
+    // compiler-created temporary
+    bool extract_producer(const FusibleLoop& loop, ASR::symbol_t*& temp_symbol,
+                          ASR::expr_t*& forwarded_expr) {
+        if( loop.n_body != 1 ||
+            !ASR::is_a<ASR::Assignment_t>(*loop.body[0]) ) {
+            return false;
+        }
+        ASR::Assignment_t* assign = ASR::down_cast<ASR::Assignment_t>(loop.body[0]);
+        if( !ASR::is_a<ASR::ArrayItem_t>(*assign->m_target) ) {
+            return false;
+        }
+        ASR::ArrayItem_t* target = ASR::down_cast<ASR::ArrayItem_t>(assign->m_target);
+        if( target->n_args != 1 ||
+            target->m_args->m_left || target->m_args->m_step ||
+            target->m_args->m_right == nullptr ||
+            !ASR::is_a<ASR::Var_t>(*target->m_args->m_right) ||
+            ASRUtils::symbol_get_past_external(ASR::down_cast<ASR::Var_t>(
+                target->m_args->m_right)->m_v) != loop.loop_var ||
+            !ASR::is_a<ASR::Var_t>(*target->m_v) ) {
+            return false;
+        }
+        temp_symbol = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(target->m_v)->m_v);
+        if( !ASR::is_a<ASR::Variable_t>(*temp_symbol) ||
+            std::string(ASRUtils::symbol_name(temp_symbol)).rfind(
+                "__libasr_created_", 0) != 0 ) {
+            return false;
+        }
+        forwarded_expr = assign->m_value;
+        return true;
+    }
+
+    bool try_fuse(ASR::stmt_t* first, ASR::stmt_t* second) {
+        FusibleLoop producer, consumer;
+        if( !extract_fusible_loop(first, producer) ||
+            !extract_fusible_loop(second, consumer) ||
+            !loop_heads_equal(producer, consumer) ) {
+            return false;
+        }
+        ASR::symbol_t* temp_symbol = nullptr;
+        ASR::expr_t* forwarded_expr = nullptr;
+        if( !extract_producer(producer, temp_symbol, forwarded_expr) ) {
+            return false;
+        }
+
+        // The forwarded expression must be pure; anything else may not be
+        // re-evaluated at a different point in time
+        ExprSymbolCollector expr_symbols;
+        expr_symbols.visit_expr(*forwarded_expr);
+        if( expr_symbols.impure || expr_symbols.symbols.count(temp_symbol) ) {
+            return false;
+        }
+
+        // The consumer must not write anything the forwarded expression
+        // reads (other than the loop variable), otherwise evaluating the
+        // expression inside the consumer loop would see modified data
+        BodyWriteCollector consumer_writes;
+        for( size_t i = 0; i < consumer.n_body; i++ ) {
+            consumer_writes.visit_stmt(*consumer.body[i]);
+        }
+        if( consumer_writes.unsafe ) {
+            return false;
+        }
+        for( ASR::symbol_t* sym: expr_symbols.symbols ) {
+            if( sym != producer.loop_var && consumer_writes.written.count(sym) ) {
+                return false;
+            }
+        }
+
+        // The temporary must have exactly this one write and one read in
+        // the whole procedure; the read must be `tmp(loop_var)` in the
+        // consumer body
+        SymbolUseCounter proc_uses(temp_symbol);
+        for( size_t i = 0; i < *proc_n_body; i++ ) {
+            proc_uses.visit_stmt(*(*proc_body)[i]);
+        }
+        if( proc_uses.count != 2 ) {
+            return false;
+        }
+        size_t consumer_reads = 0;
+        for( size_t i = 0; i < consumer.n_body; i++ ) {
+            SymbolUseCounter body_uses(temp_symbol);
+            body_uses.visit_stmt(*consumer.body[i]);
+            consumer_reads += body_uses.count;
+        }
+        if( consumer_reads != 1 ) {
+            return false;
+        }
+
+        // Forward: duplicate the expression, retarget it to the consumer's
+        // loop variable and substitute it for the temporary's read
+        ASRUtils::ExprStmtDuplicator duplicator(al);
+        ASR::expr_t* forwarded_copy = duplicator.duplicate_expr(forwarded_expr);
+        SymbolRenamer renamer(producer.loop_var, consumer.loop_var);
+        renamer.visit_expr(*forwarded_copy);
+
+        TempReadReplaceVisitor replace_visitor;
+        replace_visitor.replacer.temp_symbol = temp_symbol;
+        replace_visitor.replacer.replacement = forwarded_copy;
+        for( size_t i = 0; i < consumer.n_body; i++ ) {
+            replace_visitor.visit_stmt(*consumer.body[i]);
+        }
+        return replace_visitor.replacer.replaced;
+    }
+
+    void fuse_body(ASR::stmt_t**& m_body, size_t& n_body) {
+        if( proc_body == nullptr ) {
+            return ;
+        }
+        bool changed = false;
+        Vec<ASR::stmt_t*> new_body;
+        new_body.reserve(al, n_body);
+        size_t i = 0;
+        while( i < n_body ) {
+            if( i + 1 < n_body && try_fuse(m_body[i], m_body[i + 1]) ) {
+                // The producer loop is dropped; the consumer (already
+                // rewritten in place) becomes the fused loop
+                changed = true;
+                i++;
+                continue;
+            }
+            new_body.push_back(al, m_body[i]);
+            i++;
+        }
+        if( changed ) {
+            m_body = new_body.p;
+            n_body = new_body.size();
+        }
+    }
+
+    void visit_Function(const ASR::Function_t& x) {
+        ASR::Function_t& xx = const_cast<ASR::Function_t&>(x);
+        ASR::stmt_t*** proc_body_copy = proc_body;
+        size_t* proc_n_body_copy = proc_n_body;
+        proc_body = &xx.m_body;
+        proc_n_body = &xx.n_body;
+        ASR::BaseWalkVisitor<ArrayLoopFusionVisitor>::visit_Function(x);
+        fuse_body(xx.m_body, xx.n_body);
+        proc_body = proc_body_copy;
+        proc_n_body = proc_n_body_copy;
+    }
+
+    void visit_Program(const ASR::Program_t& x) {
+        ASR::Program_t& xx = const_cast<ASR::Program_t&>(x);
+        ASR::stmt_t*** proc_body_copy = proc_body;
+        size_t* proc_n_body_copy = proc_n_body;
+        proc_body = &xx.m_body;
+        proc_n_body = &xx.n_body;
+        ASR::BaseWalkVisitor<ArrayLoopFusionVisitor>::visit_Program(x);
+        fuse_body(xx.m_body, xx.n_body);
+        proc_body = proc_body_copy;
+        proc_n_body = proc_n_body_copy;
+    }
+
+    void visit_If(const ASR::If_t& x) {
+        ASR::If_t& xx = const_cast<ASR::If_t&>(x);
+        ASR::BaseWalkVisitor<ArrayLoopFusionVisitor>::visit_If(x);
+        fuse_body(xx.m_body, xx.n_body);
+        fuse_body(xx.m_orelse, xx.n_orelse);
+    }
+
+    void visit_WhileLoop(const ASR::WhileLoop_t& x) {
+        ASR::WhileLoop_t& xx = const_cast<ASR::WhileLoop_t&>(x);
+        ASR::BaseWalkVisitor<ArrayLoopFusionVisitor>::visit_WhileLoop(x);
+        fuse_body(xx.m_body, xx.n_body);
+        fuse_body(xx.m_orelse, xx.n_orelse);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t& x) {
+        ASR::DoLoop_t& xx = const_cast<ASR::DoLoop_t&>(x);
+        ASR::BaseWalkVisitor<ArrayLoopFusionVisitor>::visit_DoLoop(x);
+        fuse_body(xx.m_body, xx.n_body);
+        fuse_body(xx.m_orelse, xx.n_orelse);
+    }
+
+};
+
+void pass_array_loop_fusion(Allocator &al, ASR::TranslationUnit_t &unit,
+                            const LCompilers::PassOptions& /*pass_options*/) {
+    ArrayLoopFusionVisitor v(al);
+    v.visit_TranslationUnit(unit);
+}
+
+
+} // namespace LCompilers
@@ -581,6 +581,9 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
     bool bounds_checking;
     bool remove_original_stmt;
     const LCompilers::PassOptions& pass_options;
+    // what the local array pointers of the procedure currently being
+    // visited may be associated with; rebuilt per procedure
+    PassUtils::PointerAssociationSummary ptr_assoc;
     inline static std::set<const ASR::Assignment_t*> debug_inserted;
 
     public:
@@ -612,6 +615,20 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
         // Do nothing
     }
 
+    void visit_Function(const ASR::Function_t& x) {
+        PassUtils::PointerAssociationSummary ptr_assoc_copy = ptr_assoc;
+        ptr_assoc.build(x.m_symtab, x.m_body, x.n_body);
+        ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisitor>::visit_Function(x);
+        ptr_assoc = ptr_assoc_copy;
+    }
+
+    void visit_Program(const ASR::Program_t& x) {
+        PassUtils::PointerAssociationSummary ptr_assoc_copy = ptr_assoc;
+        ptr_assoc.build(x.m_symtab, x.m_body, x.n_body);
+        ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisitor>::visit_Program(x);
+        ptr_assoc = ptr_assoc_copy;
+    }
+
     void visit_GpuKernelFunction(const ASR::GpuKernelFunction_t& /*x*/) {
         // GPU kernel functions are emitted by the Metal/CUDA codegen
         // which handles array operations directly. The array_op pass
@@ -1495,6 +1512,80 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
         (void)x;
     }
 
+    // True when `target = value` is a plain whole-array copy between two
+    // distinct contiguous numeric arrays, i.e. both sides are array
+    // variables (no sections, casts or computed expressions) of the same
+    // element type and kind. Such assignments need no element-wise loop:
+    // the backend lowers them with a flat memcpy of the data
+    // (copy_array). A pointer operand is allowed only when the
+    // per-procedure association summary proves it is associated with a
+    // whole (hence contiguous) array and cannot alias the other side;
+    // other pointers may refer to non-contiguous sections or to
+    // overlapping storage. Struct or string elements are excluded
+    // because a flat copy is not a correct deep copy for them.
+    bool is_whole_array_copy(ASR::expr_t* target, ASR::expr_t* value) {
+        if( !ASR::is_a<ASR::Var_t>(*target) || !ASR::is_a<ASR::Var_t>(*value) ) {
+            return false;
+        }
+        if( ASR::down_cast<ASR::Var_t>(target)->m_v ==
+            ASR::down_cast<ASR::Var_t>(value)->m_v ) {
+            return false;
+        }
+        ASR::ttype_t* target_type = ASRUtils::expr_type(target);
+        ASR::ttype_t* value_type = ASRUtils::expr_type(value);
+        if( !ASRUtils::is_array(target_type) ||
+            !ASRUtils::is_array(value_type) ||
+            ASRUtils::is_simd_array(target) ||
+            ASRUtils::is_simd_array(value) ) {
+            return false;
+        }
+        if( ASRUtils::is_pointer(target_type) ||
+            ASRUtils::is_pointer(value_type) ) {
+            ASR::symbol_t* target_sym = ASR::down_cast<ASR::Var_t>(target)->m_v;
+            ASR::symbol_t* value_sym = ASR::down_cast<ASR::Var_t>(value)->m_v;
+            if( (ASRUtils::is_pointer(target_type) &&
+                 !ptr_assoc.points_only_to_whole_arrays(target_sym)) ||
+                (ASRUtils::is_pointer(value_type) &&
+                 !ptr_assoc.points_only_to_whole_arrays(value_sym)) ||
+                ptr_assoc.may_alias(target_sym, value_sym) ) {
+                return false;
+            }
+        }
+        ASR::ttype_t* target_el_type = ASRUtils::extract_type(target_type);
+        ASR::ttype_t* value_el_type = ASRUtils::extract_type(value_type);
+        if( !(ASR::is_a<ASR::Integer_t>(*target_el_type) ||
+              ASR::is_a<ASR::Real_t>(*target_el_type) ||
+              ASR::is_a<ASR::Complex_t>(*target_el_type) ||
+              ASR::is_a<ASR::Logical_t>(*target_el_type)) ) {
+            return false;
+        }
+        if( target_el_type->type != value_el_type->type ||
+            ASRUtils::extract_kind_from_ttype_t(target_el_type) !=
+            ASRUtils::extract_kind_from_ttype_t(value_el_type) ) {
+            return false;
+        }
+        for( ASR::ttype_t* type: {target_type, value_type} ) {
+            ASR::array_physical_typeType physical_type =
+                ASRUtils::extract_physical_type(type);
+            if( physical_type != ASR::array_physical_typeType::DescriptorArray &&
+                !(physical_type == ASR::array_physical_typeType::FixedSizeArray &&
+                  ASRUtils::is_fixed_size_array(type)) ) {
+                return false;
+            }
+        }
+        // descriptor = descriptor goes through copy_array in the backend,
+        // which also overwrites the target's dimension descriptors with
+        // the source's; that would change the target's declared bounds, so
+        // keep the loop there. All other combinations copy data only.
+        if( ASRUtils::extract_physical_type(target_type) ==
+                ASR::array_physical_typeType::DescriptorArray &&
+            ASRUtils::extract_physical_type(value_type) ==
+                ASR::array_physical_typeType::DescriptorArray ) {
+            return false;
+        }
+        return true;
+    }
+
     bool is_looping_necessary_for_bitcast(ASR::expr_t* value) {
         if (ASR::is_a<ASR::BitCast_t>(*value)) {
             ASR::BitCast_t* bit_cast = ASR::down_cast<ASR::BitCast_t>(value);
@@ -1558,6 +1649,22 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
             return ;
         }
 
+        // A constant table assigned whole to a matching fixed-size array
+        // must not be re-scalarised: the backend materialises the
+        // ArrayConstant as a read-only constant global and copies it with
+        // one flat memcpy, which per-element ArrayItem stores would defeat.
+        if (x.m_overloaded == nullptr &&
+            ASR::is_a<ASR::ArrayConstant_t>(*xx.m_value) &&
+            PassUtils::can_memcpy_array_constant(xx.m_target,
+                ASR::down_cast<ASR::ArrayConstant_t>(xx.m_value))) {
+            ASR::stmt_t* stmt = ASRUtils::STMT(ASRUtils::make_Assignment_t_util(al, loc,
+                xx.m_target, xx.m_value, xx.m_overloaded,
+                xx.m_realloc_lhs, xx.m_move_allocation));
+            pass_result.push_back(al, stmt);
+            debug_inserted.insert(ASR::down_cast<ASR::Assignment_t>(stmt));
+            return;
+        }
+
         if( call_replace_on_expr(xx.m_value->type) ||
             ASR::is_a<ASR::ImpliedDoLoop_t>(*xx.m_value) ) {
             if (ASR::is_a<ASR::ImpliedDoLoop_t>(*xx.m_value)) {
@@ -1705,6 +1812,21 @@ class ArrayOpVisitor: public ASR::CallReplacerOnExpressionsVisitor<ArrayOpVisito
             return;
         }
 
+        // Whole-array copies between distinct contiguous arrays don't need
+        // an element-wise loop either; leave them for the backend, which
+        // copies the data with one flat memcpy. The two arrays cannot
+        // overlap: they are different non-pointer variables, and the
+        // standard forbids assigning through aliased dummy arguments.
+        if (x.m_overloaded == nullptr &&
+            is_whole_array_copy(xx.m_target, xx.m_value)) {
+            ASR::stmt_t* stmt = ASRUtils::STMT(ASRUtils::make_Assignment_t_util(al, loc,
+                xx.m_target, xx.m_value, xx.m_overloaded,
+                xx.m_realloc_lhs, xx.m_move_allocation));
+            pass_result.push_back(al, stmt);
+            debug_inserted.insert(ASR::down_cast<ASR::Assignment_t>(stmt));
+            return;
+        }
+
         if (ASR::is_a<ASR::BitCast_t>(*xx.m_value)) {
             ASR::BitCast_t* bc = ASR::down_cast<ASR::BitCast_t>(xx.m_value);
             ASR::ttype_t* src_type = ASRUtils::expr_type(bc->m_source);
@@ -835,15 +835,21 @@ bool set_allocation_size(
                         allocate_dim.m_length = b.ArraySize(intrinsic_array_function->m_args[1], b.i32(2), ASRUtils::expr_type(int32_one));
                         allocate_dims.push_back(al, allocate_dim);
                     } else if (n_dims_a == 2 && n_dims_b == 2) {
-                        // matrix multiplication of a matrix and a matrix is a matrix
+                        // matrix multiplication of a matrix and a matrix is a matrix;
+                        // overload ids 4-6 mark operands whose transpose() was folded
+                        // into the matmul, so the result extent comes from the other
+                        // dimension of that operand
+                        int64_t matmul_overload = intrinsic_array_function->m_overload_id;
+                        int rows_dim = (matmul_overload == 4 || matmul_overload == 6) ? 2 : 1;
+                        int cols_dim = (matmul_overload == 5 || matmul_overload == 6) ? 1 : 2;
                         allocate_dims.reserve(al, 2);
                         ASR::dimension_t allocate_dim1, allocate_dim2;
                         allocate_dim1.loc = loc;
                         allocate_dim1.m_start = int32_one;
-                        allocate_dim1.m_length = b.ArraySize(intrinsic_array_function->m_args[0], b.i32(1), ASRUtils::expr_type(int32_one));
+                        allocate_dim1.m_length = b.ArraySize(intrinsic_array_function->m_args[0], b.i32(rows_dim), ASRUtils::expr_type(int32_one));
                         allocate_dim2.loc = loc;
                         allocate_dim2.m_start = int32_one;
-                        allocate_dim2.m_length = b.ArraySize(intrinsic_array_function->m_args[1], b.i32(2), ASRUtils::expr_type(int32_one));
+                        allocate_dim2.m_length = b.ArraySize(intrinsic_array_function->m_args[1], b.i32(cols_dim), ASRUtils::expr_type(int32_one));
                         allocate_dims.push_back(al, allocate_dim1);
                         allocate_dims.push_back(al, allocate_dim2);
                     }
@@ -1101,15 +1107,22 @@ void transform_stmts_impl(Allocator& al, ASR::stmt_t**& m_body, size_t& n_body,
             visit_stmt(*m_body[i]);
         }
     } else {
+        // `inserted_stmts` collects the temporaries generated while visiting
+        // one statement; they are spliced in front of it in a single sweep
         Vec<ASR::stmt_t*>* current_body_copy = current_body;
-        Vec<ASR::stmt_t*> current_body_vec; current_body_vec.reserve(al, 1);
-        current_body_vec.reserve(al, n_body);
-        current_body = &current_body_vec;
+        Vec<ASR::stmt_t*> inserted_stmts; inserted_stmts.reserve(al, 1);
+        current_body = &inserted_stmts;
+        VecRewriter<ASR::stmt_t*> body;
+        body.start(m_body, n_body);
         for (size_t i = 0; i < n_body; i++) {
+            inserted_stmts.n = 0;
             visit_stmt(*m_body[i]);
-            current_body->push_back(al, m_body[i]);
+            for (size_t j = 0; j < inserted_stmts.size(); j++) {
+                body.insert(al, inserted_stmts[j]);
+            }
+            body.keep(al);
         }
-        m_body = current_body_vec.p; n_body = current_body_vec.size();
+        body.finish(m_body, n_body);
         current_body = current_body_copy;
     }
 }
@@ -1573,6 +1586,19 @@ class ArgSimplifier: public ASR::CallReplacerOnExpressionsVisitor<ArgSimplifier>
                     std::string name_hint = "_assignment_";
                     ASR::expr_t* array_var_temporary = call_create_and_allocate_temporary_variable(xx.m_value, al, current_body, name_hint, current_scope, exprs_with_target);
                     xx.m_value = array_var_temporary;
+                    if (ASRUtils::is_allocatable(xx.m_value) && !xx.m_overloaded) {
+                        // The temporary now owns the only copy of the RHS, so
+                        // steal its allocation instead of copying it a second
+                        // time (the same way subroutine_from_function moves
+                        // function results). The move only overwrites the data
+                        // pointer, so free the target's old buffer first.
+                        Vec<ASR::expr_t*> dealloc_vars;
+                        dealloc_vars.reserve(al, 1);
+                        dealloc_vars.push_back(al, xx.m_target);
+                        current_body->push_back(al, ASRUtils::STMT(ASR::make_ImplicitDeallocate_t(
+                            al, xx.base.base.loc, dealloc_vars.p, dealloc_vars.size())));
+                        xx.m_move_allocation = true;
+                    }
                 }
             }
         }
@@ -2548,20 +2574,27 @@ class ReplaceExprWithTemporaryVisitor:
             return;
         }
         Vec<ASR::stmt_t*>* current_body_copy = current_body;
-        Vec<ASR::stmt_t*> current_body_vec;
-        current_body_vec.reserve(al, n_body);
-        current_body = &current_body_vec;
+        Vec<ASR::stmt_t*> inserted_stmts;
+        inserted_stmts.reserve(al, 1);
+        current_body = &inserted_stmts;
+        VecRewriter<ASR::stmt_t*> body;
+        body.start(m_body, n_body);
         for (size_t i = 0; i < n_body; i++) {
+            inserted_stmts.n = 0;
             forall_replacement = nullptr;
             visit_stmt(*m_body[i]);
+            for (size_t j = 0; j < inserted_stmts.size(); j++) {
+                body.insert(al, inserted_stmts[j]);
+            }
             if (forall_replacement) {
-                current_body->push_back(al, forall_replacement);
+                body.insert(al, forall_replacement);
+                body.skip(al);
                 forall_replacement = nullptr;
             } else {
-                current_body->push_back(al, m_body[i]);
+                body.keep(al);
             }
         }
-        m_body = current_body_vec.p; n_body = current_body_vec.size();
+        body.finish(m_body, n_body);
         current_body = current_body_copy;
     }
 
@@ -2759,6 +2792,24 @@ class ReplaceExprWithTemporaryVisitor:
             is_self_ref_allocatable_array ) {
             replacer.force_replace_current_expr_for_array(current_expr, "_assignment_value_", al, current_body, current_scope,
                                                 exprs_with_target, is_assignment_target_array_section_item);
+            if( is_self_ref_allocatable_array && !x.m_overloaded &&
+                x.m_realloc_lhs &&
+                ASR::is_a<ASR::Var_t>(**current_expr) &&
+                ASRUtils::is_allocatable(*current_expr) ) {
+                // The RHS is now an allocatable temporary owned solely by this
+                // assignment, so its allocation can be transferred into the
+                // target instead of allocate-copy-deallocate. The move only
+                // overwrites the data pointer, so release the target's old
+                // buffer first. Without realloc-lhs semantics the assignment
+                // must keep the plain copy: the move would bypass the runtime
+                // allocation-status and shape checks on the target.
+                Vec<ASR::expr_t*> dealloc_vars;
+                dealloc_vars.reserve(al, 1);
+                dealloc_vars.push_back(al, const_cast<ASR::expr_t*>(x.m_target));
+                current_body->push_back(al, ASRUtils::STMT(ASR::make_ImplicitDeallocate_t(
+                    al, x.base.base.loc, dealloc_vars.p, dealloc_vars.size())));
+                const_cast<ASR::Assignment_t&>(x).m_move_allocation = true;
+            }
         }
         current_expr = current_expr_copy_9;
         replacer.is_simd_expression = is_simd_expr_copy;
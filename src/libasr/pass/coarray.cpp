@@ -0,0 +1,146 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/exception.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_builder.h>
+#include <libasr/pass/coarray.h>
+#include <libasr/pass/stmt_walk_visitor.h>
+#include <libasr/pass/intrinsic_function_registry.h>
+
+namespace LCompilers {
+
+/*
+ * This ASR pass lowers the coarray image-control statements and image
+ * inquiries onto the `_lfortran_caf_*` runtime shims (serial by default,
+ * MPI-backed when the runtime is built WITH_RUNTIME_MPI):
+ *
+ *     sync all     -> call _lfortran_caf_sync_all()
+ *     sync memory  -> call _lfortran_caf_sync_memory()
+ *     this_image() -> _lfortran_caf_this_image()
+ *     num_images() -> _lfortran_caf_num_images()
+ *
+ * The pass only runs under --coarray; without it the backends keep the
+ * single-image behavior (syncs are no-ops, image inquiries fold to 1).
+ * CoarrayRef coindices still address the local image only: routing
+ * remote [img] references through the _lfortran_caf_get/put RMA shims
+ * requires placing coarrays in registered windows at allocation time,
+ * which is not implemented yet.
+ */
+
+static ASR::symbol_t* get_caf_subroutine(Allocator &al, const Location &loc,
+        SymbolTable &global_scope, const std::string &name) {
+    if (ASR::symbol_t* s = global_scope.get_symbol(name)) {
+        return s;
+    }
+    ASRUtils::ASRBuilder b(al, loc);
+    Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 1);
+    std::string name_ = name;
+    ASR::symbol_t* s = b.create_c_subroutine_interface(name_, &global_scope,
+        param_types, {}, {});
+    global_scope.add_symbol(name, s);
+    return s;
+}
+
+static ASR::symbol_t* get_caf_function(Allocator &al, const Location &loc,
+        SymbolTable &global_scope, const std::string &name,
+        ASR::ttype_t* return_type) {
+    if (ASR::symbol_t* s = global_scope.get_symbol(name)) {
+        return s;
+    }
+    ASRUtils::ASRBuilder b(al, loc);
+    Vec<ASR::ttype_t*> arg_types; arg_types.reserve(al, 1);
+    ASR::symbol_t* s = b.create_c_func(name, &global_scope, return_type,
+        0, arg_types);
+    global_scope.add_symbol(name, s);
+    return s;
+}
+
+class CoarrayStatementVisitor : public ASR::StatementWalkVisitor<CoarrayStatementVisitor>
+{
+    private:
+
+    SymbolTable& global_scope;
+
+    public:
+
+    CoarrayStatementVisitor(Allocator &al, SymbolTable &global_scope_) :
+        StatementWalkVisitor(al), global_scope(global_scope_) {}
+
+    void replace_with_runtime_call(const Location &loc, const std::string &name) {
+        ASR::symbol_t* s = get_caf_subroutine(al, loc, global_scope, name);
+        Vec<ASR::stmt_t*> result; result.reserve(al, 1);
+        result.push_back(al, ASRUtils::STMT(ASRUtils::make_SubroutineCall_t_util(
+            al, loc, s, s, nullptr, 0, nullptr, nullptr, false)));
+        pass_result = result;
+    }
+
+    void visit_SyncAll(const ASR::SyncAll_t &x) {
+        replace_with_runtime_call(x.base.base.loc, "_lfortran_caf_sync_all");
+    }
+
+    void visit_SyncMemory(const ASR::SyncMemory_t &x) {
+        replace_with_runtime_call(x.base.base.loc, "_lfortran_caf_sync_memory");
+    }
+};
+
+class ReplaceImageInquiry : public ASR::BaseExprReplacer<ReplaceImageInquiry>
+{
+    private:
+
+    Allocator& al;
+    SymbolTable& global_scope;
+
+    public:
+
+    ReplaceImageInquiry(Allocator &al_, SymbolTable &global_scope_) :
+        al(al_), global_scope(global_scope_) {}
+
+    void replace_IntrinsicElementalFunction(ASR::IntrinsicElementalFunction_t* x) {
+        std::string name;
+        if (x->m_intrinsic_id == static_cast<int64_t>(
+                ASRUtils::IntrinsicElementalFunctions::ThisImage)) {
+            name = "_lfortran_caf_this_image";
+        } else if (x->m_intrinsic_id == static_cast<int64_t>(
+                ASRUtils::IntrinsicElementalFunctions::NumImages)) {
+            name = "_lfortran_caf_num_images";
+        } else {
+            return;
+        }
+        // The semantics fold these to 1 (their single-image value), so the
+        // folded m_value is deliberately ignored here.
+        ASR::symbol_t* s = get_caf_function(al, x->base.base.loc, global_scope,
+            name, x->m_type);
+        *current_expr = ASRUtils::EXPR(ASRUtils::make_FunctionCall_t_util(
+            al, x->base.base.loc, s, s, nullptr, 0, x->m_type, nullptr, nullptr));
+    }
+};
+
+class CoarrayExpressionVisitor : public ASR::CallReplacerOnExpressionsVisitor<CoarrayExpressionVisitor>
+{
+    private:
+
+    ReplaceImageInquiry replacer;
+
+    public:
+
+    CoarrayExpressionVisitor(Allocator &al, SymbolTable &global_scope) :
+        replacer(al, global_scope) {}
+
+    void call_replacer() {
+        replacer.current_expr = current_expr;
+        replacer.replace_expr(*current_expr);
+    }
+};
+
+void pass_lower_coarray(Allocator &al, ASR::TranslationUnit_t &unit,
+                        const PassOptions &pass_options) {
+    if (!pass_options.coarray) {
+        return;
+    }
+    CoarrayStatementVisitor v(al, *unit.m_symtab);
+    v.visit_TranslationUnit(unit);
+    CoarrayExpressionVisitor u(al, *unit.m_symtab);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
@@ -0,0 +1,42 @@
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/serialization.h>
+#include <libasr/pass/compact_asr.h>
+
+namespace LCompilers {
+
+/*
+
+This pass relocates the whole ASR tree into a fresh, contiguous,
+traversal-ordered region of the arena. After semantics and earlier
+passes the live nodes are interleaved with abandoned intermediate
+allocations, so tree walks in later passes and codegen are cache-miss
+bound. Round-tripping through the ASR serializer produces a copy laid
+out in exactly the order the deserializer (and hence every visitor)
+walks it, and reuses the serializer's existing pointer-fixup machinery
+(symbol table reconnection and external-symbol resolution) instead of a
+separate relocation API.
+
+The pass is opt-in (run it via `--pass compact_asr`, typically late in
+the pipeline); it trades one serialize/deserialize of the tree for
+better locality in everything that runs afterwards.
+
+*/
+void pass_compact_asr(Allocator &al, ASR::TranslationUnit_t &unit,
+                      const PassOptions &/*pass_options*/) {
+    std::string binary = serialize(unit);
+    ASR::asr_t *asr = deserialize_asr(al, binary, true, 0);
+    ASR::TranslationUnit_t *tu = ASR::down_cast2<ASR::TranslationUnit_t>(asr);
+    // ExternalSymbols are resolved against the fresh global scope; the
+    // unit is self-contained at this point, so everything resolves
+    // internally
+    fix_external_symbols(*tu, *tu->m_symtab);
+    // Relink the contiguous copy into the original node, so existing
+    // references to `unit` itself stay valid
+    unit.m_symtab = tu->m_symtab;
+    unit.m_items = tu->m_items;
+    unit.n_items = tu->n_items;
+    unit.m_symtab->asr_owner = (ASR::asr_t*)&unit;
+}
+
+} // namespace LCompilers
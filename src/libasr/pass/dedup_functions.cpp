@@ -0,0 +1,211 @@
+#include <cctype>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_pickle_visitor.h>
+#include <libasr/pass/dedup_functions.h>
+#include <libasr/pass/pass_utils.h>
+
+namespace LCompilers {
+
+/*
+
+This pass detects structurally identical function implementations within
+the same scope and rewires every call of a duplicate to one canonical
+function, so code generators lower each distinct body once. Generated
+interface layers commonly contain thousands of near-duplicate accessors
+with only a few hundred unique bodies.
+
+Bodies are compared by a canonical pickle of the whole function node:
+symbol-table counters and the function's own name (which also names the
+default result variable) are masked, references to symbols local to the
+function compare by name, and references to anything outside the
+function compare by symbol identity, so two functions only match when
+they do exactly the same thing to exactly the same globals.
+
+The pass only redirects call sites; the duplicate definitions stay in
+their scope so ExternalSymbols in other modules remain valid. Run
+`unused_functions` afterwards to drop the bodies that are no longer
+referenced. The pass is opt-in (`--pass dedup_functions`).
+
+*/
+
+namespace {
+
+class FunctionKeyVisitor : public ASR::PickleBaseVisitor<FunctionKeyVisitor> {
+public:
+    SymbolTable *fn_scope = nullptr;
+
+    // The key is never shown to a user; the raw intrinsic ids are stable
+    // and unambiguous
+    std::string convert_intrinsic_id(int x) {
+        return std::to_string(x);
+    }
+    std::string convert_sub_intrinsic_id(int x) {
+        return std::to_string(x);
+    }
+    std::string convert_impure_intrinsic_id(int x) {
+        return std::to_string(x);
+    }
+    std::string convert_array_intrinsic_id(int x) {
+        return std::to_string(x);
+    }
+
+    // Symbol references: local symbols compare by name, everything
+    // outside the function by identity
+    void visit_symbol(const ASR::symbol_t &x) {
+        SymbolTable *owner = ASRUtils::symbol_parent_symtab(&x);
+        bool local = false;
+        for (SymbolTable *t = owner; t != nullptr; t = t->parent) {
+            if (t == fn_scope) {
+                local = true;
+                break;
+            }
+        }
+        if (local) {
+            s.append(".");
+        } else {
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "@%p:", (const void*) &x);
+            s.append(buf);
+        }
+        s.append(ASRUtils::symbol_name(&x));
+    }
+};
+
+// Symbol-table counters are allocation order, not structure; mask the
+// digits that follow the "SymbolTable " tag in the pickle
+std::string mask_symtab_counters(const std::string &s) {
+    const std::string tag = "SymbolTable ";
+    std::string out;
+    out.reserve(s.size());
+    size_t i = 0;
+    while (i < s.size()) {
+        if (s.compare(i, tag.size(), tag) == 0) {
+            out.append(tag);
+            i += tag.size();
+            while (i < s.size()
+                    && std::isdigit(static_cast<unsigned char>(s[i]))) {
+                i++;
+            }
+            out.push_back('_');
+        } else {
+            out.push_back(s[i]);
+            i++;
+        }
+    }
+    return out;
+}
+
+// Replaces whole-token occurrences of `name` (the function's own name,
+// which also appears as its default result variable) with a placeholder
+std::string mask_name(const std::string &s, const std::string &name) {
+    auto is_name_char = [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    };
+    std::string out;
+    out.reserve(s.size());
+    size_t i = 0;
+    while (i < s.size()) {
+        if (s.compare(i, name.size(), name) == 0
+                && (i == 0 || !is_name_char(s[i - 1]))
+                && (i + name.size() == s.size()
+                    || !is_name_char(s[i + name.size()]))) {
+            out.push_back('~');
+            i += name.size();
+        } else {
+            out.push_back(s[i]);
+            i++;
+        }
+    }
+    return out;
+}
+
+std::string function_body_key(ASR::Function_t *fn) {
+    FunctionKeyVisitor v;
+    v.fn_scope = fn->m_symtab;
+    v.visit_Function(*fn);
+    return mask_name(mask_symtab_counters(v.s), fn->m_name);
+}
+
+bool is_dedup_candidate(ASR::Function_t *fn) {
+    ASR::FunctionType_t *type = ASRUtils::get_FunctionType(fn);
+    return type->m_deftype == ASR::deftypeType::Implementation
+        && type->m_abi == ASR::abiType::Source
+        && fn->n_body > 0;
+}
+
+class RewireCallsVisitor : public ASR::BaseWalkVisitor<RewireCallsVisitor> {
+    const std::map<ASR::symbol_t*, ASR::symbol_t*> &replacement;
+
+public:
+    RewireCallsVisitor(
+        const std::map<ASR::symbol_t*, ASR::symbol_t*> &replacement)
+        : replacement{replacement} {}
+
+    void visit_FunctionCall(const ASR::FunctionCall_t &x) {
+        auto it = replacement.find(x.m_name);
+        if (it != replacement.end()) {
+            const_cast<ASR::FunctionCall_t&>(x).m_name = it->second;
+        }
+        ASR::BaseWalkVisitor<RewireCallsVisitor>::visit_FunctionCall(x);
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t &x) {
+        auto it = replacement.find(x.m_name);
+        if (it != replacement.end()) {
+            const_cast<ASR::SubroutineCall_t&>(x).m_name = it->second;
+        }
+        ASR::BaseWalkVisitor<RewireCallsVisitor>::visit_SubroutineCall(x);
+    }
+};
+
+} // anonymous namespace
+
+void pass_dedup_functions(Allocator &al, ASR::TranslationUnit_t &unit,
+                          const PassOptions &/*pass_options*/) {
+    std::vector<SymbolTable*> scopes;
+    scopes.push_back(unit.m_symtab);
+    for (auto &item : unit.m_symtab->get_scope()) {
+        if (ASR::is_a<ASR::Module_t>(*item.second)) {
+            scopes.push_back(ASR::down_cast<ASR::Module_t>(item.second)->m_symtab);
+        } else if (ASR::is_a<ASR::Program_t>(*item.second)) {
+            scopes.push_back(ASR::down_cast<ASR::Program_t>(item.second)->m_symtab);
+        }
+    }
+
+    std::map<ASR::symbol_t*, ASR::symbol_t*> replacement;
+    for (SymbolTable *scope : scopes) {
+        std::map<std::string, ASR::symbol_t*> canonical;
+        for (auto &item : scope->get_scope()) {
+            if (!ASR::is_a<ASR::Function_t>(*item.second)) {
+                continue;
+            }
+            ASR::Function_t *fn = ASR::down_cast<ASR::Function_t>(item.second);
+            if (!is_dedup_candidate(fn)) {
+                continue;
+            }
+            std::string key = function_body_key(fn);
+            auto it = canonical.find(key);
+            if (it == canonical.end()) {
+                canonical.emplace(std::move(key), item.second);
+            } else {
+                replacement[item.second] = it->second;
+            }
+        }
+    }
+    if (replacement.empty()) {
+        return;
+    }
+
+    RewireCallsVisitor v(replacement);
+    v.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
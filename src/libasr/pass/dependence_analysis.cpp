@@ -0,0 +1,342 @@
+#include <algorithm>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/dependence_analysis.h>
+
+namespace LCompilers {
+
+namespace DependenceAnalysis {
+
+/*
+
+Shared dependence analysis for loop transformations. Subscripts are
+classified as affine functions of a single induction variable
+(coeff*var + constant); pairs of accesses to the same base are then
+compared with a per-dimension SIV test that yields a direction for each
+loop of the nest. Everything the analysis cannot prove is reported
+conservatively (Direction::Any or analyzable = false), so callers can
+only ever be stopped from transforming, never misled into an illegal
+transformation.
+
+*/
+
+AffineSubscript extract_affine_subscript(ASR::expr_t* expr,
+        const std::vector<ASR::symbol_t*>& loop_vars) {
+    AffineSubscript result;
+    if( expr == nullptr ) {
+        return result;
+    }
+    if( ASR::is_a<ASR::IntegerConstant_t>(*expr) ) {
+        result.affine = true;
+        result.constant = ASR::down_cast<ASR::IntegerConstant_t>(expr)->m_n;
+        return result;
+    } else if( ASR::is_a<ASR::Var_t>(*expr) ) {
+        ASR::symbol_t* sym = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(expr)->m_v);
+        if( std::find(loop_vars.begin(), loop_vars.end(), sym)
+                != loop_vars.end() ) {
+            result.affine = true;
+            result.loop_var = sym;
+            result.coeff = 1;
+        }
+        return result;
+    } else if( ASR::is_a<ASR::IntegerBinOp_t>(*expr) ) {
+        ASR::IntegerBinOp_t* binop = ASR::down_cast<ASR::IntegerBinOp_t>(expr);
+        AffineSubscript left = extract_affine_subscript(binop->m_left, loop_vars);
+        AffineSubscript right = extract_affine_subscript(binop->m_right, loop_vars);
+        if( !left.affine || !right.affine ) {
+            return result;
+        }
+        if( binop->m_op == ASR::binopType::Add ||
+            binop->m_op == ASR::binopType::Sub ) {
+            int64_t sign = binop->m_op == ASR::binopType::Add ? 1 : -1;
+            if( left.loop_var && right.loop_var &&
+                left.loop_var != right.loop_var ) {
+                // MIV subscripts are out of scope
+                return result;
+            }
+            result.affine = true;
+            result.loop_var = left.loop_var ? left.loop_var : right.loop_var;
+            result.coeff = left.coeff + sign*right.coeff;
+            result.constant = left.constant + sign*right.constant;
+            if( result.coeff == 0 ) {
+                result.loop_var = nullptr;
+            }
+            return result;
+        } else if( binop->m_op == ASR::binopType::Mul ) {
+            // One side must be a pure constant
+            AffineSubscript* scale = nullptr;
+            AffineSubscript* term = nullptr;
+            if( left.loop_var == nullptr ) {
+                scale = &left; term = &right;
+            } else if( right.loop_var == nullptr ) {
+                scale = &right; term = &left;
+            } else {
+                return result;
+            }
+            result.affine = true;
+            result.loop_var = term->loop_var;
+            result.coeff = term->coeff * scale->constant;
+            result.constant = term->constant * scale->constant;
+            if( result.coeff == 0 ) {
+                result.loop_var = nullptr;
+            }
+            return result;
+        }
+        return result;
+    } else if( ASR::is_a<ASR::IntegerUnaryMinus_t>(*expr) ) {
+        AffineSubscript arg = extract_affine_subscript(
+            ASR::down_cast<ASR::IntegerUnaryMinus_t>(expr)->m_arg, loop_vars);
+        if( arg.affine ) {
+            result = arg;
+            result.coeff = -result.coeff;
+            result.constant = -result.constant;
+        }
+        return result;
+    } else if( ASR::is_a<ASR::Cast_t>(*expr) ) {
+        return extract_affine_subscript(
+            ASR::down_cast<ASR::Cast_t>(expr)->m_arg, loop_vars);
+    }
+    return result;
+}
+
+namespace {
+
+class AccessCollector: public ASR::BaseWalkVisitor<AccessCollector> {
+
+    public:
+
+    AccessSet& set;
+    const std::vector<ASR::symbol_t*>& loop_vars;
+
+    AccessCollector(AccessSet& set_,
+        const std::vector<ASR::symbol_t*>& loop_vars_):
+        set(set_), loop_vars(loop_vars_) {}
+
+    bool is_loop_var(ASR::symbol_t* sym) {
+        return std::find(loop_vars.begin(), loop_vars.end(), sym)
+            != loop_vars.end();
+    }
+
+    void record_array_access(ASR::ArrayItem_t* array_ref, bool is_write) {
+        if( !ASR::is_a<ASR::Var_t>(*array_ref->m_v) ) {
+            set.analyzable = false;
+            return ;
+        }
+        ArrayAccess access;
+        access.base = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(array_ref->m_v)->m_v);
+        access.is_write = is_write;
+        for( size_t i = 0; i < array_ref->n_args; i++ ) {
+            if( array_ref->m_args[i].m_left || array_ref->m_args[i].m_step ) {
+                set.analyzable = false;
+                return ;
+            }
+            access.subscripts.push_back(extract_affine_subscript(
+                array_ref->m_args[i].m_right, loop_vars));
+        }
+        set.accesses.push_back(access);
+    }
+
+    void record_base_access(ASR::symbol_t* sym, bool is_write) {
+        sym = ASRUtils::symbol_get_past_external(sym);
+        if( is_loop_var(sym) ) {
+            return ;
+        }
+        ArrayAccess access;
+        access.base = sym;
+        access.is_write = is_write;
+        set.accesses.push_back(access);
+    }
+
+    void record_write_target(ASR::expr_t* target) {
+        if( ASR::is_a<ASR::Var_t>(*target) ) {
+            record_base_access(ASR::down_cast<ASR::Var_t>(target)->m_v, true);
+        } else if( ASR::is_a<ASR::ArrayItem_t>(*target) ) {
+            ASR::ArrayItem_t* array_ref = ASR::down_cast<ASR::ArrayItem_t>(target);
+            record_array_access(array_ref, true);
+            // Subscripts themselves are reads
+            for( size_t i = 0; i < array_ref->n_args; i++ ) {
+                if( array_ref->m_args[i].m_right ) {
+                    visit_expr(*array_ref->m_args[i].m_right);
+                }
+            }
+        } else if( ASR::is_a<ASR::ArraySection_t>(*target) ) {
+            ASR::ArraySection_t* section = ASR::down_cast<ASR::ArraySection_t>(target);
+            if( ASR::is_a<ASR::Var_t>(*section->m_v) ) {
+                // Whole-section write: conflicts with everything
+                record_base_access(ASR::down_cast<ASR::Var_t>(section->m_v)->m_v, true);
+            } else {
+                set.analyzable = false;
+            }
+        } else {
+            set.analyzable = false;
+        }
+    }
+
+    void visit_Assignment(const ASR::Assignment_t& x) {
+        record_write_target(x.m_target);
+        visit_expr(*x.m_value);
+    }
+
+    void visit_ArrayItem(const ASR::ArrayItem_t& x) {
+        record_array_access(const_cast<ASR::ArrayItem_t*>(&x), false);
+        for( size_t i = 0; i < x.n_args; i++ ) {
+            if( x.m_args[i].m_right ) {
+                visit_expr(*x.m_args[i].m_right);
+            }
+        }
+    }
+
+    void visit_Var(const ASR::Var_t& x) {
+        record_base_access(x.m_v, false);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t& x) {
+        // An inner loop not part of the analyzed nest writes its own
+        // induction variable
+        if( x.m_head.m_v && ASR::is_a<ASR::Var_t>(*x.m_head.m_v) ) {
+            record_base_access(ASR::down_cast<ASR::Var_t>(x.m_head.m_v)->m_v, true);
+        }
+        ASR::BaseWalkVisitor<AccessCollector>::visit_DoLoop(x);
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t& /*x*/) {
+        set.analyzable = false;
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t& /*x*/) {
+        set.analyzable = false;
+    }
+
+    void visit_Allocate(const ASR::Allocate_t& /*x*/) { set.analyzable = false; }
+    void visit_ExplicitDeallocate(const ASR::ExplicitDeallocate_t& /*x*/) { set.analyzable = false; }
+    void visit_ImplicitDeallocate(const ASR::ImplicitDeallocate_t& /*x*/) { set.analyzable = false; }
+    void visit_Associate(const ASR::Associate_t& /*x*/) { set.analyzable = false; }
+    void visit_FileRead(const ASR::FileRead_t& /*x*/) { set.analyzable = false; }
+    void visit_GoTo(const ASR::GoTo_t& /*x*/) { set.analyzable = false; }
+
+};
+
+} // anonymous namespace
+
+AccessSet collect_array_accesses(ASR::stmt_t** body, size_t n_body,
+        const std::vector<ASR::symbol_t*>& loop_vars) {
+    AccessSet set;
+    AccessCollector collector(set, loop_vars);
+    for( size_t i = 0; i < n_body; i++ ) {
+        collector.visit_stmt(*body[i]);
+    }
+    return set;
+}
+
+Direction test_dependence(const ArrayAccess& a, const ArrayAccess& b,
+        ASR::symbol_t* loop_var) {
+    if( a.base != b.base ) {
+        return Direction::None;
+    }
+    if( a.subscripts.size() != b.subscripts.size() ) {
+        // Scalar or whole-array access against anything: conservatively
+        // every iteration conflicts
+        return Direction::Any;
+    }
+    bool have_direction = false;
+    Direction direction = Direction::Any;
+    for( size_t d = 0; d < a.subscripts.size(); d++ ) {
+        const AffineSubscript& s1 = a.subscripts[d];
+        const AffineSubscript& s2 = b.subscripts[d];
+        if( !s1.affine || !s2.affine ) {
+            continue;
+        }
+        if( s1.loop_var == nullptr && s2.loop_var == nullptr ) {
+            if( s1.constant != s2.constant ) {
+                // Distinct constant subscripts can never overlap
+                return Direction::None;
+            }
+            continue;
+        }
+        if( s1.loop_var != loop_var || s2.loop_var != loop_var ) {
+            // Constrained by a different loop (or mixed); no direction
+            // information for this one
+            continue;
+        }
+        if( s1.coeff != s2.coeff || s1.coeff == 0 ) {
+            continue;
+        }
+        // coeff*i1 + c1 == coeff*i2 + c2  =>  i1 - i2 = (c2 - c1)/coeff
+        int64_t diff = s2.constant - s1.constant;
+        if( diff % s1.coeff != 0 ) {
+            return Direction::None;
+        }
+        int64_t distance = diff / s1.coeff;
+        Direction dim_direction = distance == 0 ? Direction::Equal :
+            (distance > 0 ? Direction::Less : Direction::Greater);
+        if( have_direction && direction != dim_direction ) {
+            // Two dimensions demand contradictory iteration distances
+            return Direction::None;
+        }
+        direction = dim_direction;
+        have_direction = true;
+    }
+    return direction;
+}
+
+bool loop_carries_dependence(const AccessSet& set, ASR::symbol_t* loop_var) {
+    if( !set.analyzable ) {
+        return true;
+    }
+    for( size_t i = 0; i < set.accesses.size(); i++ ) {
+        for( size_t j = 0; j < set.accesses.size(); j++ ) {
+            if( !set.accesses[i].is_write && !set.accesses[j].is_write ) {
+                continue;
+            }
+            Direction direction = test_dependence(set.accesses[i],
+                set.accesses[j], loop_var);
+            if( direction == Direction::Less ||
+                direction == Direction::Greater ||
+                direction == Direction::Any ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool can_interchange(const AccessSet& set, ASR::symbol_t* outer,
+        ASR::symbol_t* inner) {
+    if( !set.analyzable ) {
+        return false;
+    }
+    for( size_t i = 0; i < set.accesses.size(); i++ ) {
+        for( size_t j = 0; j < set.accesses.size(); j++ ) {
+            if( !set.accesses[i].is_write && !set.accesses[j].is_write ) {
+                continue;
+            }
+            Direction outer_direction = test_dependence(set.accesses[i],
+                set.accesses[j], outer);
+            if( outer_direction == Direction::None ) {
+                continue;
+            }
+            Direction inner_direction = test_dependence(set.accesses[i],
+                set.accesses[j], inner);
+            if( inner_direction == Direction::None ) {
+                continue;
+            }
+            // Interchange reverses a (Less, Greater) dependence, which is
+            // illegal; Any may hide either component
+            bool outer_less = outer_direction == Direction::Less ||
+                outer_direction == Direction::Any;
+            bool inner_greater = inner_direction == Direction::Greater ||
+                inner_direction == Direction::Any;
+            if( outer_less && inner_greater ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace DependenceAnalysis
+
+} // namespace LCompilers
@@ -0,0 +1,85 @@
+#ifndef LIBASR_PASS_DEPENDENCE_ANALYSIS_H
+#define LIBASR_PASS_DEPENDENCE_ANALYSIS_H
+
+#include <vector>
+
+#include <libasr/asr.h>
+
+namespace LCompilers {
+
+namespace DependenceAnalysis {
+
+    // Direction of a dependence with respect to one loop variable:
+    // None     - the two accesses can never touch the same element
+    // Equal    - only within the same iteration
+    // Less     - from an earlier iteration to a later one
+    // Greater  - from a later iteration to an earlier one
+    // Any      - unknown; all directions must be assumed
+    enum class Direction {
+        None,
+        Equal,
+        Less,
+        Greater,
+        Any
+    };
+
+    // A subscript of the form coeff*loop_var + constant. loop_var is
+    // nullptr for pure constants; affine is false when the expression
+    // could not be brought into this form
+    struct AffineSubscript {
+        ASR::symbol_t* loop_var = nullptr;
+        int64_t coeff = 0;
+        int64_t constant = 0;
+        bool affine = false;
+    };
+
+    // One read or write of a variable inside a loop nest. Scalar and
+    // whole-array accesses have no subscripts and conservatively conflict
+    // with every other access to the same base in every iteration
+    struct ArrayAccess {
+        ASR::symbol_t* base = nullptr;
+        std::vector<AffineSubscript> subscripts;
+        bool is_write = false;
+    };
+
+    // All accesses of a loop body. When `analyzable` is false (calls,
+    // unrecognized assignment targets), no transformation may rely on
+    // the access list
+    struct AccessSet {
+        std::vector<ArrayAccess> accesses;
+        bool analyzable = true;
+    };
+
+    // Brings a subscript expression into coeff*loop_var + constant form
+    // with loop_var drawn from `loop_vars`; returns affine = false
+    // otherwise
+    AffineSubscript extract_affine_subscript(ASR::expr_t* expr,
+        const std::vector<ASR::symbol_t*>& loop_vars);
+
+    // Collects every access in `body`; `loop_vars` are the induction
+    // variables of the enclosing nest (their own updates are not
+    // recorded as accesses)
+    AccessSet collect_array_accesses(ASR::stmt_t** body, size_t n_body,
+        const std::vector<ASR::symbol_t*>& loop_vars);
+
+    // Direction of the dependence from access `a` to access `b` with
+    // respect to `loop_var` (a SIV subscript test per dimension)
+    Direction test_dependence(const ArrayAccess& a, const ArrayAccess& b,
+        ASR::symbol_t* loop_var);
+
+    // True when the loop over `loop_var` may carry a dependence between
+    // different iterations, which blocks reordering those iterations
+    bool loop_carries_dependence(const AccessSet& set,
+        ASR::symbol_t* loop_var);
+
+    // True when the two loops of a perfect nest may be legally
+    // interchanged: no dependence may have direction (Less, Greater)
+    // across (outer, inner)
+    bool can_interchange(const AccessSet& set, ASR::symbol_t* outer,
+        ASR::symbol_t* inner);
+
+} // namespace DependenceAnalysis
+
+} // namespace LCompilers
+
+#endif // LIBASR_PASS_DEPENDENCE_ANALYSIS_H
@@ -0,0 +1,220 @@
+#include <map>
+#include <set>
+#include <string>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/devirtualize.h>
+#include <libasr/pass/pass_utils.h>
+
+namespace LCompilers {
+
+/*
+
+This pass replaces indirect calls through procedure pointers with direct
+calls when the whole translation unit proves the pointer can only ever be
+associated with one procedure. An indirect call blocks inlining and every
+optimization that follows from it, so a callback that is set once and
+then invoked inside a hot loop pays the full indirect-call cost on every
+iteration.
+
+The analysis is deliberately conservative:
+
+- only procedure pointers declared locally in a function or program are
+  considered; a module-level pointer can be re-associated by code outside
+  this translation unit,
+- every `ptr => target` association in the unit must name a concrete
+  Function; association from another pointer, a struct component or
+  anything else disqualifies the pointer,
+- any other appearance of the pointer as an expression (call argument,
+  c_funloc, source of a pointer assignment, ...) lets its address escape
+  and disqualifies it.
+
+Only single-target pointers are rewritten; the call node keeps its
+arguments and merely has its callee swapped, so `inline_function_calls`
+can pick the call up later in the pipeline.
+
+*/
+
+namespace {
+
+uint64_t static get_hash(ASR::asr_t *node)
+{
+    return (uint64_t)node;
+}
+
+ASR::Variable_t *procedure_pointer(ASR::symbol_t *sym) {
+    if (sym == nullptr) {
+        return nullptr;
+    }
+    ASR::symbol_t *s = ASRUtils::symbol_get_past_external(sym);
+    if (s == nullptr || !ASR::is_a<ASR::Variable_t>(*s)) {
+        return nullptr;
+    }
+    ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(s);
+    if (ASR::is_a<ASR::FunctionType_t>(
+            *ASRUtils::type_get_past_pointer(v->m_type))) {
+        return v;
+    }
+    return nullptr;
+}
+
+class ProcPointerCollector : public ASR::BaseWalkVisitor<ProcPointerCollector> {
+public:
+    std::map<uint64_t, std::set<ASR::symbol_t*>> targets;
+    std::set<uint64_t> disqualified;
+
+    void visit_Associate(const ASR::Associate_t &x) {
+        ASR::Variable_t *v = nullptr;
+        if (ASR::is_a<ASR::Var_t>(*x.m_target)) {
+            v = procedure_pointer(ASR::down_cast<ASR::Var_t>(x.m_target)->m_v);
+        }
+        if (v == nullptr) {
+            ASR::BaseWalkVisitor<ProcPointerCollector>::visit_Associate(x);
+            return;
+        }
+        uint64_t h = get_hash((ASR::asr_t*)v);
+        if (ASR::is_a<ASR::Var_t>(*x.m_value)) {
+            ASR::symbol_t *s = ASRUtils::symbol_get_past_external(
+                ASR::down_cast<ASR::Var_t>(x.m_value)->m_v);
+            if (s != nullptr && ASR::is_a<ASR::Function_t>(*s)) {
+                targets[h].insert(s);
+                return;
+            }
+        } else if (ASR::is_a<ASR::PointerNullConstant_t>(*x.m_value)) {
+            // Disassociating the pointer adds no callable target
+            return;
+        }
+        // Associated from something we cannot enumerate (another pointer,
+        // a struct component, a function result, ...)
+        disqualified.insert(h);
+        visit_expr(*x.m_value);
+    }
+
+    // A call through the pointer references it as a symbol, not as an
+    // expression, so any Var occurrence that reaches here is an escaping
+    // use: an actual argument, c_funloc, the source of a pointer
+    // assignment, ...
+    void visit_Var(const ASR::Var_t &x) {
+        ASR::Variable_t *v = procedure_pointer(x.m_v);
+        if (v != nullptr) {
+            disqualified.insert(get_hash((ASR::asr_t*)v));
+        }
+    }
+};
+
+class DevirtualizeVisitor : public ASR::BaseWalkVisitor<DevirtualizeVisitor> {
+public:
+    Allocator &al;
+    const std::map<uint64_t, std::set<ASR::symbol_t*>> &targets;
+    const std::set<uint64_t> &disqualified;
+    SymbolTable *current_scope = nullptr;
+
+    DevirtualizeVisitor(Allocator &al,
+        const std::map<uint64_t, std::set<ASR::symbol_t*>> &targets,
+        const std::set<uint64_t> &disqualified)
+        : al{al}, targets{targets}, disqualified{disqualified} {}
+
+    void visit_Function(const ASR::Function_t &x) {
+        SymbolTable *parent_scope = current_scope;
+        current_scope = x.m_symtab;
+        ASR::BaseWalkVisitor<DevirtualizeVisitor>::visit_Function(x);
+        current_scope = parent_scope;
+    }
+
+    void visit_Program(const ASR::Program_t &x) {
+        SymbolTable *parent_scope = current_scope;
+        current_scope = x.m_symtab;
+        ASR::BaseWalkVisitor<DevirtualizeVisitor>::visit_Program(x);
+        current_scope = parent_scope;
+    }
+
+    // The unique procedure `sym` can call, or nullptr when `sym` is not a
+    // single-target procedure pointer
+    ASR::symbol_t *single_target(ASR::symbol_t *sym) {
+        ASR::Variable_t *v = procedure_pointer(sym);
+        if (v == nullptr || v->m_intent != ASR::intentType::Local) {
+            return nullptr;
+        }
+        // Only pointers owned by a function or program: module-level
+        // pointers can be re-associated by other translation units
+        ASR::asr_t *owner = v->m_parent_symtab->asr_owner;
+        if (owner == nullptr || !ASR::is_a<ASR::symbol_t>(*owner)) {
+            return nullptr;
+        }
+        ASR::symbol_t *owner_sym = ASR::down_cast<ASR::symbol_t>(owner);
+        if (!ASR::is_a<ASR::Function_t>(*owner_sym)
+                && !ASR::is_a<ASR::Program_t>(*owner_sym)) {
+            return nullptr;
+        }
+        uint64_t h = get_hash((ASR::asr_t*)v);
+        if (disqualified.count(h) > 0) {
+            return nullptr;
+        }
+        auto it = targets.find(h);
+        if (it == targets.end() || it->second.size() != 1) {
+            return nullptr;
+        }
+        return *it->second.begin();
+    }
+
+    // Make `fn` callable from current_scope, adding an ExternalSymbol if
+    // it does not already resolve there
+    ASR::symbol_t *resolve_in_scope(ASR::symbol_t *fn, const Location &loc) {
+        std::string fn_name = ASRUtils::symbol_name(fn);
+        ASR::symbol_t *local = current_scope->resolve_symbol(fn_name);
+        if (local != nullptr
+                && ASRUtils::symbol_get_past_external(local) == fn) {
+            return local;
+        }
+        std::string module_name = "";
+        SymbolTable *fn_scope = ASRUtils::symbol_parent_symtab(fn);
+        if (fn_scope->asr_owner != nullptr
+                && ASR::is_a<ASR::symbol_t>(*fn_scope->asr_owner)) {
+            module_name = ASRUtils::symbol_name(
+                ASR::down_cast<ASR::symbol_t>(fn_scope->asr_owner));
+        }
+        std::string unique_name = current_scope->get_unique_name(fn_name);
+        ASR::asr_t *ext = ASR::make_ExternalSymbol_t(al, loc, current_scope,
+            s2c(al, unique_name), fn, s2c(al, module_name), nullptr, 0,
+            s2c(al, fn_name), ASR::accessType::Private);
+        current_scope->add_symbol(unique_name,
+            ASR::down_cast<ASR::symbol_t>(ext));
+        return ASR::down_cast<ASR::symbol_t>(ext);
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t &x) {
+        ASR::symbol_t *fn = single_target(x.m_name);
+        if (fn != nullptr && current_scope != nullptr) {
+            ASR::FunctionCall_t &xx = const_cast<ASR::FunctionCall_t&>(x);
+            xx.m_name = resolve_in_scope(fn, x.base.base.loc);
+        }
+        ASR::BaseWalkVisitor<DevirtualizeVisitor>::visit_FunctionCall(x);
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t &x) {
+        ASR::symbol_t *fn = single_target(x.m_name);
+        if (fn != nullptr && current_scope != nullptr) {
+            ASR::SubroutineCall_t &xx = const_cast<ASR::SubroutineCall_t&>(x);
+            xx.m_name = resolve_in_scope(fn, x.base.base.loc);
+        }
+        ASR::BaseWalkVisitor<DevirtualizeVisitor>::visit_SubroutineCall(x);
+    }
+};
+
+} // anonymous namespace
+
+void pass_devirtualize(Allocator &al, ASR::TranslationUnit_t &unit,
+                       const PassOptions &/*pass_options*/) {
+    ProcPointerCollector collector;
+    collector.visit_TranslationUnit(unit);
+    if (collector.targets.empty()) {
+        return;
+    }
+    DevirtualizeVisitor v(al, collector.targets, collector.disqualified);
+    v.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
@@ -7,6 +7,10 @@
 #include <libasr/pass/stmt_walk_visitor.h>
 #include <libasr/pass/pass_utils.h>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 namespace LCompilers {
 
 using ASR::down_cast;
@@ -66,6 +70,45 @@ public:
 
 void pass_replace_do_loops(Allocator &al, ASR::TranslationUnit_t &unit,
                            const LCompilers::PassOptions& pass_options) {
+    if( pass_options.pass_jobs > 1 ) {
+        // This pass only rewrites the body and local symbol table of the
+        // program unit it is visiting, so independent units can be sharded
+        // across worker threads. Each worker allocates into a private arena
+        // that the main allocator absorbs after the join, so the rewritten
+        // nodes live exactly as long as the rest of the tree.
+        std::vector<ASR::symbol_t*> units =
+            PassUtils::collect_independent_program_units(unit);
+        size_t n_jobs = std::min((size_t) pass_options.pass_jobs, units.size());
+        if( n_jobs > 1 ) {
+            std::vector<std::unique_ptr<Allocator>> arenas;
+            std::vector<std::thread> workers;
+            std::atomic<size_t> next_unit{0};
+            for (size_t t = 0; t < n_jobs; t++) {
+                arenas.push_back(std::make_unique<Allocator>(1024*1024));
+            }
+            for (size_t t = 0; t < n_jobs; t++) {
+                workers.emplace_back([&, t]() {
+                    Allocator &worker_al = *arenas[t];
+                    size_t i;
+                    while ((i = next_unit.fetch_add(1)) < units.size()) {
+                        DoLoopVisitor v(worker_al, pass_options);
+                        v.asr_changed = true;
+                        v.use_loop_variable_after_loop =
+                            pass_options.use_loop_variable_after_loop;
+                        while( v.asr_changed ) {
+                            v.asr_changed = false;
+                            v.visit_symbol(*units[i]);
+                        }
+                    }
+                });
+            }
+            for (auto &worker : workers) worker.join();
+            for (auto &arena : arenas) {
+                al.absorb(*arena);
+            }
+            return;
+        }
+    }
     DoLoopVisitor v(al, pass_options);
     // Each call transforms only one layer of nested loops, so we call it twice
     // to transform doubly nested loops:
@@ -0,0 +1,198 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/exception.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_verify.h>
+#include <libasr/pass/replace_fused_expr_opt.h>
+#include <libasr/pass/pass_utils.h>
+
+#include <string>
+
+
+namespace LCompilers {
+
+using ASR::down_cast;
+using ASR::is_a;
+
+/*
+
+This ASR pass applies the local expression rewrites of the
+`sign_from_value`, `div_to_mul` and `fma` optimization passes in a single
+traversal of the ASR, instead of one whole-tree walk (plus verification in
+debug builds) per pass. The three rewrites dispatch on the binary operation
+of a `RealBinOp`, so they are mutually exclusive on any given node:
+
+    c = a*sign(1.0, b)   ->  c = sign_from_value(a, b)     (Mul)
+    c = x/2.0            ->  c = x*0.5                     (Div)
+    d = a + b*c          ->  d = fma(a, b, c)              (Add/Sub)
+
+Children are rewritten before their parent, so an `fma` candidate sees
+`Div` children that were already turned into `Mul`, exactly as when the
+passes run back to back. The individual passes stay available under their
+own names for debugging with `--pass`.
+
+*/
+class FusedExprOptReplacer : public ASR::BaseExprReplacer<FusedExprOptReplacer>{
+private:
+    Allocator &al;
+    ASR::TranslationUnit_t &unit;
+    const LCompilers::PassOptions& pass_options;
+
+    bool is_value_one(ASR::expr_t* expr) {
+        double value;
+        if( ASRUtils::is_value_constant(ASRUtils::expr_value(expr), value) &&
+            ASRUtils::is_real(*ASRUtils::expr_type(expr)) ) {
+            return value == 1.0;
+        }
+        return false;
+    }
+
+    ASR::expr_t* is_extract_sign(ASR::expr_t* expr) {
+        if( ASR::is_a<ASR::RealCopySign_t>(*expr) ) {
+            ASR::RealCopySign_t *real_cpy_sign = ASR::down_cast<ASR::RealCopySign_t>(expr);
+            if( !is_value_one(real_cpy_sign->m_target) ) {return nullptr;}
+            return real_cpy_sign->m_source;
+        }
+        return nullptr;
+    }
+
+    bool is_BinOpMul(ASR::expr_t* expr) {
+        if (ASR::is_a<ASR::RealBinOp_t>(*expr)) {
+            ASR::RealBinOp_t* expr_binop = ASR::down_cast<ASR::RealBinOp_t>(expr);
+            return expr_binop->m_op == ASR::binopType::Mul;
+        }
+        return false;
+    }
+
+    // a*sign(1.0, b) -> sign_from_value(a, b)
+    void replace_sign_from_value(ASR::RealBinOp_t* x) {
+        ASR::expr_t *first_arg = nullptr, *second_arg = nullptr;
+        first_arg = is_extract_sign(x->m_left);
+        second_arg = is_extract_sign(x->m_right);
+
+        if( second_arg ) {
+            first_arg = x->m_left;
+        } else if( first_arg ) {
+            second_arg = x->m_right;
+        } else {
+            return ;
+        }
+        *current_expr = PassUtils::get_sign_from_value(first_arg, second_arg,
+                                     al, unit, x->base.base.loc,
+                                    const_cast<LCompilers::PassOptions&>(pass_options));
+    }
+
+    // x/c -> x*(1/c) for a compile-time constant c
+    void replace_div_to_mul(ASR::RealBinOp_t* x) {
+        ASR::expr_t* right_value = ASRUtils::expr_value(x->m_right);
+        if( right_value ) {
+            double value;
+            if( ASRUtils::extract_value<double>(right_value, value) ) {
+                if( x->m_type->type == ASR::ttypeType::Real ) {
+                    x->m_op = ASR::binopType::Mul;
+                    x->m_right = ASRUtils::EXPR(ASR::make_RealConstant_t(
+                        al, x->m_right->base.loc, 1.0/value, x->m_type));
+                }
+            }
+        }
+    }
+
+    // a + b*c -> fma(a, b, c)
+    void replace_fma(ASR::RealBinOp_t* x) {
+        ASR::expr_t *mul_expr = nullptr, *other_expr = nullptr;
+        bool is_mul_expr_negative = false, is_other_expr_negative = false;
+        if( is_BinOpMul(x->m_right) ) {
+            mul_expr = x->m_right;
+            other_expr = x->m_left;
+            is_mul_expr_negative = (x->m_op == ASR::binopType::Sub);
+        } else if( is_BinOpMul(x->m_left) ) {
+            mul_expr = x->m_left;
+            other_expr = x->m_right;
+            is_other_expr_negative = (x->m_op == ASR::binopType::Sub);
+        } else {
+            return ;
+        }
+
+        if( is_other_expr_negative ) {
+            other_expr = ASRUtils::EXPR(ASR::make_RealUnaryMinus_t(al, other_expr->base.loc, other_expr,
+                ASRUtils::expr_type(other_expr), nullptr));
+        }
+
+        ASR::RealBinOp_t* mul_binop = ASR::down_cast<ASR::RealBinOp_t>(mul_expr);
+        ASR::expr_t *first_arg = mul_binop->m_left, *second_arg = mul_binop->m_right;
+        if( is_mul_expr_negative ) {
+            first_arg = ASRUtils::EXPR(ASR::make_RealUnaryMinus_t(al, first_arg->base.loc, first_arg,
+                ASRUtils::expr_type(first_arg), nullptr));
+        }
+
+        *current_expr = PassUtils::get_fma(other_expr, first_arg, second_arg,
+                                     al, unit, x->base.base.loc,
+                                     const_cast<LCompilers::PassOptions&>(pass_options));
+    }
+
+public:
+    FusedExprOptReplacer(Allocator &al_, ASR::TranslationUnit_t &unit_,
+                                  const LCompilers::PassOptions& pass_options_)
+                            : al(al_), unit(unit_), pass_options(pass_options_) {}
+
+    void replace_RealBinOp(ASR::RealBinOp_t* x) {
+        BaseExprReplacer::replace_RealBinOp(x);
+
+        // The rewrites are mutually exclusive on m_op, so at most one of
+        // them applies to a given node
+        switch( x->m_op ) {
+            case ASR::binopType::Mul: {
+                replace_sign_from_value(x);
+                break;
+            }
+            case ASR::binopType::Div: {
+                replace_div_to_mul(x);
+                break;
+            }
+            case ASR::binopType::Add:
+            case ASR::binopType::Sub: {
+                replace_fma(x);
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+};
+
+class FusedExprOptVisitor : public ASR::CallReplacerOnExpressionsVisitor<FusedExprOptVisitor>{
+private:
+    FusedExprOptReplacer replacer;
+public:
+    FusedExprOptVisitor(Allocator &al, ASR::TranslationUnit_t &unit,
+                                  const LCompilers::PassOptions& pass_options)
+                        : replacer{al, unit, pass_options}{}
+
+    void call_replacer(){
+        if( is_a<ASR::RealBinOp_t>(**current_expr) ){
+            replacer.current_expr = current_expr;
+            replacer.replace_expr(*current_expr);
+        }
+    }
+
+    void visit_Function(const ASR::Function_t &x){
+        if(std::string(x.m_name).find("_lcompilers_optimization_")
+            !=std::string::npos){ // Don't visit the optimization functions.
+            return;
+        }
+        CallReplacerOnExpressionsVisitor::visit_Function(x);
+    }
+};
+
+void pass_replace_fused_expr_opt(Allocator &al, ASR::TranslationUnit_t &unit,
+                                 const LCompilers::PassOptions& pass_options) {
+    FusedExprOptVisitor fused_expr_opt_visitor(al, unit, pass_options);
+    fused_expr_opt_visitor.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+
+} // namespace LCompilers
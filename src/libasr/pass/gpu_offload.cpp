@@ -12,6 +12,7 @@
 #include <libasr/string_utils.h>
 
 #include <filesystem>
+#include <limits>
 #include <map>
 #include <set>
 #include <string>
@@ -21,7 +22,6 @@ namespace LCompilers {
 using ASR::down_cast;
 using ASR::is_a;
 
-static int gpu_kernel_counter = 0;
 
 // Collects all symbols referenced in expressions/statements
 class GpuSymbolCollector : public ASR::BaseWalkVisitor<GpuSymbolCollector> {
@@ -240,6 +240,36 @@ public:
     }
 };
 
+// Redirects references to scalar reduce-clause variables in a kernel
+// body to their kernel-local accumulators, so each thread accumulates
+// privately before the GpuReduction tree combine
+class GpuReductionAccReplacer : public ASR::BaseExprReplacer<GpuReductionAccReplacer> {
+public:
+    std::map<ASR::symbol_t*, ASR::symbol_t*> &acc_map;
+    GpuReductionAccReplacer(std::map<ASR::symbol_t*, ASR::symbol_t*> &acc_map_)
+        : acc_map(acc_map_) {}
+
+    void replace_Var(ASR::Var_t *x) {
+        auto it = acc_map.find(x->m_v);
+        if (it != acc_map.end()) {
+            x->m_v = it->second;
+        }
+    }
+};
+
+class GpuReductionAccReplacerVisitor :
+    public ASR::CallReplacerOnExpressionsVisitor<GpuReductionAccReplacerVisitor> {
+public:
+    GpuReductionAccReplacer replacer;
+    GpuReductionAccReplacerVisitor(std::map<ASR::symbol_t*, ASR::symbol_t*> &acc_map)
+        : replacer(acc_map) {}
+
+    void call_replacer() {
+        replacer.current_expr = current_expr;
+        replacer.replace_expr(*current_expr);
+    }
+};
+
 // Collects local variables used in do concurrent body that are NOT
 // arrays and NOT the loop variables — these are per-thread temporaries
 class GpuLocalVarCollector : public ASR::BaseWalkVisitor<GpuLocalVarCollector> {
@@ -572,6 +602,10 @@ public:
     // Scalar variables that receive the result of an inlined all()
     // reduction. These need to be passed back from the GPU kernel.
     std::set<std::string> all_reduction_targets;
+    // Numbers the generated kernels within this pass invocation. A member
+    // rather than a global so that kernel names depend only on the current
+    // translation unit, not on how many units the process compiled before.
+    int gpu_kernel_counter = 0;
 
     GpuOffloadVisitor(Allocator &al, PassOptions pass_options_,
                       ASR::TranslationUnit_t &tu_)
@@ -1539,8 +1573,10 @@ public:
             // Detect and unwrap Transpose on matmul arguments so the
             // inlined loops index into the original array with swapped
             // indices instead of calling _lcompilers_transpose (which
-            // is unavailable inside Metal GPU kernels).
-            bool transpose_a = false, transpose_b = false;
+            // is unavailable inside Metal GPU kernels). Overload ids 4-6
+            // mark transposes already folded away at matmul creation.
+            bool transpose_a = (iaf->m_overload_id == 4 || iaf->m_overload_id == 6);
+            bool transpose_b = (iaf->m_overload_id == 5 || iaf->m_overload_id == 6);
             if (ASR::is_a<ASR::IntrinsicArrayFunction_t>(*arg_a)) {
                 auto *iaf_a = ASR::down_cast<ASR::IntrinsicArrayFunction_t>(arg_a);
                 if (static_cast<ASRUtils::IntrinsicArrayFunctions>(
@@ -4108,11 +4144,69 @@ public:
         }
     }
 
+    // Identity element of a supported reduce operation, used to seed the
+    // kernel-local accumulator of every thread
+    ASR::expr_t* reduction_identity(ASR::reduction_opType op,
+                                    ASR::ttype_t *type, const Location &loc) {
+        int kind = ASRUtils::extract_kind_from_ttype_t(type);
+        if (ASRUtils::is_integer(*type)) {
+            int64_t v = 0;
+            if (op == ASR::reduction_opType::ReduceMIN) {
+                v = (kind == 8) ? std::numeric_limits<int64_t>::max()
+                                : std::numeric_limits<int32_t>::max();
+            } else if (op == ASR::reduction_opType::ReduceMAX) {
+                v = (kind == 8) ? std::numeric_limits<int64_t>::min()
+                                : std::numeric_limits<int32_t>::min();
+            }
+            return ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, v,
+                ASRUtils::duplicate_type(al, type),
+                ASR::integerbozType::Decimal));
+        }
+        double v = 0.0;
+        if (op == ASR::reduction_opType::ReduceMIN) {
+            v = (kind == 8) ? std::numeric_limits<double>::max()
+                            : (double) std::numeric_limits<float>::max();
+        } else if (op == ASR::reduction_opType::ReduceMAX) {
+            v = (kind == 8) ? std::numeric_limits<double>::lowest()
+                            : (double) std::numeric_limits<float>::lowest();
+        }
+        return ASRUtils::EXPR(ASR::make_RealConstant_t(al, loc, v,
+            ASRUtils::duplicate_type(al, type)));
+    }
+
     void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t &x) {
         if (!pass_options.gpu_offload_metal && !pass_options.gpu_offload_cuda) return;
 
-        // Skip loops with reduce clause (let do_loops handle as regular loop)
-        if (x.n_reduction > 0) return;
+        // Scalar sum/min/max reduce clauses are offloaded: each thread
+        // accumulates into a kernel-local variable and a trailing
+        // GpuReduction statement combines the per-thread partials
+        // (threadgroup tree reduction plus an atomic finish in the
+        // backends). Other reduce clauses stay on the CPU (do_loops
+        // lowers the loop as a regular do loop). Metal has no 64-bit
+        // atomics, so kind-8 reductions are not offloaded there.
+        std::map<std::string, ASR::reduction_opType> dc_reductions;
+        for (size_t r = 0; r < x.n_reduction; r++) {
+            if (x.m_reduction[r].m_op != ASR::reduction_opType::ReduceAdd &&
+                x.m_reduction[r].m_op != ASR::reduction_opType::ReduceMIN &&
+                x.m_reduction[r].m_op != ASR::reduction_opType::ReduceMAX) {
+                return;
+            }
+            if (!ASR::is_a<ASR::Var_t>(*x.m_reduction[r].m_arg)) return;
+            ASR::symbol_t *red_sym = ASR::down_cast<ASR::Var_t>(
+                x.m_reduction[r].m_arg)->m_v;
+            ASR::ttype_t *red_type = ASRUtils::symbol_type(red_sym);
+            if (ASRUtils::is_array(red_type) ||
+                !(ASRUtils::is_integer(*red_type) ||
+                  ASRUtils::is_real(*red_type))) {
+                return;
+            }
+            if (pass_options.gpu_offload_metal &&
+                ASRUtils::extract_kind_from_ttype_t(red_type) == 8) {
+                return;
+            }
+            dc_reductions[ASRUtils::symbol_name(red_sym)] =
+                x.m_reduction[r].m_op;
+        }
 
         Location loc = x.base.base.loc;
         size_t n_dims = x.n_head;
@@ -4761,6 +4855,7 @@ public:
         for (auto &name : assigned_vars) {
             if (loop_var_set.count(name)) continue;
             if (all_reduction_targets.count(name)) continue;
+            if (dc_reductions.count(name)) continue;
             if (post_loop_vars.count(name)) continue;
             auto it = involved_syms.find(name);
             if (it != involved_syms.end()) {
@@ -6962,6 +7057,90 @@ public:
             kernel_body.push_back(al, body_copy.p[i]);
         }
 
+        // For reduce clauses, restructure the kernel. The tree combine
+        // emitted for GpuReduction uses threadgroup barriers, which every
+        // thread must reach, so the early-return range guard becomes a
+        // wrapping if. References to each reduction variable are
+        // redirected to a kernel-local accumulator seeded with the
+        // operation's identity; the trailing GpuReduction statements
+        // combine the per-thread partials into the 1-element liveout
+        // buffer, whose copied-in prior value participates in the result
+        // as do concurrent reduce semantics require.
+        if (!dc_reductions.empty()) {
+            ASR::If_t *guard_if = ASR::down_cast<ASR::If_t>(kernel_body.p[0]);
+            ASR::expr_t *in_range = ASRUtils::EXPR(ASR::make_LogicalNot_t(
+                al, loc, guard_if->m_test,
+                ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 4)), nullptr));
+
+            Vec<ASR::stmt_t*> in_range_body;
+            in_range_body.reserve(al, kernel_body.n - 1);
+            for (size_t i = 1; i < kernel_body.n; i++) {
+                in_range_body.push_back(al, kernel_body.p[i]);
+            }
+
+            Vec<ASR::stmt_t*> red_body;
+            red_body.reserve(al, 2 * dc_reductions.size() + 1);
+            Vec<ASR::stmt_t*> red_tail;
+            red_tail.reserve(al, dc_reductions.size());
+            std::map<ASR::symbol_t*, ASR::symbol_t*> acc_map;
+            for (auto &[red_name, red_op] : dc_reductions) {
+                ASR::symbol_t *param_sym = kernel_scope->get_symbol(red_name);
+                ASR::ttype_t *scalar_type = nullptr;
+                for (auto &ls : liveout_scalars) {
+                    if (ls.orig_name == red_name) {
+                        scalar_type = ls.scalar_type;
+                        break;
+                    }
+                }
+                if (param_sym == nullptr || scalar_type == nullptr) {
+                    // The body never references this reduction variable,
+                    // so there is nothing to accumulate
+                    continue;
+                }
+                std::string acc_name = kernel_scope->get_unique_name(
+                    "__red_" + red_name);
+                ASR::symbol_t *acc_sym = ASR::down_cast<ASR::symbol_t>(
+                    ASRUtils::make_Variable_t_util(al, loc, kernel_scope,
+                        s2c(al, acc_name), nullptr, 0,
+                        ASR::intentType::Local, nullptr, nullptr,
+                        ASR::storage_typeType::Default,
+                        ASRUtils::duplicate_type(al, scalar_type),
+                        nullptr, ASR::abiType::Source,
+                        ASR::accessType::Public,
+                        ASR::presenceType::Required, false));
+                kernel_scope->add_symbol(acc_name, acc_sym);
+                acc_map[param_sym] = acc_sym;
+
+                red_body.push_back(al, ASRUtils::STMT(
+                    ASR::make_Assignment_t(al, loc,
+                        ASRUtils::EXPR(ASR::make_Var_t(al, loc, acc_sym)),
+                        reduction_identity(red_op, scalar_type, loc),
+                        nullptr, false, false)));
+                red_tail.push_back(al, ASRUtils::STMT(
+                    ASR::make_GpuReduction_t(al, loc, red_op,
+                        ASRUtils::EXPR(ASR::make_Var_t(al, loc, acc_sym)),
+                        ASRUtils::EXPR(ASR::make_Var_t(al, loc, param_sym)))));
+            }
+
+            if (!acc_map.empty()) {
+                GpuReductionAccReplacerVisitor acc_replacer(acc_map);
+                for (size_t i = 0; i < in_range_body.n; i++) {
+                    acc_replacer.visit_stmt(*in_range_body.p[i]);
+                }
+
+                Vec<ASR::stmt_t*> empty_else;
+                empty_else.reserve(al, 0);
+                red_body.push_back(al, ASRUtils::STMT(
+                    ASR::make_If_t(al, loc, nullptr, in_range,
+                        in_range_body.p, in_range_body.n,
+                        empty_else.p, empty_else.n)));
+                for (size_t i = 0; i < red_tail.n; i++) {
+                    red_body.push_back(al, red_tail.p[i]);
+                }
+                kernel_body = red_body;
+            }
+        }
+
         // 5. Build function signature
         // FunctionType arg_types must not contain scope-bound expressions,
         // so strip dimension expressions that reference variables.
@@ -7272,6 +7451,429 @@ public:
     }
 };
 
+// Data-residency stage for the CUDA backend. Its runtime launches kernels
+// on a stream and defers all device-to-host downloads to lfortran_gpu_sync,
+// keeping buffers device-resident in between; a GpuSync is therefore only
+// needed where the host actually consumes device data. Back-to-back
+// offloaded loops lower to `GpuKernelLaunch; GpuSync; GpuKernelLaunch; ...`,
+// and the interior sync would force every involved array through a
+// download/upload pair, so it is dropped: stream order keeps the launches
+// correct and the arrays stay on the device until the surviving sync. Any
+// host statement between two launches (liveout scalar copy-backs, result
+// allocations, a present() guard) breaks the pattern and keeps its sync, so
+// the host never observes a buffer before its sync point.
+class GpuSyncElisionVisitor :
+    public ASR::BaseWalkVisitor<GpuSyncElisionVisitor> {
+public:
+    void elide_in_body(ASR::stmt_t **m_body, size_t &n_body) {
+        size_t kept = 0;
+        for (size_t i = 0; i < n_body; i++) {
+            if (ASR::is_a<ASR::GpuSync_t>(*m_body[i]) && i + 1 < n_body &&
+                    ASR::is_a<ASR::GpuKernelLaunch_t>(*m_body[i + 1])) {
+                continue;
+            }
+            m_body[kept++] = m_body[i];
+        }
+        n_body = kept;
+    }
+
+    void visit_Program(const ASR::Program_t &x) {
+        ASR::Program_t &xx = const_cast<ASR::Program_t&>(x);
+        elide_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_Program(x);
+    }
+
+    void visit_Function(const ASR::Function_t &x) {
+        ASR::Function_t &xx = const_cast<ASR::Function_t&>(x);
+        elide_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_Function(x);
+    }
+
+    void visit_Block(const ASR::Block_t &x) {
+        ASR::Block_t &xx = const_cast<ASR::Block_t&>(x);
+        elide_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_Block(x);
+    }
+
+    void visit_If(const ASR::If_t &x) {
+        ASR::If_t &xx = const_cast<ASR::If_t&>(x);
+        elide_in_body(xx.m_body, xx.n_body);
+        elide_in_body(xx.m_orelse, xx.n_orelse);
+        BaseWalkVisitor::visit_If(x);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        ASR::DoLoop_t &xx = const_cast<ASR::DoLoop_t&>(x);
+        elide_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_DoLoop(x);
+    }
+
+    void visit_WhileLoop(const ASR::WhileLoop_t &x) {
+        ASR::WhileLoop_t &xx = const_cast<ASR::WhileLoop_t&>(x);
+        elide_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_WhileLoop(x);
+    }
+};
+
+// Structural expression equality across two kernel scopes. Kernel parameters
+// and locals keep their host names, so matching Var references by name is
+// exact; anything this helper does not understand compares unequal, which
+// makes the dependence check below conservative.
+static bool fusion_expr_equal(ASR::expr_t *x, ASR::expr_t *y) {
+    if (x == nullptr || y == nullptr) return x == y;
+    if (x->type != y->type) return false;
+    switch (x->type) {
+        case ASR::exprType::Var: {
+            return std::string(ASRUtils::symbol_name(
+                ASR::down_cast<ASR::Var_t>(x)->m_v)) ==
+                ASRUtils::symbol_name(ASR::down_cast<ASR::Var_t>(y)->m_v);
+        }
+        case ASR::exprType::IntegerConstant: {
+            return ASR::down_cast<ASR::IntegerConstant_t>(x)->m_n ==
+                ASR::down_cast<ASR::IntegerConstant_t>(y)->m_n;
+        }
+        case ASR::exprType::IntegerBinOp: {
+            ASR::IntegerBinOp_t *bx = ASR::down_cast<ASR::IntegerBinOp_t>(x);
+            ASR::IntegerBinOp_t *by = ASR::down_cast<ASR::IntegerBinOp_t>(y);
+            return bx->m_op == by->m_op &&
+                fusion_expr_equal(bx->m_left, by->m_left) &&
+                fusion_expr_equal(bx->m_right, by->m_right);
+        }
+        case ASR::exprType::IntegerUnaryMinus: {
+            return fusion_expr_equal(
+                ASR::down_cast<ASR::IntegerUnaryMinus_t>(x)->m_arg,
+                ASR::down_cast<ASR::IntegerUnaryMinus_t>(y)->m_arg);
+        }
+        case ASR::exprType::Cast: {
+            ASR::Cast_t *cx = ASR::down_cast<ASR::Cast_t>(x);
+            ASR::Cast_t *cy = ASR::down_cast<ASR::Cast_t>(y);
+            return cx->m_kind == cy->m_kind &&
+                fusion_expr_equal(cx->m_arg, cy->m_arg);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// Collects, per kernel argument, the index expressions of every read and
+// write in a kernel body. Whole-variable stores to arguments, array
+// sections, and calls with unknown side effects mark the body unsupported,
+// which vetoes fusion.
+class KernelAccessCollector : public ASR::BaseWalkVisitor<KernelAccessCollector> {
+public:
+    typedef std::vector<std::vector<ASR::expr_t*>> access_list;
+    std::map<std::string, access_list> reads, writes;
+    bool unsupported = false;
+
+    void visit_Assignment(const ASR::Assignment_t &x) {
+        if (ASR::is_a<ASR::ArrayItem_t>(*x.m_target)) {
+            ASR::ArrayItem_t *ai = ASR::down_cast<ASR::ArrayItem_t>(x.m_target);
+            record(ai, writes);
+            for (size_t i = 0; i < ai->n_args; i++) {
+                if (ai->m_args[i].m_right) visit_expr(*ai->m_args[i].m_right);
+            }
+        } else if (ASR::is_a<ASR::Var_t>(*x.m_target)) {
+            if (is_argument(ASR::down_cast<ASR::Var_t>(x.m_target)->m_v)) {
+                // whole-variable store to something shared across threads
+                unsupported = true;
+            }
+        } else {
+            unsupported = true;
+        }
+        visit_expr(*x.m_value);
+    }
+
+    void visit_ArrayItem(const ASR::ArrayItem_t &x) {
+        record(&x, reads);
+        for (size_t i = 0; i < x.n_args; i++) {
+            if (x.m_args[i].m_right) visit_expr(*x.m_args[i].m_right);
+        }
+    }
+
+    void visit_ArraySection(const ASR::ArraySection_t & /*x*/) {
+        unsupported = true;
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t & /*x*/) {
+        unsupported = true;
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t & /*x*/) {
+        unsupported = true;
+    }
+
+private:
+    bool is_argument(ASR::symbol_t *s) {
+        s = ASRUtils::symbol_get_past_external(s);
+        return ASR::is_a<ASR::Variable_t>(*s) &&
+            ASR::down_cast<ASR::Variable_t>(s)->m_intent !=
+                ASR::intentType::Local;
+    }
+
+    void record(const ASR::ArrayItem_t *x, std::map<std::string, access_list> &into) {
+        if (!ASR::is_a<ASR::Var_t>(*x->m_v)) {
+            unsupported = true;
+            return;
+        }
+        ASR::symbol_t *s = ASR::down_cast<ASR::Var_t>(x->m_v)->m_v;
+        if (!is_argument(s)) return; // locals are per-thread
+        std::vector<ASR::expr_t*> idx;
+        for (size_t i = 0; i < x->n_args; i++) {
+            if (x->m_args[i].m_left || x->m_args[i].m_step) {
+                unsupported = true;
+                return;
+            }
+            idx.push_back(x->m_args[i].m_right);
+        }
+        into[ASRUtils::symbol_name(s)].push_back(std::move(idx));
+    }
+};
+
+// Kernel fusion for adjacent offloaded loops. Once the interior sync points
+// are gone, a chain of elementwise loops is a run of consecutive
+// GpuKernelLaunch statements, each still paying a launch plus a full
+// global-memory round trip over its arrays. Launches with identical
+// grid/block expressions are folded into the first kernel when the
+// dependence check proves it safe: wherever the earlier kernel writes an
+// array the later one touches (flow/output dependence), or reads an array
+// the later one writes (anti dependence), the index expressions must match
+// structurally, i.e. each thread stays on its own element. Stencil-style
+// neighbor accesses fail the check and keep their own kernel - that is
+// precisely the case where fusion would race across thread boundaries.
+class GpuKernelFusionVisitor :
+    public ASR::BaseWalkVisitor<GpuKernelFusionVisitor> {
+private:
+    Allocator &al;
+
+    // Host-side argument identity: the Var behind an optional physical cast.
+    static ASR::symbol_t* host_arg_symbol(ASR::expr_t *e) {
+        if (e && ASR::is_a<ASR::ArrayPhysicalCast_t>(*e)) {
+            e = ASR::down_cast<ASR::ArrayPhysicalCast_t>(e)->m_arg;
+        }
+        if (e && ASR::is_a<ASR::Var_t>(*e)) {
+            return ASR::down_cast<ASR::Var_t>(e)->m_v;
+        }
+        return nullptr;
+    }
+
+    static bool accesses_conflict(const KernelAccessCollector::access_list *a,
+        const KernelAccessCollector::access_list *b)
+    {
+        if (!a || !b) return false;
+        for (auto &ia : *a) {
+            for (auto &ib : *b) {
+                if (ia.size() != ib.size()) return true;
+                for (size_t d = 0; d < ia.size(); d++) {
+                    if (!fusion_expr_equal(ia[d], ib[d])) return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool try_fuse(ASR::GpuKernelLaunch_t *a, ASR::GpuKernelLaunch_t *b) {
+        if (a->m_kernel == b->m_kernel) return false;
+        if (!ASR::is_a<ASR::Function_t>(*a->m_kernel) ||
+                !ASR::is_a<ASR::Function_t>(*b->m_kernel)) {
+            return false;
+        }
+        ASR::Function_t *fa = ASR::down_cast<ASR::Function_t>(a->m_kernel);
+        ASR::Function_t *fb = ASR::down_cast<ASR::Function_t>(b->m_kernel);
+        if (fa->n_args != a->n_args || fb->n_args != b->n_args) return false;
+
+        // Compatible iteration spaces: identical grid and block expressions
+        // (these are host-scope expressions, so pointer-identical symbols).
+        if (!ASRUtils::expr_equal(a->m_grid_size, b->m_grid_size) ||
+                !ASRUtils::expr_equal(a->m_block_size, b->m_block_size)) {
+            return false;
+        }
+
+        // Same-named symbols must refer to the same host entity: parameters
+        // keep their host names, so a name shared by both kernels must be
+        // backed by the same host argument in both launches.
+        for (size_t j = 0; j < fb->n_args; j++) {
+            std::string name = ASRUtils::symbol_name(
+                ASR::down_cast<ASR::Var_t>(fb->m_args[j])->m_v);
+            if (!fa->m_symtab->get_symbol(name)) continue;
+            ASR::symbol_t *host_b = host_arg_symbol(b->m_args[j].m_value);
+            bool matched = false;
+            for (size_t i = 0; i < fa->n_args; i++) {
+                if (name == ASRUtils::symbol_name(
+                        ASR::down_cast<ASR::Var_t>(fa->m_args[i])->m_v)) {
+                    matched = host_b != nullptr &&
+                        host_b == host_arg_symbol(a->m_args[i].m_value);
+                    break;
+                }
+            }
+            if (!matched) return false;
+        }
+        for (auto &item : fb->m_symtab->get_scope()) {
+            ASR::symbol_t *in_fa = fa->m_symtab->get_symbol(item.first);
+            if (in_fa && (in_fa->type != item.second->type ||
+                    !ASR::is_a<ASR::Variable_t>(*item.second))) {
+                return false;
+            }
+        }
+
+        // Dependence check over both bodies.
+        KernelAccessCollector ca, cb;
+        for (size_t i = 0; i < fa->n_body; i++) ca.visit_stmt(*fa->m_body[i]);
+        for (size_t i = 0; i < fb->n_body; i++) cb.visit_stmt(*fb->m_body[i]);
+        if (ca.unsupported || cb.unsupported) return false;
+        for (auto &w : ca.writes) {
+            const KernelAccessCollector::access_list *br = nullptr, *bw = nullptr;
+            auto itr = cb.reads.find(w.first);
+            if (itr != cb.reads.end()) br = &itr->second;
+            auto itw = cb.writes.find(w.first);
+            if (itw != cb.writes.end()) bw = &itw->second;
+            if (accesses_conflict(&w.second, br) ||
+                    accesses_conflict(&w.second, bw)) {
+                return false;
+            }
+        }
+        for (auto &r : ca.reads) {
+            auto itw = cb.writes.find(r.first);
+            if (itw != cb.writes.end() &&
+                    accesses_conflict(&r.second, &itw->second)) {
+                return false;
+            }
+        }
+
+        // Legal: merge fb into fa. Missing symbols are recreated in fa's
+        // scope under their host names; parameters additionally extend both
+        // the kernel signature and the launch arguments.
+        Vec<ASR::expr_t*> new_fn_args;
+        new_fn_args.reserve(al, fa->n_args + fb->n_args);
+        for (size_t i = 0; i < fa->n_args; i++) {
+            new_fn_args.push_back(al, fa->m_args[i]);
+        }
+        Vec<ASR::call_arg_t> new_call_args;
+        new_call_args.reserve(al, a->n_args + b->n_args);
+        for (size_t i = 0; i < a->n_args; i++) {
+            new_call_args.push_back(al, a->m_args[i]);
+        }
+        for (auto &item : fb->m_symtab->get_scope()) {
+            if (fa->m_symtab->get_symbol(item.first)) continue;
+            ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(item.second);
+            ASR::symbol_t *copy = ASR::down_cast<ASR::symbol_t>(
+                ASRUtils::make_Variable_t_util(al, v->base.base.loc,
+                    fa->m_symtab, s2c(al, item.first),
+                    v->m_dependencies, v->n_dependencies, v->m_intent,
+                    v->m_symbolic_value, v->m_value, v->m_storage,
+                    ASRUtils::duplicate_type(al, v->m_type),
+                    v->m_type_declaration, v->m_abi, v->m_access,
+                    v->m_presence, v->m_value_attr));
+            fa->m_symtab->add_symbol(item.first, copy);
+        }
+        for (size_t j = 0; j < fb->n_args; j++) {
+            std::string name = ASRUtils::symbol_name(
+                ASR::down_cast<ASR::Var_t>(fb->m_args[j])->m_v);
+            bool already = false;
+            for (size_t i = 0; i < fa->n_args; i++) {
+                if (name == ASRUtils::symbol_name(
+                        ASR::down_cast<ASR::Var_t>(fa->m_args[i])->m_v)) {
+                    already = true;
+                    break;
+                }
+            }
+            if (already) continue;
+            new_fn_args.push_back(al, ASRUtils::EXPR(ASR::make_Var_t(al,
+                fb->m_args[j]->base.loc,
+                fa->m_symtab->get_symbol(name))));
+            new_call_args.push_back(al, b->m_args[j]);
+        }
+
+        // Re-home fb's body: duplicate it and rebind every symbol reference
+        // to fa's scope by name.
+        ASRUtils::ExprStmtDuplicator dup(al);
+        GpuReplaceSymbolsVisitor rebind(*fa->m_symtab);
+        Vec<ASR::stmt_t*> new_body;
+        new_body.reserve(al, fa->n_body + fb->n_body);
+        for (size_t i = 0; i < fa->n_body; i++) {
+            new_body.push_back(al, fa->m_body[i]);
+        }
+        for (size_t i = 0; i < fb->n_body; i++) {
+            dup.success = true;
+            ASR::stmt_t *s = dup.duplicate_stmt(fb->m_body[i]);
+            if (!dup.success) return false;
+            rebind.visit_stmt(*s);
+            new_body.push_back(al, s);
+        }
+        fa->m_body = new_body.p;
+        fa->n_body = new_body.n;
+        fa->m_args = new_fn_args.p;
+        fa->n_args = new_fn_args.n;
+        a->m_args = new_call_args.p;
+        a->n_args = new_call_args.n;
+
+        // The fused-away kernel must not be emitted or registered.
+        ASRUtils::symbol_parent_symtab(b->m_kernel)->erase_symbol(
+            ASRUtils::symbol_name(b->m_kernel));
+        return true;
+    }
+
+public:
+    GpuKernelFusionVisitor(Allocator &al_) : al(al_) {}
+
+    void fuse_in_body(ASR::stmt_t **m_body, size_t &n_body) {
+        size_t kept = 0, i = 0;
+        while (i < n_body) {
+            m_body[kept] = m_body[i];
+            if (ASR::is_a<ASR::GpuKernelLaunch_t>(*m_body[kept])) {
+                ASR::GpuKernelLaunch_t *head =
+                    ASR::down_cast<ASR::GpuKernelLaunch_t>(m_body[kept]);
+                while (i + 1 < n_body &&
+                        ASR::is_a<ASR::GpuKernelLaunch_t>(*m_body[i + 1]) &&
+                        try_fuse(head, ASR::down_cast<ASR::GpuKernelLaunch_t>(
+                            m_body[i + 1]))) {
+                    i++;
+                }
+            }
+            kept++;
+            i++;
+        }
+        n_body = kept;
+    }
+
+    void visit_Program(const ASR::Program_t &x) {
+        ASR::Program_t &xx = const_cast<ASR::Program_t&>(x);
+        fuse_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_Program(x);
+    }
+
+    void visit_Function(const ASR::Function_t &x) {
+        ASR::Function_t &xx = const_cast<ASR::Function_t&>(x);
+        fuse_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_Function(x);
+    }
+
+    void visit_Block(const ASR::Block_t &x) {
+        ASR::Block_t &xx = const_cast<ASR::Block_t&>(x);
+        fuse_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_Block(x);
+    }
+
+    void visit_If(const ASR::If_t &x) {
+        ASR::If_t &xx = const_cast<ASR::If_t&>(x);
+        fuse_in_body(xx.m_body, xx.n_body);
+        fuse_in_body(xx.m_orelse, xx.n_orelse);
+        BaseWalkVisitor::visit_If(x);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        ASR::DoLoop_t &xx = const_cast<ASR::DoLoop_t&>(x);
+        fuse_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_DoLoop(x);
+    }
+
+    void visit_WhileLoop(const ASR::WhileLoop_t &x) {
+        ASR::WhileLoop_t &xx = const_cast<ASR::WhileLoop_t&>(x);
+        fuse_in_body(xx.m_body, xx.n_body);
+        BaseWalkVisitor::visit_WhileLoop(x);
+    }
+};
+
 void pass_replace_gpu_offload(Allocator &al, ASR::TranslationUnit_t &unit,
                               const LCompilers::PassOptions& pass_options) {
     if (!pass_options.gpu_offload_metal && !pass_options.gpu_offload_cuda) return;
@@ -7281,6 +7883,15 @@ void pass_replace_gpu_offload(Allocator &al, ASR::TranslationUnit_t &unit,
         v.asr_changed = false;
         v.visit_TranslationUnit(unit);
     }
+    // The Metal runtime still launches synchronously, so only the CUDA
+    // backend can drop the interior sync points; eliding them is also what
+    // exposes the adjacent-launch runs that the fusion stage merges.
+    if (pass_options.gpu_offload_cuda) {
+        GpuSyncElisionVisitor e;
+        e.visit_TranslationUnit(unit);
+        GpuKernelFusionVisitor f(al);
+        f.visit_TranslationUnit(unit);
+    }
     // Kernel extraction moves Block symbols out of their enclosing
     // function, which can leave stale entries in that function's
     // dependency list. Recompute all dependencies to fix this.
@@ -728,6 +728,15 @@ class ReplaceArrayConstant: public ASR::BaseExprReplacer<ReplaceArrayConstant> {
             resultvar2value[result_var] == &(x->base)) {
             is_result_var_fixed_size = ASRUtils::is_fixed_size_array(ASRUtils::expr_type(result_var));
         }
+        if( is_result_var_fixed_size &&
+            PassUtils::can_memcpy_array_constant(result_var, x) ) {
+            // `target = [...]` with a matching fixed-size target: keep
+            // the whole-array assignment so the backend copies the
+            // constant from a read-only global instead of expanding it
+            // into one store per element
+            remove_original_statement = false;
+            return ;
+        }
         ASR::ttype_t* result_type_ = nullptr;
         bool is_allocatable = false;
         ASR::expr_t* array_constant_size = get_ArrayConstant_size(x);
@@ -862,7 +871,7 @@ class ArrayConstantVisitor : public ASR::CallReplacerOnExpressionsVisitor<ArrayC
         ASR::expr_t* m_unit = nullptr;
         ReplaceArrayConstant replacer;
         Vec<ASR::stmt_t*> pass_result;
-        Vec<ASR::stmt_t*>* parent_body;
+        VecRewriter<ASR::stmt_t*>* parent_body;
         std::map<ASR::expr_t*, ASR::expr_t*> resultvar2value;
         const LCompilers::PassOptions& pass_options;
 
@@ -930,11 +939,11 @@ class ArrayConstantVisitor : public ASR::CallReplacerOnExpressionsVisitor<ArrayC
         }
 
         void transform_stmts(ASR::stmt_t **&m_body, size_t &n_body) {
-            Vec<ASR::stmt_t*> body;
-            body.reserve(al, n_body);
+            VecRewriter<ASR::stmt_t*> body;
+            body.start(m_body, n_body);
             if( parent_body ) {
                 for (size_t j=0; j < pass_result.size(); j++) {
-                    parent_body->push_back(al, pass_result[j]);
+                    parent_body->insert(al, pass_result[j]);
                 }
             }
 
@@ -943,20 +952,21 @@ class ArrayConstantVisitor : public ASR::CallReplacerOnExpressionsVisitor<ArrayC
                 pass_result.reserve(al, 1);
                 remove_original_statement = false;
                 replacer.result_var = nullptr;
-                Vec<ASR::stmt_t*>* parent_body_copy = parent_body;
+                VecRewriter<ASR::stmt_t*>* parent_body_copy = parent_body;
                 parent_body = &body;
                 visit_stmt(*m_body[i]);
                 parent_body = parent_body_copy;
                 for (size_t j = 0; j < pass_result.size(); j++) {
-                    body.push_back(al, pass_result[j]);
+                    body.insert(al, pass_result[j]);
                 }
                 if( !remove_original_statement ) {
-                    body.push_back(al, m_body[i]);
+                    body.keep(al);
+                } else {
+                    body.skip(al);
                 }
                 remove_original_statement = false;
             }
-            m_body = body.p;
-            n_body = body.size();
+            body.finish(m_body, n_body);
             replacer.result_var = nullptr;
             pass_result.n = 0;
             pass_result.reserve(al, 0);
@@ -102,6 +102,26 @@ class CollectCalls: public ASR::BaseWalkVisitor<CollectCalls> {
 
 };
 
+// Rough size of an ASR fragment, counted as the number of statement and
+// expression nodes; used by the inlining cost model
+class NodeCounter: public ASR::BaseWalkVisitor<NodeCounter> {
+
+    public:
+
+    size_t count = 0;
+
+    void visit_stmt(const ASR::stmt_t& x) {
+        count++;
+        ASR::BaseWalkVisitor<NodeCounter>::visit_stmt(x);
+    }
+
+    void visit_expr(const ASR::expr_t& x) {
+        count++;
+        ASR::BaseWalkVisitor<NodeCounter>::visit_expr(x);
+    }
+
+};
+
 class InlineFunctionCalls: public ASR::BaseExprReplacer<InlineFunctionCalls> {
 
     public:
@@ -111,8 +131,29 @@ class InlineFunctionCalls: public ASR::BaseExprReplacer<InlineFunctionCalls> {
     SymbolTable* current_scope = nullptr;
     SymbolTable* global_scope = nullptr;
 
+    // Cost model: a callee larger than max_callee_size is never inlined,
+    // and each caller may absorb at most max_inlined_per_caller nodes in
+    // total, so chains of inlined calls cannot blow up code size
+    static constexpr size_t max_callee_size = 96;
+    static constexpr size_t max_inlined_per_caller = 1024;
+    size_t inlined_size = 0;
+    std::unordered_map<ASR::symbol_t*, size_t> function_size_cache;
+
     InlineFunctionCalls(Allocator& al_): al(al_) {}
 
+    size_t function_size(ASR::symbol_t* func, ASR::Function_t* function) {
+        auto it = function_size_cache.find(func);
+        if( it != function_size_cache.end() ) {
+            return it->second;
+        }
+        NodeCounter counter;
+        for( size_t i = 0; i < function->n_body; i++ ) {
+            counter.visit_stmt(*function->m_body[i]);
+        }
+        function_size_cache[func] = counter.count;
+        return counter.count;
+    }
+
     bool check_non_global_function_calls(ASR::Function_t* function) {
         Vec<ASR::symbol_t*> called_syms; called_syms.reserve(al, 1);
         for( size_t i = 0; i < function->n_body; i++ ) {
@@ -156,6 +197,14 @@ class InlineFunctionCalls: public ASR::BaseExprReplacer<InlineFunctionCalls> {
             return false;
         }
 
+        // Reject callees the cost model deems too large, either on their
+        // own or on top of what this caller has already absorbed
+        size_t callee_size = function_size(func, function);
+        if( callee_size > max_callee_size ||
+            inlined_size + callee_size > max_inlined_per_caller ) {
+            return false;
+        }
+
         // ⁠Function should have only Variable symbols in its symtab.
         // The type of those Variable symbols shouldn't be FunctionType.
         for( auto sym: function->m_symtab->get_scope() ) {
@@ -365,6 +414,8 @@ class InlineFunctionCalls: public ASR::BaseExprReplacer<InlineFunctionCalls> {
         }
 
         *current_expr = ASRUtils::EXPR(ASR::make_Var_t(al, loc, return_variable));
+        inlined_size += function_size(ASRUtils::symbol_get_past_external(x->m_name),
+            function);
     }
 
     void replace_OverloadedCompare(ASR::OverloadedCompare_t* /*x*/) {
@@ -400,19 +451,34 @@ class InlineFunctionCallsVisitor: public ASR::CallReplacerOnExpressionsVisitor<I
         SymbolTable* current_scope_copy = current_scope;
         current_scope = x.m_symtab;
         replacer.global_scope = x.m_symtab;
-        Vec<ASR::symbol_t*> functions, modules, programme;
-        functions.reserve(al, 1); modules.reserve(al, 1); programme.reserve(al, 1);
+        // Gather every function (global, module and program level) together
+        // with its enclosing scope; program bodies are transformed last
+        std::vector<std::pair<ASR::symbol_t*, SymbolTable*>> functions;
+        Vec<ASR::symbol_t*> programme; programme.reserve(al, 1);
         for( auto sym: x.m_symtab->get_scope() ) {
             switch( sym.second->type ) {
                 case ASR::symbolType::Function: {
-                    functions.push_back(al, sym.second);
+                    functions.push_back(std::make_pair(sym.second, x.m_symtab));
                     break;
                 }
                 case ASR::symbolType::Module: {
-                    modules.push_back(al, sym.second);
+                    ASR::Module_t* module = ASR::down_cast<ASR::Module_t>(sym.second);
+                    for( auto module_sym: module->m_symtab->get_scope() ) {
+                        if( ASR::is_a<ASR::Function_t>(*module_sym.second) ) {
+                            functions.push_back(std::make_pair(
+                                module_sym.second, module->m_symtab));
+                        }
+                    }
                     break;
                 }
                 case ASR::symbolType::Program: {
+                    ASR::Program_t* program = ASR::down_cast<ASR::Program_t>(sym.second);
+                    for( auto program_sym: program->m_symtab->get_scope() ) {
+                        if( ASR::is_a<ASR::Function_t>(*program_sym.second) ) {
+                            functions.push_back(std::make_pair(
+                                program_sym.second, program->m_symtab));
+                        }
+                    }
                     programme.push_back(al, sym.second);
                     break;
                 }
@@ -421,14 +487,68 @@ class InlineFunctionCallsVisitor: public ASR::CallReplacerOnExpressionsVisitor<I
             }
         }
 
+        // Build the call graph over the gathered functions so that callees
+        // are processed before their callers: a caller then inlines the
+        // fully inlined body of each callee instead of its original one
+        std::unordered_map<ASR::symbol_t*, size_t> function_index;
         for( size_t i = 0; i < functions.size(); i++ ) {
-            visit_Function(*ASR::down_cast<ASR::Function_t>(functions.p[i]));
+            function_index[functions[i].first] = i;
+        }
+        std::vector<std::vector<size_t>> callees(functions.size());
+        Vec<ASR::symbol_t*> called_syms; called_syms.reserve(al, 1);
+        for( size_t i = 0; i < functions.size(); i++ ) {
+            ASR::Function_t* function = ASR::down_cast<ASR::Function_t>(
+                functions[i].first);
+            called_syms.n = 0;
+            CollectCalls call_collector(al, called_syms);
+            for( size_t j = 0; j < function->n_body; j++ ) {
+                call_collector.visit_stmt(*function->m_body[j]);
+            }
+            for( size_t j = 0; j < called_syms.size(); j++ ) {
+                auto it = function_index.find(called_syms[j]);
+                if( it != function_index.end() && it->second != i ) {
+                    callees[i].push_back(it->second);
+                }
+            }
         }
 
-        for( size_t i = 0; i < modules.size(); i++ ) {
-            visit_Module(*ASR::down_cast<ASR::Module_t>(modules.p[i]));
+        // Iterative post-order over the call graph (bottom-up); back edges
+        // from recursive cycles are ignored
+        std::vector<int> state(functions.size(), 0); // 0 new, 1 open, 2 done
+        std::vector<size_t> postorder;
+        postorder.reserve(functions.size());
+        for( size_t root = 0; root < functions.size(); root++ ) {
+            if( state[root] != 0 ) {
+                continue;
+            }
+            std::vector<std::pair<size_t, size_t>> dfs_stack;
+            dfs_stack.push_back(std::make_pair(root, 0));
+            state[root] = 1;
+            while( !dfs_stack.empty() ) {
+                size_t node = dfs_stack.back().first;
+                size_t next = dfs_stack.back().second;
+                if( next < callees[node].size() ) {
+                    dfs_stack.back().second++;
+                    size_t child = callees[node][next];
+                    if( state[child] == 0 ) {
+                        state[child] = 1;
+                        dfs_stack.push_back(std::make_pair(child, 0));
+                    }
+                } else {
+                    state[node] = 2;
+                    postorder.push_back(node);
+                    dfs_stack.pop_back();
+                }
+            }
         }
 
+        for( size_t i = 0; i < postorder.size(); i++ ) {
+            current_scope = functions[postorder[i]].second;
+            visit_Function(*ASR::down_cast<ASR::Function_t>(
+                functions[postorder[i]].first));
+        }
+        current_scope = x.m_symtab;
+
         for( size_t i = 0; i < programme.size(); i++ ) {
             visit_Program(*ASR::down_cast<ASR::Program_t>(programme.p[i]));
         }
@@ -436,26 +556,24 @@ class InlineFunctionCallsVisitor: public ASR::CallReplacerOnExpressionsVisitor<I
 
     }
 
-    void visit_Module(const ASR::Module_t& x) {
-        SymbolTable* current_scope_copy = current_scope;
-        current_scope = x.m_symtab;
-        for( auto sym: x.m_symtab->get_scope() ) {
-            if( ASR::is_a<ASR::Function_t>(*sym.second) ) {
-                visit_Function(*ASR::down_cast<ASR::Function_t>(sym.second));
-            }
-        }
-        current_scope = current_scope_copy;
+    void visit_Function(const ASR::Function_t& x) {
+        // Each caller gets its own inlining budget
+        size_t inlined_size_copy = replacer.inlined_size;
+        replacer.inlined_size = 0;
+        ASR::CallReplacerOnExpressionsVisitor<InlineFunctionCallsVisitor>::visit_Function(x);
+        replacer.inlined_size = inlined_size_copy;
+    }
+
+    void visit_Module(const ASR::Module_t& /*x*/) {
+        // Module functions are visited in call-graph post-order from
+        // visit_TranslationUnit
     }
 
     void visit_Program(const ASR::Program_t& x) {
         ASR::Program_t& xx = const_cast<ASR::Program_t&>(x);
         SymbolTable* current_scope_copy = current_scope;
         current_scope = x.m_symtab;
-        for( auto sym: x.m_symtab->get_scope() ) {
-            if( ASR::is_a<ASR::Function_t>(*sym.second) ) {
-                visit_Function(*ASR::down_cast<ASR::Function_t>(sym.second));
-            }
-        }
+        replacer.inlined_size = 0;
         transform_stmts(xx.m_body, xx.n_body);
         current_scope = current_scope_copy;
     }
@@ -11,6 +11,7 @@
 #include <string>
 #include <numeric>
 #include <tuple>
+#include <unordered_map>
 
 namespace LCompilers {
 
@@ -44,6 +45,7 @@ enum class IntrinsicArrayFunctions : int64_t {
     Eoshift,
     Spread,
     Reduce,
+    VectorMath,
     // ...
 };
 
@@ -79,12 +81,18 @@ inline std::string get_array_intrinsic_name(int64_t x) {
         ARRAY_INTRINSIC_NAME_CASE(Eoshift)
         ARRAY_INTRINSIC_NAME_CASE(Spread)
         ARRAY_INTRINSIC_NAME_CASE(Reduce)
+        ARRAY_INTRINSIC_NAME_CASE(VectorMath)
         default : {
             throw LCompilersException("pickle: intrinsic_id not implemented");
         }
     }
 }
 
+// Set by pass_replace_intrinsic_function when --parallel-intrinsics is
+// active; instantiate functions consult it to route eligible large-array
+// cases to the threaded kernels in the runtime library.
+inline bool parallel_intrinsics_enabled = false;
+
 typedef ASR::expr_t* (ASRBuilder::*elemental_operation_func)(ASR::expr_t*,
     ASR::expr_t*);
 
@@ -1674,6 +1682,14 @@ static inline ASR::expr_t *instantiate_MaxMinLoc(Allocator &al,
     } else if (m_dims && m_dims[0].m_start) {
         index_kind = extract_kind_from_ttype_t(expr_type(m_dims[0].m_start));
     }
+    // For 1-D scalar-output maxloc/minloc, track the current best element in
+    // a scalar local so the loop does not reload array(result) through the
+    // result index on every iteration; that loop-carried indirect load keeps
+    // the backend from vectorizing the scan.
+    ASR::expr_t *best_val = nullptr;
+    if (overload_id < 2 && n_dims == 1) {
+        best_val = declare("best_val", ASRUtils::extract_type(arg_types[0]), Local);
+    }
     if (overload_id < 2) {
         b.generate_reduction_intrinsic_stmts_for_scalar_output(
             loc, args[0], fn_symtab, body, idx_vars, doloop_body,
@@ -1686,11 +1702,14 @@ static inline ASR::expr_t *instantiate_MaxMinLoc(Allocator &al,
                     ASR::expr_t *maskval = ASRUtils::is_array_t(args[2])? b.ArrayItem_01(args[2], {i}) : args[2];
                     // Cast i to result type if needed when assigning to result
                     ASR::expr_t *i_result = (result_kind != index_kind) ? b.i2i_t(i, type) : i;
+                    std::vector<ASR::stmt_t*> found_body;
+                    found_body.push_back(b.Assignment(result, i_result));
+                    if (best_val) {
+                        found_body.push_back(b.Assignment(best_val, b.ArrayItem_01(args[0], {i})));
+                    }
+                    found_body.push_back(b.Exit());
                     body.push_back(al, b.DoLoop(i, b.GetLBound(args[0], 1, index_kind), b.GetUBound(args[0], 1, index_kind), {
-                        b.If(b.Eq(maskval, b.bool_t(1, logical)), {
-                            b.Assignment(result, i_result),
-                            b.Exit()
-                        }, {})
+                        b.If(b.Eq(maskval, b.bool_t(1, logical)), found_body, {})
                     }, nullptr));
                 } else {
                     // Cast LBound to result type if needed
@@ -1698,9 +1717,13 @@ static inline ASR::expr_t *instantiate_MaxMinLoc(Allocator &al,
                     if (result_kind != index_kind) {
                         lb = b.i2i_t(lb, type);
                     }
-                    body.push_back(al, b.If(b.Eq(args[2], b.bool_t(1, logical)), {
-                        b.Assignment(result, lb)
-                    }, {}));
+                    std::vector<ASR::stmt_t*> init_body;
+                    init_body.push_back(b.Assignment(result, lb));
+                    if (best_val) {
+                        init_body.push_back(b.Assignment(best_val,
+                            b.ArrayItem_01(args[0], {b.GetLBound(args[0], 1, index_kind)})));
+                    }
+                    body.push_back(al, b.If(b.Eq(args[2], b.bool_t(1, logical)), init_body, {}));
                 }
             }, [=, &al, &b, &idx_vars, &doloop_body, &result_kind, &index_kind] () {
                 ASR::expr_t* result_check = !ASRUtils::is_array(return_type) ?
@@ -1726,7 +1749,10 @@ static inline ASR::expr_t *instantiate_MaxMinLoc(Allocator &al,
                     ArrayItem_02(args[2], idx_vars) : args[2];
                 Vec<ASR::stmt_t*> comparison_body;
                 comparison_body.reserve(al, 1);
-                ASR::expr_t *array_ref_02 = ArrayItem_02(args[0], result_idx);
+                ASR::expr_t *array_ref_02 = best_val ? best_val : ArrayItem_02(args[0], result_idx);
+                if (best_val) {
+                    if_body.push_back(b.Assignment(best_val, array_ref_01));
+                }
                 if (overload_id == 1) {
                     if (static_cast<int64_t>(IntrinsicArrayFunctions::MaxLoc) == static_cast<int64_t>(intrinsic_func_id)) {
                         comparison_body.push_back(al, b.If(b.Eq(args[4], b.bool_t(1, logical)), {
@@ -2197,6 +2223,47 @@ namespace Cshift {
         }
         ASR::expr_t *result = declare("result", return_type_, Out);
         args.push_back(al, result);
+        ASR::ttype_t* el_type = ASRUtils::extract_type(arg_types[0]);
+        if (shifting_dim == 1 && !ASRUtils::is_array(arg_types[1]) &&
+                (is_integer(*el_type) || is_real(*el_type) || is_complex(*el_type))) {
+            // The shifted dimension is contiguous: the runtime kernel rotates
+            // each dim-1 column with two memcpy regions instead of running
+            // the per-element loops below.
+            int el_kind = ASRUtils::extract_kind_from_ttype_t(el_type);
+            int64_t elem_size = (int64_t)el_kind * (is_complex(*el_type) ? 2 : 1);
+            std::string c_func_name = "_lfortran_cshift_dim1";
+            Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 6);
+            param_types.push_back(al, b.CPtr());
+            param_types.push_back(al, b.CPtr());
+            for (int p = 0; p < 4; p++) param_types.push_back(al, int64);
+            ASR::symbol_t* kernel = b.create_c_subroutine_interface(c_func_name,
+                fn_symtab, param_types, {"dest", "src", "elem_size", "m", "ncols", "shift"},
+                {true, true, true, true, true, true});
+            fn_symtab->add_symbol(c_func_name, kernel);
+            dep.push_back(al, s2c(al, c_func_name));
+            Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 6);
+            kernel_args.push_back(al, {loc, b.PointerToCPtr(result, b.CPtr())});
+            kernel_args.push_back(al, {loc, b.PointerToCPtr(args[0], b.CPtr())});
+            // Build the sizes in the default kind and cast explicitly:
+            // pass_array_by_data rewrites ArraySize into the hidden
+            // integer(4) size argument, so an int64-typed ArraySize would
+            // leave the kernel call with mixed kinds
+            kernel_args.push_back(al, {loc, b.i_t(elem_size, int64)});
+            kernel_args.push_back(al, {loc, b.i2i_t(b.ArraySize(args[0], b.i32(1), int32), int64)});
+            kernel_args.push_back(al, {loc, b.Div(
+                b.i2i_t(b.ArraySize(args[0], nullptr, int32), int64),
+                b.i2i_t(b.ArraySize(args[0], b.i32(1), int32), int64))});
+            kernel_args.push_back(al, {loc, b.i2i_t(args[1], int64)});
+            body.push_back(al, b.SubroutineCall(kernel, kernel_args));
+            body.push_back(al, b.Return());
+            ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                    body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+            scope->add_symbol(fn_name, fn_sym);
+            Vec<ASR::call_arg_t> new_args; new_args.reserve(al, 2);
+            new_args.push_back(al, m_args[0]);
+            new_args.push_back(al, m_args[1]);
+            return b.Call(fn_sym, new_args, return_type, nullptr);
+        }
         ASR::expr_t *i = declare("i", b.int_type(index_kind), Local);
         ASR::expr_t *j = declare("j", b.int_type(index_kind), Local);
         int n_dims = extract_n_dims_from_ttype(return_type);
@@ -2837,6 +2904,41 @@ namespace Eoshift {
         }
         ASR::expr_t *result = declare("result", return_type_, Out);
         args.push_back(al, result);
+        ASR::ttype_t* el_type = ASRUtils::extract_type(arg_types[0]);
+        if (extract_n_dims_from_ttype(arg_types[0]) == 1 &&
+                !ASRUtils::is_array(arg_types[1]) &&
+                (is_integer(*el_type) || is_real(*el_type) || is_complex(*el_type))) {
+            // Contiguous rank-1 shift: one memcpy of the kept region plus a
+            // boundary fill in the runtime kernel instead of element loops.
+            int el_kind = ASRUtils::extract_kind_from_ttype_t(el_type);
+            int64_t elem_size = (int64_t)el_kind * (is_complex(*el_type) ? 2 : 1);
+            std::string c_func_name = "_lfortran_eoshift_dim1";
+            Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 6);
+            param_types.push_back(al, b.CPtr());
+            param_types.push_back(al, b.CPtr());
+            param_types.push_back(al, ASRUtils::extract_type(arg_types[2]));
+            for (int p = 0; p < 3; p++) param_types.push_back(al, int64);
+            ASR::symbol_t* kernel = b.create_c_subroutine_interface(c_func_name,
+                fn_symtab, param_types, {"dest", "src", "boundary", "elem_size", "m", "shift"},
+                {true, true, false, true, true, true});
+            fn_symtab->add_symbol(c_func_name, kernel);
+            dep.push_back(al, s2c(al, c_func_name));
+            Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 6);
+            kernel_args.push_back(al, {loc, b.PointerToCPtr(result, b.CPtr())});
+            kernel_args.push_back(al, {loc, b.PointerToCPtr(args[0], b.CPtr())});
+            kernel_args.push_back(al, {loc, args[2]});
+            kernel_args.push_back(al, {loc, b.i_t(elem_size, int64)});
+            // cast explicitly: pass_array_by_data rewrites ArraySize into
+            // the hidden integer(4) size argument, losing the int64 kind
+            kernel_args.push_back(al, {loc, b.i2i_t(b.ArraySize(args[0], nullptr, int32), int64)});
+            kernel_args.push_back(al, {loc, b.i2i_t(args[1], int64)});
+            body.push_back(al, b.SubroutineCall(kernel, kernel_args));
+            body.push_back(al, b.Return());
+            ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                    body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+            scope->add_symbol(fn_name, fn_sym);
+            return b.Call(fn_sym, m_args, return_type, nullptr);
+        }
         ASR::expr_t *i = declare("i", b.int_type(index_kind), Local);
         ASR::expr_t *j = declare("j", b.int_type(index_kind), Local);
         ASR::expr_t* abs_shift = declare("z", b.int_type(index_kind), Local);
@@ -3667,6 +3769,39 @@ namespace Sum {
             const Location &loc, SymbolTable *scope, Vec<ASR::ttype_t*>& arg_types,
             ASR::ttype_t *return_type, Vec<ASR::call_arg_t>& new_args,
             int64_t overload_id, int index_kind) {
+        if (parallel_intrinsics_enabled && overload_id == 0 &&
+                is_real(*return_type)) {
+            // whole-array real sum: call the blocked pairwise reduction
+            // kernel (threaded for large arrays) instead of expanding the
+            // sequential accumulation loop
+            int el_kind = ASRUtils::extract_kind_from_ttype_t(return_type);
+            ASR::ttype_t* a_type = ASRUtils::extract_type(arg_types[0]);
+            if ((el_kind == 4 || el_kind == 8) && is_real(*a_type) &&
+                    ASRUtils::extract_kind_from_ttype_t(a_type) == el_kind) {
+                declare_basic_variables("_lcompilers_sum");
+                fill_func_arg("array", duplicate_type_with_empty_dims(al, arg_types[0]));
+                ASR::expr_t *result = declare("result", return_type, ReturnVar);
+                std::string c_func_name = el_kind == 4 ?
+                    "_lfortran_parallel_sum_r32" : "_lfortran_parallel_sum_r64";
+                Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 2);
+                param_types.push_back(al, b.CPtr());
+                param_types.push_back(al, int64);
+                ASR::symbol_t* kernel = b.create_c_func(c_func_name, fn_symtab,
+                    return_type, 2, param_types);
+                fn_symtab->add_symbol(c_func_name, kernel);
+                dep.push_back(al, s2c(al, c_func_name));
+                Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 2);
+                kernel_args.push_back(al, {loc, b.PointerToCPtr(args[0], b.CPtr())});
+                kernel_args.push_back(al, {loc, b.ArraySize(args[0], nullptr, int64)});
+                body.push_back(al, b.Assignment(result,
+                    b.Call(kernel, kernel_args, return_type)));
+                body.push_back(al, b.Return());
+                ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                        body, result, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+                scope->add_symbol(fn_name, fn_sym);
+                return b.Call(fn_sym, new_args, return_type, nullptr);
+            }
+        }
         return ArrIntrinsic::instantiate_ArrIntrinsic(al, loc, scope, arg_types,
             return_type, new_args, overload_id, index_kind, IntrinsicArrayFunctions::Sum,
             &get_constant_zero_with_given_type, &ASRBuilder::Add);
@@ -4897,6 +5032,35 @@ namespace MatMul {
         }
         ret_type = ASRUtils::duplicate_type(al, ret_type, &result_dims);
         ASR::expr_t *value = eval_MatMul(al, loc, ret_type, args, diag);
+        // matmul(transpose(a), b): drop the transpose and record the flip in
+        // the overload id (4: a transposed, 5: b transposed, 6: both), so the
+        // generated loops read the original matrix with swapped subscripts
+        // instead of materializing a transposed copy first.
+        if (overload_id == 3) {
+            auto strip_transpose = [&](ASR::expr_t*& m) -> bool {
+                if (!ASR::is_a<ASR::IntrinsicArrayFunction_t>(*m)) {
+                    return false;
+                }
+                ASR::IntrinsicArrayFunction_t* iaf =
+                    ASR::down_cast<ASR::IntrinsicArrayFunction_t>(m);
+                if (iaf->m_arr_intrinsic_id != static_cast<int64_t>(
+                        IntrinsicArrayFunctions::Transpose) ||
+                        iaf->m_value != nullptr) {
+                    return false;
+                }
+                m = iaf->m_args[0];
+                return true;
+            };
+            bool a_transposed = strip_transpose(args.p[0]);
+            bool b_transposed = strip_transpose(args.p[1]);
+            if (a_transposed && b_transposed) {
+                overload_id = 6;
+            } else if (a_transposed) {
+                overload_id = 4;
+            } else if (b_transposed) {
+                overload_id = 5;
+            }
+        }
         return make_IntrinsicArrayFunction_t_util(al, loc,
             static_cast<int64_t>(IntrinsicArrayFunctions::MatMul),
             args.p, args.n, overload_id, ret_type, value);
@@ -4950,9 +5114,15 @@ namespace MatMul {
         extract_dimensions_from_ttype(arg_types[1], matrix_b_dims);
         ASR::expr_t *res_ref, *a_ref, *b_ref, *a_lbound, *b_lbound;
         ASR::expr_t *dim_mismatch_check, *a_ubound, *b_ubound;
-        dim_mismatch_check = b.Eq(b.GetUBound(args[0], 2), b.GetUBound(args[1], 1));
-        a_lbound = b.GetLBound(args[0], 1); a_ubound = b.GetUBound(args[0], 1);
-        b_lbound = b.GetLBound(args[1], 2); b_ubound = b.GetUBound(args[1], 2);
+        // Overload ids 4-6 mark operands whose transpose() was folded into
+        // the matmul at creation time; read them with swapped subscripts.
+        bool a_transposed = (overload_id == 4 || overload_id == 6);
+        bool b_transposed = (overload_id == 5 || overload_id == 6);
+        int a_row_dim = a_transposed ? 2 : 1, a_inner_dim = a_transposed ? 1 : 2;
+        int b_col_dim = b_transposed ? 1 : 2, b_inner_dim = b_transposed ? 2 : 1;
+        dim_mismatch_check = b.Eq(b.GetUBound(args[0], a_inner_dim), b.GetUBound(args[1], b_inner_dim));
+        a_lbound = b.GetLBound(args[0], a_row_dim); a_ubound = b.GetUBound(args[0], a_row_dim);
+        b_lbound = b.GetLBound(args[1], b_col_dim); b_ubound = b.GetUBound(args[1], b_col_dim);
         std::string assert_msg = "'MatMul' intrinsic dimension mismatch: "
             "please make sure the dimensions are ";
         Vec<ASR::dimension_t> alloc_dims; alloc_dims.reserve(al, 1);
@@ -4976,10 +5146,12 @@ namespace MatMul {
         } else {
             // r(i, j) = r(i, j) + a(i, k) * b(k, j)
             res_ref = b.ArrayItem_01(result,  {i, j});
-            a_ref   = b.ArrayItem_01(args[0], {i, k});
-            b_ref   = b.ArrayItem_01(args[1], {k, j});
-            alloc_dims.push_back(al, b.set_dim(b.GetLBound(args[0], 1), b.GetUBound(args[0], 1)));
-            alloc_dims.push_back(al, b.set_dim(b.GetLBound(args[1], 2), b.GetUBound(args[1], 2)));
+            a_ref   = a_transposed ? b.ArrayItem_01(args[0], {k, i})
+                                   : b.ArrayItem_01(args[0], {i, k});
+            b_ref   = b_transposed ? b.ArrayItem_01(args[1], {j, k})
+                                   : b.ArrayItem_01(args[1], {k, j});
+            alloc_dims.push_back(al, b.set_dim(b.GetLBound(args[0], a_row_dim), b.GetUBound(args[0], a_row_dim)));
+            alloc_dims.push_back(al, b.set_dim(b.GetLBound(args[1], b_col_dim), b.GetUBound(args[1], b_col_dim)));
             assert_msg += "`matrix_a(i, k)` and `matrix_b(k, j)`";
         }
         // Note: allocation/reallocation for allocatable results is handled by
@@ -4987,6 +5159,43 @@ namespace MatMul {
         body.push_back(al, STMT(ASR::make_Assert_t(al, loc, dim_mismatch_check,
             EXPR(ASR::make_StringConstant_t(al, loc, s2c(al, assert_msg),
             character(assert_msg.size()))))));
+        if (parallel_intrinsics_enabled && overload_id == 3) {
+            // matrix x matrix on same-kind reals: call the threaded runtime
+            // kernel c(m, n) = a(m, k) * b(k, n) instead of building the
+            // triple loop; the kernel keeps small products on one thread
+            ASR::ttype_t* el_type = ASRUtils::extract_type(return_type);
+            int el_kind = ASRUtils::extract_kind_from_ttype_t(el_type);
+            ASR::ttype_t* a_type = ASRUtils::extract_type(arg_types[0]);
+            ASR::ttype_t* b_type = ASRUtils::extract_type(arg_types[1]);
+            if (is_real(*el_type) && (el_kind == 4 || el_kind == 8) &&
+                    is_real(*a_type) && is_real(*b_type) &&
+                    ASRUtils::extract_kind_from_ttype_t(a_type) == el_kind &&
+                    ASRUtils::extract_kind_from_ttype_t(b_type) == el_kind) {
+                std::string c_func_name = el_kind == 4 ?
+                    "_lfortran_parallel_matmul_r32" : "_lfortran_parallel_matmul_r64";
+                Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 6);
+                for (int p = 0; p < 3; p++) param_types.push_back(al, b.CPtr());
+                for (int p = 0; p < 3; p++) param_types.push_back(al, int64);
+                ASR::symbol_t* kernel = b.create_c_subroutine_interface(c_func_name,
+                    fn_symtab, param_types, {"a", "b", "c", "m", "k", "n"},
+                    {true, true, true, true, true, true});
+                fn_symtab->add_symbol(c_func_name, kernel);
+                dep.push_back(al, s2c(al, c_func_name));
+                Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 6);
+                kernel_args.push_back(al, {loc, b.PointerToCPtr(args[0], b.CPtr())});
+                kernel_args.push_back(al, {loc, b.PointerToCPtr(args[1], b.CPtr())});
+                kernel_args.push_back(al, {loc, b.PointerToCPtr(result, b.CPtr())});
+                kernel_args.push_back(al, {loc, b.ArraySize(args[0], b.i32(1), int64)});
+                kernel_args.push_back(al, {loc, b.ArraySize(args[0], b.i32(2), int64)});
+                kernel_args.push_back(al, {loc, b.ArraySize(args[1], b.i32(2), int64)});
+                body.push_back(al, b.SubroutineCall(kernel, kernel_args));
+                body.push_back(al, b.Return());
+                ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                        body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+                scope->add_symbol(fn_name, fn_sym);
+                return b.Call(fn_sym, m_args, return_type, nullptr);
+            }
+        }
         ASR::expr_t *mul_value;
         if (is_real(*expr_type(a_ref)) && is_integer(*expr_type(b_ref))) {
             mul_value = b.Mul(a_ref, b.i2r_t(b_ref, expr_type(a_ref)));
@@ -5010,7 +5219,7 @@ namespace MatMul {
         body.push_back(al, b.DoLoop(i, a_lbound, a_ubound, {
             b.DoLoop(j, b_lbound, b_ubound, {
                 b.Assign_Constant(res_ref, 0),
-                b.DoLoop(k, b.GetLBound(args[1], 1), b.GetUBound(args[1], 1), {
+                b.DoLoop(k, b.GetLBound(args[1], b_inner_dim), b.GetUBound(args[1], b_inner_dim), {
                     b.Assignment(res_ref, b.Add(res_ref, mul_value))
                 }),
             })
@@ -5024,6 +5233,57 @@ namespace MatMul {
 
 } // namespace MatMul
 
+namespace VectorMath {
+
+    // Lowers a whole-array elemental sin/cos/exp/log over real(4/8) arrays
+    // into a single call of the matching `_lfortran_v*` runtime kernel;
+    // used by pass_replace_intrinsic_function under --parallel-intrinsics
+    // instead of instantiating the scalar function and looping per element.
+    static inline ASR::expr_t* instantiate_VectorMath(Allocator &al,
+            const Location &loc, SymbolTable *scope,
+            const std::string &kernel_base_name,
+            Vec<ASR::ttype_t*> &arg_types, ASR::ttype_t *return_type,
+            Vec<ASR::call_arg_t> &m_args) {
+        int el_kind = ASRUtils::extract_kind_from_ttype_t(return_type);
+        declare_basic_variables("_lcompilers_v" + kernel_base_name
+            + "_r" + std::to_string(el_kind * 8));
+        fill_func_arg("x", duplicate_type_with_empty_dims(al, arg_types[0]));
+        ASR::ttype_t* return_type_ = return_type;
+        if( !ASRUtils::is_fixed_size_array(return_type) ) {
+            bool is_allocatable = ASRUtils::is_allocatable(return_type);
+            return_type_ = ASRUtils::duplicate_type_with_empty_dims(al,
+                ASRUtils::type_get_past_allocatable(return_type));
+            if( is_allocatable ) {
+                return_type_ = ASRUtils::TYPE(ASRUtils::make_Allocatable_t_util(
+                    al, loc, return_type_));
+            }
+        }
+        ASR::expr_t *result = declare("result", return_type_, Out);
+        args.push_back(al, result);
+        std::string c_func_name = "_lfortran_v" + kernel_base_name +
+            (el_kind == 4 ? "_r32" : "_r64");
+        Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 3);
+        param_types.push_back(al, b.CPtr());
+        param_types.push_back(al, b.CPtr());
+        param_types.push_back(al, int64);
+        ASR::symbol_t* kernel = b.create_c_subroutine_interface(c_func_name,
+            fn_symtab, param_types, {"dest", "src", "n"}, {true, true, true});
+        fn_symtab->add_symbol(c_func_name, kernel);
+        dep.push_back(al, s2c(al, c_func_name));
+        Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 3);
+        kernel_args.push_back(al, {loc, b.PointerToCPtr(result, b.CPtr())});
+        kernel_args.push_back(al, {loc, b.PointerToCPtr(args[0], b.CPtr())});
+        kernel_args.push_back(al, {loc, b.ArraySize(args[0], nullptr, int64)});
+        body.push_back(al, b.SubroutineCall(kernel, kernel_args));
+        body.push_back(al, b.Return());
+        ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+        scope->add_symbol(fn_name, fn_sym);
+        return b.Call(fn_sym, m_args, return_type, nullptr);
+    }
+
+} // namespace VectorMath
+
 namespace Count {
 
     static inline void verify_args(const ASR::IntrinsicArrayFunction_t &x,
@@ -5222,9 +5482,7 @@ namespace Count {
                     }
                 }
                 ASR::stmt_t* inner_most_do_loop = b.DoLoop(j, b.GetLBound(args[0], dim_val), b.GetUBound(args[0], dim_val), {
-                    b.If(b.ArrayItem_01(args[0], idx), {
-                        b.Assignment(c, b.Add(c, b.i32(1))),
-                    }, {})
+                    b.Assignment(c, b.Add(c, b.l2i_t(b.ArrayItem_01(args[0], idx), int32)))
                 });
                 return PassUtils::create_do_loop_helper_count_dim(al, loc,
                                         idx, res_idx, inner_most_do_loop, c, args[0], result, 0, dim_val);
@@ -6723,6 +6981,40 @@ namespace DotProduct {
                 res = res + matrix_a(i) * matrix_b(i)
             end do
         */
+        if (parallel_intrinsics_enabled && is_real(*return_type)) {
+            // same-kind reals: call the runtime dot kernel (threaded, or
+            // sdot/ddot when the runtime is built against a BLAS) instead
+            // of building the accumulation loop
+            int el_kind = ASRUtils::extract_kind_from_ttype_t(return_type);
+            ASR::ttype_t* a_type = ASRUtils::extract_type(arg_types[0]);
+            ASR::ttype_t* b_type = ASRUtils::extract_type(arg_types[1]);
+            if ((el_kind == 4 || el_kind == 8) &&
+                    is_real(*a_type) && is_real(*b_type) &&
+                    ASRUtils::extract_kind_from_ttype_t(a_type) == el_kind &&
+                    ASRUtils::extract_kind_from_ttype_t(b_type) == el_kind) {
+                std::string c_func_name = el_kind == 4 ?
+                    "_lfortran_parallel_dot_r32" : "_lfortran_parallel_dot_r64";
+                Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 3);
+                param_types.push_back(al, b.CPtr());
+                param_types.push_back(al, b.CPtr());
+                param_types.push_back(al, int64);
+                ASR::symbol_t* kernel = b.create_c_func(c_func_name, fn_symtab,
+                    return_type, 3, param_types);
+                fn_symtab->add_symbol(c_func_name, kernel);
+                dep.push_back(al, s2c(al, c_func_name));
+                Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 3);
+                kernel_args.push_back(al, {loc, b.PointerToCPtr(args[0], b.CPtr())});
+                kernel_args.push_back(al, {loc, b.PointerToCPtr(args[1], b.CPtr())});
+                kernel_args.push_back(al, {loc, b.ArraySize(args[0], b.i32(1), int64)});
+                body.push_back(al, b.Assignment(result,
+                    b.Call(kernel, kernel_args, return_type)));
+                body.push_back(al, b.Return());
+                ASR::symbol_t *fn_sym = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+                        body, result, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+                scope->add_symbol(fn_name, fn_sym);
+                return b.Call(fn_sym, m_args, return_type, nullptr);
+            }
+        }
         if (is_logical(*return_type)) {
             body.push_back(al, b.Assignment(result, ASRUtils::EXPR(ASR::make_LogicalConstant_t(al, loc, false, return_type))));
             body.push_back(al, b.DoLoop(i, b.GetLBound(args[0], 1), b.GetUBound(args[0], 1), {
@@ -6978,9 +7270,9 @@ namespace IntrinsicArrayFunctionRegistry {
         return intrinsic_function_by_id_db;
     }
 
-    inline const std::map<std::string, std::tuple<create_intrinsic_function,
+    inline const std::unordered_map<std::string, std::tuple<create_intrinsic_function,
             eval_intrinsic_function>>& get_function_by_name_db() {
-        static const std::map<std::string, std::tuple<create_intrinsic_function,
+        static const std::unordered_map<std::string, std::tuple<create_intrinsic_function,
                 eval_intrinsic_function>> function_by_name_db = {
         {"any", {&Any::create_Any, &Any::eval_Any}},
         {"all", {&All::create_All, &All::eval_All}},
@@ -44,6 +44,53 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
         index_kind(index_kind_) {}
 
 
+    // Under --parallel-intrinsics, whole-array sin/cos/exp/log over real(4/8)
+    // arrays become one call of the matching `_lfortran_v*` runtime kernel
+    // instead of one libm call per element; returns false when the
+    // application is not eligible so the caller takes the usual path.
+    bool replace_with_vector_math_kernel(ASR::IntrinsicElementalFunction_t* x) {
+        if (x->n_args != 1 || !ASRUtils::is_array(x->m_type)) {
+            return false;
+        }
+        std::string kernel_base_name;
+        switch (x->m_intrinsic_id) {
+            case static_cast<int64_t>(ASRUtils::IntrinsicElementalFunctions::Sin):
+                kernel_base_name = "sin"; break;
+            case static_cast<int64_t>(ASRUtils::IntrinsicElementalFunctions::Cos):
+                kernel_base_name = "cos"; break;
+            case static_cast<int64_t>(ASRUtils::IntrinsicElementalFunctions::Exp):
+                kernel_base_name = "exp"; break;
+            case static_cast<int64_t>(ASRUtils::IntrinsicElementalFunctions::Log):
+                kernel_base_name = "log"; break;
+            default:
+                return false;
+        }
+        ASR::ttype_t* arg_type = ASRUtils::expr_type(x->m_args[0]);
+        ASR::ttype_t* el_type = ASRUtils::extract_type(x->m_type);
+        int el_kind = ASRUtils::extract_kind_from_ttype_t(el_type);
+        if (!ASRUtils::is_array(arg_type) ||
+                !ASRUtils::is_real(*el_type) || (el_kind != 4 && el_kind != 8) ||
+                !ASRUtils::is_real(*ASRUtils::extract_type(arg_type)) ||
+                ASRUtils::extract_kind_from_ttype_t(arg_type) != el_kind) {
+            return false;
+        }
+        Vec<ASR::ttype_t*> arg_types; arg_types.reserve(al, 1);
+        arg_types.push_back(al, arg_type);
+        Vec<ASR::call_arg_t> new_args; new_args.reserve(al, 1);
+        ASR::call_arg_t arg0;
+        arg0.loc = (*current_expr)->base.loc;
+        arg0.m_value = x->m_args[0];
+        new_args.push_back(al, arg0);
+        ASR::expr_t* func_call = ASRUtils::VectorMath::instantiate_VectorMath(
+            al, x->base.base.loc, global_scope, kernel_base_name, arg_types,
+            x->m_type, new_args);
+        *current_expr = func_call;
+        ASR::symbol_t *call_sym = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::FunctionCall_t>(func_call)->m_name);
+        func2intrinsicid[call_sym] = ASRUtils::IntrinsicArrayFunctions::VectorMath;
+        return true;
+    }
+
     void replace_IntrinsicElementalFunction(ASR::IntrinsicElementalFunction_t* x) {
         if (x->m_value) {
             *current_expr = x->m_value;
@@ -53,6 +100,11 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
         // Then keep the IntrinsicElementalFunction because its arguments are used to find ArraySize
         if (in_debugcheck && !in_ttype) return;
 
+        if (ASRUtils::parallel_intrinsics_enabled && !in_ttype &&
+                replace_with_vector_math_kernel(x)) {
+            return;
+        }
+
         Vec<ASR::call_arg_t> new_args; new_args.reserve(al, x->n_args);
         // Replace any IntrinsicElementalFunctions in the argument first:
         for( size_t i = 0; i < x->n_args; i++ ) {
@@ -79,6 +131,31 @@ class ReplaceIntrinsicFunctions: public ASR::BaseExprReplacer<ReplaceIntrinsicFu
         }
         ASR::ttype_t* type = nullptr;
         type = ASRUtils::extract_type(x->m_type);
+        // Inline-expansion tier: trivial intrinsics (mod, dim, ...) expand
+        // to a couple of instructions directly at the call site when every
+        // actual argument is cheap to re-evaluate; anything else falls
+        // through to the usual helper-function instantiation below.
+        if (!ASRUtils::is_array(x->m_type)) {
+            ASRUtils::impl_function inline_expansion =
+                ASRUtils::IntrinsicElementalFunctionRegistry::get_inline_expansion_function(x->m_intrinsic_id);
+            if (inline_expansion != nullptr) {
+                bool args_duplicable = true;
+                for (size_t i = 0; i < x->n_args; i++) {
+                    if (!ASRUtils::IntrinsicElementalFunctionRegistry::is_cheap_to_duplicate(x->m_args[i])) {
+                        args_duplicable = false;
+                        break;
+                    }
+                }
+                if (args_duplicable) {
+                    ASR::expr_t* expansion = inline_expansion(al, x->base.base.loc,
+                        global_scope, arg_types, type, new_args, x->m_overload_id, index_kind);
+                    if (expansion) {
+                        *current_expr = expansion;
+                        return;
+                    }
+                }
+            }
+        }
         ASR::expr_t* current_expr_ = instantiate_function(al, x->base.base.loc,
             global_scope, arg_types, type, new_args, x->m_overload_id, index_kind);
         if (current_expr_) {
@@ -394,6 +471,7 @@ class ReplaceFunctionCallReturningArrayVisitor : public ASR::CallReplacerOnExpre
 void pass_replace_intrinsic_function(Allocator &al, ASR::TranslationUnit_t &unit,
                             const LCompilers::PassOptions& pass_options) {
     int index_kind = pass_options.descriptor_index_64 ? 8 : 4;
+    ASRUtils::parallel_intrinsics_enabled = pass_options.parallel_intrinsics;
     std::map<ASR::symbol_t*, ASRUtils::IntrinsicArrayFunctions> func2intrinsicid;
     ReplaceIntrinsicFunctionsVisitor v(al, unit.m_symtab, func2intrinsicid, index_kind);
     v.visit_TranslationUnit(unit);
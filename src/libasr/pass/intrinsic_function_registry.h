@@ -6,6 +6,7 @@
 #include <cmath>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 
 namespace LCompilers {
 
@@ -618,10 +619,10 @@ namespace IntrinsicElementalFunctionRegistry {
     }
 
 
-    inline const std::map<std::string,
+    inline const std::unordered_map<std::string,
         std::tuple<create_intrinsic_function,
                     eval_intrinsic_function>>& get_intrinsic_function_by_name_db() {
-        static const std::map<std::string,
+        static const std::unordered_map<std::string,
             std::tuple<create_intrinsic_function,
                         eval_intrinsic_function>> intrinsic_function_by_name_db = {
                 {"type", {&ObjectType::create_ObjectType, &ObjectType::eval_ObjectType}},
@@ -842,6 +843,38 @@ namespace IntrinsicElementalFunctionRegistry {
         return std::get<0>(get_intrinsic_function_by_id_db().at(id));
     }
 
+    // Inline-expansion tier: intrinsics whose implementation is only a few
+    // instructions can provide a direct expression built at the call site,
+    // with the helper-function instantiation above as the fallback (the
+    // inline_* function may itself return nullptr for cases it does not
+    // cover, e.g. real modulo).
+    inline const std::map<int64_t, impl_function>& get_inline_expansion_by_id_db() {
+        static const std::map<int64_t, impl_function> inline_expansion_by_id_db = {
+        {static_cast<int64_t>(IntrinsicElementalFunctions::Mod),
+            &Mod::inline_Mod},
+        {static_cast<int64_t>(IntrinsicElementalFunctions::Dim),
+            &Dim::inline_Dim},
+        {static_cast<int64_t>(IntrinsicElementalFunctions::Modulo),
+            &Modulo::inline_Modulo},
+        };
+        return inline_expansion_by_id_db;
+    }
+
+    static inline impl_function get_inline_expansion_function(int64_t id) {
+        if( get_inline_expansion_by_id_db().find(id) == get_inline_expansion_by_id_db().end() ) {
+            return nullptr;
+        }
+        return get_inline_expansion_by_id_db().at(id);
+    }
+
+    // The inline expansions duplicate their arguments, so they are only
+    // used when re-evaluating an argument is side-effect free and costs at
+    // most a load: a variable reference or a compile-time constant.
+    static inline bool is_cheap_to_duplicate(ASR::expr_t* expr) {
+        return expr != nullptr && (ASR::is_a<ASR::Var_t>(*expr) ||
+            expr_value(expr) != nullptr);
+    }
+
     static inline std::string get_intrinsic_function_name(int64_t id) {
         // Use switch statement instead of lazy map for zero runtime overhead
         return get_intrinsic_name(id);
@@ -907,9 +940,9 @@ namespace IsIostatEor {
 
 namespace IntrinsicImpureFunctionRegistry {
 
-    inline const std::map<std::string, std::tuple<create_intrinsic_function,
+    inline const std::unordered_map<std::string, std::tuple<create_intrinsic_function,
             eval_intrinsic_function>>& get_function_by_name_db() {
-        static const std::map<std::string, std::tuple<create_intrinsic_function,
+        static const std::unordered_map<std::string, std::tuple<create_intrinsic_function,
                 eval_intrinsic_function>> function_by_name_db = {
             {"is_iostat_end", {&IsIostatEnd::create_IsIostatEnd, nullptr}},
             {"is_iostat_eor", {&IsIostatEor::create_IsIostatEor, nullptr}},
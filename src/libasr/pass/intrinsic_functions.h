@@ -3263,6 +3263,22 @@ namespace Dim {
 
     }
 
+    // Direct expansion used by the registry's inline tier:
+    // dim(x, y) = max(x - y, 0), a single compare-and-select, so the
+    // helper-function call is pure overhead for cheap arguments.
+    static inline ASR::expr_t* inline_Dim(Allocator &al, const Location &loc,
+            SymbolTable* /*scope*/, Vec<ASR::ttype_t*>& arg_types, ASR::ttype_t* /*return_type*/,
+            Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/, int /*index_kind*/) {
+        ASRBuilder b(al, loc);
+        ASR::expr_t* x = new_args[0].m_value;
+        if (is_real(*arg_types[0])) {
+            return b.Max(b.Sub(x, b.r2r_t(new_args[1].m_value, arg_types[0])),
+                b.f_t(0.0, arg_types[0]));
+        }
+        return b.Max(b.Sub(x, b.i2i_t(new_args[1].m_value, arg_types[0])),
+            b.i_t(0, arg_types[0]));
+    }
+
 } // namespace Dim
 
 namespace Sqrt {
@@ -3880,6 +3896,35 @@ namespace Mod {
         return b.CallIntrinsic(scope, {expr_type(a), expr_type(p)}, {a, p}, expr_type(a), 0, Mod::instantiate_Mod);
     }
 
+    // Direct expansion used by the registry's inline tier; mirrors the body
+    // of the helper above but builds the expression at the call site, so it
+    // must only be used when the arguments are cheap to re-evaluate.
+    static inline ASR::expr_t* inline_Mod(Allocator &al, const Location &loc,
+            SymbolTable* /*scope*/, Vec<ASR::ttype_t*>& arg_types, ASR::ttype_t *return_type,
+            Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/, int /*index_kind*/) {
+        ASRBuilder b(al, loc);
+        int kind = ASRUtils::extract_kind_from_ttype_t(arg_types[1]);
+        int kind2 = ASRUtils::extract_kind_from_ttype_t(arg_types[0]);
+        int upper_kind = std::max(kind, kind2);
+        ASR::expr_t* result = nullptr;
+        if (is_real(*arg_types[1])) {
+            ASR::ttype_t* new_type = ASRUtils::TYPE(ASR::make_Real_t(al, loc, upper_kind));
+            ASR::expr_t* arg0 = b.r2r_t(new_args[0].m_value, new_type);
+            ASR::expr_t* arg1 = b.r2r_t(new_args[1].m_value, new_type);
+            if (upper_kind == 4) {
+                result = b.Sub(arg0, b.Mul(arg1, b.i2r_t(b.r2i_t(b.Div(arg0, arg1), real32), real32)));
+            } else {
+                result = b.Sub(arg0, b.Mul(arg1, b.i2r_t(b.r2i_t(b.Div(arg0, arg1), real64), real64)));
+            }
+        } else {
+            ASR::ttype_t* new_type = ASRUtils::TYPE(ASR::make_Integer_t(al, loc, upper_kind));
+            ASR::expr_t* arg0 = b.i2i_t(new_args[0].m_value, new_type);
+            ASR::expr_t* arg1 = b.i2i_t(new_args[1].m_value, new_type);
+            result = b.Sub(arg0, b.Mul(arg1, b.Div(arg0, arg1)));
+        }
+        return CastingUtil::perform_casting(result, return_type, al, loc);
+    }
+
 } // namespace Mod
 
 namespace Ibclr {
@@ -4593,6 +4638,25 @@ namespace Modulo {
         return b.Call(f_sym, new_args, return_type, nullptr);
     }
 
+    // Direct expansion used by the registry's inline tier, integer case only:
+    // modulo(a, p) == mod(mod(a, p) + p, p) with mod written out as
+    // a - p*(a/p), which avoids both the helper call and the sign-correction
+    // branch of the helper body. The real case needs floor() and stays on
+    // the helper-function fallback.
+    static inline ASR::expr_t* inline_Modulo(Allocator &al, const Location &loc,
+            SymbolTable* /*scope*/, Vec<ASR::ttype_t*>& arg_types, ASR::ttype_t* /*return_type*/,
+            Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/, int /*index_kind*/) {
+        if (!is_integer(*arg_types[0]) || !is_integer(*arg_types[1])) {
+            return nullptr;
+        }
+        ASRBuilder b(al, loc);
+        ASR::expr_t* a = new_args[0].m_value;
+        ASR::expr_t* p = b.i2i_t(new_args[1].m_value, arg_types[0]);
+        ASR::expr_t* m = b.Sub(a, b.Mul(p, b.Div(a, p)));
+        ASR::expr_t* s = b.Add(m, p);
+        return b.Sub(s, b.Mul(p, b.Div(s, p)));
+    }
+
 }  // namespace Modulo
 
 namespace BesselJN {
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 
 namespace LCompilers {
 
@@ -36,6 +37,8 @@ inline std::string get_intrinsic_subroutine_name(int x) {
         INTRINSIC_SUBROUTINE_NAME_CASE(System)
         INTRINSIC_SUBROUTINE_NAME_CASE(Sleep)
         INTRINSIC_SUBROUTINE_NAME_CASE(CoSum)
+        INTRINSIC_SUBROUTINE_NAME_CASE(LfortranDump)
+        INTRINSIC_SUBROUTINE_NAME_CASE(LfortranRestore)
         default : {
             throw LCompilersException("pickle: intrinsic_id not implemented");
         }
@@ -86,13 +89,17 @@ namespace IntrinsicImpureSubroutineRegistry {
             {&Sleep::instantiate_Sleep, &Sleep::verify_args}},
         {static_cast<int64_t>(IntrinsicImpureSubroutines::CoSum),
             {&CoSum::instantiate_CoSum, &CoSum::verify_args}},
+        {static_cast<int64_t>(IntrinsicImpureSubroutines::LfortranDump),
+            {&LfortranDump::instantiate_LfortranDump, &LfortranDump::verify_args}},
+        {static_cast<int64_t>(IntrinsicImpureSubroutines::LfortranRestore),
+            {&LfortranRestore::instantiate_LfortranRestore, &LfortranRestore::verify_args}},
         };
         return intrinsic_subroutine_by_id_db;
     }
 
-    inline const std::map<std::string,
+    inline const std::unordered_map<std::string,
         create_intrinsic_subroutine>& get_intrinsic_subroutine_by_name_db() {
-        static const std::map<std::string,
+        static const std::unordered_map<std::string,
             create_intrinsic_subroutine> intrinsic_subroutine_by_name_db = {
                 {"random_number", &RandomNumber::create_RandomNumber},
                 {"random_init", &RandomInit::create_RandomInit},
@@ -111,6 +118,8 @@ namespace IntrinsicImpureSubroutineRegistry {
                 {"system", &System::create_System},
                 {"sleep", &Sleep::create_Sleep},
                 {"co_sum", &CoSum::create_CoSum},
+                {"lfortran_dump", &LfortranDump::create_LfortranDump},
+                {"lfortran_restore", &LfortranRestore::create_LfortranRestore},
         };
         return intrinsic_subroutine_by_name_db;
     }
@@ -37,6 +37,8 @@ enum class IntrinsicImpureSubroutines : int64_t {
     System,
     Sleep,
     CoSum,
+    LfortranDump,
+    LfortranRestore,
     // ...
 };
 
@@ -1774,6 +1776,156 @@ namespace CoSum {
 
 } // namespace CoSum
 
+namespace LfortranDump {
+
+    // Shared by lfortran_dump and lfortran_restore: both lower to one
+    // BindC runtime call that receives the unit, the raw data pointer and
+    // the compile-time type descriptor (type code, element size, rank)
+    // plus the runtime shape, so the runtime can write or check the
+    // self-describing dump header.
+    static inline void verify_dump_args(const ASR::IntrinsicImpureSubroutine_t& x,
+            const std::string& sub_name, diag::Diagnostics& diagnostics) {
+        ASRUtils::require_impl(x.n_args == 2,
+            "Unexpected number of args, " + sub_name + " takes 2 arguments, found "
+            + std::to_string(x.n_args), x.base.base.loc, diagnostics);
+        ASRUtils::require_impl(ASRUtils::is_integer(*ASRUtils::expr_type(x.m_args[0])),
+            "First argument of " + sub_name + " must be an integer unit number",
+            x.base.base.loc, diagnostics);
+        ASRUtils::require_impl(ASRUtils::is_array(ASRUtils::expr_type(x.m_args[1])),
+            "Second argument of " + sub_name + " must be an array",
+            x.base.base.loc, diagnostics);
+    }
+
+    static inline ASR::asr_t* create_dump_restore(Allocator& al, const Location& loc,
+            Vec<ASR::expr_t*>& args, diag::Diagnostics& diag,
+            IntrinsicImpureSubroutines sub_id, const std::string& sub_name) {
+        if (args.size() != 2 || args[0] == nullptr || args[1] == nullptr) {
+            diag.add(diag::Diagnostic(sub_name + " takes exactly 2 arguments",
+                diag::Level::Error, diag::Stage::Semantic, {diag::Label("", { loc })}));
+            return nullptr;
+        }
+        ASR::ttype_t* unit_type = ASRUtils::expr_type(args[0]);
+        if (!ASRUtils::is_integer(*unit_type) || ASRUtils::is_array(unit_type)) {
+            diag.add(diag::Diagnostic("`unit` argument of " + sub_name
+                + " must be a scalar integer",
+                diag::Level::Error, diag::Stage::Semantic,
+                {diag::Label("", { args[0]->base.loc })}));
+            return nullptr;
+        }
+        ASR::ttype_t* array_type = ASRUtils::expr_type(args[1]);
+        if (!ASRUtils::is_array(array_type) ||
+                !(ASRUtils::is_integer(*array_type) || ASRUtils::is_real(*array_type)
+                  || ASRUtils::is_complex(*array_type))) {
+            diag.add(diag::Diagnostic("`array` argument of " + sub_name
+                + " must be an array of integer, real or complex type",
+                diag::Level::Error, diag::Stage::Semantic,
+                {diag::Label("", { args[1]->base.loc })}));
+            return nullptr;
+        }
+        Vec<ASR::expr_t*> m_args; m_args.reserve(al, 2);
+        m_args.push_back(al, args[0]);
+        m_args.push_back(al, args[1]);
+        return ASR::make_IntrinsicImpureSubroutine_t(al, loc,
+            static_cast<int64_t>(sub_id), m_args.p, m_args.n, 0);
+    }
+
+    static inline ASR::stmt_t* instantiate_dump_restore(Allocator &al, const Location &loc,
+            SymbolTable *scope, Vec<ASR::ttype_t*>& arg_types,
+            Vec<ASR::call_arg_t>& new_args, bool restore) {
+        std::string new_name = restore ? "_lcompilers_lfortran_restore_"
+            : "_lcompilers_lfortran_dump_";
+        declare_basic_variables(new_name);
+        fill_func_arg_sub("unit", arg_types[0], In);
+        if (restore) {
+            fill_func_arg_sub("array",
+                ASRUtils::duplicate_type_with_empty_dims(al, arg_types[1]), InOut);
+        } else {
+            fill_func_arg_sub("array",
+                ASRUtils::duplicate_type_with_empty_dims(al, arg_types[1]), In);
+        }
+        ASR::ttype_t* el_type = ASRUtils::extract_type(arg_types[1]);
+        int el_kind = ASRUtils::extract_kind_from_ttype_t(el_type);
+        int type_code = ASRUtils::is_integer(*el_type) ? 1
+            : ASRUtils::is_real(*el_type) ? 2 : 3;
+        int elem_size = el_kind * (ASRUtils::is_complex(*el_type) ? 2 : 1);
+        int rank = ASRUtils::extract_n_dims_from_ttype(arg_types[1]);
+        ASR::expr_t* shape_var = declare("shape", b.Array({rank}, int64), Local);
+        for (int d = 1; d <= rank; d++) {
+            // cast explicitly: pass_array_by_data rewrites ArraySize into
+            // the hidden integer(4) size argument, losing the int64 kind
+            body.push_back(al, b.Assignment(b.ArrayItem_01(shape_var, {b.i32(d)}),
+                b.i2i_t(b.ArraySize(args[1], b.i32(d), int32), int64)));
+        }
+        std::string c_func_name = restore ? "_lfortran_restore_array"
+            : "_lfortran_dump_array";
+        Vec<ASR::ttype_t*> param_types; param_types.reserve(al, 6);
+        param_types.push_back(al, int32);
+        param_types.push_back(al, b.CPtr());
+        param_types.push_back(al, int32);
+        param_types.push_back(al, int32);
+        param_types.push_back(al, int32);
+        param_types.push_back(al, b.CPtr());
+        ASR::symbol_t* kernel = b.create_c_subroutine_interface(c_func_name,
+            fn_symtab, param_types,
+            {"unit", "data", "type_code", "elem_size", "rank", "shape"},
+            {true, true, true, true, true, true});
+        fn_symtab->add_symbol(c_func_name, kernel);
+        dep.push_back(al, s2c(al, c_func_name));
+        Vec<ASR::call_arg_t> kernel_args; kernel_args.reserve(al, 6);
+        kernel_args.push_back(al, {loc, b.i2i_t(args[0], int32)});
+        kernel_args.push_back(al, {loc, b.PointerToCPtr(args[1], b.CPtr())});
+        kernel_args.push_back(al, {loc, b.i32(type_code)});
+        kernel_args.push_back(al, {loc, b.i32(elem_size)});
+        kernel_args.push_back(al, {loc, b.i32(rank)});
+        kernel_args.push_back(al, {loc, b.PointerToCPtr(shape_var, b.CPtr())});
+        body.push_back(al, b.SubroutineCall(kernel, kernel_args));
+        ASR::symbol_t *new_symbol = make_ASR_Function_t(fn_name, fn_symtab, dep, args,
+            body, nullptr, ASR::abiType::Source, ASR::deftypeType::Implementation, nullptr);
+        scope->add_symbol(fn_name, new_symbol);
+        return b.SubroutineCall(new_symbol, new_args);
+    }
+
+    static inline void verify_args(const ASR::IntrinsicImpureSubroutine_t& x,
+            diag::Diagnostics& diagnostics) {
+        verify_dump_args(x, "lfortran_dump", diagnostics);
+    }
+
+    static inline ASR::asr_t* create_LfortranDump(Allocator& al, const Location& loc,
+            Vec<ASR::expr_t*>& args, diag::Diagnostics& diag) {
+        return create_dump_restore(al, loc, args, diag,
+            IntrinsicImpureSubroutines::LfortranDump, "lfortran_dump");
+    }
+
+    static inline ASR::stmt_t* instantiate_LfortranDump(Allocator &al, const Location &loc,
+            SymbolTable *scope, Vec<ASR::ttype_t*>& arg_types,
+            Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/) {
+        return instantiate_dump_restore(al, loc, scope, arg_types, new_args, false);
+    }
+
+} // namespace LfortranDump
+
+namespace LfortranRestore {
+
+    static inline void verify_args(const ASR::IntrinsicImpureSubroutine_t& x,
+            diag::Diagnostics& diagnostics) {
+        LfortranDump::verify_dump_args(x, "lfortran_restore", diagnostics);
+    }
+
+    static inline ASR::asr_t* create_LfortranRestore(Allocator& al, const Location& loc,
+            Vec<ASR::expr_t*>& args, diag::Diagnostics& diag) {
+        return LfortranDump::create_dump_restore(al, loc, args, diag,
+            IntrinsicImpureSubroutines::LfortranRestore, "lfortran_restore");
+    }
+
+    static inline ASR::stmt_t* instantiate_LfortranRestore(Allocator &al, const Location &loc,
+            SymbolTable *scope, Vec<ASR::ttype_t*>& arg_types,
+            Vec<ASR::call_arg_t>& new_args, int64_t /*overload_id*/) {
+        return LfortranDump::instantiate_dump_restore(al, loc, scope, arg_types,
+            new_args, true);
+    }
+
+} // namespace LfortranRestore
+
 } // namespace LCompilers::ASRUtils
 
 #endif // LIBASR_PASS_INTRINSIC_SUBROUTINES_H
@@ -0,0 +1,359 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/exception.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_verify.h>
+#include <libasr/pass/loop_invariant_code_motion.h>
+#include <libasr/pass/pass_utils.h>
+
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+
+
+namespace LCompilers {
+
+using ASR::down_cast;
+using ASR::is_a;
+
+/*
+
+This ASR pass hoists loop-invariant scalar computations out of do loops.
+Identical invariant expressions within one loop are value numbered and
+share a single temporary, so repeated bound and address computations in
+the body are evaluated once before the loop:
+
+    do i = 1, n
+        a(i) = b(i) / (c * d + 2.0)
+    end do
+
+becomes
+
+    tmp = c * d + 2.0
+    do i = 1, n
+        a(i) = b(i) / tmp
+    end do
+
+Only pure arithmetic over scalar variables that the loop body cannot
+modify is hoisted. Loops whose bodies contain statements with effects
+the analysis cannot see (impure calls, I/O into variables, allocation,
+pointer association) are left untouched.
+
+*/
+
+// Collects every symbol the loop body may assign to and flags statements
+// that make the analysis unsafe because they can change variables the
+// collector cannot enumerate
+class LoopBodyAnalysis: public ASR::BaseWalkVisitor<LoopBodyAnalysis> {
+
+    public:
+
+    std::set<ASR::symbol_t*> modified_symbols;
+    bool unsafe = false;
+
+    void note_modified(ASR::expr_t* target) {
+        if( ASR::is_a<ASR::Var_t>(*target) ) {
+            modified_symbols.insert(ASRUtils::symbol_get_past_external(
+                ASR::down_cast<ASR::Var_t>(target)->m_v));
+        } else if( ASR::is_a<ASR::ArrayItem_t>(*target) ) {
+            note_modified(ASR::down_cast<ASR::ArrayItem_t>(target)->m_v);
+        } else if( ASR::is_a<ASR::ArraySection_t>(*target) ) {
+            note_modified(ASR::down_cast<ASR::ArraySection_t>(target)->m_v);
+        } else if( ASR::is_a<ASR::StructInstanceMember_t>(*target) ) {
+            note_modified(ASR::down_cast<ASR::StructInstanceMember_t>(target)->m_v);
+        } else {
+            unsafe = true;
+        }
+    }
+
+    void visit_Assignment(const ASR::Assignment_t& x) {
+        note_modified(x.m_target);
+        ASR::BaseWalkVisitor<LoopBodyAnalysis>::visit_Assignment(x);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t& x) {
+        note_modified(x.m_head.m_v);
+        ASR::BaseWalkVisitor<LoopBodyAnalysis>::visit_DoLoop(x);
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+        // A pure function cannot modify anything visible here
+        ASR::symbol_t* func = ASRUtils::symbol_get_past_external(x.m_name);
+        if( !ASR::is_a<ASR::Function_t>(*func) ||
+            !ASR::down_cast<ASR::FunctionType_t>(ASR::down_cast<ASR::Function_t>(
+                func)->m_function_signature)->m_pure ) {
+            unsafe = true;
+        }
+        ASR::BaseWalkVisitor<LoopBodyAnalysis>::visit_FunctionCall(x);
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t& /*x*/) { unsafe = true; }
+    void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t& /*x*/) { unsafe = true; }
+    void visit_Allocate(const ASR::Allocate_t& /*x*/) { unsafe = true; }
+    void visit_ExplicitDeallocate(const ASR::ExplicitDeallocate_t& /*x*/) { unsafe = true; }
+    void visit_ImplicitDeallocate(const ASR::ImplicitDeallocate_t& /*x*/) { unsafe = true; }
+    void visit_Associate(const ASR::Associate_t& /*x*/) { unsafe = true; }
+    void visit_Nullify(const ASR::Nullify_t& /*x*/) { unsafe = true; }
+    void visit_CPtrToPointer(const ASR::CPtrToPointer_t& /*x*/) { unsafe = true; }
+    void visit_BlockCall(const ASR::BlockCall_t& /*x*/) { unsafe = true; }
+    void visit_FileOpen(const ASR::FileOpen_t& /*x*/) { unsafe = true; }
+    void visit_FileClose(const ASR::FileClose_t& /*x*/) { unsafe = true; }
+    void visit_FileRead(const ASR::FileRead_t& /*x*/) { unsafe = true; }
+    void visit_FileWrite(const ASR::FileWrite_t& /*x*/) { unsafe = true; }
+    void visit_FileInquire(const ASR::FileInquire_t& /*x*/) { unsafe = true; }
+    void visit_FileRewind(const ASR::FileRewind_t& /*x*/) { unsafe = true; }
+    void visit_FileBackspace(const ASR::FileBackspace_t& /*x*/) { unsafe = true; }
+
+};
+
+// Returns true when `expr` is pure arithmetic over constants and scalar
+// variables not in `modified`, building a structural value-number key as
+// it goes; `has_var` distinguishes genuinely invariant computations from
+// constant expressions that folding handles elsewhere
+static bool invariant_expr_key(ASR::expr_t* expr,
+        const std::set<ASR::symbol_t*>& modified,
+        std::string& key, bool& has_var) {
+    if( ASR::is_a<ASR::IntegerConstant_t>(*expr) ) {
+        ASR::IntegerConstant_t* c = ASR::down_cast<ASR::IntegerConstant_t>(expr);
+        key += "i" + std::to_string(c->m_n) + "_" +
+            std::to_string(ASRUtils::extract_kind_from_ttype_t(c->m_type));
+        return true;
+    } else if( ASR::is_a<ASR::RealConstant_t>(*expr) ) {
+        ASR::RealConstant_t* c = ASR::down_cast<ASR::RealConstant_t>(expr);
+        uint64_t bits;
+        std::memcpy(&bits, &c->m_r, sizeof(bits));
+        key += "r" + std::to_string(bits) + "_" +
+            std::to_string(ASRUtils::extract_kind_from_ttype_t(c->m_type));
+        return true;
+    } else if( ASR::is_a<ASR::LogicalConstant_t>(*expr) ) {
+        key += "l" + std::to_string(
+            ASR::down_cast<ASR::LogicalConstant_t>(expr)->m_value);
+        return true;
+    } else if( ASR::is_a<ASR::Var_t>(*expr) ) {
+        ASR::symbol_t* sym = ASRUtils::symbol_get_past_external(
+            ASR::down_cast<ASR::Var_t>(expr)->m_v);
+        if( !ASR::is_a<ASR::Variable_t>(*sym) ||
+            ASRUtils::is_array(ASRUtils::symbol_type(sym)) ||
+            ASRUtils::is_pointer(ASRUtils::symbol_type(sym)) ||
+            modified.count(sym) ) {
+            return false;
+        }
+        key += "v" + std::to_string((uintptr_t) sym);
+        has_var = true;
+        return true;
+    } else if( ASR::is_a<ASR::IntegerBinOp_t>(*expr) ) {
+        ASR::IntegerBinOp_t* binop = ASR::down_cast<ASR::IntegerBinOp_t>(expr);
+        if( binop->m_op == ASR::binopType::Div ) {
+            // Hoisting may move a division out of a guard that protects
+            // against a zero divisor
+            return false;
+        }
+        key += "(bi" + std::to_string(binop->m_op) + "_" +
+            std::to_string(ASRUtils::extract_kind_from_ttype_t(binop->m_type));
+        if( !invariant_expr_key(binop->m_left, modified, key, has_var) ) {
+            return false;
+        }
+        key += ",";
+        if( !invariant_expr_key(binop->m_right, modified, key, has_var) ) {
+            return false;
+        }
+        key += ")";
+        return true;
+    } else if( ASR::is_a<ASR::RealBinOp_t>(*expr) ) {
+        ASR::RealBinOp_t* binop = ASR::down_cast<ASR::RealBinOp_t>(expr);
+        key += "(br" + std::to_string(binop->m_op) + "_" +
+            std::to_string(ASRUtils::extract_kind_from_ttype_t(binop->m_type));
+        if( !invariant_expr_key(binop->m_left, modified, key, has_var) ) {
+            return false;
+        }
+        key += ",";
+        if( !invariant_expr_key(binop->m_right, modified, key, has_var) ) {
+            return false;
+        }
+        key += ")";
+        return true;
+    } else if( ASR::is_a<ASR::IntegerUnaryMinus_t>(*expr) ) {
+        key += "(ni";
+        if( !invariant_expr_key(ASR::down_cast<ASR::IntegerUnaryMinus_t>(expr)->m_arg,
+                modified, key, has_var) ) {
+            return false;
+        }
+        key += ")";
+        return true;
+    } else if( ASR::is_a<ASR::RealUnaryMinus_t>(*expr) ) {
+        key += "(nr";
+        if( !invariant_expr_key(ASR::down_cast<ASR::RealUnaryMinus_t>(expr)->m_arg,
+                modified, key, has_var) ) {
+            return false;
+        }
+        key += ")";
+        return true;
+    } else if( ASR::is_a<ASR::Cast_t>(*expr) ) {
+        ASR::Cast_t* cast = ASR::down_cast<ASR::Cast_t>(expr);
+        key += "(c" + std::to_string(cast->m_kind) + "_" +
+            std::to_string(ASRUtils::extract_kind_from_ttype_t(cast->m_type));
+        if( !invariant_expr_key(cast->m_arg, modified, key, has_var) ) {
+            return false;
+        }
+        key += ")";
+        return true;
+    }
+    return false;
+}
+
+// Replaces maximal invariant binary operations in the loop body with a
+// temporary; the first occurrence of each value number creates the
+// temporary and the hoisted assignment
+class InvariantExprReplacer: public ASR::BaseExprReplacer<InvariantExprReplacer> {
+
+    public:
+
+    Allocator& al;
+    SymbolTable*& current_scope;
+    const std::set<ASR::symbol_t*>& modified;
+    std::map<std::string, ASR::expr_t*>& value_numbers;
+    Vec<ASR::stmt_t*>& hoisted;
+    int& temp_counter;
+
+    InvariantExprReplacer(Allocator& al_, SymbolTable*& current_scope_,
+        const std::set<ASR::symbol_t*>& modified_,
+        std::map<std::string, ASR::expr_t*>& value_numbers_,
+        Vec<ASR::stmt_t*>& hoisted_, int& temp_counter_):
+        al(al_), current_scope(current_scope_), modified(modified_),
+        value_numbers(value_numbers_), hoisted(hoisted_),
+        temp_counter(temp_counter_) {}
+
+    bool try_hoist(ASR::expr_t* x) {
+        std::string key;
+        bool has_var = false;
+        if( !invariant_expr_key(x, modified, key, has_var) || !has_var ) {
+            return false;
+        }
+        auto it = value_numbers.find(key);
+        ASR::expr_t* temp = nullptr;
+        if( it == value_numbers.end() ) {
+            const Location& loc = x->base.loc;
+            temp = PassUtils::create_var(temp_counter++, "_licm", loc,
+                ASRUtils::expr_type(x), al, current_scope);
+            hoisted.push_back(al, ASRUtils::STMT(ASRUtils::make_Assignment_t_util(
+                al, loc, temp, x, nullptr, false, false)));
+            value_numbers[key] = temp;
+        } else {
+            temp = it->second;
+        }
+        *current_expr = temp;
+        return true;
+    }
+
+    void replace_IntegerBinOp(ASR::IntegerBinOp_t* x) {
+        if( !try_hoist((ASR::expr_t*) x) ) {
+            ASR::BaseExprReplacer<InvariantExprReplacer>::replace_IntegerBinOp(x);
+        }
+    }
+
+    void replace_RealBinOp(ASR::RealBinOp_t* x) {
+        if( !try_hoist((ASR::expr_t*) x) ) {
+            ASR::BaseExprReplacer<InvariantExprReplacer>::replace_RealBinOp(x);
+        }
+    }
+
+    // Mixed-kind expressions insert a Cast around the narrower operand;
+    // when that operand is invariant the conversion is too, so hoist it
+    // instead of converting on every iteration
+    void replace_Cast(ASR::Cast_t* x) {
+        if( !try_hoist((ASR::expr_t*) x) ) {
+            ASR::BaseExprReplacer<InvariantExprReplacer>::replace_Cast(x);
+        }
+    }
+
+};
+
+class LoopBodyExprVisitor: public ASR::CallReplacerOnExpressionsVisitor<LoopBodyExprVisitor> {
+
+    public:
+
+    InvariantExprReplacer replacer;
+
+    LoopBodyExprVisitor(Allocator& al_, SymbolTable*& current_scope_,
+        const std::set<ASR::symbol_t*>& modified_,
+        std::map<std::string, ASR::expr_t*>& value_numbers_,
+        Vec<ASR::stmt_t*>& hoisted_, int& temp_counter_):
+        replacer(al_, current_scope_, modified_, value_numbers_,
+                 hoisted_, temp_counter_) {}
+
+    void call_replacer() {
+        replacer.current_expr = current_expr;
+        replacer.replace_expr(*current_expr);
+    }
+
+};
+
+class LoopInvariantCodeMotionVisitor :
+    public PassUtils::PassVisitor<LoopInvariantCodeMotionVisitor>
+{
+private:
+
+    int temp_counter;
+
+public:
+    LoopInvariantCodeMotionVisitor(Allocator &al_) : PassVisitor(al_, nullptr),
+    temp_counter(0)
+    {
+        pass_result.reserve(al, 1);
+    }
+
+    void hoist_from_body(ASR::stmt_t** m_body, size_t n_body,
+                         ASR::expr_t* loop_var) {
+        LoopBodyAnalysis analysis;
+        if( loop_var ) {
+            analysis.note_modified(loop_var);
+        }
+        for( size_t i = 0; i < n_body; i++ ) {
+            analysis.visit_stmt(*m_body[i]);
+        }
+        if( analysis.unsafe ) {
+            return ;
+        }
+        Vec<ASR::stmt_t*> hoisted;
+        hoisted.reserve(al, 1);
+        std::map<std::string, ASR::expr_t*> value_numbers;
+        LoopBodyExprVisitor body_visitor(al, current_scope,
+            analysis.modified_symbols, value_numbers, hoisted, temp_counter);
+        for( size_t i = 0; i < n_body; i++ ) {
+            body_visitor.visit_stmt(*m_body[i]);
+        }
+        for( size_t i = 0; i < hoisted.size(); i++ ) {
+            pass_result.push_back(al, hoisted[i]);
+        }
+        if( hoisted.size() > 0 ) {
+            retain_original_stmt = true;
+        }
+    }
+
+    // Process nested loops first so their hoisted assignments become part
+    // of this body and can be analysed like any other statement. While
+    // loops matter as much as do loops here: under --fast this pass runs
+    // after do_loops has already lowered do loops into while loops.
+    void visit_DoLoop(const ASR::DoLoop_t& x) {
+        PassUtils::PassVisitor<LoopInvariantCodeMotionVisitor>::visit_DoLoop(x);
+        ASR::DoLoop_t& xx = const_cast<ASR::DoLoop_t&>(x);
+        hoist_from_body(xx.m_body, xx.n_body, x.m_head.m_v);
+    }
+
+    void visit_WhileLoop(const ASR::WhileLoop_t& x) {
+        PassUtils::PassVisitor<LoopInvariantCodeMotionVisitor>::visit_WhileLoop(x);
+        ASR::WhileLoop_t& xx = const_cast<ASR::WhileLoop_t&>(x);
+        hoist_from_body(xx.m_body, xx.n_body, nullptr);
+    }
+
+};
+
+void pass_loop_invariant_code_motion(Allocator &al, ASR::TranslationUnit_t &unit,
+                                     const LCompilers::PassOptions& /*pass_options*/) {
+    LoopInvariantCodeMotionVisitor v(al);
+    v.visit_TranslationUnit(unit);
+}
+
+
+} // namespace LCompilers
@@ -0,0 +1,273 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/exception.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_verify.h>
+#include <libasr/pass/dependence_analysis.h>
+#include <libasr/pass/loop_tiling.h>
+#include <libasr/pass/pass_utils.h>
+
+
+namespace LCompilers {
+
+using ASR::down_cast;
+using ASR::is_a;
+
+/*
+
+This ASR pass tiles perfectly nested do loop pairs for cache locality.
+A nest
+
+    do j = 1, n
+        do i = 1, m
+            c(i, j) = c(i, j) + a(i, k)*b(k, j)
+        end do
+    end do
+
+becomes
+
+    do jt = 1, n, T
+        do it = 1, m, T
+            do j = jt, min(jt + T - 1, n)
+                do i = it, min(it + T - 1, m)
+                    ...
+
+so that the elements touched by one tile stay resident in cache across
+the outer traversal. The tile size T comes from
+PassOptions::tile_size. Tiling strip-mines both loops and interchanges
+the strip loops, which is legal only when the nest is fully permutable;
+this is checked with DependenceAnalysis::can_interchange in both
+orders. The pass runs before do_loops lowering and only under --fast.
+
+*/
+class LoopTilingVisitor : public PassUtils::PassVisitor<LoopTilingVisitor>
+{
+private:
+
+    int64_t tile_size;
+
+    ASRUtils::ExprStmtDuplicator node_duplicator;
+
+public:
+
+    LoopTilingVisitor(Allocator &al_, int64_t tile_size_) :
+    PassVisitor(al_, nullptr),
+    tile_size(tile_size_), node_duplicator(al_)
+    {
+        pass_result.reserve(al, 1);
+    }
+
+    // Exit, cycle, return or goto inside the nest would change meaning
+    // once iterations are regrouped into tiles
+    class ControlFlowDetector : public ASR::BaseWalkVisitor<ControlFlowDetector> {
+        public:
+        bool found = false;
+        void visit_Exit(const ASR::Exit_t& /*x*/) { found = true; }
+        void visit_Cycle(const ASR::Cycle_t& /*x*/) { found = true; }
+        void visit_Return(const ASR::Return_t& /*x*/) { found = true; }
+        void visit_GoTo(const ASR::GoTo_t& /*x*/) { found = true; }
+        void visit_Stop(const ASR::Stop_t& /*x*/) { found = true; }
+        void visit_ErrorStop(const ASR::ErrorStop_t& /*x*/) { found = true; }
+    };
+
+    class SymbolUseDetector : public ASR::BaseWalkVisitor<SymbolUseDetector> {
+        public:
+        ASR::symbol_t* sym;
+        bool found = false;
+        SymbolUseDetector(ASR::symbol_t* sym_) : sym(sym_) {}
+        void visit_Var(const ASR::Var_t& x) {
+            if( ASRUtils::symbol_get_past_external(x.m_v) == sym ) {
+                found = true;
+            }
+        }
+    };
+
+    bool expr_uses_symbol(ASR::expr_t* expr, ASR::symbol_t* sym) {
+        if( expr == nullptr ) {
+            return false;
+        }
+        SymbolUseDetector detector(sym);
+        detector.visit_expr(*expr);
+        return detector.found;
+    }
+
+    bool has_unit_increment(const ASR::do_loop_head_t& head) {
+        if( head.m_increment == nullptr ) {
+            return true;
+        }
+        ASR::expr_t* inc_value = ASRUtils::expr_value(head.m_increment);
+        int64_t inc_int = 0;
+        return ASRUtils::is_value_constant(inc_value, inc_int) && inc_int == 1;
+    }
+
+    // True when the loop provably has at most tile_size iterations, in
+    // which case there is nothing to tile along it
+    bool fits_in_one_tile(const ASR::do_loop_head_t& head) {
+        int64_t start_int = 0, end_int = 0;
+        if( ASRUtils::is_value_constant(ASRUtils::expr_value(head.m_start), start_int) &&
+            ASRUtils::is_value_constant(ASRUtils::expr_value(head.m_end), end_int) ) {
+            return end_int - start_int + 1 <= tile_size;
+        }
+        return false;
+    }
+
+    ASR::expr_t* make_tile_cap(ASR::expr_t* tile_var, ASR::expr_t* loop_end,
+                               ASR::ttype_t* index_type, const Location& loc) {
+        // min(tile_var + T - 1, loop_end)
+        ASR::expr_t* tile_size_minus_one = ASRUtils::EXPR(
+            ASR::make_IntegerConstant_t(al, loc, tile_size - 1, index_type));
+        ASR::expr_t* cap = ASRUtils::EXPR(ASR::make_IntegerBinOp_t(al, loc,
+            tile_var, ASR::binopType::Add, tile_size_minus_one, index_type, nullptr));
+        ASR::ttype_t* logical_type = ASRUtils::TYPE(
+            ASR::make_Logical_t(al, loc, 4));
+        ASR::expr_t* test = ASRUtils::EXPR(ASR::make_IntegerCompare_t(al, loc,
+            node_duplicator.duplicate_expr(cap), ASR::cmpopType::Gt,
+            node_duplicator.duplicate_expr(loop_end), logical_type, nullptr));
+        return ASRUtils::EXPR(ASR::make_IfExp_t(al, loc, test,
+            node_duplicator.duplicate_expr(loop_end), cap, index_type, nullptr));
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t& x) {
+        ASR::DoLoop_t& xx = const_cast<ASR::DoLoop_t&>(x);
+        // Tile inner nests first; a deeper nest then presents its tile
+        // loop (non-unit step) here and is left alone
+        transform_stmts(xx.m_body, xx.n_body);
+        if( tile_size < 2 ) {
+            return ;
+        }
+        if( x.n_body != 1 || x.n_orelse != 0 ||
+            !ASR::is_a<ASR::DoLoop_t>(*x.m_body[0]) ) {
+            return ;
+        }
+        ASR::DoLoop_t* inner = ASR::down_cast<ASR::DoLoop_t>(x.m_body[0]);
+        if( inner->n_orelse != 0 ||
+            !has_unit_increment(x.m_head) ||
+            !has_unit_increment(inner->m_head) ) {
+            return ;
+        }
+        if( fits_in_one_tile(x.m_head) && fits_in_one_tile(inner->m_head) ) {
+            return ;
+        }
+        ASR::symbol_t* outer_sym = ASR::down_cast<ASR::Var_t>(x.m_head.m_v)->m_v;
+        ASR::symbol_t* inner_sym = ASR::down_cast<ASR::Var_t>(inner->m_head.m_v)->m_v;
+        // The inner bounds become bounds of a loop outside the outer
+        // element loop, so they must not depend on it (no triangular nests)
+        if( expr_uses_symbol(inner->m_head.m_start, outer_sym) ||
+            expr_uses_symbol(inner->m_head.m_end, outer_sym) ) {
+            return ;
+        }
+        ControlFlowDetector control_flow;
+        for( size_t i = 0; i < inner->n_body; i++ ) {
+            control_flow.visit_stmt(*inner->m_body[i]);
+        }
+        if( control_flow.found ) {
+            return ;
+        }
+        std::vector<ASR::symbol_t*> loop_vars = {outer_sym, inner_sym};
+        DependenceAnalysis::AccessSet accesses =
+            DependenceAnalysis::collect_array_accesses(inner->m_body,
+                inner->n_body, loop_vars);
+        if( !accesses.analyzable ) {
+            return ;
+        }
+        // Tiling requires full permutability of the pair
+        if( !DependenceAnalysis::can_interchange(accesses, outer_sym, inner_sym) ||
+            !DependenceAnalysis::can_interchange(accesses, inner_sym, outer_sym) ) {
+            return ;
+        }
+        // Only worthwhile when the body walks a multi-dimensional array,
+        // i.e. one traversal order is necessarily strided
+        bool has_multi_dim_access = false;
+        for( const DependenceAnalysis::ArrayAccess& access: accesses.accesses ) {
+            if( access.subscripts.size() >= 2 ) {
+                has_multi_dim_access = true;
+                break;
+            }
+        }
+        if( !has_multi_dim_access ) {
+            return ;
+        }
+
+        const Location& loc = x.base.base.loc;
+        ASR::ttype_t* outer_index_type = ASRUtils::expr_type(x.m_head.m_v);
+        ASR::ttype_t* inner_index_type = ASRUtils::expr_type(inner->m_head.m_v);
+        int index_kind = ASRUtils::extract_kind_from_ttype_t(outer_index_type);
+        Vec<ASR::expr_t*> tile_vars;
+        PassUtils::create_idx_vars(tile_vars, 2, loc, al, current_scope,
+            "_tile", index_kind);
+        ASR::expr_t* outer_tile_var = tile_vars[0];
+        ASR::expr_t* inner_tile_var = tile_vars[1];
+        ASR::expr_t* tile_step = ASRUtils::EXPR(
+            ASR::make_IntegerConstant_t(al, loc, tile_size, outer_index_type));
+
+        // Innermost pair: the original element loops restricted to one tile
+        ASR::do_loop_head_t inner_element_head;
+        inner_element_head.m_v = inner->m_head.m_v;
+        inner_element_head.m_start = inner_tile_var;
+        inner_element_head.m_end = make_tile_cap(inner_tile_var,
+            inner->m_head.m_end, inner_index_type, loc);
+        inner_element_head.m_increment = inner->m_head.m_increment;
+        inner_element_head.loc = inner->m_head.loc;
+        ASR::stmt_t* inner_element_loop = ASRUtils::STMT(ASR::make_DoLoop_t(
+            al, inner->base.base.loc, inner->m_name, inner_element_head,
+            inner->m_body, inner->n_body, nullptr, 0));
+
+        ASR::do_loop_head_t outer_element_head;
+        outer_element_head.m_v = x.m_head.m_v;
+        outer_element_head.m_start = outer_tile_var;
+        outer_element_head.m_end = make_tile_cap(outer_tile_var,
+            x.m_head.m_end, outer_index_type, loc);
+        outer_element_head.m_increment = x.m_head.m_increment;
+        outer_element_head.loc = x.m_head.loc;
+        Vec<ASR::stmt_t*> outer_element_body;
+        outer_element_body.reserve(al, 1);
+        outer_element_body.push_back(al, inner_element_loop);
+        ASR::stmt_t* outer_element_loop = ASRUtils::STMT(ASR::make_DoLoop_t(
+            al, loc, x.m_name, outer_element_head,
+            outer_element_body.p, outer_element_body.size(), nullptr, 0));
+
+        // Tile loops walk the original iteration spaces in steps of T
+        ASR::do_loop_head_t inner_tile_head;
+        inner_tile_head.m_v = inner_tile_var;
+        inner_tile_head.m_start = inner->m_head.m_start;
+        inner_tile_head.m_end = inner->m_head.m_end;
+        inner_tile_head.m_increment = tile_step;
+        inner_tile_head.loc = inner->m_head.loc;
+        Vec<ASR::stmt_t*> inner_tile_body;
+        inner_tile_body.reserve(al, 1);
+        inner_tile_body.push_back(al, outer_element_loop);
+        ASR::stmt_t* inner_tile_loop = ASRUtils::STMT(ASR::make_DoLoop_t(
+            al, loc, nullptr, inner_tile_head,
+            inner_tile_body.p, inner_tile_body.size(), nullptr, 0));
+
+        ASR::do_loop_head_t outer_tile_head;
+        outer_tile_head.m_v = outer_tile_var;
+        outer_tile_head.m_start = x.m_head.m_start;
+        outer_tile_head.m_end = x.m_head.m_end;
+        outer_tile_head.m_increment = node_duplicator.duplicate_expr(tile_step);
+        outer_tile_head.loc = x.m_head.loc;
+        Vec<ASR::stmt_t*> outer_tile_body;
+        outer_tile_body.reserve(al, 1);
+        outer_tile_body.push_back(al, inner_tile_loop);
+        pass_result.push_back(al, ASRUtils::STMT(ASR::make_DoLoop_t(
+            al, loc, nullptr, outer_tile_head,
+            outer_tile_body.p, outer_tile_body.size(), nullptr, 0)));
+    }
+
+};
+
+void pass_loop_tiling(Allocator &al, ASR::TranslationUnit_t &unit,
+                      const LCompilers::PassOptions& pass_options) {
+    if( !pass_options.fast ) {
+        // Registered before do_loops so that the nests are still visible,
+        // but it is an optimization and must not change the default output
+        return ;
+    }
+    LoopTilingVisitor v(al, pass_options.tile_size);
+    v.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+
+} // namespace LCompilers
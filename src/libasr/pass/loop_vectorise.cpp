@@ -3,6 +3,7 @@
 #include <libasr/exception.h>
 #include <libasr/asr_utils.h>
 #include <libasr/asr_verify.h>
+#include <libasr/pass/dependence_analysis.h>
 #include <libasr/pass/loop_vectorise.h>
 #include <libasr/pass/pass_utils.h>
 
@@ -21,16 +22,19 @@ optimization routine for loop vectorisation. This allows backend
 specific code generation for vector operations resulting in optimized
 code.
 
-Converts:
+Handles constant-bound, unit-increment loops whose single statement is
+either an element-wise copy or a sum reduction indexed by the loop
+variable:
 
-    i: i32
-    for i in range(9216):
-        a[i] = b[i]
+    do i = 2, 9217
+        a(i) = b(i)
+    end do
 
-to:
-
-    for i in range(0, 9216, 8):
-        vector_copy(8, a[i*8:(i+1)*8], b[i*8:(i+1)*8])
+becomes a blocked loop calling the internal vector_copy routine on one
+vector-register-sized chunk per iteration, followed by a scalar tail
+loop for the elements past the last full block. Reductions
+`s = s + a(i)` are strip-mined into an outer block loop with a
+constant-trip inner loop that the backend can turn into vector code.
 
 */
 class LoopVectoriseVisitor : public PassUtils::SkipOptimizationFunctionVisitor<LoopVectoriseVisitor>
@@ -59,7 +63,23 @@ public:
                 ASR::is_a<ASR::WhileLoop_t>(x));
     }
 
-    bool is_vector_copy(ASR::stmt_t* x, Vec<ASR::expr_t*>& arrays) {
+    bool is_loop_index(ASR::expr_t* expr, ASR::expr_t* loop_var) {
+        return ASR::is_a<ASR::Var_t>(*expr) &&
+               ASR::down_cast<ASR::Var_t>(expr)->m_v ==
+               ASR::down_cast<ASR::Var_t>(loop_var)->m_v;
+    }
+
+    // A 1-D element reference `a(i)` indexed directly by the loop variable
+    bool is_unit_stride_ref(ASR::ArrayItem_t* array_ref, ASR::expr_t* loop_var) {
+        return array_ref->n_args == 1 &&
+               array_ref->m_args->m_left == nullptr &&
+               array_ref->m_args->m_step == nullptr &&
+               array_ref->m_args->m_right != nullptr &&
+               is_loop_index(array_ref->m_args->m_right, loop_var);
+    }
+
+    bool is_vector_copy(ASR::stmt_t* x, ASR::expr_t* loop_var,
+                        Vec<ASR::expr_t*>& arrays) {
         if( !ASR::is_a<ASR::Assignment_t>(*x) ) {
             return false;
         }
@@ -72,10 +92,8 @@ public:
         }
         ASR::ArrayItem_t* target_array_ref = ASR::down_cast<ASR::ArrayItem_t>(target);
         ASR::ArrayItem_t* value_array_ref = ASR::down_cast<ASR::ArrayItem_t>(value);
-        if( target_array_ref->m_args->m_left ||
-            target_array_ref->m_args->m_step ||
-            value_array_ref->m_args->m_left ||
-            value_array_ref->m_args->m_step ) {
+        if( !is_unit_stride_ref(target_array_ref, loop_var) ||
+            !is_unit_stride_ref(value_array_ref, loop_var) ) {
             return false;
         }
         arrays.push_back(al, target_array_ref->m_v);
@@ -83,6 +101,55 @@ public:
         return true;
     }
 
+    // Matches `s = s + a(i)` (either operand order) where `s` is a scalar
+    // variable and `a(i)` is indexed directly by the loop variable. This
+    // pass runs only under --fast, so reassociating the additions when the
+    // loop is strip-mined is acceptable.
+    bool is_sum_reduction(ASR::stmt_t* x, ASR::expr_t* loop_var) {
+        if( !ASR::is_a<ASR::Assignment_t>(*x) ) {
+            return false;
+        }
+        ASR::Assignment_t* x_assignment = ASR::down_cast<ASR::Assignment_t>(x);
+        if( !ASR::is_a<ASR::Var_t>(*x_assignment->m_target) ||
+            ASRUtils::is_array(ASRUtils::expr_type(x_assignment->m_target)) ) {
+            return false;
+        }
+        ASR::symbol_t* acc = ASR::down_cast<ASR::Var_t>(x_assignment->m_target)->m_v;
+        if( acc == ASR::down_cast<ASR::Var_t>(loop_var)->m_v ) {
+            return false;
+        }
+        ASR::expr_t *left = nullptr, *right = nullptr;
+        if( ASR::is_a<ASR::IntegerBinOp_t>(*x_assignment->m_value) ) {
+            ASR::IntegerBinOp_t* binop = ASR::down_cast<ASR::IntegerBinOp_t>(x_assignment->m_value);
+            if( binop->m_op != ASR::binopType::Add ) {
+                return false;
+            }
+            left = binop->m_left;
+            right = binop->m_right;
+        } else if( ASR::is_a<ASR::RealBinOp_t>(*x_assignment->m_value) ) {
+            ASR::RealBinOp_t* binop = ASR::down_cast<ASR::RealBinOp_t>(x_assignment->m_value);
+            if( binop->m_op != ASR::binopType::Add ) {
+                return false;
+            }
+            left = binop->m_left;
+            right = binop->m_right;
+        } else {
+            return false;
+        }
+        ASR::expr_t* element = nullptr;
+        if( ASR::is_a<ASR::Var_t>(*left) &&
+            ASR::down_cast<ASR::Var_t>(left)->m_v == acc ) {
+            element = right;
+        } else if( ASR::is_a<ASR::Var_t>(*right) &&
+                   ASR::down_cast<ASR::Var_t>(right)->m_v == acc ) {
+            element = left;
+        } else {
+            return false;
+        }
+        return ASR::is_a<ASR::ArrayItem_t>(*element) &&
+               is_unit_stride_ref(ASR::down_cast<ASR::ArrayItem_t>(element), loop_var);
+    }
+
     int64_t select_vector_instruction_size() {
         return avx512;
     }
@@ -94,32 +161,16 @@ public:
         return instruction_length/(kind * 8);
     }
 
-    void get_vector_intrinsic(ASR::stmt_t* loop_stmt, ASR::expr_t* index,
-                              ASR::expr_t*& vector_length,
-                              Vec<ASR::stmt_t*>& vectorised_loop_body) {
-        LCOMPILERS_ASSERT(vectorised_loop_body.reserve_called);
-        Vec<ASR::expr_t*> arrays;
-        arrays.reserve(al, 2);
-        if( is_vector_copy(loop_stmt, arrays) ) {
-            ASR::expr_t *target_sym = arrays[0], *value_sym = arrays[1];
-            ASR::ttype_t* target_type = ASRUtils::expr_type(target_sym);
-            int64_t vector_length_int = get_vector_length(target_type);
-            vector_length = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loop_stmt->base.loc,
-                                vector_length_int, ASRUtils::expr_type(index)));
-            ASR::expr_t* start = ASRUtils::EXPR(ASR::make_IntegerBinOp_t(al, loop_stmt->base.loc, index, ASR::binopType::Mul,
-                                        vector_length, ASRUtils::expr_type(index), nullptr));
-            ASR::expr_t* one = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loop_stmt->base.loc,
-                                    1, ASRUtils::expr_type(index)));
-            ASR::expr_t* next_index = ASRUtils::EXPR(ASR::make_IntegerBinOp_t(al, loop_stmt->base.loc, index, ASR::binopType::Add,
-                                            one, ASRUtils::expr_type(index), nullptr));
-            ASR::expr_t* end = ASRUtils::EXPR(ASR::make_IntegerBinOp_t(al, loop_stmt->base.loc, next_index, ASR::binopType::Mul,
-                                        vector_length, ASRUtils::expr_type(index), nullptr));
-            vectorised_loop_body.push_back(al, PassUtils::get_vector_copy(target_sym, value_sym, start,
-                end, one, vector_length,
-                al, unit,
-                current_scope, loop_stmt->base.loc));
-            return ;
-        }
+    ASR::expr_t* make_index_constant(int64_t value, ASR::ttype_t* index_type,
+                                     const Location& loc) {
+        return ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, value, index_type));
+    }
+
+    ASR::expr_t* make_index_binop(ASR::expr_t* left, ASR::binopType op,
+                                  ASR::expr_t* right, ASR::ttype_t* index_type,
+                                  const Location& loc) {
+        return ASRUtils::EXPR(ASR::make_IntegerBinOp_t(al, loc, left, op,
+                                  right, index_type, nullptr));
     }
 
     void vectorise_loop(const ASR::DoLoop_t& x) {
@@ -129,52 +180,150 @@ public:
         ASR::expr_t* loop_inc = x.m_head.m_increment;
         LCOMPILERS_ASSERT(loop_start);
         LCOMPILERS_ASSERT(loop_end);
-        if (!loop_inc) {
-            int a_kind = ASRUtils::extract_kind_from_ttype_t(ASRUtils::expr_type(x.m_head.m_v));
-            ASR::ttype_t *type = ASRUtils::TYPE(ASR::make_Integer_t(al, x.base.base.loc, a_kind));
-            loop_inc = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, x.base.base.loc, 1, type));
+        int64_t loop_inc_int = 1;
+        if( loop_inc ) {
+            ASR::expr_t* loop_inc_value = ASRUtils::expr_value(loop_inc);
+            if( !ASRUtils::is_value_constant(loop_inc_value) ) {
+                return ;
+            }
+            ASRUtils::extract_value(loop_inc_value, loop_inc_int);
+        }
+        if( loop_inc_int != 1 ) {
+            // The blocking below assumes consecutive elements
+            return ;
         }
         ASR::expr_t* loop_start_value = ASRUtils::expr_value(loop_start);
         ASR::expr_t* loop_end_value = ASRUtils::expr_value(loop_end);
-        ASR::expr_t* loop_inc_value = ASRUtils::expr_value(loop_inc);
         if( !ASRUtils::is_value_constant(loop_start_value) ||
-            !ASRUtils::is_value_constant(loop_end_value) ||
-            !ASRUtils::is_value_constant(loop_inc_value) ) {
+            !ASRUtils::is_value_constant(loop_end_value) ) {
             // Skip vectorisation of variable sized loops
             return ;
         }
-        ASR::stmt_t* loop_stmt = x.m_body[0];
-        int64_t loop_start_int = -1, loop_end_int = -1, loop_inc_int = -1;
+        int64_t loop_start_int = -1, loop_end_int = -1;
         ASRUtils::extract_value(loop_start_value, loop_start_int);
         ASRUtils::extract_value(loop_end_value, loop_end_int);
-        ASRUtils::extract_value(loop_inc_value, loop_inc_int);
-        int64_t loop_size = (loop_end_int - loop_start_int) / loop_inc_int + 1;
-        ASR::expr_t* vector_length = nullptr;
-        Vec<ASR::stmt_t*> vectorised_loop_body;
-        vectorised_loop_body.reserve(al, x.n_body);
-        get_vector_intrinsic(loop_stmt, x.m_head.m_v,
-                             vector_length, vectorised_loop_body);
-        if( !vector_length ) {
+        int64_t loop_size = loop_end_int - loop_start_int + 1;
+        if( loop_size <= 0 ) {
+            return ;
+        }
+        ASR::stmt_t* loop_stmt = x.m_body[0];
+        ASR::expr_t* loop_var = x.m_head.m_v;
+        ASR::ttype_t* index_type = ASRUtils::expr_type(loop_var);
+        const Location& loc = loop_stmt->base.loc;
+
+        Vec<ASR::expr_t*> arrays;
+        arrays.reserve(al, 2);
+        bool vector_copy = is_vector_copy(loop_stmt, loop_var, arrays);
+        bool sum_reduction = !vector_copy && is_sum_reduction(loop_stmt, loop_var);
+        if( !vector_copy && !sum_reduction ) {
+            return ;
+        }
+        // Blocking reorders iterations relative to the scalar tail, so the
+        // loop must not carry a dependence between iterations
+        std::vector<ASR::symbol_t*> loop_vars = {
+            ASR::down_cast<ASR::Var_t>(loop_var)->m_v };
+        DependenceAnalysis::AccessSet accesses =
+            DependenceAnalysis::collect_array_accesses(x.m_body, x.n_body, loop_vars);
+        if( DependenceAnalysis::loop_carries_dependence(accesses, loop_vars[0]) &&
+            !sum_reduction ) {
+            // The reduction's carried dependence on the accumulator is
+            // exactly what strip-mining preserves
+            return ;
+        }
+        ASR::ttype_t* element_type = nullptr;
+        if( vector_copy ) {
+            element_type = ASRUtils::expr_type(arrays[0]);
+        } else {
+            element_type = ASRUtils::expr_type(
+                ASR::down_cast<ASR::Assignment_t>(loop_stmt)->m_target);
+        }
+        int64_t vector_length_int = get_vector_length(element_type);
+        int64_t n_blocks = loop_size / vector_length_int;
+        int64_t remainder = loop_size % vector_length_int;
+        if( n_blocks == 0 ) {
+            // Shorter than one vector register, not worth rewriting
             return ;
         }
-        ASR::do_loop_head_t vectorised_loop_head;
-        vectorised_loop_head.m_start = loop_start;
-        int64_t vector_length_int = -1;
-        ASRUtils::extract_value(vector_length, vector_length_int);
-        // TODO: Add tests for loop sizes not divisible by vector_length.
-        vectorised_loop_head.m_end = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, x.m_head.m_v->base.loc,
-                                        loop_size/vector_length_int - 1, ASRUtils::expr_type(x.m_head.m_v)));
-        // TODO: Update this for increments other 1.
-        ASR::expr_t* one = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loop_stmt->base.loc,
-                                    1, ASRUtils::expr_type(x.m_head.m_v)));
-        vectorised_loop_head.m_increment = one;
-        vectorised_loop_head.m_v = x.m_head.m_v;
-        vectorised_loop_head.loc = x.m_head.loc;
-
-        ASR::stmt_t* vectorised_loop = ASRUtils::STMT(ASR::make_DoLoop_t(al, x.base.base.loc,
-                                            x.m_name, vectorised_loop_head, vectorised_loop_body.p,
-                                            vectorised_loop_body.size(), nullptr, 0));
-        pass_result.push_back(al, vectorised_loop);
+        ASR::expr_t* one = make_index_constant(1, index_type, loc);
+        ASR::expr_t* vector_length = make_index_constant(vector_length_int, index_type, loc);
+        ASR::expr_t* base = make_index_constant(loop_start_int, index_type, loc);
+
+        if( vector_copy ) {
+            // do i = 0, n_blocks - 1: copy the block
+            // [loop_start + i*VL, loop_start + (i+1)*VL) (end exclusive)
+            ASR::expr_t* block_start = make_index_binop(base, ASR::binopType::Add,
+                make_index_binop(loop_var, ASR::binopType::Mul, vector_length, index_type, loc),
+                index_type, loc);
+            ASR::expr_t* block_end = make_index_binop(block_start, ASR::binopType::Add,
+                vector_length, index_type, loc);
+            Vec<ASR::stmt_t*> blocked_body;
+            blocked_body.reserve(al, 1);
+            blocked_body.push_back(al, PassUtils::get_vector_copy(arrays[0], arrays[1],
+                block_start, block_end, one, vector_length, al, unit,
+                current_scope, loop_stmt->base.loc));
+            ASR::do_loop_head_t blocked_head;
+            blocked_head.m_v = loop_var;
+            blocked_head.m_start = make_index_constant(0, index_type, loc);
+            blocked_head.m_end = make_index_constant(n_blocks - 1, index_type, loc);
+            blocked_head.m_increment = one;
+            blocked_head.loc = x.m_head.loc;
+            pass_result.push_back(al, ASRUtils::STMT(ASR::make_DoLoop_t(al, x.base.base.loc,
+                x.m_name, blocked_head, blocked_body.p, blocked_body.size(), nullptr, 0)));
+        } else {
+            // Strip-mine the reduction: the outer loop walks the blocks with
+            // a fresh index; the inner loop keeps the original statement and
+            // has a constant trip count of vector_length, which the backend
+            // can unroll into vector code
+            int index_kind = ASRUtils::extract_kind_from_ttype_t(index_type);
+            Vec<ASR::expr_t*> idx_vars;
+            PassUtils::create_idx_vars(idx_vars, 1, loc, al, current_scope,
+                "_vec", index_kind);
+            ASR::expr_t* block_var = idx_vars[0];
+            ASR::expr_t* block_start = make_index_binop(base, ASR::binopType::Add,
+                make_index_binop(block_var, ASR::binopType::Mul, vector_length, index_type, loc),
+                index_type, loc);
+            ASR::expr_t* block_end = make_index_binop(block_start, ASR::binopType::Add,
+                make_index_constant(vector_length_int - 1, index_type, loc),
+                index_type, loc);
+            Vec<ASR::stmt_t*> inner_body;
+            inner_body.reserve(al, 1);
+            inner_body.push_back(al, loop_stmt);
+            ASR::do_loop_head_t inner_head;
+            inner_head.m_v = loop_var;
+            inner_head.m_start = block_start;
+            inner_head.m_end = block_end;
+            inner_head.m_increment = one;
+            inner_head.loc = x.m_head.loc;
+            Vec<ASR::stmt_t*> outer_body;
+            outer_body.reserve(al, 1);
+            outer_body.push_back(al, ASRUtils::STMT(ASR::make_DoLoop_t(al, x.base.base.loc,
+                nullptr, inner_head, inner_body.p, inner_body.size(), nullptr, 0)));
+            ASR::do_loop_head_t outer_head;
+            outer_head.m_v = block_var;
+            outer_head.m_start = make_index_constant(0, index_type, loc);
+            outer_head.m_end = make_index_constant(n_blocks - 1, index_type, loc);
+            outer_head.m_increment = one;
+            outer_head.loc = x.m_head.loc;
+            pass_result.push_back(al, ASRUtils::STMT(ASR::make_DoLoop_t(al, x.base.base.loc,
+                x.m_name, outer_head, outer_body.p, outer_body.size(), nullptr, 0)));
+        }
+
+        if( remainder > 0 ) {
+            // Scalar tail loop for the elements past the last full block
+            ASRUtils::ExprStmtDuplicator stmt_duplicator(al);
+            Vec<ASR::stmt_t*> tail_body;
+            tail_body.reserve(al, 1);
+            tail_body.push_back(al, stmt_duplicator.duplicate_stmt(loop_stmt));
+            ASR::do_loop_head_t tail_head;
+            tail_head.m_v = loop_var;
+            tail_head.m_start = make_index_constant(
+                loop_start_int + n_blocks * vector_length_int, index_type, loc);
+            tail_head.m_end = loop_end;
+            tail_head.m_increment = one;
+            tail_head.loc = x.m_head.loc;
+            pass_result.push_back(al, ASRUtils::STMT(ASR::make_DoLoop_t(al, x.base.base.loc,
+                nullptr, tail_head, tail_body.p, tail_body.size(), nullptr, 0)));
+        }
     }
 
     void visit_DoLoop(const ASR::DoLoop_t& x) {
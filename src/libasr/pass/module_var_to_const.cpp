@@ -0,0 +1,268 @@
+#include <set>
+#include <vector>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/module_var_to_const.h>
+
+namespace LCompilers {
+
+/*
+
+This pass promotes effectively-constant module variables to parameters.
+A module variable that has an initializer and is never written anywhere
+in the translation unit behaves exactly like a parameter, but because it
+is declared as a variable every read of it inside a hot loop stays a
+memory load; after promotion `expr_value()` sees the constant and the
+value-propagation passes fold the reads away. Configuration globals that
+are set in the source and then only ever read are the typical case.
+
+Only private or protected scalars are considered: a public,
+unprotected module variable can be assigned by any other translation
+unit that uses the module, and the defining module may itself be
+compiled separately. Modules loaded from modfiles are skipped for the
+same reason. A candidate is disqualified by any write-like use: an
+assignment or pointer association, a read statement, an intrinsic
+subroutine argument, having its address taken, or being passed to a
+dummy argument whose intent is not intent(in).
+
+*/
+
+namespace {
+
+uint64_t static get_hash(ASR::asr_t *node)
+{
+    return (uint64_t)node;
+}
+
+class WriteScanVisitor : public ASR::BaseWalkVisitor<WriteScanVisitor> {
+public:
+    std::set<uint64_t> written;
+    bool write_context = false;
+
+    void visit_Var(const ASR::Var_t &x) {
+        if (!write_context) {
+            return;
+        }
+        ASR::symbol_t *s = ASRUtils::symbol_get_past_external(x.m_v);
+        if (s != nullptr && ASR::is_a<ASR::Variable_t>(*s)) {
+            written.insert(get_hash((ASR::asr_t*)s));
+        }
+    }
+
+    void with_write_context(bool w, ASR::expr_t *e) {
+        if (e == nullptr) {
+            return;
+        }
+        bool old = write_context;
+        write_context = w;
+        visit_expr(*e);
+        write_context = old;
+    }
+
+    void visit_Assignment(const ASR::Assignment_t &x) {
+        with_write_context(true, x.m_target);
+        with_write_context(false, x.m_value);
+        if (x.m_overloaded != nullptr) {
+            visit_stmt(*x.m_overloaded);
+        }
+    }
+
+    // Either side of a pointer association aliases the variable; writes
+    // through the pointer are invisible to this scan
+    void visit_Associate(const ASR::Associate_t &x) {
+        with_write_context(true, x.m_target);
+        with_write_context(true, x.m_value);
+    }
+
+    void visit_GetPointer(const ASR::GetPointer_t &x) {
+        with_write_context(true, x.m_arg);
+    }
+
+    void visit_PointerToCPtr(const ASR::PointerToCPtr_t &x) {
+        with_write_context(true, x.m_arg);
+    }
+
+    void visit_CPtrToPointer(const ASR::CPtrToPointer_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_CPtrToPointer(x);
+        write_context = old;
+    }
+
+    // I/O statements store into their iostat/iomsg/inquiry arguments; a
+    // read statement additionally stores into every value. Treating the
+    // whole statement as a write only over-approximates on unit numbers.
+    void visit_FileRead(const ASR::FileRead_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileRead(x);
+        write_context = old;
+    }
+
+    void visit_FileOpen(const ASR::FileOpen_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileOpen(x);
+        write_context = old;
+    }
+
+    void visit_FileClose(const ASR::FileClose_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileClose(x);
+        write_context = old;
+    }
+
+    void visit_FileInquire(const ASR::FileInquire_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileInquire(x);
+        write_context = old;
+    }
+
+    void visit_FileRewind(const ASR::FileRewind_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileRewind(x);
+        write_context = old;
+    }
+
+    void visit_FileBackspace(const ASR::FileBackspace_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileBackspace(x);
+        write_context = old;
+    }
+
+    void visit_FileEndfile(const ASR::FileEndfile_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_FileEndfile(x);
+        write_context = old;
+    }
+
+    // A write statement only reads the printed values, but can store
+    // into its status arguments
+    void visit_FileWrite(const ASR::FileWrite_t &x) {
+        with_write_context(false, x.m_unit);
+        with_write_context(true, x.m_iomsg);
+        with_write_context(true, x.m_iostat);
+        with_write_context(true, x.m_id);
+        for (size_t i = 0; i < x.n_values; i++) {
+            with_write_context(false, x.m_values[i]);
+        }
+        with_write_context(false, x.m_separator);
+        with_write_context(false, x.m_end);
+        with_write_context(false, x.m_rec);
+        with_write_context(false, x.m_pos);
+        if (x.m_overloaded != nullptr) {
+            visit_stmt(*x.m_overloaded);
+        }
+    }
+
+    void visit_IntrinsicImpureSubroutine(
+            const ASR::IntrinsicImpureSubroutine_t &x) {
+        bool old = write_context;
+        write_context = true;
+        ASR::BaseWalkVisitor<WriteScanVisitor>::visit_IntrinsicImpureSubroutine(x);
+        write_context = old;
+    }
+
+    // An actual argument is only a read when the matching dummy is
+    // intent(in); anything else (including an unresolvable callee) is
+    // treated as a write
+    template <typename T>
+    void visit_call(const T &x) {
+        ASR::Function_t *fn = nullptr;
+        ASR::symbol_t *s = ASRUtils::symbol_get_past_external(x.m_name);
+        if (s != nullptr && ASR::is_a<ASR::Function_t>(*s)) {
+            fn = ASR::down_cast<ASR::Function_t>(s);
+        }
+        for (size_t i = 0; i < x.n_args; i++) {
+            bool dummy_is_in = false;
+            if (fn != nullptr && i < fn->n_args
+                    && ASR::is_a<ASR::Var_t>(*fn->m_args[i])) {
+                ASR::symbol_t *arg_sym =
+                    ASR::down_cast<ASR::Var_t>(fn->m_args[i])->m_v;
+                if (ASR::is_a<ASR::Variable_t>(*arg_sym)) {
+                    dummy_is_in = ASR::down_cast<ASR::Variable_t>(
+                        arg_sym)->m_intent == ASR::intentType::In;
+                }
+            }
+            with_write_context(!dummy_is_in, x.m_args[i].m_value);
+        }
+        if (x.m_dt != nullptr) {
+            with_write_context(false, x.m_dt);
+        }
+    }
+
+    void visit_SubroutineCall(const ASR::SubroutineCall_t &x) {
+        visit_call(x);
+    }
+
+    void visit_FunctionCall(const ASR::FunctionCall_t &x) {
+        visit_call(x);
+    }
+};
+
+bool is_candidate(const ASR::Variable_t &v) {
+    if (v.m_intent != ASR::intentType::Local
+            || (v.m_storage != ASR::storage_typeType::Default
+                && v.m_storage != ASR::storage_typeType::Save)
+            || v.m_abi != ASR::abiType::Source
+            || v.m_target_attr || v.m_is_volatile) {
+        return false;
+    }
+    if (v.m_access != ASR::accessType::Private && !v.m_is_protected) {
+        return false;
+    }
+    ASR::ttype_t *t = v.m_type;
+    if (ASRUtils::is_array(t)
+            || !(ASR::is_a<ASR::Integer_t>(*t) || ASR::is_a<ASR::Real_t>(*t)
+                || ASR::is_a<ASR::Logical_t>(*t)
+                || ASR::is_a<ASR::Complex_t>(*t))) {
+        return false;
+    }
+    return v.m_symbolic_value != nullptr && v.m_value != nullptr
+        && ASRUtils::is_value_constant(v.m_value);
+}
+
+} // anonymous namespace
+
+void pass_module_var_to_const(Allocator &/*al*/, ASR::TranslationUnit_t &unit,
+                              const PassOptions &/*pass_options*/) {
+    std::vector<ASR::Variable_t*> candidates;
+    for (auto &item : unit.m_symtab->get_scope()) {
+        if (!ASR::is_a<ASR::Module_t>(*item.second)) {
+            continue;
+        }
+        ASR::Module_t *m = ASR::down_cast<ASR::Module_t>(item.second);
+        if (m->m_loaded_from_mod || m->m_intrinsic) {
+            // The scan below cannot see writes in the module's original
+            // translation unit
+            continue;
+        }
+        for (auto &vitem : m->m_symtab->get_scope()) {
+            if (!ASR::is_a<ASR::Variable_t>(*vitem.second)) {
+                continue;
+            }
+            ASR::Variable_t *v = ASR::down_cast<ASR::Variable_t>(vitem.second);
+            if (is_candidate(*v)) {
+                candidates.push_back(v);
+            }
+        }
+    }
+    if (candidates.empty()) {
+        return;
+    }
+    WriteScanVisitor scan;
+    scan.visit_TranslationUnit(unit);
+    for (ASR::Variable_t *v : candidates) {
+        if (scan.written.count(get_hash((ASR::asr_t*)v)) == 0) {
+            v->m_storage = ASR::storage_typeType::Parameter;
+        }
+    }
+}
+
+} // namespace LCompilers
@@ -0,0 +1,14 @@
+#ifndef LIBASR_PASS_MODULE_VAR_TO_CONST_H
+#define LIBASR_PASS_MODULE_VAR_TO_CONST_H
+
+#include <libasr/asr.h>
+#include <libasr/utils.h>
+
+namespace LCompilers {
+
+    void pass_module_var_to_const(Allocator &al, ASR::TranslationUnit_t &unit,
+                                  const PassOptions &pass_options);
+
+} // namespace LCompilers
+
+#endif // LIBASR_PASS_MODULE_VAR_TO_CONST_H
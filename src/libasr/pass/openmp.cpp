@@ -6,6 +6,7 @@
 #include <libasr/asr_verify.h>
 #include <libasr/asr_builder.h>
 #include <libasr/pass/pass_utils.h>
+#include <libasr/pass/intrinsic_function_registry.h>
 #include <libasr/pass/replace_openmp.h>
 
 namespace LCompilers {
@@ -576,6 +577,134 @@ public:
 
 };
 
+// Infers locality for a `do concurrent` that carries no explicit specs, so
+// that --parallel-do-concurrent can lower it without user annotations. A
+// scalar that is only ever updated as `v = v op expr` (op one of +, -, *) or
+// `v = min/max(v, expr)` across the body is a reduction on that operation;
+// any other update pattern, or a mix of operations, disqualifies it. Scalars
+// that are not reductions need no clause: the thread-data packing below gives
+// every worker its own copy, which is exactly `local` semantics.
+class DoConcurrentReductionInferrer :
+    public ASR::BaseWalkVisitor<DoConcurrentReductionInferrer>
+{
+    public:
+        // insertion-ordered so the synthesized clauses are deterministic
+        std::vector<std::pair<ASR::expr_t*, ASR::reduction_opType>> candidates;
+        std::set<ASR::symbol_t*> disqualified;
+
+        void visit_Assignment(const ASR::Assignment_t &x) {
+            if (!ASR::is_a<ASR::Var_t>(*x.m_target) ||
+                    ASRUtils::is_array(ASRUtils::expr_type(x.m_target))) {
+                return;
+            }
+            ASR::symbol_t* target = ASR::down_cast<ASR::Var_t>(x.m_target)->m_v;
+            ASR::reduction_opType op;
+            if (!detect_reduction_op(x.m_value, target, op)) {
+                disqualified.insert(target);
+                return;
+            }
+            for (auto &candidate: candidates) {
+                if (ASR::down_cast<ASR::Var_t>(candidate.first)->m_v == target) {
+                    if (candidate.second != op) {
+                        disqualified.insert(target);
+                    }
+                    return;
+                }
+            }
+            candidates.push_back({x.m_target, op});
+        }
+
+    private:
+        bool is_var_of(ASR::expr_t* e, ASR::symbol_t* sym) {
+            return ASR::is_a<ASR::Var_t>(*e) &&
+                ASR::down_cast<ASR::Var_t>(e)->m_v == sym;
+        }
+
+        bool detect_reduction_op(ASR::expr_t* value, ASR::symbol_t* target,
+                ASR::reduction_opType &op) {
+            ASR::binopType binop;
+            ASR::expr_t *left = nullptr, *right = nullptr;
+            if (ASR::is_a<ASR::IntegerBinOp_t>(*value)) {
+                ASR::IntegerBinOp_t* b = ASR::down_cast<ASR::IntegerBinOp_t>(value);
+                binop = b->m_op; left = b->m_left; right = b->m_right;
+            } else if (ASR::is_a<ASR::RealBinOp_t>(*value)) {
+                ASR::RealBinOp_t* b = ASR::down_cast<ASR::RealBinOp_t>(value);
+                binop = b->m_op; left = b->m_left; right = b->m_right;
+            } else if (ASR::is_a<ASR::IntrinsicElementalFunction_t>(*value)) {
+                ASR::IntrinsicElementalFunction_t* f =
+                    ASR::down_cast<ASR::IntrinsicElementalFunction_t>(value);
+                int64_t min_id = static_cast<int64_t>(
+                    ASRUtils::IntrinsicElementalFunctions::Min);
+                int64_t max_id = static_cast<int64_t>(
+                    ASRUtils::IntrinsicElementalFunctions::Max);
+                if ((f->m_intrinsic_id != min_id && f->m_intrinsic_id != max_id)
+                        || f->n_args != 2) {
+                    return false;
+                }
+                if (!is_var_of(f->m_args[0], target) &&
+                        !is_var_of(f->m_args[1], target)) {
+                    return false;
+                }
+                op = f->m_intrinsic_id == min_id ?
+                    ASR::reduction_opType::ReduceMIN :
+                    ASR::reduction_opType::ReduceMAX;
+                return true;
+            } else {
+                return false;
+            }
+            switch (binop) {
+                case ASR::binopType::Add: {
+                    if (!is_var_of(left, target) && !is_var_of(right, target)) {
+                        return false;
+                    }
+                    op = ASR::reduction_opType::ReduceAdd;
+                    return true;
+                }
+                case ASR::binopType::Sub: {
+                    // `v - expr` only; `expr - v` is not a running difference
+                    if (!is_var_of(left, target)) {
+                        return false;
+                    }
+                    op = ASR::reduction_opType::ReduceSub;
+                    return true;
+                }
+                case ASR::binopType::Mul: {
+                    if (!is_var_of(left, target) && !is_var_of(right, target)) {
+                        return false;
+                    }
+                    op = ASR::reduction_opType::ReduceMul;
+                    return true;
+                }
+                default: {
+                    return false;
+                }
+            }
+        }
+};
+
+// Collects every ArrayItem whose base array belongs to the shared set of the
+// enclosing parallel region. --check-parallel uses it to emit one runtime
+// access record per shared element read inside an outlined region body.
+class RaceReadCollector:
+    public ASR::BaseWalkVisitor<RaceReadCollector>
+{
+    public:
+        const std::set<std::string> &shared_arrays;
+        std::vector<ASR::ArrayItem_t*> reads;
+        RaceReadCollector(const std::set<std::string> &shared_arrays) :
+            shared_arrays(shared_arrays) {}
+
+        void visit_ArrayItem(const ASR::ArrayItem_t &x) {
+            if (ASR::is_a<ASR::Var_t>(*x.m_v)) {
+                ASR::Var_t* v = ASR::down_cast<ASR::Var_t>(x.m_v);
+                if (shared_arrays.count(to_lower(ASRUtils::symbol_name(v->m_v)))) {
+                    reads.push_back(const_cast<ASR::ArrayItem_t*>(&x));
+                }
+            }
+            ASR::BaseWalkVisitor<RaceReadCollector>::visit_ArrayItem(x);
+        }
+};
+
 class ParallelRegionVisitor :
     public ASR::BaseWalkVisitor<ParallelRegionVisitor>
 {
@@ -1175,11 +1304,121 @@ class ParallelRegionVisitor :
                 nullptr, 0,
                 false, false, false, nullptr));
 
+            if (pass_options.check_parallel) {
+                std::set<std::string> shared_arrays;
+                for (auto &it: involved_symbols) {
+                    if (ASRUtils::is_array(ASRUtils::type_get_past_pointer(it.second.first))) {
+                        shared_arrays.insert(it.first);
+                    }
+                }
+                if (!shared_arrays.empty()) {
+                    ASR::Function_t* f = ASR::down_cast<ASR::Function_t>(function);
+                    instrument_race_checks(f->m_body, f->n_body, shared_arrays);
+                }
+            }
+
             current_scope->parent->add_symbol(ASRUtils::symbol_name(function), function);
             current_scope = current_scope_copy;
             return function;
         }
 
+        // --check-parallel: one runtime record for a single shared-element
+        // access. Passes the element address, the array name and the source
+        // byte offset so the checker can name both sides of a race. Returns
+        // nullptr when the checker interfaces are missing (stale omp_lib
+        // modfile), in which case no instrumentation is emitted.
+        ASR::stmt_t* race_check_call(ASR::ArrayItem_t* elem, bool is_write) {
+            ASR::symbol_t* callee = current_scope->resolve_symbol("lfortran_race_check_access");
+            if (callee == nullptr) {
+                return nullptr;
+            }
+            const Location &loc = elem->base.base.loc;
+            std::string name = to_lower(ASRUtils::symbol_name(
+                ASR::down_cast<ASR::Var_t>(elem->m_v)->m_v));
+            ASRUtils::ASRBuilder b(al, loc);
+            ASRUtils::ExprStmtDuplicator dup(al);
+            dup.success = true;
+            ASR::expr_t* elem_copy = dup.duplicate_expr((ASR::expr_t*)elem);
+            ASR::expr_t* addr = ASRUtils::EXPR(ASR::make_PointerToCPtr_t(al, loc,
+                ASRUtils::EXPR(ASR::make_GetPointer_t(al, loc, elem_copy,
+                    ASRUtils::TYPE(ASR::make_Pointer_t(al, loc, ASRUtils::expr_type(elem_copy))), nullptr)),
+                ASRUtils::TYPE(ASR::make_CPtr_t(al, loc)), nullptr));
+            ASR::ttype_t* name_type = ASRUtils::TYPE(ASR::make_String_t(al, loc, 1,
+                ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, name.size(),
+                    ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 8)))),
+                ASR::string_length_kindType::ExpressionLength,
+                ASR::string_physical_typeType::CChar));
+            ASR::expr_t* name_expr = ASRUtils::EXPR(ASR::make_StringConstant_t(
+                al, loc, s2c(al, name), name_type));
+            Vec<ASR::call_arg_t> args; args.reserve(al, 5);
+            ASR::call_arg_t a; a.loc = loc;
+            a.m_value = addr; args.push_back(al, a);
+            a.m_value = name_expr; args.push_back(al, a);
+            a.m_value = b.i32(name.size()); args.push_back(al, a);
+            a.m_value = b.i64(loc.first); args.push_back(al, a);
+            a.m_value = b.i32(is_write ? 1 : 0); args.push_back(al, a);
+            return ASRUtils::STMT(ASR::make_SubroutineCall_t(al, loc, callee, nullptr,
+                args.p, args.n, nullptr, false));
+        }
+
+        // --check-parallel: rewrite an outlined region body in place so every
+        // access to a shared array element reports to the runtime checker
+        // first: reads of a statement, then its write, then the statement
+        // itself. Recurses into the bodies of nested control flow.
+        void instrument_race_checks(ASR::stmt_t** &stmts, size_t &n,
+                const std::set<std::string> &shared_arrays) {
+            Vec<ASR::stmt_t*> nb; nb.reserve(al, n);
+            for (size_t i = 0; i < n; i++) {
+                ASR::stmt_t* s = stmts[i];
+                if (ASR::is_a<ASR::DoLoop_t>(*s)) {
+                    ASR::DoLoop_t* dl = ASR::down_cast<ASR::DoLoop_t>(s);
+                    instrument_race_checks(dl->m_body, dl->n_body, shared_arrays);
+                } else if (ASR::is_a<ASR::DoConcurrentLoop_t>(*s)) {
+                    ASR::DoConcurrentLoop_t* dl = ASR::down_cast<ASR::DoConcurrentLoop_t>(s);
+                    instrument_race_checks(dl->m_body, dl->n_body, shared_arrays);
+                } else if (ASR::is_a<ASR::WhileLoop_t>(*s)) {
+                    ASR::WhileLoop_t* wl = ASR::down_cast<ASR::WhileLoop_t>(s);
+                    instrument_race_checks(wl->m_body, wl->n_body, shared_arrays);
+                } else if (ASR::is_a<ASR::If_t>(*s)) {
+                    ASR::If_t* if_stmt = ASR::down_cast<ASR::If_t>(s);
+                    instrument_race_checks(if_stmt->m_body, if_stmt->n_body, shared_arrays);
+                    instrument_race_checks(if_stmt->m_orelse, if_stmt->n_orelse, shared_arrays);
+                } else if (ASR::is_a<ASR::Assignment_t>(*s)) {
+                    ASR::Assignment_t* assign = ASR::down_cast<ASR::Assignment_t>(s);
+                    RaceReadCollector rc(shared_arrays);
+                    rc.visit_expr(*assign->m_value);
+                    ASR::ArrayItem_t* target = nullptr;
+                    if (ASR::is_a<ASR::ArrayItem_t>(*assign->m_target)) {
+                        ASR::ArrayItem_t* ai = ASR::down_cast<ASR::ArrayItem_t>(assign->m_target);
+                        if (ASR::is_a<ASR::Var_t>(*ai->m_v) && shared_arrays.count(
+                                to_lower(ASRUtils::symbol_name(
+                                    ASR::down_cast<ASR::Var_t>(ai->m_v)->m_v)))) {
+                            target = ai;
+                        }
+                        // subscripts of the target are reads either way
+                        for (size_t d = 0; d < ai->n_args; d++) {
+                            if (ai->m_args[d].m_left) rc.visit_expr(*ai->m_args[d].m_left);
+                            if (ai->m_args[d].m_right) rc.visit_expr(*ai->m_args[d].m_right);
+                            if (ai->m_args[d].m_step) rc.visit_expr(*ai->m_args[d].m_step);
+                        }
+                    } else {
+                        rc.visit_expr(*assign->m_target);
+                    }
+                    for (ASR::ArrayItem_t* r : rc.reads) {
+                        ASR::stmt_t* call = race_check_call(r, false);
+                        if (call) nb.push_back(al, call);
+                    }
+                    if (target) {
+                        ASR::stmt_t* call = race_check_call(target, true);
+                        if (call) nb.push_back(al, call);
+                    }
+                }
+                nb.push_back(al, s);
+            }
+            stmts = nb.p;
+            n = nb.n;
+        }
+
         ASR::ttype_t* f_type_to_c_type(ASR::ttype_t* /*f_type*/) {
             // populate it when required
             // right now in ASR `integer(c_int) :: n` is represented same as `integer :: n`
@@ -1581,7 +1820,38 @@ class ParallelRegionVisitor :
             }
         }
 
+        // Synthesizes `reduce` clauses on a clause-less `do concurrent` from
+        // the update patterns in its body (see DoConcurrentReductionInferrer),
+        // so the lowering below initializes the per-thread partials and merges
+        // them atomically exactly as it would for explicit clauses.
+        void infer_reduction_clauses(ASR::DoConcurrentLoop_t &x) {
+            DoConcurrentReductionInferrer inferrer;
+            for (size_t i = 0; i < x.n_body; i++) {
+                inferrer.visit_stmt(*x.m_body[i]);
+            }
+            Vec<ASR::reduction_expr_t> reductions;
+            reductions.reserve(al, inferrer.candidates.size());
+            for (auto &candidate: inferrer.candidates) {
+                ASR::symbol_t* sym = ASR::down_cast<ASR::Var_t>(candidate.first)->m_v;
+                if (inferrer.disqualified.count(sym)) {
+                    continue;
+                }
+                ASR::reduction_expr_t red;
+                red.loc = candidate.first->base.loc;
+                red.m_op = candidate.second;
+                red.m_arg = candidate.first;
+                reductions.push_back(al, red);
+            }
+            if (reductions.size() > 0) {
+                x.m_reduction = reductions.p;
+                x.n_reduction = reductions.size();
+            }
+        }
+
         void visit_DoConcurrentLoop(const ASR::DoConcurrentLoop_t &x) {
+            if (pass_options.parallel_do_concurrent && x.n_reduction == 0) {
+                infer_reduction_clauses(const_cast<ASR::DoConcurrentLoop_t&>(x));
+            }
             std::map<std::string, std::pair<ASR::ttype_t*, ASR::expr_t*>> involved_symbols;
 
             InvolvedSymbolsCollector c(al, involved_symbols);
@@ -1770,8 +2040,16 @@ class ParallelRegionVisitor :
             std::string unsupported_sym_name = import_all(ASR::down_cast<ASR::Module_t>(mod_sym));
             LCOMPILERS_ASSERT(unsupported_sym_name == "");
 
+            if (pass_options.check_parallel && current_scope->get_symbol("lfortran_race_check_begin")) {
+                pass_result.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc,
+                    current_scope->get_symbol("lfortran_race_check_begin"), nullptr, nullptr, 0, nullptr, false)));
+            }
             pass_result.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc, current_scope->get_symbol("gomp_parallel"), nullptr,
                                 call_args.p, call_args.n, nullptr, false)));
+            if (pass_options.check_parallel && current_scope->get_symbol("lfortran_race_check_end")) {
+                pass_result.push_back(al, ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc,
+                    current_scope->get_symbol("lfortran_race_check_end"), nullptr, nullptr, 0, nullptr, false)));
+            }
 
             for (auto it: reduction_variables) {
                 ASR::symbol_t* actual_sym = current_scope->resolve_symbol(it);
@@ -2506,7 +2784,21 @@ class ParallelRegionVisitor :
                 ASR::accessType::Public, ASR::deftypeType::Implementation,
                 nullptr, false, false, false, false, false, nullptr, 0,
                 false, false, false, nullptr));
-            
+
+            if (pass_options.check_parallel) {
+                std::set<std::string> shared_arrays;
+                for (auto &it: involved_symbols) {
+                    if (c->variable_accessibility[it.first] == ASR::omp_clauseType::OMPShared &&
+                            ASRUtils::is_array(ASRUtils::type_get_past_pointer(it.second.first))) {
+                        shared_arrays.insert(it.first);
+                    }
+                }
+                if (!shared_arrays.empty()) {
+                    ASR::Function_t* f = ASR::down_cast<ASR::Function_t>(function);
+                    instrument_race_checks(f->m_body, f->n_body, shared_arrays);
+                }
+            }
+
             clauses_heirarchial[nesting_lvl].clear();
             current_scope->parent->add_symbol(ASRUtils::symbol_name(function), function);
             current_scope = current_scope_copy;
@@ -2582,6 +2874,11 @@ class ParallelRegionVisitor :
 
                 case ASR::omp_region_typeType::Atomic:
                 visit_OMPAtomic(x);
+                break;
+
+                case ASR::omp_region_typeType::Simd:
+                visit_OMPSimd(x);
+                break;
 
                 default:
                     // for now give error for constructs which we do not support
@@ -2686,8 +2983,16 @@ class ParallelRegionVisitor :
                                 call_args1.p, call_args1.n, nullptr, false)));
             }
 
+            if (pass_options.check_parallel && current_scope->get_symbol("lfortran_race_check_begin")) {
+                nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc,
+                    current_scope->get_symbol("lfortran_race_check_begin"), nullptr, nullptr, 0, nullptr, false)));
+            }
             nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc, current_scope->get_symbol("gomp_parallel"), nullptr,
                                 call_args.p, call_args.n, nullptr, false)));
+            if (pass_options.check_parallel && current_scope->get_symbol("lfortran_race_check_end")) {
+                nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_SubroutineCall_t(al, x.base.base.loc,
+                    current_scope->get_symbol("lfortran_race_check_end"), nullptr, nullptr, 0, nullptr, false)));
+            }
             ASR::symbol_t* thread_data_sym = thread_data_module.second;
 
             for (auto it: reduction_variables) {
@@ -3187,15 +3492,72 @@ class ParallelRegionVisitor :
                                     task_interface_func->m_function_signature)), nullptr)),
                                     ASRUtils::TYPE(ASR::make_CPtr_t(al, loc)), nullptr));
             
+            // Untied tasks and task dependences map onto the GOMP flags word
+            // and the legacy depend array (GOMP_TASK_FLAG_UNTIED = 1,
+            // GOMP_TASK_FLAG_DEPEND = 8)
+            bool is_untied = false;
+            std::vector<ASR::expr_t*> depend_out_vars, depend_in_vars;
+            for (size_t i = 0; i < x.n_clauses; i++) {
+                if (x.m_clauses[i]->type == ASR::omp_clauseType::OMPUntied) {
+                    is_untied = true;
+                } else if (x.m_clauses[i]->type == ASR::omp_clauseType::OMPDepend) {
+                    ASR::OMPDepend_t* dep = ASR::down_cast<ASR::OMPDepend_t>(x.m_clauses[i]);
+                    for (size_t j = 0; j < dep->n_vars; j++) {
+                        if (dep->m_type == ASR::omp_depend_typeType::DependIn) {
+                            depend_in_vars.push_back(dep->m_vars[j]);
+                        } else {
+                            // out and inout dependences are equivalent for GOMP
+                            depend_out_vars.push_back(dep->m_vars[j]);
+                        }
+                    }
+                }
+            }
+            int64_t n_depend = (int64_t) (depend_out_vars.size() + depend_in_vars.size());
+            int32_t task_flags = 0;
+            if (is_untied) task_flags |= 1;
+            if (n_depend > 0) task_flags |= 8;
+
             // Constants for GOMP_task call
             ASR::expr_t* data_size = b.i64(compute_task_data_size(task_data_module.second));
             ASR::expr_t* data_align = b.i64(8);
             ASR::expr_t* if_clause = b.bool_t(true, ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 1))); // Always create task (c_bool kind)
-            ASR::expr_t* flags = b.i32(0);      // No special flags
-            Vec<ASR::call_arg_t> task_call_args; 
+            ASR::expr_t* flags = b.i32(task_flags);
+            Vec<ASR::call_arg_t> task_call_args;
             task_call_args.reserve(al, 8);
             ASR::ttype_t *type_ = ASRUtils::TYPE(ASR::make_CPtr_t(al, loc));
             ASR::expr_t *tmp_1 = ASRUtils::EXPR(ASR::make_PointerNullConstant_t(al, loc, type_, nullptr));
+
+            ASR::expr_t* depend_arg = tmp_1;
+            if (n_depend > 0) {
+                // Legacy GOMP depend format: element 1 holds the total number
+                // of dependences, element 2 the number of out/inout entries,
+                // followed by the addresses (out/inout first, then in)
+                ASR::ttype_t* i64_type = ASRUtils::TYPE(ASR::make_Integer_t(al, loc, 8));
+                ASR::expr_t* depend_array = b.Variable(current_scope,
+                    current_scope->get_unique_name("task_depend"),
+                    b.Array({n_depend + 2}, i64_type), ASR::intentType::Local);
+                nested_lowered_body.push_back(b.Assignment(
+                    b.ArrayItem_01(depend_array, {b.i32(1)}), b.i64(n_depend)));
+                nested_lowered_body.push_back(b.Assignment(
+                    b.ArrayItem_01(depend_array, {b.i32(2)}),
+                    b.i64((int64_t) depend_out_vars.size())));
+                int64_t slot = 3;
+                for (std::vector<ASR::expr_t*>* dep_vars : {&depend_out_vars, &depend_in_vars}) {
+                    for (ASR::expr_t* v : *dep_vars) {
+                        nested_lowered_body.push_back(b.Assignment(
+                            b.ArrayItem_01(depend_array, {b.i32(slot++)}),
+                            ASRUtils::EXPR(ASR::make_Cast_t(al, loc, v,
+                                ASR::cast_kindType::PointerToInteger, i64_type,
+                                nullptr, nullptr))));
+                    }
+                }
+                depend_arg = ASRUtils::EXPR(ASR::make_PointerToCPtr_t(al, loc,
+                    ASRUtils::EXPR(ASR::make_GetPointer_t(al, loc, depend_array,
+                        ASRUtils::TYPE(ASR::make_Pointer_t(al, loc,
+                            ASRUtils::expr_type(depend_array))), nullptr)),
+                    type_, nullptr));
+            }
+
             ASR::call_arg_t arg1; arg1.loc = loc; arg1.m_value = c_funloc;
             ASR::call_arg_t arg2; arg2.loc = loc; arg2.m_value = task_ptr_expr;
             ASR::call_arg_t arg3; arg3.loc = loc; arg3.m_value = tmp_1;
@@ -3203,7 +3565,7 @@ class ParallelRegionVisitor :
             ASR::call_arg_t arg5; arg5.loc = loc; arg5.m_value = data_align;
             ASR::call_arg_t arg6; arg6.loc = loc; arg6.m_value = if_clause;
             ASR::call_arg_t arg7; arg7.loc = loc; arg7.m_value = flags;
-            ASR::call_arg_t arg8; arg8.loc = loc; arg8.m_value = tmp_1;
+            ASR::call_arg_t arg8; arg8.loc = loc; arg8.m_value = depend_arg;
             
             task_call_args.push_back(al, arg1); task_call_args.push_back(al, arg2);
             task_call_args.push_back(al, arg3); task_call_args.push_back(al, arg4);
@@ -3567,6 +3929,122 @@ class ParallelRegionVisitor :
             clauses_heirarchial[nesting_lvl].clear();
         }
 
+        void visit_OMPSimd(const ASR::OMPRegion_t &x) {
+            nested_lowered_body = {};
+            Location loc = x.base.base.loc;
+            ASRUtils::ASRBuilder b(al, loc);
+
+            // A simd region stays serial; the goal is to hand the backend an
+            // inner loop with a constant trip count that it can turn into
+            // vector code. Strip-mine the annotated loop into blocks of the
+            // vector length plus a scalar tail. safelen bounds the block
+            // size; aligned is accepted but advisory in this lowering.
+            // Strip-mining preserves the exact iteration order, so this is
+            // valid for any loop body, including reductions.
+            Vec<ASR::stmt_t*> simd_body;
+            simd_body.reserve(al, x.n_body);
+            visit_OMPBody(&x, simd_body);
+
+            int64_t vector_length = 8;
+            for (size_t i = 0; i < x.n_clauses; i++) {
+                if (x.m_clauses[i]->type == ASR::omp_clauseType::OMPSafelen) {
+                    ASR::OMPSafelen_t* safelen = ASR::down_cast<ASR::OMPSafelen_t>(x.m_clauses[i]);
+                    ASR::expr_t* safelen_value = ASRUtils::expr_value(safelen->m_length);
+                    int64_t safelen_int = 0;
+                    if (ASRUtils::is_value_constant(safelen_value)) {
+                        ASRUtils::extract_value(safelen_value, safelen_int);
+                        if (safelen_int > 0 && safelen_int < vector_length) {
+                            vector_length = safelen_int;
+                        }
+                    }
+                }
+            }
+
+            ASR::DoLoop_t* simd_do = nullptr;
+            if (simd_body.size() == 1 && ASR::is_a<ASR::DoLoop_t>(*simd_body[0])) {
+                simd_do = ASR::down_cast<ASR::DoLoop_t>(simd_body[0]);
+            }
+            if (simd_do && simd_do->m_head.m_increment) {
+                // The blocking below assumes consecutive iterations
+                ASR::expr_t* inc_value = ASRUtils::expr_value(simd_do->m_head.m_increment);
+                int64_t inc_int = 0;
+                if (!ASRUtils::is_value_constant(inc_value)) {
+                    simd_do = nullptr;
+                } else {
+                    ASRUtils::extract_value(inc_value, inc_int);
+                    if (inc_int != 1) simd_do = nullptr;
+                }
+            }
+            if (simd_do == nullptr) {
+                // Not a unit-stride counted loop; keep the body as is
+                for (size_t i = 0; i < simd_body.size(); i++) {
+                    nested_lowered_body.push_back(simd_body[i]);
+                }
+                clauses_heirarchial[nesting_lvl].clear();
+                return;
+            }
+
+            ASR::expr_t* loop_var = simd_do->m_head.m_v;
+            ASR::expr_t* loop_start = simd_do->m_head.m_start;
+            ASR::expr_t* loop_end = simd_do->m_head.m_end;
+            ASR::ttype_t* index_type = ASRUtils::expr_type(loop_var);
+
+            // n_blocks = (end - start + 1) / VL, evaluated at run time
+            ASR::expr_t* trip_count = b.Add(b.Sub(loop_end, loop_start), b.i_t(1, index_type));
+            ASR::expr_t* n_blocks = b.Div(trip_count, b.i_t(vector_length, index_type));
+
+            ASR::expr_t* block_var = b.Variable(current_scope,
+                current_scope->get_unique_name("simd_block"), index_type, ASR::intentType::Local);
+            ASR::expr_t* block_base = b.Add(loop_start, b.Mul(block_var, b.i_t(vector_length, index_type)));
+
+            // Inner loop: the original body over one block, constant trip
+            // count of vector_length
+            Vec<ASR::stmt_t*> inner_body;
+            inner_body.reserve(al, simd_do->n_body);
+            for (size_t i = 0; i < simd_do->n_body; i++) {
+                inner_body.push_back(al, simd_do->m_body[i]);
+            }
+            ASR::do_loop_head_t inner_head;
+            inner_head.loc = simd_do->m_head.loc;
+            inner_head.m_v = loop_var;
+            inner_head.m_start = block_base;
+            inner_head.m_end = b.Add(block_base, b.i_t(vector_length - 1, index_type));
+            inner_head.m_increment = b.i_t(1, index_type);
+
+            Vec<ASR::stmt_t*> outer_body;
+            outer_body.reserve(al, 1);
+            outer_body.push_back(al, ASRUtils::STMT(ASR::make_DoLoop_t(al, loc, nullptr,
+                inner_head, inner_body.p, inner_body.n, nullptr, 0)));
+
+            ASR::do_loop_head_t outer_head;
+            outer_head.loc = simd_do->m_head.loc;
+            outer_head.m_v = block_var;
+            outer_head.m_start = b.i_t(0, index_type);
+            outer_head.m_end = b.Sub(n_blocks, b.i_t(1, index_type));
+            outer_head.m_increment = b.i_t(1, index_type);
+            nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_DoLoop_t(al, loc,
+                simd_do->m_name, outer_head, outer_body.p, outer_body.n, nullptr, 0)));
+
+            // Scalar tail loop for the iterations past the last full block
+            ASRUtils::ExprStmtDuplicator stmt_duplicator(al);
+            Vec<ASR::stmt_t*> tail_body;
+            tail_body.reserve(al, simd_do->n_body);
+            for (size_t i = 0; i < simd_do->n_body; i++) {
+                stmt_duplicator.success = true;
+                tail_body.push_back(al, stmt_duplicator.duplicate_stmt(simd_do->m_body[i]));
+            }
+            ASR::do_loop_head_t tail_head;
+            tail_head.loc = simd_do->m_head.loc;
+            tail_head.m_v = loop_var;
+            tail_head.m_start = b.Add(loop_start, b.Mul(n_blocks, b.i_t(vector_length, index_type)));
+            tail_head.m_end = loop_end;
+            tail_head.m_increment = b.i_t(1, index_type);
+            nested_lowered_body.push_back(ASRUtils::STMT(ASR::make_DoLoop_t(al, loc, nullptr,
+                tail_head, tail_body.p, tail_body.n, nullptr, 0)));
+
+            clauses_heirarchial[nesting_lvl].clear();
+        }
+
         void visit_OMPTaskloop(const ASR::OMPRegion_t &x) {
             Location loc = x.base.base.loc;
             ASRUtils::ASRBuilder b(al, loc);
@@ -4091,7 +4569,10 @@ class ParallelRegionVisitor :
 
 void pass_replace_openmp(Allocator &al, ASR::TranslationUnit_t &unit,
                             const PassOptions &pass_options) {
-    if (pass_options.openmp) {
+    // --parallel-do-concurrent reuses the whole lowering, but only its
+    // DoConcurrentLoop path triggers: OMPRegion nodes exist only when the
+    // frontend saw pragmas, which requires --openmp.
+    if (pass_options.openmp || pass_options.parallel_do_concurrent) {
         ParallelRegionVisitor v(al, pass_options);
         v.visit_TranslationUnit(unit);
     }
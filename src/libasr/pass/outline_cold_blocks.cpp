@@ -0,0 +1,225 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/exception.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_verify.h>
+#include <libasr/pass/pass_utils.h>
+#include <libasr/pass/outline_cold_blocks.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace LCompilers {
+
+/*
+This ASR pass moves cold statement regions out of hot procedures into
+helper subroutines, so that error-reporting code does not inflate the
+body (and instruction-cache footprint) of the procedure it guards.
+
+A region is considered cold when it is an If branch that
+unconditionally terminates the program: its last statement is `stop`
+or `error stop` and the statements before it only print or write the
+diagnostic. Such a branch
+
+    if (n < 0) then
+        print *, "invalid size:", n
+        print *, "expected a non-negative value"
+        error stop
+    end if
+
+becomes
+
+    if (n < 0) then
+        call _lcompilers_cold_block(n)
+    end if
+
+with the prints and the error stop moved into the helper. Scalars the
+region reads are passed as intent(in) arguments. The LLVM backend
+marks procedures ending in stop/error stop as cold and noinline, so
+the helper stays out of the caller's code layout.
+*/
+
+// Collects, in first-use order, the variables a statement region reads,
+// and rejects regions referencing anything that cannot be passed as a
+// plain scalar argument
+class ColdRegionVarCollector: public ASR::BaseWalkVisitor<ColdRegionVarCollector> {
+    public:
+
+    std::vector<ASR::symbol_t*> symbols;
+    std::set<ASR::symbol_t*> seen;
+    bool eligible = true;
+
+    void visit_Var(const ASR::Var_t& x) {
+        if( !seen.insert(x.m_v).second ) {
+            return ;
+        }
+        ASR::ttype_t* type = ASRUtils::symbol_type(x.m_v);
+        if( !ASR::is_a<ASR::Variable_t>(
+                *ASRUtils::symbol_get_past_external(x.m_v)) ||
+            ASRUtils::is_array(type) ||
+            ASRUtils::is_pointer(type) ||
+            ASRUtils::is_allocatable(type) ) {
+            eligible = false;
+            return ;
+        }
+        ASR::ttype_t* el_type = ASRUtils::type_get_past_allocatable_pointer(type);
+        if( !(ASR::is_a<ASR::Integer_t>(*el_type) ||
+              ASR::is_a<ASR::Real_t>(*el_type) ||
+              ASR::is_a<ASR::Complex_t>(*el_type) ||
+              ASR::is_a<ASR::Logical_t>(*el_type)) ) {
+            eligible = false;
+            return ;
+        }
+        symbols.push_back(x.m_v);
+    }
+};
+
+// Redirects Var references in the outlined copy of the region to the
+// helper's dummy arguments
+class ColdRegionSymbolReplacer: public ASR::BaseExprReplacer<ColdRegionSymbolReplacer> {
+    public:
+
+    std::map<ASR::symbol_t*, ASR::symbol_t*>& symbol_map;
+
+    ColdRegionSymbolReplacer(std::map<ASR::symbol_t*, ASR::symbol_t*>& symbol_map_):
+        symbol_map(symbol_map_) {}
+
+    void replace_Var(ASR::Var_t* x) {
+        auto it = symbol_map.find(x->m_v);
+        if( it != symbol_map.end() ) {
+            x->m_v = it->second;
+        }
+    }
+};
+
+class ColdRegionSymbolReplacerVisitor:
+    public ASR::CallReplacerOnExpressionsVisitor<ColdRegionSymbolReplacerVisitor> {
+    public:
+
+    ColdRegionSymbolReplacer replacer;
+
+    ColdRegionSymbolReplacerVisitor(std::map<ASR::symbol_t*, ASR::symbol_t*>& symbol_map):
+        replacer(symbol_map) {}
+
+    void call_replacer() {
+        replacer.current_expr = current_expr;
+        replacer.replace_expr(*current_expr);
+    }
+};
+
+class ColdBlockOutliner: public PassUtils::PassVisitor<ColdBlockOutliner> {
+    public:
+
+    ColdBlockOutliner(Allocator& al_): PassVisitor(al_, nullptr) {
+        pass_result.reserve(al, 0);
+    }
+
+    bool is_cold_region(ASR::stmt_t** stmts, size_t n) {
+        // a lone stop is already compact; outline only when diagnostic
+        // statements precede it
+        if( n < 2 ) {
+            return false;
+        }
+        if( !ASR::is_a<ASR::ErrorStop_t>(*stmts[n - 1]) &&
+            !ASR::is_a<ASR::Stop_t>(*stmts[n - 1]) ) {
+            return false;
+        }
+        for( size_t i = 0; i < n; i++ ) {
+            if( !ASR::is_a<ASR::Print_t>(*stmts[i]) &&
+                !ASR::is_a<ASR::FileWrite_t>(*stmts[i]) &&
+                !ASR::is_a<ASR::ErrorStop_t>(*stmts[i]) &&
+                !ASR::is_a<ASR::Stop_t>(*stmts[i]) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void try_outline_region(ASR::stmt_t**& stmts, size_t& n) {
+        if( current_scope == nullptr || !is_cold_region(stmts, n) ) {
+            return ;
+        }
+        const Location& loc = stmts[0]->base.loc;
+        ColdRegionVarCollector collector;
+        for( size_t i = 0; i < n; i++ ) {
+            collector.visit_stmt(*stmts[i]);
+        }
+        if( !collector.eligible ) {
+            return ;
+        }
+
+        SymbolTable* fn_symtab = al.make_new<SymbolTable>(current_scope);
+        std::map<ASR::symbol_t*, ASR::symbol_t*> symbol_map;
+        Vec<ASR::expr_t*> fn_args; fn_args.reserve(al, collector.symbols.size());
+        for( ASR::symbol_t* sym: collector.symbols ) {
+            std::string dummy_name = fn_symtab->get_unique_name(
+                ASRUtils::symbol_name(sym), false);
+            ASR::symbol_t* dummy = ASR::down_cast<ASR::symbol_t>(
+                ASRUtils::make_Variable_t_util(al, loc, fn_symtab,
+                    s2c(al, dummy_name), nullptr, 0, ASR::intentType::In,
+                    nullptr, nullptr, ASR::storage_typeType::Default,
+                    ASRUtils::duplicate_type(al, ASRUtils::symbol_type(sym)),
+                    nullptr, ASR::abiType::Source, ASR::accessType::Public,
+                    ASR::presenceType::Required, false));
+            fn_symtab->add_symbol(dummy_name, dummy);
+            symbol_map[sym] = dummy;
+            fn_args.push_back(al, ASRUtils::EXPR(ASR::make_Var_t(al, loc, dummy)));
+        }
+
+        ASRUtils::ExprStmtDuplicator duplicator(al);
+        Vec<ASR::stmt_t*> fn_body; fn_body.reserve(al, n);
+        for( size_t i = 0; i < n; i++ ) {
+            duplicator.success = true;
+            ASR::stmt_t* stmt_copy = duplicator.duplicate_stmt(stmts[i]);
+            if( !duplicator.success ) {
+                return ;
+            }
+            fn_body.push_back(al, stmt_copy);
+        }
+        ColdRegionSymbolReplacerVisitor symbol_replacer(symbol_map);
+        for( size_t i = 0; i < fn_body.size(); i++ ) {
+            symbol_replacer.visit_stmt(*fn_body[i]);
+        }
+
+        std::string fn_name = current_scope->get_unique_name("_lcompilers_cold_block");
+        ASR::symbol_t* fn_sym = ASR::down_cast<ASR::symbol_t>(
+            ASRUtils::make_Function_t_util(al, loc, fn_symtab, s2c(al, fn_name),
+                nullptr, 0, fn_args.p, fn_args.size(), fn_body.p, fn_body.size(),
+                nullptr, ASR::abiType::Source, ASR::accessType::Public,
+                ASR::deftypeType::Implementation, nullptr, false, false,
+                false, false, false, nullptr, 0, false, false, false));
+        current_scope->add_symbol(fn_name, fn_sym);
+
+        Vec<ASR::call_arg_t> call_args; call_args.reserve(al, collector.symbols.size());
+        for( ASR::symbol_t* sym: collector.symbols ) {
+            ASR::call_arg_t call_arg;
+            call_arg.loc = loc;
+            call_arg.m_value = ASRUtils::EXPR(ASR::make_Var_t(al, loc, sym));
+            call_args.push_back(al, call_arg);
+        }
+        Vec<ASR::stmt_t*> new_region; new_region.reserve(al, 1);
+        new_region.push_back(al, ASRUtils::STMT(ASRUtils::make_SubroutineCall_t_util(
+            al, loc, fn_sym, fn_sym, call_args.p, call_args.size(),
+            nullptr, nullptr, false)));
+        stmts = new_region.p;
+        n = new_region.size();
+    }
+
+    void visit_If(const ASR::If_t& x) {
+        ASR::ASRPassBaseWalkVisitor<ColdBlockOutliner>::visit_If(x);
+        ASR::If_t& xx = const_cast<ASR::If_t&>(x);
+        try_outline_region(xx.m_body, xx.n_body);
+        try_outline_region(xx.m_orelse, xx.n_orelse);
+    }
+};
+
+void pass_outline_cold_blocks(Allocator &al, ASR::TranslationUnit_t &unit,
+                              const LCompilers::PassOptions& /*pass_options*/) {
+    ColdBlockOutliner v(al);
+    v.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
@@ -741,7 +741,10 @@ class EditProcedureCallsVisitor : public ASR::ASRPassBaseWalkVisitor<EditProcedu
             for( int i = 0; i < n_dims; i++ ) {
                 ASR::expr_t* length = compile_time_dims[i].m_length;
                 if( length == nullptr ) {
-                    if (ASRUtils::is_allocatable(array_type)) {
+                    if (ASRUtils::is_allocatable(array_type) ||
+                        ASR::is_a<ASR::Pointer_t>(*array_type)) {
+                        // Allocatables and pointers may have a remapped lower
+                        // bound, so the upper bound alone is not the extent.
                         length = ASRUtils::get_size(array, i + 1, al_);
                     } else {
                         length = PassUtils::get_bound(array, i + 1, "ubound", al_, index_kind);
@@ -951,13 +954,44 @@ class EditProcedureCallsVisitor : public ASR::ASRPassBaseWalkVisitor<EditProcedu
             return new_args;
         }
 
-        bool can_edit_call(ASR::call_arg_t* args, size_t n_args) {
+        // Whether an actual argument is known to occupy contiguous storage.
+        // Every actual except a POINTER does in this compiler: fixed-size and
+        // allocatable arrays are contiguous by construction, and array
+        // sections are materialised into contiguous temporaries before this
+        // pass runs. A pointer may designate a strided slice, so it is only
+        // contiguous when declared with the CONTIGUOUS attribute.
+        static bool is_contiguous_actual(ASR::expr_t* expr) {
+            ASR::ttype_t* type = ASRUtils::expr_type(expr);
+            if( !ASR::is_a<ASR::Pointer_t>(*type) ) {
+                return true;
+            }
+            if( ASR::is_a<ASR::Var_t>(*expr) ) {
+                ASR::symbol_t* sym = ASRUtils::symbol_get_past_external(
+                    ASR::down_cast<ASR::Var_t>(expr)->m_v);
+                if( ASR::is_a<ASR::Variable_t>(*sym) &&
+                    ASR::down_cast<ASR::Variable_t>(sym)->m_contiguous_attr ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool can_edit_call(ASR::call_arg_t* args, size_t n_args,
+                           const std::vector<size_t>& indices) {
             for ( size_t i = 0; i < n_args; i++ ) {
                 if( args[i].m_value &&
                     ASRUtils::expr_type(args[i].m_value) &&
                     ASR::is_a<ASR::Pointer_t>(*
                         ASRUtils::expr_type(args[i].m_value)) ) {
-                    return false;
+                    // A pointer actual bound to a dummy that the clone
+                    // receives as a raw data pointer is fine as long as it is
+                    // provably contiguous; otherwise only the descriptor
+                    // version of the callee can index it correctly, so this
+                    // call site keeps the generic version.
+                    if( std::find(indices.begin(), indices.end(), i) == indices.end() ||
+                        !is_contiguous_actual(args[i].m_value) ) {
+                        return false;
+                    }
                 }
             }
             return true;
@@ -1062,7 +1096,12 @@ class EditProcedureCallsVisitor : public ASR::ASRPassBaseWalkVisitor<EditProcedu
                 }
             }
 
-            if( !can_edit_call(x.m_args, x.n_args) && !ASRUtils::get_FunctionType(subrout_sym)->m_module
+            static const std::vector<size_t> no_indices;
+            const std::vector<size_t>& converted_indices =
+                v.proc2newproc.find(subrout_sym) != v.proc2newproc.end() ?
+                v.proc2newproc[subrout_sym].second : no_indices;
+            if( !can_edit_call(x.m_args, x.n_args, converted_indices)
+                    && !ASRUtils::get_FunctionType(subrout_sym)->m_module
                     && !is_struct_method_declaration(x.m_name) ) {
                 not_to_be_erased.insert(subrout_sym);
                 return ;
@@ -6,6 +6,7 @@
 #include <libasr/asr.h>
 #include <libasr/string_utils.h>
 #include <libasr/alloc.h>
+#include <libasr/profiler.h>
 
 // TODO: Remove lpython/lfortran includes, make it compiler agnostic
 #if __has_include(<lfortran/utils.h>)
@@ -34,15 +35,30 @@
 #include <libasr/pass/replace_intrinsic_function.h>
 #include <libasr/pass/replace_intrinsic_subroutine.h>
 #include <libasr/pass/replace_fma.h>
+#include <libasr/pass/replace_fused_expr_opt.h>
 #include <libasr/pass/loop_unroll.h>
 #include <libasr/pass/replace_sign_from_value.h>
 #include <libasr/pass/replace_class_constructor.h>
 #include <libasr/pass/unused_functions.h>
+#include <libasr/pass/unused_arguments.h>
 #include <libasr/pass/inline_function_calls.h>
+#include <libasr/pass/compact_asr.h>
+#include <libasr/pass/share_expressions.h>
+#include <libasr/pass/dedup_functions.h>
+#include <libasr/pass/devirtualize.h>
+#include <libasr/pass/module_var_to_const.h>
+#include <libasr/pass/outline_cold_blocks.h>
+#include <libasr/pass/pass_stats.h>
 #include <libasr/pass/dead_code_removal.h>
 #include <libasr/pass/replace_for_all.h>
 #include <libasr/pass/replace_init_expr.h>
 #include <libasr/pass/replace_select_case.h>
+#include <libasr/pass/aos_to_soa.h>
+#include <libasr/pass/array_loop_fusion.h>
+#include <libasr/pass/loop_invariant_code_motion.h>
+#include <libasr/pass/loop_tiling.h>
+#include <libasr/pass/value_range_opt.h>
+#include <libasr/pass/specialize_constant_args.h>
 #include <libasr/pass/loop_vectorise.h>
 #include <libasr/pass/update_array_dim_intrinsic_calls.h>
 #include <libasr/pass/array_by_data.h>
@@ -58,6 +74,7 @@
 #include <libasr/pass/replace_function_call_in_declaration.h>
 #include <libasr/pass/replace_array_passed_in_function_call.h>
 #include <libasr/pass/replace_openmp.h>
+#include <libasr/pass/coarray.h>
 #include <libasr/pass/replace_gpu_offload.h>
 #include <libasr/pass/replace_with_compile_time_values.h>
 #include <libasr/codegen/asr_to_fortran.h>
@@ -98,12 +115,26 @@ namespace LCompilers {
             {"unused_functions", &pass_unused_functions},
             {"div_to_mul", &pass_replace_div_to_mul},
             {"fma", &pass_replace_fma},
+            {"fused_expr_opt", &pass_replace_fused_expr_opt},
             {"sign_from_value", &pass_replace_sign_from_value},
             {"inline_function_calls", &pass_inline_function_calls},
             {"loop_unroll", &pass_loop_unroll},
             {"dead_code_removal", &pass_dead_code_removal},
+            {"unused_arguments", &pass_unused_arguments},
+            {"compact_asr", &pass_compact_asr},
+            {"share_expressions", &pass_share_expressions},
+            {"dedup_functions", &pass_dedup_functions},
+            {"devirtualize", &pass_devirtualize},
+            {"module_var_to_const", &pass_module_var_to_const},
+            {"outline_cold_blocks", &pass_outline_cold_blocks},
             {"forall", &pass_replace_for_all},
             {"select_case", &pass_replace_select_case},
+            {"aos_to_soa", &pass_aos_to_soa},
+            {"array_loop_fusion", &pass_array_loop_fusion},
+            {"loop_invariant_code_motion", &pass_loop_invariant_code_motion},
+            {"loop_tiling", &pass_loop_tiling},
+            {"value_range_opt", &pass_value_range_opt},
+            {"specialize_constant_args", &pass_specialize_constant_args},
             {"loop_vectorise", &pass_loop_vectorise},
             {"array_dim_intrinsics_update", &pass_update_array_dim_intrinsic_calls},
             {"pass_list_expr", &pass_list_expr},
@@ -116,6 +147,7 @@ namespace LCompilers {
             {"function_call_in_declaration", &pass_replace_function_call_in_declaration},
             {"array_passed_in_function_call", &pass_replace_array_passed_in_function_call},
             {"openmp", &pass_replace_openmp},
+            {"coarray", &pass_lower_coarray},
             {"gpu_offload", &pass_replace_gpu_offload},
             {"print_struct_type", &pass_replace_print_struct_type},
             {"unique_symbols", &pass_unique_symbols},
@@ -171,6 +203,13 @@ namespace LCompilers {
                         passes.push_back(_with_optimization_passes[i]);
                 }
             }
+            // One cheap read-only walk decides which rewrite passes are
+            // guaranteed no-ops for this unit (their trigger constructs are
+            // absent and no pass creates them)
+            PassTriggerStats trigger_stats = collect_pass_trigger_stats(*asr);
+            if (pass_options.dump_pass_stats) {
+                dump_pass_stats(std::cerr, trigger_stats);
+            }
             for (size_t i = 0; i < passes.size(); i++) {
                 // TODO: rework the whole pass manager: construct the passes
                 // ahead of time (not at the last minute), and remove this much
@@ -184,13 +223,41 @@ namespace LCompilers {
                 if (c_skip_pass && std::find(_c_skip_passes.begin(),
                         _c_skip_passes.end(), passes[i]) != _c_skip_passes.end())
                     continue;
+                if (pass_has_no_triggers(passes[i], trigger_stats)) {
+                    if (pass_options.verbose) {
+                        std::cerr << "ASR Pass skipped (no trigger constructs): '"
+                            << passes[i] << "'\n";
+                    }
+                    continue;
+                }
                 if (pass_options.verbose) {
                     std::cerr << "ASR Pass starts: '" << passes[i] << "'\n";
                 }
                 auto t1 = std::chrono::high_resolution_clock::now();
-                _passes_db[passes[i]](al, *asr, pass_options);
+                {
+                    ProfileScope profile_scope(pass_options,
+                        "pass " + passes[i], &al);
+                    _passes_db[passes[i]](al, *asr, pass_options);
+                }
 #if defined(WITH_LFORTRAN_ASSERT)
-                if (!asr_verify(*asr, true, diagnostics)) {
+                bool verify_ok = true;
+                if (pass_options.incremental_verify) {
+                    // Modules loaded from modfiles were verified when
+                    // they were produced; re-verify only this
+                    // compilation's own units after each pass
+                    for (auto &item : asr->m_symtab->get_scope()) {
+                        if (ASR::is_a<ASR::Module_t>(*item.second) &&
+                                ASR::down_cast<ASR::Module_t>(
+                                    item.second)->m_loaded_from_mod) {
+                            continue;
+                        }
+                        verify_ok = verify_ok &&
+                            asr_verify(*item.second, true, diagnostics);
+                    }
+                } else {
+                    verify_ok = asr_verify(*asr, true, diagnostics);
+                }
+                if (!verify_ok) {
                     std::cerr << diagnostics.render2();
                     throw LCompilersException("Verify failed in the pass: "
                         + passes[i]);
@@ -246,7 +313,9 @@ namespace LCompilers {
                 "global_stmts",
                 "init_expr",
                 "function_call_in_declaration",
+                "aos_to_soa",
                 "openmp",
+                "coarray",
                 "implied_do_loops",
                 "gpu_offload",
                 "array_struct_temporary",
@@ -263,6 +332,7 @@ namespace LCompilers {
                 "intrinsic_subroutine",
                 "subroutine_from_function",
                 "array_op",
+                "specialize_constant_args",
                 "pass_array_by_data",
                 "array_passed_in_function_call",
                 "print_struct_type",
@@ -270,6 +340,8 @@ namespace LCompilers {
                 "print_list_tuple",
                 "print_struct_type",
                 "array_dim_intrinsics_update",
+                "value_range_opt",
+                "loop_tiling",
                 "do_loops",
                 "while_else",
                 "unused_functions",
@@ -277,14 +349,18 @@ namespace LCompilers {
                 "insert_deallocate",
             };
             _optimization_passes = {
+                "module_var_to_const",
                 "replace_with_compile_time_values",
+                "array_loop_fusion",
+                "loop_invariant_code_motion",
                 "loop_vectorise",
                 "dead_code_removal",
+                "unused_arguments",
                 "unused_functions",
-                "sign_from_value",
-                "div_to_mul",
-                "fma",
+                "fused_expr_opt",
+                "devirtualize",
                 "inline_function_calls",
+                "outline_cold_blocks",
                 "promote_allocatable_to_nonallocatable"
             };
 
@@ -0,0 +1,109 @@
+#include <ostream>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/pass_stats.h>
+
+namespace LCompilers {
+
+class PassTriggerStatsVisitor :
+    public ASR::BaseWalkVisitor<PassTriggerStatsVisitor> {
+
+    public:
+
+    PassTriggerStats stats;
+
+    void visit_ImpliedDoLoop(const ASR::ImpliedDoLoop_t &x) {
+        stats.implied_do_loops++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_ImpliedDoLoop(x);
+    }
+
+    void visit_ArrayConstant(const ASR::ArrayConstant_t &x) {
+        stats.array_literals++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_ArrayConstant(x);
+    }
+
+    void visit_ArrayConstructor(const ASR::ArrayConstructor_t &x) {
+        stats.array_literals++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_ArrayConstructor(x);
+    }
+
+    void visit_Select(const ASR::Select_t &x) {
+        stats.select_constructs++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_Select(x);
+    }
+
+    void visit_Where(const ASR::Where_t &x) {
+        stats.where_constructs++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_Where(x);
+    }
+
+    void visit_ForAllSingle(const ASR::ForAllSingle_t &x) {
+        stats.forall_constructs++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_ForAllSingle(x);
+    }
+
+    void visit_WhileLoop(const ASR::WhileLoop_t &x) {
+        if (x.n_orelse > 0) stats.loops_with_else++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_WhileLoop(x);
+    }
+
+    void visit_DoLoop(const ASR::DoLoop_t &x) {
+        if (x.n_orelse > 0) stats.loops_with_else++;
+        ASR::BaseWalkVisitor<PassTriggerStatsVisitor>::visit_DoLoop(x);
+    }
+};
+
+PassTriggerStats collect_pass_trigger_stats(ASR::TranslationUnit_t &unit) {
+    PassTriggerStatsVisitor v;
+    v.visit_TranslationUnit(unit);
+    return v.stats;
+}
+
+bool pass_has_no_triggers(const std::string &pass_name,
+        const PassTriggerStats &stats) {
+    // Only passes whose trigger nodes are created exclusively by the
+    // frontend may appear here: a zero count then stays zero for the whole
+    // pipeline, so skipping the pass cannot change the output
+    if (pass_name == "implied_do_loops") {
+        // besides implied do loops, this pass also materializes array
+        // literals (constants and constructors) into temporaries, which
+        // later passes rely on
+        return stats.implied_do_loops == 0 && stats.array_literals == 0;
+    } else if (pass_name == "select_case") {
+        return stats.select_constructs == 0;
+    } else if (pass_name == "where") {
+        return stats.where_constructs == 0;
+    } else if (pass_name == "forall") {
+        return stats.forall_constructs == 0;
+    } else if (pass_name == "while_else") {
+        return stats.loops_with_else == 0;
+    }
+    return false;
+}
+
+void dump_pass_stats(std::ostream &os, const PassTriggerStats &stats) {
+    os << "Pass trigger statistics:" << std::endl;
+    os << "    implied do loops     : " << stats.implied_do_loops << std::endl;
+    os << "    array literals       : " << stats.array_literals << std::endl;
+    os << "    select constructs    : " << stats.select_constructs << std::endl;
+    os << "    where constructs     : " << stats.where_constructs << std::endl;
+    os << "    forall constructs    : " << stats.forall_constructs << std::endl;
+    os << "    loops with else block: " << stats.loops_with_else << std::endl;
+    const char *skippable[] = {"implied_do_loops", "select_case", "where",
+        "forall", "while_else"};
+    os << "Passes skipped as no-ops:";
+    bool any = false;
+    for (const char *pass_name : skippable) {
+        if (pass_has_no_triggers(pass_name, stats)) {
+            os << " " << pass_name;
+            any = true;
+        }
+    }
+    if (!any) {
+        os << " (none)";
+    }
+    os << std::endl;
+}
+
+} // namespace LCompilers
@@ -0,0 +1,35 @@
+#ifndef LIBASR_PASS_STATS_H
+#define LIBASR_PASS_STATS_H
+
+#include <iosfwd>
+#include <string>
+
+#include <libasr/asr.h>
+
+namespace LCompilers {
+
+    // Counts of the constructs that trigger individual rewrite passes,
+    // collected in one cheap read-only walk before the pipeline runs. A pass
+    // whose trigger count is zero is a guaranteed no-op and can be skipped;
+    // only constructs that no other pass synthesizes are used as triggers.
+    struct PassTriggerStats {
+        size_t implied_do_loops = 0;
+        size_t array_literals = 0;
+        size_t select_constructs = 0;
+        size_t where_constructs = 0;
+        size_t forall_constructs = 0;
+        size_t loops_with_else = 0;
+    };
+
+    PassTriggerStats collect_pass_trigger_stats(ASR::TranslationUnit_t &unit);
+
+    // True when `pass_name` is known to be a no-op because its trigger
+    // constructs are absent from `stats`
+    bool pass_has_no_triggers(const std::string &pass_name,
+        const PassTriggerStats &stats);
+
+    void dump_pass_stats(std::ostream &os, const PassTriggerStats &stats);
+
+} // namespace LCompilers
+
+#endif // LIBASR_PASS_STATS_H
@@ -346,11 +346,12 @@ namespace LCompilers {
             ASR::expr_t* idx_var = nullptr;
             std::string str_name = "__libasr__created__var__" + std::to_string(counter) + "_" + suffix;
 
-            if( current_scope->get_symbol(str_name) == nullptr ||
+            ASR::symbol_t* existing_sym = current_scope->get_symbol(str_name);
+            if( existing_sym == nullptr ||
                 !ASRUtils::check_equal_type(
-                    ASRUtils::symbol_type(current_scope->get_symbol(str_name)),
+                    ASRUtils::symbol_type(existing_sym),
                     var_type, ASRUtils::get_expr_from_sym(
-                        al, current_scope->get_symbol(str_name)), var, true
+                        al, existing_sym), var, true
                 ) ) {
                 ASR::symbol_t* type_decl = nullptr;
                 if ( var != nullptr ) {
@@ -364,8 +365,7 @@ namespace LCompilers {
                 current_scope->add_symbol(str_name, ASR::down_cast<ASR::symbol_t>(idx_sym));
                 idx_var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(idx_sym)));
             } else {
-                ASR::symbol_t* idx_sym = current_scope->get_symbol(str_name);
-                idx_var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, idx_sym));
+                idx_var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, existing_sym));
             }
 
             return idx_var;
@@ -395,29 +395,29 @@ namespace LCompilers {
                 std::string idx_var_name = "__" + std::to_string(i) + suffix;
                 idx_var_name = current_scope->get_unique_name(idx_var_name, false);
                 ASR::ttype_t* int32_type = ASRUtils::TYPE(ASR::make_Integer_t(al, loc, index_kind));
-                if( current_scope->get_symbol(idx_var_name) != nullptr ) {
-                    ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
+                ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
+                if( idx_sym != nullptr ) {
+                    bool reusable = false;
                     if( ASR::is_a<ASR::Variable_t>(*idx_sym) ) {
                         ASR::Variable_t* idx_var = ASR::down_cast<ASR::Variable_t>(idx_sym);
-                        if( !(ASRUtils::check_equal_type(idx_var->m_type, int32_type, nullptr, nullptr) &&
-                              idx_var->m_symbolic_value == nullptr) ) {
-                            idx_var_name = current_scope->get_unique_name(idx_var_name, false);
-                        }
-                    } else {
+                        reusable = ASRUtils::check_equal_type(idx_var->m_type, int32_type, nullptr, nullptr) &&
+                              idx_var->m_symbolic_value == nullptr;
+                    }
+                    if( !reusable ) {
                         idx_var_name = current_scope->get_unique_name(idx_var_name, false);
+                        idx_sym = current_scope->get_symbol(idx_var_name);
                     }
                 }
                 char* var_name = s2c(al, idx_var_name);;
                 ASR::expr_t* var = nullptr;
-                if( current_scope->get_symbol(idx_var_name) == nullptr ) {
-                    ASR::asr_t* idx_sym = ASRUtils::make_Variable_t_util(al, loc, current_scope, var_name, nullptr, 0,
+                if( idx_sym == nullptr ) {
+                    ASR::asr_t* new_sym = ASRUtils::make_Variable_t_util(al, loc, current_scope, var_name, nullptr, 0,
                                                             intent, nullptr, nullptr, ASR::storage_typeType::Default,
                                                             int32_type, nullptr, ASR::abiType::Source, ASR::accessType::Public,
                                                             presence, false);
-                    current_scope->add_symbol(idx_var_name, ASR::down_cast<ASR::symbol_t>(idx_sym));
-                    var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(idx_sym)));
+                    current_scope->add_symbol(idx_var_name, ASR::down_cast<ASR::symbol_t>(new_sym));
+                    var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(new_sym)));
                 } else {
-                    ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
                     var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, idx_sym));
                 }
                 vars.push_back(al, var);
@@ -442,29 +442,29 @@ namespace LCompilers {
                 }
                 std::string idx_var_name = "__" + std::to_string(i) + suffix;
                 ASR::ttype_t* int32_type = ASRUtils::TYPE(ASR::make_Integer_t(al, loc, index_kind));
-                if( current_scope->get_symbol(idx_var_name) != nullptr ) {
-                    ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
+                ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
+                if( idx_sym != nullptr ) {
+                    bool reusable = false;
                     if( ASR::is_a<ASR::Variable_t>(*idx_sym) ) {
                         ASR::Variable_t* idx_var = ASR::down_cast<ASR::Variable_t>(idx_sym);
-                        if( !(ASRUtils::check_equal_type(idx_var->m_type, int32_type, nullptr, nullptr) &&
-                              idx_var->m_symbolic_value == nullptr) ) {
-                            idx_var_name = current_scope->get_unique_name(idx_var_name, false);
-                        }
-                    } else {
+                        reusable = ASRUtils::check_equal_type(idx_var->m_type, int32_type, nullptr, nullptr) &&
+                              idx_var->m_symbolic_value == nullptr;
+                    }
+                    if( !reusable ) {
                         idx_var_name = current_scope->get_unique_name(idx_var_name, false);
+                        idx_sym = current_scope->get_symbol(idx_var_name);
                     }
                 }
                 char* var_name = s2c(al, idx_var_name);;
                 ASR::expr_t* var = nullptr;
-                if( current_scope->get_symbol(idx_var_name) == nullptr ) {
-                    ASR::asr_t* idx_sym = ASRUtils::make_Variable_t_util(al, loc, current_scope, var_name, nullptr, 0,
+                if( idx_sym == nullptr ) {
+                    ASR::asr_t* new_sym = ASRUtils::make_Variable_t_util(al, loc, current_scope, var_name, nullptr, 0,
                                             ASR::intentType::Local, nullptr, nullptr, ASR::storage_typeType::Default,
                                             int32_type, nullptr, ASR::abiType::Source, ASR::accessType::Public,
                                             ASR::presenceType::Required, false);
-                    current_scope->add_symbol(idx_var_name, ASR::down_cast<ASR::symbol_t>(idx_sym));
-                    var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(idx_sym)));
+                    current_scope->add_symbol(idx_var_name, ASR::down_cast<ASR::symbol_t>(new_sym));
+                    var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(new_sym)));
                 } else {
-                    ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
                     var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, idx_sym));
                 }
                 value_indices.push_back(i - 1);
@@ -486,29 +486,29 @@ namespace LCompilers {
                 }
                 std::string idx_var_name = "__" + std::to_string(i + 1) + suffix;
                 ASR::ttype_t* int32_type = ASRUtils::TYPE(ASR::make_Integer_t(al, loc, index_kind));
-                if( current_scope->get_symbol(idx_var_name) != nullptr ) {
-                    ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
+                ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
+                if( idx_sym != nullptr ) {
+                    bool reusable = false;
                     if( ASR::is_a<ASR::Variable_t>(*idx_sym) ) {
                         ASR::Variable_t* idx_var = ASR::down_cast<ASR::Variable_t>(idx_sym);
-                        if( !(ASRUtils::check_equal_type(idx_var->m_type, int32_type, nullptr, nullptr) &&
-                              idx_var->m_symbolic_value == nullptr) ) {
-                            idx_var_name = current_scope->get_unique_name(idx_var_name, false);
-                        }
-                    } else {
+                        reusable = ASRUtils::check_equal_type(idx_var->m_type, int32_type, nullptr, nullptr) &&
+                              idx_var->m_symbolic_value == nullptr;
+                    }
+                    if( !reusable ) {
                         idx_var_name = current_scope->get_unique_name(idx_var_name, false);
+                        idx_sym = current_scope->get_symbol(idx_var_name);
                     }
                 }
                 char* var_name = s2c(al, idx_var_name);;
                 ASR::expr_t* var = nullptr;
-                if( current_scope->get_symbol(idx_var_name) == nullptr ) {
-                    ASR::asr_t* idx_sym = ASRUtils::make_Variable_t_util(al, loc, current_scope, var_name, nullptr, 0,
+                if( idx_sym == nullptr ) {
+                    ASR::asr_t* new_sym = ASRUtils::make_Variable_t_util(al, loc, current_scope, var_name, nullptr, 0,
                                             ASR::intentType::Local, nullptr, nullptr, ASR::storage_typeType::Default,
                                             int32_type, nullptr, ASR::abiType::Source, ASR::accessType::Public,
                                             ASR::presenceType::Required, false);
-                    current_scope->add_symbol(idx_var_name, ASR::down_cast<ASR::symbol_t>(idx_sym));
-                    var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(idx_sym)));
+                    current_scope->add_symbol(idx_var_name, ASR::down_cast<ASR::symbol_t>(new_sym));
+                    var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, ASR::down_cast<ASR::symbol_t>(new_sym)));
                 } else {
-                    ASR::symbol_t* idx_sym = current_scope->get_symbol(idx_var_name);
                     var = ASRUtils::EXPR(ASR::make_Var_t(al, loc, idx_sym));
                 }
                 idx_vars.push_back(al, var);
@@ -614,10 +614,11 @@ namespace LCompilers {
                 for (size_t i = 0; i < do_loop_variables.size(); i++) {
                     vars.push_back(do_loop_variables[i]);
                 }
+                // Accumulate the zero-extended mask instead of a conditional
+                // increment; the branchless sum is vectorizable.
                 return b.DoLoop(do_loop_variables[curr_idx - 1], b.GetLBound(mask, curr_idx), b.GetUBound(mask, curr_idx), {
-                    b.If(b.ArrayItem_01(mask, vars), {
-                        b.Assignment(res, b.Add(res, b.i_t(1, ASRUtils::expr_type(res))))
-                    }, {}),
+                    b.Assignment(res, b.Add(res,
+                        b.l2i_t(b.ArrayItem_01(mask, vars), ASRUtils::expr_type(res))))
                 }, nullptr);
             }
             return b.DoLoop(do_loop_variables[curr_idx - 1], b.GetLBound(mask, curr_idx), b.GetUBound(mask, curr_idx), {
@@ -1359,6 +1360,74 @@ namespace LCompilers {
             body = new_body;
         }
 
+        std::vector<ASR::symbol_t*> collect_independent_program_units(
+                ASR::TranslationUnit_t &unit) {
+            std::vector<ASR::symbol_t*> units;
+            for (auto &item : unit.m_symtab->get_scope()) {
+                if (ASR::is_a<ASR::Module_t>(*item.second)) {
+                    // Shard big modules at member granularity; nested
+                    // functions are reached through their parent unit
+                    ASR::Module_t *m = ASR::down_cast<ASR::Module_t>(item.second);
+                    for (auto &member : m->m_symtab->get_scope()) {
+                        units.push_back(member.second);
+                    }
+                } else {
+                    units.push_back(item.second);
+                }
+            }
+            return units;
+        }
+
+        bool can_memcpy_array_constant(ASR::expr_t* target,
+                ASR::ArrayConstant_t* value) {
+            if( !ASR::is_a<ASR::Var_t>(*target) ) {
+                return false;
+            }
+            ASR::ttype_t* target_type = ASRUtils::expr_type(target);
+            if( ASRUtils::is_allocatable(target_type) ||
+                ASRUtils::is_pointer(target_type) ||
+                ASRUtils::is_simd_array(target) ) {
+                return false;
+            }
+            // both sides must agree on the flat element count; 0-sized
+            // constants keep the existing statement-removal behaviour
+            int64_t value_size = ASRUtils::get_fixed_size_of_array(value->m_type);
+            if( value_size <= 0 ||
+                !ASRUtils::is_fixed_size_array(target_type) ||
+                ASRUtils::get_fixed_size_of_array(target_type) != value_size ) {
+                return false;
+            }
+            for( ASR::ttype_t* type: {target_type, value->m_type} ) {
+                if( ASRUtils::extract_physical_type(type) !=
+                    ASR::array_physical_typeType::FixedSizeArray ) {
+                    return false;
+                }
+            }
+            ASR::ttype_t* target_el_type = ASRUtils::extract_type(target_type);
+            ASR::ttype_t* value_el_type = ASRUtils::extract_type(value->m_type);
+            if( target_el_type->type != value_el_type->type ||
+                ASRUtils::extract_kind_from_ttype_t(target_el_type) !=
+                ASRUtils::extract_kind_from_ttype_t(value_el_type) ||
+                !ASRUtils::check_equal_type(target_type, value->m_type,
+                    target, &(value->base)) ) {
+                return false;
+            }
+            // strings need per-element padding/truncation, so only the
+            // flat numeric and logical element types are safe to memcpy
+            switch( target_el_type->type ) {
+                case ASR::ttypeType::Integer:
+                case ASR::ttypeType::Logical:
+                    return true;
+                case ASR::ttypeType::Real:
+                case ASR::ttypeType::Complex:
+                    // the backend emits constant globals only for these kinds
+                    return ASRUtils::extract_kind_from_ttype_t(target_el_type) == 4 ||
+                           ASRUtils::extract_kind_from_ttype_t(target_el_type) == 8;
+                default:
+                    return false;
+            }
+        }
+
         Vec<ASR::stmt_t*> replace_doloop(Allocator &al, const ASR::DoLoop_t &loop,
                                          int comp, bool use_loop_variable_after_loop,
                                          SymbolTable* current_scope) {
@@ -1552,6 +1621,161 @@ namespace LCompilers {
             return result;
         }
 
+        class PointerAssociationCollector:
+            public ASR::BaseWalkVisitor<PointerAssociationCollector> {
+
+            private:
+
+            SymbolTable* symtab;
+            std::map<ASR::symbol_t*, std::set<ASR::symbol_t*>>& targets;
+            std::set<ASR::symbol_t*>& unknown;
+
+            // Only local array pointers of the summarised procedure are
+            // tracked. Dummies and use/host-associated pointers may
+            // arrive already associated (possibly with a section), so
+            // they stay untracked and the queries treat them
+            // conservatively.
+            bool is_tracked_pointer(ASR::symbol_t* sym) {
+                if( sym == nullptr || !ASR::is_a<ASR::Variable_t>(*sym) ) {
+                    return false;
+                }
+                ASR::Variable_t* var = ASR::down_cast<ASR::Variable_t>(sym);
+                return var->m_parent_symtab == symtab &&
+                       var->m_intent == ASR::intentType::Local &&
+                       ASRUtils::is_pointer(var->m_type) &&
+                       ASRUtils::is_array(var->m_type);
+            }
+
+            void demote_if_tracked(ASR::expr_t* e) {
+                if( e != nullptr && ASR::is_a<ASR::Var_t>(*e) ) {
+                    ASR::symbol_t* sym = ASR::down_cast<ASR::Var_t>(e)->m_v;
+                    if( is_tracked_pointer(sym) ) {
+                        unknown.insert(sym);
+                    }
+                }
+            }
+
+            public:
+
+            PointerAssociationCollector(SymbolTable* symtab_,
+                std::map<ASR::symbol_t*, std::set<ASR::symbol_t*>>& targets_,
+                std::set<ASR::symbol_t*>& unknown_):
+                symtab(symtab_), targets(targets_), unknown(unknown_) {}
+
+            void collect_from(SymbolTable* scope, ASR::stmt_t** body, size_t n_body) {
+                for( size_t i = 0; i < n_body; i++ ) {
+                    visit_stmt(*body[i]);
+                }
+                // Block and AssociateBlock bodies hang off the symbol
+                // table rather than the statement list; pointers of the
+                // procedure may be (re)associated inside them.
+                for( auto& item: scope->get_scope() ) {
+                    if( ASR::is_a<ASR::Block_t>(*item.second) ) {
+                        ASR::Block_t* block = ASR::down_cast<ASR::Block_t>(item.second);
+                        collect_from(block->m_symtab, block->m_body, block->n_body);
+                    } else if( ASR::is_a<ASR::AssociateBlock_t>(*item.second) ) {
+                        ASR::AssociateBlock_t* block =
+                            ASR::down_cast<ASR::AssociateBlock_t>(item.second);
+                        collect_from(block->m_symtab, block->m_body, block->n_body);
+                    }
+                }
+            }
+
+            void visit_Associate(const ASR::Associate_t& x) {
+                if( !ASR::is_a<ASR::Var_t>(*x.m_target) ) {
+                    return ;
+                }
+                ASR::symbol_t* ptr = ASR::down_cast<ASR::Var_t>(x.m_target)->m_v;
+                if( !is_tracked_pointer(ptr) ) {
+                    return ;
+                }
+                if( ASR::is_a<ASR::Var_t>(*x.m_value) ) {
+                    ASR::symbol_t* tgt = ASR::down_cast<ASR::Var_t>(x.m_value)->m_v;
+                    ASR::ttype_t* tgt_type = ASRUtils::symbol_type(tgt);
+                    if( ASRUtils::is_array(tgt_type) &&
+                        !ASRUtils::is_pointer(tgt_type) ) {
+                        targets[ptr].insert(tgt);
+                        return ;
+                    }
+                }
+                // sections, components, pointer-valued right hand
+                // sides, ... are not modelled
+                unknown.insert(ptr);
+            }
+
+            // A pointer passed to a call may be re-associated inside the
+            // callee (pointer dummy with intent(inout)); assume the worst.
+            void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+                for( size_t i = 0; i < x.n_args; i++ ) {
+                    demote_if_tracked(x.m_args[i].m_value);
+                }
+                ASR::BaseWalkVisitor<PointerAssociationCollector>::visit_SubroutineCall(x);
+            }
+
+            void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+                for( size_t i = 0; i < x.n_args; i++ ) {
+                    demote_if_tracked(x.m_args[i].m_value);
+                }
+                ASR::BaseWalkVisitor<PointerAssociationCollector>::visit_FunctionCall(x);
+            }
+
+            void visit_CPtrToPointer(const ASR::CPtrToPointer_t& x) {
+                demote_if_tracked(x.m_ptr);
+            }
+
+            void visit_Allocate(const ASR::Allocate_t& x) {
+                for( size_t i = 0; i < x.n_args; i++ ) {
+                    demote_if_tracked(x.m_args[i].m_a);
+                }
+            }
+        };
+
+        void PointerAssociationSummary::build(SymbolTable* symtab,
+            ASR::stmt_t** body, size_t n_body) {
+            clear();
+            PointerAssociationCollector collector(symtab, targets, unknown);
+            collector.collect_from(symtab, body, n_body);
+        }
+
+        void PointerAssociationSummary::clear() {
+            targets.clear();
+            unknown.clear();
+        }
+
+        bool PointerAssociationSummary::points_only_to_whole_arrays(
+            ASR::symbol_t* sym) const {
+            return targets.count(sym) > 0 && unknown.count(sym) == 0;
+        }
+
+        bool PointerAssociationSummary::may_alias(ASR::symbol_t* a,
+            ASR::symbol_t* b) const {
+            if( a == b ) {
+                return true;
+            }
+            bool a_is_pointer = ASRUtils::is_pointer(ASRUtils::symbol_type(a));
+            bool b_is_pointer = ASRUtils::is_pointer(ASRUtils::symbol_type(b));
+            if( !a_is_pointer && !b_is_pointer ) {
+                // distinct non-pointer variables occupy distinct storage
+                return false;
+            }
+            if( (a_is_pointer && !points_only_to_whole_arrays(a)) ||
+                (b_is_pointer && !points_only_to_whole_arrays(b)) ) {
+                return true;
+            }
+            if( a_is_pointer && b_is_pointer ) {
+                const std::set<ASR::symbol_t*>& b_targets = targets.at(b);
+                for( ASR::symbol_t* tgt: targets.at(a) ) {
+                    if( b_targets.count(tgt) > 0 ) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            ASR::symbol_t* ptr = a_is_pointer ? a : b;
+            ASR::symbol_t* var = a_is_pointer ? b : a;
+            return targets.at(ptr).count(var) > 0;
+        }
+
     #define increment_by_one(var, body) ASR::expr_t* inc_by_one = builder.Add(var, \
         make_ConstantWithType(make_IntegerConstant_t, 1, \
             ASRUtils::expr_type(var), loc)); \
@@ -7,6 +7,8 @@
 #include <libasr/asr_pass_walk_visitor.h>
 
 #include <deque>
+#include <map>
+#include <set>
 
 namespace LCompilers {
 
@@ -112,6 +114,22 @@ namespace LCompilers {
                                          int comp=-1, bool use_loop_variable_after_loop=false,
                                          SymbolTable* current_scope=nullptr);
 
+        // Collects the program units of the translation unit that a pass can
+        // rewrite independently of each other: every global symbol, with
+        // modules expanded into their member symbols. A symbol is returned
+        // exactly once, and no returned symbol is nested inside another, so
+        // the units can be sharded across worker threads by passes that only
+        // mutate the unit they are visiting (body plus local symbol table).
+        std::vector<ASR::symbol_t*> collect_independent_program_units(
+            ASR::TranslationUnit_t &unit);
+
+        // True when `target = value` can stay a whole-array assignment:
+        // the backend then materialises the constant as a read-only
+        // global and copies it with a single memcpy, instead of the
+        // per-element stores the scalarising passes would generate.
+        bool can_memcpy_array_constant(ASR::expr_t* target,
+            ASR::ArrayConstant_t* value);
+
         ASR::stmt_t* create_do_loop_helper_pack(Allocator &al, const Location &loc,
             std::vector<ASR::expr_t*> do_loop_variables, ASR::expr_t* array, ASR::expr_t* mask,
             ASR::expr_t* res, ASR::expr_t* idx, int curr_idx);
@@ -305,12 +323,12 @@ namespace LCompilers {
                 }
 
                 void transform_stmts(ASR::stmt_t **&m_body, size_t &n_body) {
-                    Vec<ASR::stmt_t*> body;
-                    body.reserve(al, n_body);
+                    VecRewriter<ASR::stmt_t*> body;
+                    body.start(m_body, n_body);
                     if (pass_result.size() > 0) {
                         asr_changed = true;
                         for (size_t j=0; j < pass_result.size(); j++) {
-                            body.push_back(al, pass_result[j]);
+                            body.insert(al, pass_result[j]);
                         }
                         pass_result.n = 0;
                     }
@@ -324,19 +342,22 @@ namespace LCompilers {
                         if (pass_result.size() > 0) {
                             asr_changed = true;
                             for (size_t j=0; j < pass_result.size(); j++) {
-                                body.push_back(al, pass_result[j]);
+                                body.insert(al, pass_result[j]);
                             }
                             if( retain_original_stmt ) {
-                                body.push_back(al, m_body[i]);
+                                body.keep(al);
                                 retain_original_stmt = false;
+                            } else {
+                                body.skip(al);
                             }
                             pass_result.n = 0;
                         } else if(!remove_original_stmt) {
-                            body.push_back(al, m_body[i]);
+                            body.keep(al);
+                        } else {
+                            body.skip(al);
                         }
                     }
-                    m_body = body.p;
-                    n_body = body.size();
+                    body.finish(m_body, n_body);
                 }
 
                 void visit_Program(const ASR::Program_t &x) {
@@ -417,6 +438,47 @@ namespace LCompilers {
 
         };
 
+        // Flow-insensitive summary of what the local array pointers of a
+        // single procedure may be associated with, built from the pointer
+        // assignments (`ptr => target`, ASR Associate) in its body,
+        // including nested Block/AssociateBlock bodies. Passes can query
+        // it instead of bailing out on every pointer operand. A pointer
+        // is tracked only while every association seen is with a whole
+        // non-pointer array variable and the pointer never escapes the
+        // summary's view (pointer dummy, passed to a call, target of
+        // c_f_pointer, allocated directly, ...); anything else demotes it
+        // to "unknown" and the queries then answer conservatively.
+        class PointerAssociationSummary {
+
+            public:
+
+                // Rebuilds the summary from the statements of one
+                // procedure whose local symbols live in `symtab`. Nested
+                // procedures are not visited; build a fresh summary for
+                // each of them.
+                void build(SymbolTable* symtab, ASR::stmt_t** body, size_t n_body);
+
+                void clear();
+
+                // True when every association of `sym` seen in the
+                // procedure is with a whole (hence contiguous) array
+                // variable.
+                bool points_only_to_whole_arrays(ASR::symbol_t* sym) const;
+
+                // True unless `a` and `b` are provably backed by disjoint
+                // storage: two distinct non-pointer variables, or a
+                // tracked pointer whose possible targets exclude the
+                // other side.
+                bool may_alias(ASR::symbol_t* a, ASR::symbol_t* b) const;
+
+            private:
+
+                // pointer variable -> whole-array variables it may be
+                // associated with; absence means no association was seen
+                std::map<ASR::symbol_t*, std::set<ASR::symbol_t*>> targets;
+                std::set<ASR::symbol_t*> unknown;
+        };
+
         class UpdateDependenciesVisitor : public ASR::BaseWalkVisitor<UpdateDependenciesVisitor> {
 
             private:
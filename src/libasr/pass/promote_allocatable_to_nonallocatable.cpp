@@ -10,13 +10,25 @@
 
 namespace LCompilers {
 
-class IsAllocatedCalled: public ASR::CallReplacerOnExpressionsVisitor<IsAllocatedCalled> {
+/*
+Escape analysis over the allocatables of each scope. A symbol recorded
+in scope2var must keep its allocatable nature: its allocation status is
+observable (allocated(), explicit deallocate), its descriptor is handed
+to code that may reallocate or free it (allocatable/pointer dummies,
+move_alloc, realloc), or it is allocated more than once or with a shape
+that is not computable on entry. Everything not recorded here has a
+lifetime that provably ends inside its scope, so the promoter may turn
+it into an ordinary local array and drop the matching heap traffic —
+including the scope-exit frees that insert_deallocate emits, which are
+recognized as lifetime ends rather than escapes.
+*/
+class EscapeAnalysis: public ASR::CallReplacerOnExpressionsVisitor<EscapeAnalysis> {
     public:
 
         std::map<SymbolTable*, std::vector<ASR::symbol_t*>>& scope2var;
         std::map<ASR::symbol_t*, int> alloc_count;
 
-        IsAllocatedCalled(std::map<SymbolTable*, std::vector<ASR::symbol_t*>>& scope2var_):
+        EscapeAnalysis(std::map<SymbolTable*, std::vector<ASR::symbol_t*>>& scope2var_):
             scope2var(scope2var_) {}
 
         // Push symbol to all scopes from current_scope up to and including the
@@ -135,17 +147,13 @@ class IsAllocatedCalled: public ASR::CallReplacerOnExpressionsVisitor<IsAllocate
             }
         }
 
-        void visit_ImplicitDeallocate(const ASR::ImplicitDeallocate_t& x) {
-            for( size_t i = 0; i < x.n_vars; i++ ) {
-                if( ASR::is_a<ASR::Var_t>(*x.m_vars[i]) ) {
-                    ASR::symbol_t* sym = ASR::down_cast<ASR::Var_t>(x.m_vars[i])->m_v;
-                    push_to_scopes_until_symbol_scope(sym);
-                }
-            }
-        }
+        // ImplicitDeallocate is deliberately not an escape: it is the
+        // compiler's own scope-exit free, i.e. exactly the lifetime end
+        // that makes promotion sound. The promoter drops promoted symbols
+        // from those statements afterwards.
 
         void visit_Assignment(const ASR::Assignment_t& x) {
-            ASR::CallReplacerOnExpressionsVisitor<IsAllocatedCalled>::visit_Assignment(x);
+            ASR::CallReplacerOnExpressionsVisitor<EscapeAnalysis>::visit_Assignment(x);
             if (x.m_move_allocation) {
                 if( ASR::is_a<ASR::Var_t>(*x.m_target) ) {
                     ASR::symbol_t* sym = ASR::down_cast<ASR::Var_t>(x.m_target)->m_v;
@@ -177,6 +185,31 @@ class PromoteAllocatableToNonAllocatable:
             std::map<SymbolTable*, std::vector<ASR::symbol_t*>>& scope2var_):
             al(al_), remove_original_statement(false), scope2var(scope2var_) {}
 
+        // Promotion moves the data into the procedure's stack frame, so a
+        // compile-time shape must fit comfortably under typical stack
+        // limits; larger constant shapes stay on the heap. Shapes that
+        // depend on arguments are not boundable here and are promoted as
+        // before (the backend allocates them dynamically on the stack)
+        static constexpr int64_t max_stack_bytes = 1024 * 1024;
+
+        bool fits_on_stack(ASR::alloc_arg_t& alloc_arg) {
+            int64_t n_elements = 1;
+            for( size_t i = 0; i < alloc_arg.n_dims; i++ ) {
+                int64_t length = 0;
+                if( alloc_arg.m_dims[i].m_length == nullptr ||
+                    !ASRUtils::is_value_constant(ASRUtils::expr_value(
+                        alloc_arg.m_dims[i].m_length), length) ) {
+                    return true;
+                }
+                n_elements *= length;
+            }
+            int64_t element_bytes = ASRUtils::extract_kind_from_ttype_t(
+                ASRUtils::type_get_past_array(
+                    ASRUtils::type_get_past_allocatable(
+                        ASRUtils::expr_type(alloc_arg.m_a))));
+            return n_elements * element_bytes <= max_stack_bytes;
+        }
+
         void visit_Allocate(const ASR::Allocate_t& x) {
             ASR::Allocate_t& xx = const_cast<ASR::Allocate_t&>(x);
             Vec<ASR::alloc_arg_t> x_args;
@@ -210,6 +243,7 @@ class PromoteAllocatableToNonAllocatable:
                     ASRUtils::expr_intent(alloc_arg.m_a) == ASRUtils::intent_local &&
                     ASRUtils::is_dimension_dependent_only_on_arguments(
                         alloc_arg.m_dims, alloc_arg.n_dims) &&
+                    fits_on_stack(alloc_arg) &&
                     std::find(scope2var[current_scope].begin(),
                         scope2var[current_scope].end(),
                         ASR::down_cast<ASR::Var_t>(alloc_arg.m_a)->m_v) ==
@@ -457,8 +491,8 @@ void pass_promote_allocatable_to_nonallocatable(
     Allocator &al, ASR::TranslationUnit_t &unit,
     const PassOptions &/*pass_options*/) {
     std::map<SymbolTable*, std::vector<ASR::symbol_t*>> scope2var;
-    IsAllocatedCalled is_allocated_called(scope2var);
-    is_allocated_called.visit_TranslationUnit(unit);
+    EscapeAnalysis escape_analysis(scope2var);
+    escape_analysis.visit_TranslationUnit(unit);
     PromoteAllocatableToNonAllocatable promoter(al, scope2var);
     promoter.visit_TranslationUnit(unit);
     promoter.visit_TranslationUnit(unit);
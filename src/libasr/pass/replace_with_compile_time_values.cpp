@@ -9,24 +9,661 @@
 #include <libasr/pass/intrinsic_array_function_registry.h>
 
 #include <libasr/asr_builder.h>
+#include <libasr/constant_pool.h>
 
+#include <cmath>
+#include <cstdint>
+#include <map>
 #include <vector>
 
 namespace LCompilers {
 
+namespace {
+
+// Bounded interpreter that folds calls to small `pure` scalar user
+// functions with constant arguments into constants, the way intrinsics
+// already fold at compile time. It executes a restricted statement and
+// expression subset (scalar integer/real/logical assignments, if, do,
+// while, return, exit/cycle, nested calls to equally eligible
+// functions) under a shared step and depth budget; anything outside the
+// subset, or a budget overrun, abandons the attempt and leaves the call
+// for runtime. Integer arithmetic wraps to the expression kind and real
+// arithmetic rounds to it, so a folded value matches what the lowered
+// code would compute.
+class PureCallEvaluator {
+public:
+
+    PureCallEvaluator(Allocator& al_): al(al_) {}
+
+    ASR::expr_t* try_evaluate(ASR::FunctionCall_t* x) {
+        steps = max_steps;
+        CTValue result;
+        if( !eval_call(x, nullptr, 0, result) ) {
+            return nullptr;
+        }
+        return make_constant(result, x->m_type, x->base.base.loc);
+    }
+
+private:
+
+    struct CTValue {
+        enum class Tag { t_integer, t_real, t_logical };
+        Tag tag = Tag::t_integer;
+        int64_t i = 0;
+        double r = 0.0;
+        bool b = false;
+    };
+
+    enum class Flow { normal, returned, exited, cycled };
+
+    using Env = std::map<ASR::symbol_t*, CTValue>;
+
+    static const int max_steps = 65536;
+    static const int max_depth = 64;
+
+    Allocator& al;
+    int steps = 0;
+
+    bool take_step() {
+        return --steps >= 0;
+    }
+
+    static bool scalar_tag(ASR::ttype_t* type, CTValue::Tag& tag) {
+        if( ASRUtils::extract_n_dims_from_ttype(type) != 0 ) {
+            return false;
+        }
+        if( ASRUtils::is_integer(*type) ) {
+            tag = CTValue::Tag::t_integer;
+        } else if( ASRUtils::is_real(*type) ) {
+            tag = CTValue::Tag::t_real;
+        } else if( ASRUtils::is_logical(*type) ) {
+            tag = CTValue::Tag::t_logical;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // Wrap to the declared kind so folding reproduces what the lowered
+    // integer arithmetic of that width would produce
+    static int64_t wrap_integer(int64_t v, int kind) {
+        switch( kind ) {
+            case 1: return (int8_t) v;
+            case 2: return (int16_t) v;
+            case 4: return (int32_t) v;
+            default: return v;
+        }
+    }
+
+    static double round_real(double v, int kind) {
+        if( kind == 4 ) {
+            return (float) v;
+        }
+        return v;
+    }
+
+    ASR::expr_t* make_constant(const CTValue& value, ASR::ttype_t* type,
+            const Location& loc) {
+        CTValue::Tag tag;
+        if( !scalar_tag(type, tag) || tag != value.tag ) {
+            return nullptr;
+        }
+        switch( value.tag ) {
+            case CTValue::Tag::t_integer:
+                return ASRUtils::EXPR(ASR::make_IntegerConstant_t(
+                    al, loc, value.i, type));
+            case CTValue::Tag::t_real:
+                return ASRUtils::EXPR(ASR::make_RealConstant_t(
+                    al, loc, value.r, type));
+            case CTValue::Tag::t_logical:
+                return ASRUtils::EXPR(ASR::make_LogicalConstant_t(
+                    al, loc, value.b, type));
+        }
+        return nullptr;
+    }
+
+    static bool constant_to_value(ASR::expr_t* e, CTValue& out) {
+        if( ASR::is_a<ASR::IntegerConstant_t>(*e) ) {
+            out.tag = CTValue::Tag::t_integer;
+            out.i = ASR::down_cast<ASR::IntegerConstant_t>(e)->m_n;
+            return true;
+        }
+        if( ASR::is_a<ASR::RealConstant_t>(*e) ) {
+            out.tag = CTValue::Tag::t_real;
+            out.r = ASR::down_cast<ASR::RealConstant_t>(e)->m_r;
+            return true;
+        }
+        if( ASR::is_a<ASR::LogicalConstant_t>(*e) ) {
+            out.tag = CTValue::Tag::t_logical;
+            out.b = ASR::down_cast<ASR::LogicalConstant_t>(e)->m_value;
+            return true;
+        }
+        return false;
+    }
+
+    static bool eligible_function(ASR::Function_t* fn) {
+        ASR::FunctionType_t* fn_type = ASRUtils::get_FunctionType(fn);
+        return (fn_type->m_pure || fn->m_side_effect_free)
+            && fn_type->m_deftype == ASR::deftypeType::Implementation
+            && fn_type->m_abi == ASR::abiType::Source
+            && fn->n_body > 0 && fn->m_return_var != nullptr;
+    }
+
+    bool eval_call(ASR::FunctionCall_t* x, Env* caller_env, int depth,
+            CTValue& out) {
+        if( depth >= max_depth || !take_step() || x->m_dt != nullptr ) {
+            return false;
+        }
+        ASR::symbol_t* sym = ASRUtils::symbol_get_past_external(x->m_name);
+        if( !ASR::is_a<ASR::Function_t>(*sym) ) {
+            return false;
+        }
+        ASR::Function_t* fn = ASR::down_cast<ASR::Function_t>(sym);
+        if( !eligible_function(fn) || x->n_args != fn->n_args ) {
+            return false;
+        }
+
+        Env env;
+        for( size_t i = 0; i < x->n_args; i++ ) {
+            if( x->m_args[i].m_value == nullptr
+                    || !ASR::is_a<ASR::Var_t>(*fn->m_args[i]) ) {
+                return false;
+            }
+            ASR::symbol_t* arg_sym = ASR::down_cast<ASR::Var_t>(
+                fn->m_args[i])->m_v;
+            if( !ASR::is_a<ASR::Variable_t>(*arg_sym) ) {
+                return false;
+            }
+            ASR::Variable_t* arg = ASR::down_cast<ASR::Variable_t>(arg_sym);
+            CTValue::Tag arg_tag;
+            if( arg->m_intent != ASR::intentType::In
+                    || arg->m_presence != ASR::presenceType::Required
+                    || !scalar_tag(arg->m_type, arg_tag) ) {
+                return false;
+            }
+            CTValue value;
+            if( !eval_expr(x->m_args[i].m_value, caller_env, depth, value)
+                    || value.tag != arg_tag ) {
+                return false;
+            }
+            env[arg_sym] = value;
+        }
+
+        // Preload locals with constant initializers; stateful (save)
+        // locals make the function unfit for folding
+        for( auto& item: fn->m_symtab->get_scope() ) {
+            if( !ASR::is_a<ASR::Variable_t>(*item.second) ) {
+                continue;
+            }
+            ASR::Variable_t* v = ASR::down_cast<ASR::Variable_t>(item.second);
+            if( v->m_storage == ASR::storage_typeType::Save ) {
+                return false;
+            }
+            if( v->m_storage != ASR::storage_typeType::Default
+                    || v->m_symbolic_value == nullptr ) {
+                continue;
+            }
+            ASR::expr_t* init = ASRUtils::expr_value(v->m_symbolic_value);
+            CTValue value;
+            if( init != nullptr && constant_to_value(init, value) ) {
+                env[item.second] = value;
+            }
+        }
+
+        Flow flow = Flow::normal;
+        for( size_t i = 0; i < fn->n_body; i++ ) {
+            if( !exec_stmt(fn->m_body[i], env, depth, flow) ) {
+                return false;
+            }
+            if( flow != Flow::normal ) {
+                break;
+            }
+        }
+        if( flow == Flow::exited || flow == Flow::cycled ) {
+            return false;
+        }
+
+        ASR::symbol_t* result_sym = ASR::down_cast<ASR::Var_t>(
+            fn->m_return_var)->m_v;
+        auto it = env.find(result_sym);
+        if( it == env.end() ) {
+            return false;
+        }
+        out = it->second;
+        return true;
+    }
+
+    bool exec_block(ASR::stmt_t** body, size_t n_body, Env& env, int depth,
+            Flow& flow) {
+        for( size_t i = 0; i < n_body; i++ ) {
+            if( !exec_stmt(body[i], env, depth, flow) ) {
+                return false;
+            }
+            if( flow != Flow::normal ) {
+                return true;
+            }
+        }
+        return true;
+    }
+
+    bool exec_stmt(ASR::stmt_t* stmt, Env& env, int depth, Flow& flow) {
+        if( !take_step() ) {
+            return false;
+        }
+        switch( stmt->type ) {
+            case ASR::stmtType::Assignment: {
+                ASR::Assignment_t* a = ASR::down_cast<ASR::Assignment_t>(stmt);
+                if( a->m_overloaded != nullptr
+                        || !ASR::is_a<ASR::Var_t>(*a->m_target) ) {
+                    return false;
+                }
+                ASR::symbol_t* target = ASR::down_cast<ASR::Var_t>(
+                    a->m_target)->m_v;
+                CTValue::Tag target_tag;
+                if( !scalar_tag(ASRUtils::symbol_type(target), target_tag) ) {
+                    return false;
+                }
+                CTValue value;
+                if( !eval_expr(a->m_value, &env, depth, value)
+                        || value.tag != target_tag ) {
+                    return false;
+                }
+                env[target] = value;
+                return true;
+            }
+            case ASR::stmtType::If: {
+                ASR::If_t* i = ASR::down_cast<ASR::If_t>(stmt);
+                CTValue test;
+                if( !eval_expr(i->m_test, &env, depth, test)
+                        || test.tag != CTValue::Tag::t_logical ) {
+                    return false;
+                }
+                if( test.b ) {
+                    return exec_block(i->m_body, i->n_body, env, depth, flow);
+                }
+                return exec_block(i->m_orelse, i->n_orelse, env, depth, flow);
+            }
+            case ASR::stmtType::WhileLoop: {
+                ASR::WhileLoop_t* w = ASR::down_cast<ASR::WhileLoop_t>(stmt);
+                if( w->n_orelse > 0 ) {
+                    return false;
+                }
+                while( true ) {
+                    if( !take_step() ) {
+                        return false;
+                    }
+                    CTValue test;
+                    if( !eval_expr(w->m_test, &env, depth, test)
+                            || test.tag != CTValue::Tag::t_logical ) {
+                        return false;
+                    }
+                    if( !test.b ) {
+                        break;
+                    }
+                    if( !exec_block(w->m_body, w->n_body, env, depth, flow) ) {
+                        return false;
+                    }
+                    if( flow == Flow::returned ) {
+                        return true;
+                    }
+                    if( flow == Flow::exited ) {
+                        break;
+                    }
+                    flow = Flow::normal;
+                }
+                flow = Flow::normal;
+                return true;
+            }
+            case ASR::stmtType::DoLoop: {
+                ASR::DoLoop_t* d = ASR::down_cast<ASR::DoLoop_t>(stmt);
+                if( d->n_orelse > 0 || d->m_head.m_v == nullptr
+                        || !ASR::is_a<ASR::Var_t>(*d->m_head.m_v) ) {
+                    return false;
+                }
+                ASR::symbol_t* loop_var = ASR::down_cast<ASR::Var_t>(
+                    d->m_head.m_v)->m_v;
+                CTValue start, end, inc;
+                inc.tag = CTValue::Tag::t_integer;
+                inc.i = 1;
+                if( !eval_expr(d->m_head.m_start, &env, depth, start)
+                        || !eval_expr(d->m_head.m_end, &env, depth, end) ) {
+                    return false;
+                }
+                if( d->m_head.m_increment != nullptr
+                        && !eval_expr(d->m_head.m_increment, &env, depth, inc) ) {
+                    return false;
+                }
+                if( start.tag != CTValue::Tag::t_integer
+                        || end.tag != CTValue::Tag::t_integer
+                        || inc.tag != CTValue::Tag::t_integer || inc.i == 0 ) {
+                    return false;
+                }
+                for( int64_t v = start.i;
+                        inc.i > 0 ? v <= end.i : v >= end.i; v += inc.i ) {
+                    if( !take_step() ) {
+                        return false;
+                    }
+                    CTValue iter;
+                    iter.tag = CTValue::Tag::t_integer;
+                    iter.i = v;
+                    env[loop_var] = iter;
+                    if( !exec_block(d->m_body, d->n_body, env, depth, flow) ) {
+                        return false;
+                    }
+                    if( flow == Flow::returned ) {
+                        return true;
+                    }
+                    if( flow == Flow::exited ) {
+                        break;
+                    }
+                    flow = Flow::normal;
+                }
+                flow = Flow::normal;
+                return true;
+            }
+            case ASR::stmtType::Return: {
+                flow = Flow::returned;
+                return true;
+            }
+            case ASR::stmtType::Exit: {
+                if( ASR::down_cast<ASR::Exit_t>(stmt)->m_stmt_name != nullptr ) {
+                    return false;
+                }
+                flow = Flow::exited;
+                return true;
+            }
+            case ASR::stmtType::Cycle: {
+                if( ASR::down_cast<ASR::Cycle_t>(stmt)->m_stmt_name != nullptr ) {
+                    return false;
+                }
+                flow = Flow::cycled;
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    bool eval_expr(ASR::expr_t* e, Env* env, int depth, CTValue& out) {
+        if( !take_step() ) {
+            return false;
+        }
+        if( constant_to_value(e, out) ) {
+            return true;
+        }
+        ASR::expr_t* known = ASRUtils::expr_value(e);
+        if( known != nullptr && constant_to_value(known, out) ) {
+            return true;
+        }
+        switch( e->type ) {
+            case ASR::exprType::Var: {
+                ASR::symbol_t* sym = ASRUtils::symbol_get_past_external(
+                    ASR::down_cast<ASR::Var_t>(e)->m_v);
+                if( env != nullptr ) {
+                    auto it = env->find(sym);
+                    if( it != env->end() ) {
+                        out = it->second;
+                        return true;
+                    }
+                }
+                return false;
+            }
+            case ASR::exprType::IntegerBinOp: {
+                ASR::IntegerBinOp_t* op = ASR::down_cast<ASR::IntegerBinOp_t>(e);
+                CTValue left, right;
+                if( !eval_expr(op->m_left, env, depth, left)
+                        || !eval_expr(op->m_right, env, depth, right)
+                        || left.tag != CTValue::Tag::t_integer
+                        || right.tag != CTValue::Tag::t_integer ) {
+                    return false;
+                }
+                out.tag = CTValue::Tag::t_integer;
+                switch( op->m_op ) {
+                    case ASR::binopType::Add: out.i = left.i + right.i; break;
+                    case ASR::binopType::Sub: out.i = left.i - right.i; break;
+                    case ASR::binopType::Mul: out.i = left.i * right.i; break;
+                    case ASR::binopType::Div: {
+                        if( right.i == 0 ) {
+                            return false;
+                        }
+                        out.i = left.i / right.i;
+                        break;
+                    }
+                    case ASR::binopType::Pow: {
+                        if( !integer_pow(left.i, right.i, out.i) ) {
+                            return false;
+                        }
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+                out.i = wrap_integer(out.i,
+                    ASRUtils::extract_kind_from_ttype_t(op->m_type));
+                return true;
+            }
+            case ASR::exprType::RealBinOp: {
+                ASR::RealBinOp_t* op = ASR::down_cast<ASR::RealBinOp_t>(e);
+                CTValue left, right;
+                if( !eval_expr(op->m_left, env, depth, left)
+                        || !eval_expr(op->m_right, env, depth, right)
+                        || left.tag != CTValue::Tag::t_real
+                        || right.tag != CTValue::Tag::t_real ) {
+                    return false;
+                }
+                out.tag = CTValue::Tag::t_real;
+                switch( op->m_op ) {
+                    case ASR::binopType::Add: out.r = left.r + right.r; break;
+                    case ASR::binopType::Sub: out.r = left.r - right.r; break;
+                    case ASR::binopType::Mul: out.r = left.r * right.r; break;
+                    case ASR::binopType::Div: out.r = left.r / right.r; break;
+                    case ASR::binopType::Pow: out.r = std::pow(left.r, right.r); break;
+                    default:
+                        return false;
+                }
+                out.r = round_real(out.r,
+                    ASRUtils::extract_kind_from_ttype_t(op->m_type));
+                return true;
+            }
+            case ASR::exprType::LogicalBinOp: {
+                ASR::LogicalBinOp_t* op = ASR::down_cast<ASR::LogicalBinOp_t>(e);
+                CTValue left, right;
+                if( !eval_expr(op->m_left, env, depth, left)
+                        || !eval_expr(op->m_right, env, depth, right)
+                        || left.tag != CTValue::Tag::t_logical
+                        || right.tag != CTValue::Tag::t_logical ) {
+                    return false;
+                }
+                out.tag = CTValue::Tag::t_logical;
+                switch( op->m_op ) {
+                    case ASR::logicalbinopType::And: out.b = left.b && right.b; break;
+                    case ASR::logicalbinopType::Or: out.b = left.b || right.b; break;
+                    case ASR::logicalbinopType::Xor:
+                    case ASR::logicalbinopType::NEqv: out.b = left.b != right.b; break;
+                    case ASR::logicalbinopType::Eqv: out.b = left.b == right.b; break;
+                    default:
+                        return false;
+                }
+                return true;
+            }
+            case ASR::exprType::IntegerCompare: {
+                ASR::IntegerCompare_t* op = ASR::down_cast<ASR::IntegerCompare_t>(e);
+                CTValue left, right;
+                if( !eval_expr(op->m_left, env, depth, left)
+                        || !eval_expr(op->m_right, env, depth, right)
+                        || left.tag != CTValue::Tag::t_integer
+                        || right.tag != CTValue::Tag::t_integer ) {
+                    return false;
+                }
+                out.tag = CTValue::Tag::t_logical;
+                return compare(left.i, right.i, op->m_op, out.b);
+            }
+            case ASR::exprType::RealCompare: {
+                ASR::RealCompare_t* op = ASR::down_cast<ASR::RealCompare_t>(e);
+                CTValue left, right;
+                if( !eval_expr(op->m_left, env, depth, left)
+                        || !eval_expr(op->m_right, env, depth, right)
+                        || left.tag != CTValue::Tag::t_real
+                        || right.tag != CTValue::Tag::t_real ) {
+                    return false;
+                }
+                out.tag = CTValue::Tag::t_logical;
+                return compare(left.r, right.r, op->m_op, out.b);
+            }
+            case ASR::exprType::IntegerUnaryMinus: {
+                ASR::IntegerUnaryMinus_t* op
+                    = ASR::down_cast<ASR::IntegerUnaryMinus_t>(e);
+                if( !eval_expr(op->m_arg, env, depth, out)
+                        || out.tag != CTValue::Tag::t_integer ) {
+                    return false;
+                }
+                out.i = wrap_integer(-out.i,
+                    ASRUtils::extract_kind_from_ttype_t(op->m_type));
+                return true;
+            }
+            case ASR::exprType::RealUnaryMinus: {
+                ASR::RealUnaryMinus_t* op
+                    = ASR::down_cast<ASR::RealUnaryMinus_t>(e);
+                if( !eval_expr(op->m_arg, env, depth, out)
+                        || out.tag != CTValue::Tag::t_real ) {
+                    return false;
+                }
+                out.r = -out.r;
+                return true;
+            }
+            case ASR::exprType::LogicalNot: {
+                ASR::LogicalNot_t* op = ASR::down_cast<ASR::LogicalNot_t>(e);
+                if( !eval_expr(op->m_arg, env, depth, out)
+                        || out.tag != CTValue::Tag::t_logical ) {
+                    return false;
+                }
+                out.b = !out.b;
+                return true;
+            }
+            case ASR::exprType::Cast: {
+                ASR::Cast_t* cast = ASR::down_cast<ASR::Cast_t>(e);
+                CTValue arg;
+                if( !eval_expr(cast->m_arg, env, depth, arg) ) {
+                    return false;
+                }
+                int kind = ASRUtils::extract_kind_from_ttype_t(cast->m_type);
+                switch( cast->m_kind ) {
+                    case ASR::cast_kindType::IntegerToInteger: {
+                        if( arg.tag != CTValue::Tag::t_integer ) {
+                            return false;
+                        }
+                        out.tag = CTValue::Tag::t_integer;
+                        out.i = wrap_integer(arg.i, kind);
+                        return true;
+                    }
+                    case ASR::cast_kindType::IntegerToReal: {
+                        if( arg.tag != CTValue::Tag::t_integer ) {
+                            return false;
+                        }
+                        out.tag = CTValue::Tag::t_real;
+                        out.r = round_real((double) arg.i, kind);
+                        return true;
+                    }
+                    case ASR::cast_kindType::RealToInteger: {
+                        if( arg.tag != CTValue::Tag::t_real
+                                || !std::isfinite(arg.r)
+                                || std::fabs(arg.r) >= 9.2e18 ) {
+                            return false;
+                        }
+                        out.tag = CTValue::Tag::t_integer;
+                        out.i = wrap_integer((int64_t) arg.r, kind);
+                        return true;
+                    }
+                    case ASR::cast_kindType::RealToReal: {
+                        if( arg.tag != CTValue::Tag::t_real ) {
+                            return false;
+                        }
+                        out.tag = CTValue::Tag::t_real;
+                        out.r = round_real(arg.r, kind);
+                        return true;
+                    }
+                    case ASR::cast_kindType::LogicalToLogical: {
+                        if( arg.tag != CTValue::Tag::t_logical ) {
+                            return false;
+                        }
+                        out = arg;
+                        return true;
+                    }
+                    default:
+                        return false;
+                }
+            }
+            case ASR::exprType::FunctionCall: {
+                return eval_call(ASR::down_cast<ASR::FunctionCall_t>(e),
+                    env, depth + 1, out);
+            }
+            default:
+                return false;
+        }
+    }
+
+    template <typename T>
+    static bool compare(T left, T right, ASR::cmpopType op, bool& out) {
+        switch( op ) {
+            case ASR::cmpopType::Eq: out = left == right; return true;
+            case ASR::cmpopType::NotEq: out = left != right; return true;
+            case ASR::cmpopType::Lt: out = left < right; return true;
+            case ASR::cmpopType::LtE: out = left <= right; return true;
+            case ASR::cmpopType::Gt: out = left > right; return true;
+            case ASR::cmpopType::GtE: out = left >= right; return true;
+        }
+        return false;
+    }
+
+    static bool integer_pow(int64_t base, int64_t exp, int64_t& out) {
+        if( exp < 0 ) {
+            if( base == 1 ) {
+                out = 1;
+            } else if( base == -1 ) {
+                out = (exp % 2 == 0) ? 1 : -1;
+            } else if( base == 0 ) {
+                return false;
+            } else {
+                out = 0;
+            }
+            return true;
+        }
+        out = 1;
+        for( int64_t i = 0; i < exp; i++ ) {
+            out *= base;
+        }
+        return true;
+    }
+};
+
+} // anonymous namespace
+
 class CompileTimeValueReplacer: public ASR::BaseExprReplacer<CompileTimeValueReplacer> {
 
     private:
 
     Allocator& al;
+    ConstantPool& const_pool;
 
     public:
 
     bool inside_prohibited_expression;
 
 
-    CompileTimeValueReplacer(Allocator& al_):
-        al(al_), inside_prohibited_expression(false) {}
+    CompileTimeValueReplacer(Allocator& al_, ConstantPool& const_pool_):
+        al(al_), const_pool(const_pool_), inside_prohibited_expression(false) {}
+
+    void replace_FunctionCall(ASR::FunctionCall_t* x) {
+        ASR::BaseExprReplacer<CompileTimeValueReplacer>::replace_FunctionCall(x);
+        if( x->m_value != nullptr || inside_prohibited_expression ) {
+            return ;
+        }
+        // Calls to small pure user functions with constant arguments
+        // fold like intrinsic calls do; the generic replace_expr tail
+        // then substitutes and interns the value
+        PureCallEvaluator evaluator(al);
+        x->m_value = evaluator.try_evaluate(x);
+    }
 
     void replace_ArrayReshape(ASR::ArrayReshape_t* x) {
         ASR::BaseExprReplacer<CompileTimeValueReplacer>::replace_ArrayReshape(x);
@@ -82,7 +719,10 @@ class CompileTimeValueReplacer: public ASR::BaseExprReplacer<CompileTimeValueRep
             return ;
         }
 
-        *current_expr = compile_time_value;
+        // Scalar constants are interned so the many use sites of the same
+        // (kind, value) share a single node instead of each keeping its own
+        // copy of the evaluated value
+        *current_expr = const_pool.intern(compile_time_value);
     }
 };
 
@@ -90,6 +730,7 @@ class ExprVisitor: public ASR::CallReplacerOnExpressionsVisitor<ExprVisitor> {
 
     private:
 
+    ConstantPool const_pool;
     CompileTimeValueReplacer replacer;
 
     public:
@@ -99,7 +740,7 @@ class ExprVisitor: public ASR::CallReplacerOnExpressionsVisitor<ExprVisitor> {
         replacer.replace_expr(*current_expr);
     }
 
-    ExprVisitor(Allocator& al_): replacer(al_)
+    ExprVisitor(Allocator& al_): const_pool(al_), replacer(al_, const_pool)
     {}
 
     template <typename ExprType>
@@ -6,6 +6,8 @@
 #include <libasr/pass/pass_utils.h>
 #include <libasr/pass/replace_select_case.h>
 
+#include <algorithm>
+#include <vector>
 
 namespace LCompilers {
 
@@ -46,6 +48,12 @@ to:
         ...
     end if
 
+When the select has at least `min_arms_for_binary_search` arms and every
+case value is a compile-time integer constant with no overlaps, the arms
+are instead sorted and emitted as a balanced tree of nested ifs (binary
+search), so a large dispatch select costs O(log n) comparisons per
+execution instead of a linear scan.
+
 */
 
 inline ASR::expr_t* gen_test_expr_CaseStmt(Allocator& al, const Location& loc, ASR::CaseStmt_t* Case_Stmt, ASR::expr_t* a_test) {
@@ -86,6 +94,195 @@ inline ASR::expr_t* gen_test_expr_CaseStmt_Range(Allocator& al, const Location&
     return test_expr;
 }
 
+// One case arm whose values form the constant integer interval [lo, hi].
+// A `case (v)` contributes [v, v]; a `case (s:e)` contributes [s, e].
+struct CaseInterval {
+    int64_t lo;
+    int64_t hi;
+    ASR::stmt_t** m_body;
+    size_t n_body;
+};
+
+// Below this many arms the linear if-else chain is at least as fast as a
+// binary search and produces less code.
+const size_t min_arms_for_binary_search = 8;
+
+// Collects one interval per case value when every arm of the select tests
+// compile-time integer constants and no arm falls through. Returns false
+// (leaving `intervals` unusable) as soon as a non-constant value, an
+// unbounded range or an overlap between arms is found; the caller then
+// keeps the linear chain, which preserves textual order for overlaps.
+// A `case (1, 5, 9)` arm becomes three intervals; the second and later
+// ones get a duplicated body so no statement appears twice in the tree.
+bool collect_constant_case_intervals(Allocator& al, const ASR::Select_t& x,
+        std::vector<CaseInterval>& intervals) {
+    if( !ASRUtils::is_integer(*ASRUtils::expr_type(x.m_test)) ) {
+        return false;
+    }
+    for( size_t i = 0; i < x.n_body; i++ ) {
+        switch(x.m_body[i]->type) {
+            case ASR::case_stmtType::CaseStmt: {
+                ASR::CaseStmt_t* Case_Stmt = ASR::down_cast<ASR::CaseStmt_t>(x.m_body[i]);
+                if( Case_Stmt->m_fall_through ) {
+                    return false;
+                }
+                for( size_t j = 0; j < Case_Stmt->n_test; j++ ) {
+                    int64_t value = 0;
+                    if( !ASRUtils::is_value_constant(
+                            ASRUtils::expr_value(Case_Stmt->m_test[j]), value) ) {
+                        return false;
+                    }
+                    ASR::stmt_t** m_body = Case_Stmt->m_body;
+                    size_t n_body = Case_Stmt->n_body;
+                    if( j > 0 ) {
+                        ASRUtils::ExprStmtDuplicator stmt_duplicator(al);
+                        stmt_duplicator.allow_procedure_calls = true;
+                        stmt_duplicator.allow_reshape = true;
+                        Vec<ASR::stmt_t*> new_body;
+                        new_body.reserve(al, n_body);
+                        for( size_t k = 0; k < n_body; k++ ) {
+                            stmt_duplicator.success = true;
+                            ASR::stmt_t* new_stmt = stmt_duplicator.duplicate_stmt(m_body[k]);
+                            if( !stmt_duplicator.success ) {
+                                return false;
+                            }
+                            new_body.push_back(al, new_stmt);
+                        }
+                        m_body = new_body.p;
+                        n_body = new_body.size();
+                    }
+                    intervals.push_back({value, value, m_body, n_body});
+                }
+                break;
+            }
+            case ASR::case_stmtType::CaseStmt_Range: {
+                ASR::CaseStmt_Range_t* Case_Stmt = ASR::down_cast<ASR::CaseStmt_Range_t>(x.m_body[i]);
+                int64_t start = 0, end = 0;
+                if( Case_Stmt->m_start == nullptr || Case_Stmt->m_end == nullptr ||
+                    !ASRUtils::is_value_constant(
+                        ASRUtils::expr_value(Case_Stmt->m_start), start) ||
+                    !ASRUtils::is_value_constant(
+                        ASRUtils::expr_value(Case_Stmt->m_end), end) ) {
+                    return false;
+                }
+                if( start > end ) {
+                    // empty range, the arm can never be selected
+                    continue;
+                }
+                intervals.push_back({start, end,
+                    Case_Stmt->m_body, Case_Stmt->n_body});
+                break;
+            }
+        }
+    }
+    std::sort(intervals.begin(), intervals.end(),
+        [](const CaseInterval& a, const CaseInterval& b) {
+            return a.lo < b.lo;
+        });
+    for( size_t i = 1; i < intervals.size(); i++ ) {
+        if( intervals[i].lo <= intervals[i - 1].hi ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline ASR::expr_t* interval_constant(Allocator& al, const Location& loc,
+        int64_t value, ASR::ttype_t* a_type) {
+    return ASRUtils::EXPR(ASR::make_IntegerConstant_t(al, loc, value, a_type));
+}
+
+// Builds a balanced tree of nested if statements selecting among
+// intervals[begin..end). Each interior node halves the candidate set with
+// one `a <= hi` comparison; each leaf tests its own interval and runs the
+// arm body, setting `case_found_sym` (when given) so the default body can
+// be guarded once after the tree.
+ASR::stmt_t* build_search_tree(Allocator& al, const ASR::Select_t& x,
+        ASR::expr_t* a_test, const std::vector<CaseInterval>& intervals,
+        size_t begin, size_t end, ASR::symbol_t* case_found_sym) {
+    const Location& loc = x.base.base.loc;
+    ASR::ttype_t* a_type = ASRUtils::expr_type(a_test);
+    if( end - begin == 1 ) {
+        const CaseInterval& interval = intervals[begin];
+        ASR::expr_t* test_expr = nullptr;
+        if( interval.lo == interval.hi ) {
+            test_expr = PassUtils::create_compare_helper(al, loc, a_test,
+                interval_constant(al, loc, interval.lo, a_type), ASR::cmpopType::Eq);
+        } else {
+            ASR::expr_t* left = PassUtils::create_compare_helper(al, loc,
+                interval_constant(al, loc, interval.lo, a_type), a_test, ASR::cmpopType::LtE);
+            ASR::expr_t* right = PassUtils::create_compare_helper(al, loc, a_test,
+                interval_constant(al, loc, interval.hi, a_type), ASR::cmpopType::LtE);
+            test_expr = ASRUtils::EXPR(ASR::make_LogicalBinOp_t(al, loc, left,
+                ASR::logicalbinopType::And, right, ASRUtils::expr_type(left), nullptr));
+        }
+        Vec<ASR::stmt_t*> if_body;
+        if_body.reserve(al, interval.n_body + 1);
+        for( size_t i = 0; i < interval.n_body; i++ ) {
+            if_body.push_back(al, interval.m_body[i]);
+        }
+        if( case_found_sym != nullptr ) {
+            ASR::ttype_t* logical_type = ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 4));
+            if_body.push_back(al, ASRUtils::STMT(ASRUtils::make_Assignment_t_util(al, loc,
+                ASRUtils::EXPR(ASR::make_Var_t(al, loc, case_found_sym)),
+                ASRUtils::EXPR(ASR::make_LogicalConstant_t(al, loc, true,
+                    logical_type)), nullptr, false, false)));
+        }
+        return ASRUtils::STMT(ASR::make_If_t(al, loc, x.m_name, test_expr,
+            if_body.p, if_body.size(), nullptr, 0));
+    }
+    size_t mid = begin + (end - begin) / 2;
+    ASR::expr_t* test_expr = PassUtils::create_compare_helper(al, loc, a_test,
+        interval_constant(al, loc, intervals[mid - 1].hi, a_type), ASR::cmpopType::LtE);
+    Vec<ASR::stmt_t*> left_body;
+    left_body.reserve(al, 1);
+    left_body.push_back(al, build_search_tree(al, x, a_test, intervals,
+        begin, mid, case_found_sym));
+    Vec<ASR::stmt_t*> right_body;
+    right_body.reserve(al, 1);
+    right_body.push_back(al, build_search_tree(al, x, a_test, intervals,
+        mid, end, case_found_sym));
+    return ASRUtils::STMT(ASR::make_If_t(al, loc, x.m_name, test_expr,
+        left_body.p, left_body.size(), right_body.p, right_body.size()));
+}
+
+// Lowers a select over constant, non-overlapping integer cases to a binary
+// search: O(log n) comparisons per execution instead of the linear chain's
+// O(n). The default body runs once after the tree, guarded by a found flag,
+// so it is never duplicated across the tree's leaves.
+void case_to_binary_search(Allocator& al, const ASR::Select_t& x,
+        ASR::expr_t* a_test, const std::vector<CaseInterval>& intervals,
+        Vec<ASR::stmt_t*>& body, SymbolTable* scope) {
+    const Location& loc = x.base.base.loc;
+    body.reserve(al, 3);
+    ASR::symbol_t* case_found_sym = nullptr;
+    if( x.n_default > 0 ) {
+        ASR::ttype_t* logical_type = ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 4));
+        std::string case_found_name = scope->get_unique_name("case_found");
+        case_found_sym = ASR::down_cast<ASR::symbol_t>(
+            ASRUtils::make_Variable_t_util(al, loc, scope, s2c(al, case_found_name),
+                nullptr, 0, ASR::intentType::Local, nullptr, nullptr,
+                ASR::storage_typeType::Default, logical_type, nullptr,
+                ASR::abiType::Source, ASR::accessType::Public,
+                ASR::presenceType::Required, false));
+        scope->add_symbol(case_found_name, case_found_sym);
+        body.push_back(al, ASRUtils::STMT(ASRUtils::make_Assignment_t_util(al, loc,
+            ASRUtils::EXPR(ASR::make_Var_t(al, loc, case_found_sym)),
+            ASRUtils::EXPR(ASR::make_LogicalConstant_t(al, loc, false,
+                logical_type)), nullptr, false, false)));
+    }
+    body.push_back(al, build_search_tree(al, x, a_test, intervals,
+        0, intervals.size(), case_found_sym));
+    if( x.n_default > 0 ) {
+        ASR::ttype_t* logical_type = ASRUtils::TYPE(ASR::make_Logical_t(al, loc, 4));
+        ASR::expr_t* not_found = ASRUtils::EXPR(ASR::make_LogicalNot_t(al, loc,
+            ASRUtils::EXPR(ASR::make_Var_t(al, loc, case_found_sym)),
+            logical_type, nullptr));
+        body.push_back(al, ASRUtils::STMT(ASR::make_If_t(al, loc, x.m_name,
+            not_found, x.m_default, x.n_default, nullptr, 0)));
+    }
+}
+
 void case_to_if(Allocator& al, const ASR::Select_t& x, ASR::expr_t* a_test, Vec<ASR::stmt_t*>& body) {
     if( x.n_body == 0 ) {
         body.reserve(al, x.n_default);
@@ -170,7 +367,14 @@ Vec<ASR::stmt_t*> replace_selectcase(Allocator &al, const ASR::Select_t &select_
     }
 
     Vec<ASR::stmt_t*> body;
-    case_to_if(al, select_case, a_test, body);
+    std::vector<CaseInterval> intervals;
+    if (select_case.n_body >= min_arms_for_binary_search &&
+            collect_constant_case_intervals(al, select_case, intervals) &&
+            intervals.size() >= min_arms_for_binary_search) {
+        case_to_binary_search(al, select_case, a_test, intervals, body, scope);
+    } else {
+        case_to_if(al, select_case, a_test, body);
+    }
 
     if (pre_stmt != nullptr) {
         Vec<ASR::stmt_t*> result;
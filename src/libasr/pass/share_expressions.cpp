@@ -0,0 +1,390 @@
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include <libasr/asr.h>
+#include <libasr/asr_utils.h>
+#include <libasr/asr_side_effect.h>
+#include <libasr/pass/share_expressions.h>
+#include <libasr/pass/pass_utils.h>
+
+namespace LCompilers {
+
+/*
+
+This pass turns the expression trees of each procedure into DAGs:
+structurally identical, side-effect-free subexpressions are replaced by
+a single shared node, so verification, printing and codegen visit each
+distinct subexpression once instead of once per occurrence. Semantics
+duplicates such subtrees freely (the same bound expression ends up in
+declarations, allocations and loop bounds), and generated code commonly
+contains thousands of identical `size(x, 1)` subtrees per file.
+
+Sharing is purely structural: every use site still evaluates the shared
+node at its own program point, so the transformation does not reorder or
+coalesce evaluations. Only composite value expressions are shared;
+variables and constants are left alone (there is nothing to save), which
+also guarantees that assignment targets are never canonicalized. Calls
+are shared only when the callee is known to be side effect free (see
+asr_side_effect.h).
+
+The memo table is reset per procedure, so shared nodes never cross
+procedure boundaries. The pass is opt-in (run it via
+`--pass share_expressions`): passes that rewrite expressions in place
+after it would mutate every occurrence of a shared node at once, so it
+belongs late in the pipeline.
+
+*/
+
+namespace {
+
+void append_byte(std::string &key, uint8_t byte) {
+    key.push_back(static_cast<char>(byte));
+}
+
+void append_uint64(std::string &key, uint64_t value) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        append_byte(key, static_cast<uint8_t>(value >> shift));
+    }
+}
+
+void append_pointer(std::string &key, const void *pointer) {
+    append_uint64(key, reinterpret_cast<uintptr_t>(pointer));
+}
+
+void append_double(std::string &key, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    append_uint64(key, bits);
+}
+
+void append_type(std::string &key, ASR::ttype_t *type) {
+    if (type == nullptr) {
+        append_byte(key, 0xff);
+        return;
+    }
+    append_byte(key, static_cast<uint8_t>(type->type));
+    append_byte(key, static_cast<uint8_t>(
+        ASRUtils::extract_kind_from_ttype_t(type)));
+}
+
+bool append_expr_key(ASR::expr_t *expr, std::string &key);
+
+bool append_optional_expr_key(ASR::expr_t *expr, std::string &key) {
+    if (expr == nullptr) {
+        append_byte(key, 0);
+        return true;
+    }
+    append_byte(key, 1);
+    return append_expr_key(expr, key);
+}
+
+// Appends a byte string to `key` that uniquely identifies the structure
+// of `expr`; two expressions with equal keys evaluate to the same value
+// at the same program point. Returns false for expression kinds that
+// cannot be keyed (the caller then leaves the expression alone).
+bool append_expr_key(ASR::expr_t *expr, std::string &key) {
+    append_byte(key, static_cast<uint8_t>(expr->type));
+    switch (expr->type) {
+        case ASR::exprType::Var: {
+            append_pointer(key, ASR::down_cast<ASR::Var_t>(expr)->m_v);
+            return true;
+        }
+        case ASR::exprType::IntegerConstant: {
+            ASR::IntegerConstant_t *x =
+                ASR::down_cast<ASR::IntegerConstant_t>(expr);
+            append_uint64(key, static_cast<uint64_t>(x->m_n));
+            append_type(key, x->m_type);
+            return true;
+        }
+        case ASR::exprType::UnsignedIntegerConstant: {
+            ASR::UnsignedIntegerConstant_t *x =
+                ASR::down_cast<ASR::UnsignedIntegerConstant_t>(expr);
+            append_uint64(key, static_cast<uint64_t>(x->m_n));
+            append_type(key, x->m_type);
+            return true;
+        }
+        case ASR::exprType::RealConstant: {
+            ASR::RealConstant_t *x =
+                ASR::down_cast<ASR::RealConstant_t>(expr);
+            append_double(key, x->m_r);
+            append_type(key, x->m_type);
+            return true;
+        }
+        case ASR::exprType::ComplexConstant: {
+            ASR::ComplexConstant_t *x =
+                ASR::down_cast<ASR::ComplexConstant_t>(expr);
+            append_double(key, x->m_re);
+            append_double(key, x->m_im);
+            append_type(key, x->m_type);
+            return true;
+        }
+        case ASR::exprType::LogicalConstant: {
+            ASR::LogicalConstant_t *x =
+                ASR::down_cast<ASR::LogicalConstant_t>(expr);
+            append_byte(key, x->m_value ? 1 : 0);
+            append_type(key, x->m_type);
+            return true;
+        }
+        case ASR::exprType::StringConstant: {
+            ASR::StringConstant_t *x =
+                ASR::down_cast<ASR::StringConstant_t>(expr);
+            std::size_t length = std::strlen(x->m_s);
+            append_uint64(key, length);
+            key.append(x->m_s, length);
+            return true;
+        }
+        case ASR::exprType::IntegerBinOp: {
+            ASR::IntegerBinOp_t *x =
+                ASR::down_cast<ASR::IntegerBinOp_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::UnsignedIntegerBinOp: {
+            ASR::UnsignedIntegerBinOp_t *x =
+                ASR::down_cast<ASR::UnsignedIntegerBinOp_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::RealBinOp: {
+            ASR::RealBinOp_t *x = ASR::down_cast<ASR::RealBinOp_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::ComplexBinOp: {
+            ASR::ComplexBinOp_t *x =
+                ASR::down_cast<ASR::ComplexBinOp_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::LogicalBinOp: {
+            ASR::LogicalBinOp_t *x =
+                ASR::down_cast<ASR::LogicalBinOp_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::IntegerCompare: {
+            ASR::IntegerCompare_t *x =
+                ASR::down_cast<ASR::IntegerCompare_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::RealCompare: {
+            ASR::RealCompare_t *x =
+                ASR::down_cast<ASR::RealCompare_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::StringCompare: {
+            ASR::StringCompare_t *x =
+                ASR::down_cast<ASR::StringCompare_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::LogicalCompare: {
+            ASR::LogicalCompare_t *x =
+                ASR::down_cast<ASR::LogicalCompare_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_op));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_left, key)
+                && append_expr_key(x->m_right, key);
+        }
+        case ASR::exprType::IntegerUnaryMinus: {
+            ASR::IntegerUnaryMinus_t *x =
+                ASR::down_cast<ASR::IntegerUnaryMinus_t>(expr);
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_arg, key);
+        }
+        case ASR::exprType::RealUnaryMinus: {
+            ASR::RealUnaryMinus_t *x =
+                ASR::down_cast<ASR::RealUnaryMinus_t>(expr);
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_arg, key);
+        }
+        case ASR::exprType::ComplexUnaryMinus: {
+            ASR::ComplexUnaryMinus_t *x =
+                ASR::down_cast<ASR::ComplexUnaryMinus_t>(expr);
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_arg, key);
+        }
+        case ASR::exprType::LogicalNot: {
+            ASR::LogicalNot_t *x = ASR::down_cast<ASR::LogicalNot_t>(expr);
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_arg, key);
+        }
+        case ASR::exprType::Cast: {
+            ASR::Cast_t *x = ASR::down_cast<ASR::Cast_t>(expr);
+            if (x->m_dest != nullptr) {
+                return false;
+            }
+            append_byte(key, static_cast<uint8_t>(x->m_kind));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_arg, key);
+        }
+        case ASR::exprType::ArrayPhysicalCast: {
+            ASR::ArrayPhysicalCast_t *x =
+                ASR::down_cast<ASR::ArrayPhysicalCast_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_old));
+            append_byte(key, static_cast<uint8_t>(x->m_new));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_arg, key);
+        }
+        case ASR::exprType::ArraySize: {
+            ASR::ArraySize_t *x = ASR::down_cast<ASR::ArraySize_t>(expr);
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_v, key)
+                && append_optional_expr_key(x->m_dim, key);
+        }
+        case ASR::exprType::ArrayBound: {
+            ASR::ArrayBound_t *x = ASR::down_cast<ASR::ArrayBound_t>(expr);
+            append_byte(key, static_cast<uint8_t>(x->m_bound));
+            append_type(key, x->m_type);
+            return append_expr_key(x->m_v, key)
+                && append_optional_expr_key(x->m_dim, key);
+        }
+        case ASR::exprType::IntrinsicElementalFunction: {
+            ASR::IntrinsicElementalFunction_t *x =
+                ASR::down_cast<ASR::IntrinsicElementalFunction_t>(expr);
+            append_uint64(key, static_cast<uint64_t>(x->m_intrinsic_id));
+            append_uint64(key, static_cast<uint64_t>(x->m_overload_id));
+            append_type(key, x->m_type);
+            append_uint64(key, x->n_args);
+            for (std::size_t i = 0; i < x->n_args; i++) {
+                if (!append_optional_expr_key(x->m_args[i], key)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ASR::exprType::IntrinsicArrayFunction: {
+            ASR::IntrinsicArrayFunction_t *x =
+                ASR::down_cast<ASR::IntrinsicArrayFunction_t>(expr);
+            append_uint64(key, static_cast<uint64_t>(x->m_arr_intrinsic_id));
+            append_uint64(key, static_cast<uint64_t>(x->m_overload_id));
+            append_type(key, x->m_type);
+            append_uint64(key, x->n_args);
+            for (std::size_t i = 0; i < x->n_args; i++) {
+                if (!append_expr_key(x->m_args[i], key)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ASR::exprType::FunctionCall: {
+            ASR::FunctionCall_t *x =
+                ASR::down_cast<ASR::FunctionCall_t>(expr);
+            if (x->m_dt != nullptr) {
+                return false;
+            }
+            // Only calls the side-effect analysis proves harmless may be
+            // shared; anything it flags (an impure callee anywhere in the
+            // subtree) must keep its own node
+            ASR::SideEffectFinder finder;
+            finder.visit_expr(*expr);
+            if (finder.found) {
+                return false;
+            }
+            append_pointer(key, x->m_name);
+            append_type(key, x->m_type);
+            append_uint64(key, x->n_args);
+            for (std::size_t i = 0; i < x->n_args; i++) {
+                if (!append_optional_expr_key(x->m_args[i].m_value, key)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+// Variables and constants are cheap leaves: replacing them saves
+// nothing, and excluding them keeps assignment targets untouched
+bool is_composite(ASR::expr_t *expr) {
+    switch (expr->type) {
+        case ASR::exprType::Var:
+        case ASR::exprType::IntegerConstant:
+        case ASR::exprType::UnsignedIntegerConstant:
+        case ASR::exprType::RealConstant:
+        case ASR::exprType::ComplexConstant:
+        case ASR::exprType::LogicalConstant:
+        case ASR::exprType::StringConstant: {
+            return false;
+        }
+        default: {
+            return true;
+        }
+    }
+}
+
+class ShareExpressionsVisitor :
+    public ASR::CallReplacerOnExpressionsVisitor<ShareExpressionsVisitor> {
+
+    std::unordered_map<std::string, ASR::expr_t*> memo;
+
+public:
+
+    void call_replacer() {
+        ASR::expr_t *expr = *current_expr;
+        if (expr == nullptr || !is_composite(expr)) {
+            return;
+        }
+        std::string key;
+        key.reserve(64);
+        if (!append_expr_key(expr, key)) {
+            return;
+        }
+        auto it = memo.find(key);
+        if (it != memo.end()) {
+            *current_expr = it->second;
+        } else {
+            memo.emplace(std::move(key), expr);
+        }
+    }
+
+    void visit_Function(const ASR::Function_t &x) {
+        std::unordered_map<std::string, ASR::expr_t*> parent_memo =
+            std::move(memo);
+        memo.clear();
+        CallReplacerOnExpressionsVisitor::visit_Function(x);
+        memo = std::move(parent_memo);
+    }
+
+    void visit_Program(const ASR::Program_t &x) {
+        std::unordered_map<std::string, ASR::expr_t*> parent_memo =
+            std::move(memo);
+        memo.clear();
+        CallReplacerOnExpressionsVisitor::visit_Program(x);
+        memo = std::move(parent_memo);
+    }
+};
+
+} // anonymous namespace
+
+void pass_share_expressions(Allocator &al, ASR::TranslationUnit_t &unit,
+                            const PassOptions &/*pass_options*/) {
+    ShareExpressionsVisitor visitor;
+    visitor.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
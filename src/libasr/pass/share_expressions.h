@@ -0,0 +1,14 @@
+#ifndef LIBASR_PASS_SHARE_EXPRESSIONS_H
+#define LIBASR_PASS_SHARE_EXPRESSIONS_H
+
+#include <libasr/asr.h>
+#include <libasr/utils.h>
+
+namespace LCompilers {
+
+    void pass_share_expressions(Allocator &al, ASR::TranslationUnit_t &unit,
+                                const PassOptions &pass_options);
+
+} // namespace LCompilers
+
+#endif // LIBASR_PASS_SHARE_EXPRESSIONS_H
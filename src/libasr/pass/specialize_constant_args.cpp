@@ -0,0 +1,391 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/specialize_constant_args.h>
+#include <libasr/pass/pass_utils.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace LCompilers {
+
+/*
+
+Specializes procedures on constant scalar arguments. A scalar
+integer or logical dummy that receives the same literal at several
+call sites is a flag the callee keeps re-testing at run time; this
+pass clones the procedure once per popular constant combination,
+turns the dummy into a named constant (Parameter) inside the clone,
+drops it from the clone's argument list and redirects the matching
+call sites. With the flag now a compile-time constant in the clone,
+later constant folding and the backend optimizer eliminate the
+per-call (and per-iteration) branches on it.
+
+Call sites are grouped by the exact set of (argument index, value)
+pairs they pass; a group needs at least two call sites to earn a
+clone and each procedure gets at most a handful of clones to bound
+code growth. Only direct calls are rewritten — calls through
+ExternalSymbol, generics and type-bound procedures keep using the
+original, which is left untouched. The pass runs only under --fast.
+
+*/
+
+const size_t min_call_sites_for_specialization = 2;
+const size_t max_specializations_per_function = 4;
+
+// One specialized (dummy argument, constant value) pair
+struct ConstArg {
+    size_t index;
+    bool is_logical;
+    int64_t int_value;
+    bool bool_value;
+
+    bool operator<(const ConstArg& other) const {
+        return std::tie(index, is_logical, int_value, bool_value) <
+            std::tie(other.index, other.is_logical, other.int_value,
+                     other.bool_value);
+    }
+};
+
+// The full set of constants a call site passes, ordered by argument index
+using SpecKey = std::vector<ConstArg>;
+
+static bool is_specializable_dummy(ASR::Function_t* f, size_t i, bool& is_logical) {
+    if( !ASR::is_a<ASR::Var_t>(*f->m_args[i]) ) {
+        return false;
+    }
+    ASR::symbol_t* arg_sym = ASR::down_cast<ASR::Var_t>(f->m_args[i])->m_v;
+    if( !ASR::is_a<ASR::Variable_t>(*arg_sym) ) {
+        return false;
+    }
+    ASR::Variable_t* arg = ASR::down_cast<ASR::Variable_t>(arg_sym);
+    if( arg->m_intent != ASR::intentType::In ||
+        arg->m_presence != ASR::presenceType::Required ) {
+        return false;
+    }
+    ASR::ttype_t* type = arg->m_type;
+    if( ASRUtils::is_array(type) ||
+        ASR::is_a<ASR::Allocatable_t>(*type) ||
+        ASR::is_a<ASR::Pointer_t>(*type) ) {
+        return false;
+    }
+    if( ASR::is_a<ASR::Integer_t>(*type) ) {
+        is_logical = false;
+        return true;
+    }
+    if( ASR::is_a<ASR::Logical_t>(*type) ) {
+        is_logical = true;
+        return true;
+    }
+    return false;
+}
+
+static bool is_specializable_function(ASR::Function_t* f) {
+    ASR::FunctionType_t* f_type = ASRUtils::get_FunctionType(*f);
+    if( f_type->m_abi != ASR::abiType::Source ||
+        f_type->m_deftype != ASR::deftypeType::Implementation ||
+        f_type->m_elemental || f_type->n_restrictions > 0 ||
+        f->n_body == 0 ) {
+        return false;
+    }
+    for( size_t i = 0; i < f->n_args; i++ ) {
+        if( ASR::is_a<ASR::Var_t>(*f->m_args[i]) ) {
+            ASR::symbol_t* arg_sym = ASR::down_cast<ASR::Var_t>(f->m_args[i])->m_v;
+            if( ASR::is_a<ASR::Variable_t>(*arg_sym) &&
+                ASR::down_cast<ASR::Variable_t>(arg_sym)->m_presence ==
+                    ASR::presenceType::Optional ) {
+                return false;
+            }
+        }
+    }
+    // Duplicated bodies would need their BlockCall statements remapped to
+    // the duplicated Block symbols; skip such procedures instead
+    for( auto& item: f->m_symtab->get_scope() ) {
+        if( ASR::is_a<ASR::Block_t>(*item.second) ||
+            ASR::is_a<ASR::AssociateBlock_t>(*item.second) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Computes the specialization key of a direct call; false when the callee
+// is not specializable or no eligible argument is a compile-time constant
+static bool call_site_key(ASR::symbol_t* name, ASR::call_arg_t* args,
+        size_t n_args, SpecKey& key) {
+    if( !ASR::is_a<ASR::Function_t>(*name) ) {
+        return false;
+    }
+    ASR::Function_t* f = ASR::down_cast<ASR::Function_t>(name);
+    if( !is_specializable_function(f) || n_args != f->n_args ) {
+        return false;
+    }
+    for( size_t i = 0; i < n_args; i++ ) {
+        if( args[i].m_value == nullptr ) {
+            return false;
+        }
+        bool is_logical = false;
+        if( !is_specializable_dummy(f, i, is_logical) ) {
+            continue;
+        }
+        ASR::expr_t* value = ASRUtils::expr_value(args[i].m_value);
+        ConstArg const_arg;
+        const_arg.index = i;
+        const_arg.is_logical = is_logical;
+        const_arg.int_value = 0;
+        const_arg.bool_value = false;
+        if( is_logical ) {
+            if( !ASRUtils::is_value_constant(value, const_arg.bool_value) ) {
+                continue;
+            }
+        } else {
+            if( !ASRUtils::is_value_constant(value, const_arg.int_value) ) {
+                continue;
+            }
+        }
+        key.push_back(const_arg);
+    }
+    return !key.empty();
+}
+
+class CallSiteCollector : public ASR::BaseWalkVisitor<CallSiteCollector> {
+    public:
+
+        std::map<ASR::symbol_t*, std::map<SpecKey, size_t>> groups;
+
+        void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+            ASR::BaseWalkVisitor<CallSiteCollector>::visit_FunctionCall(x);
+            if( x.m_dt != nullptr ) {
+                return ;
+            }
+            SpecKey key;
+            if( call_site_key(x.m_name, x.m_args, x.n_args, key) ) {
+                groups[x.m_name][key] += 1;
+            }
+        }
+
+        void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+            ASR::BaseWalkVisitor<CallSiteCollector>::visit_SubroutineCall(x);
+            if( x.m_dt != nullptr ) {
+                return ;
+            }
+            SpecKey key;
+            if( call_site_key(x.m_name, x.m_args, x.n_args, key) ) {
+                groups[x.m_name][key] += 1;
+            }
+        }
+};
+
+static ASR::symbol_t* create_specialized_clone(Allocator& al,
+        ASR::Function_t* f, const SpecKey& key) {
+    ASRUtils::ExprStmtDuplicator node_duplicator(al);
+    node_duplicator.allow_procedure_calls = true;
+    node_duplicator.allow_reshape = false;
+    Vec<ASR::stmt_t*> new_body;
+    new_body.reserve(al, f->n_body);
+    for( size_t i = 0; i < f->n_body; i++ ) {
+        node_duplicator.success = true;
+        ASR::stmt_t* new_stmt = node_duplicator.duplicate_stmt(f->m_body[i]);
+        if( !node_duplicator.success ) {
+            return nullptr;
+        }
+        new_body.push_back(al, new_stmt);
+    }
+
+    SymbolTable* parent_scope = f->m_symtab->parent;
+    SymbolTable* new_symtab = al.make_new<SymbolTable>(parent_scope);
+    ASRUtils::SymbolDuplicator symbol_duplicator(al);
+    // first duplicate the external symbols
+    // so they can be referenced by derived_type
+    for( auto& item: f->m_symtab->get_scope() ) {
+        if (ASR::is_a<ASR::ExternalSymbol_t>(*item.second)) {
+            symbol_duplicator.duplicate_symbol(item.second, new_symtab);
+        }
+    }
+    for( auto& item: f->m_symtab->get_scope() ) {
+        if (!ASR::is_a<ASR::ExternalSymbol_t>(*item.second)) {
+            symbol_duplicator.duplicate_symbol(item.second, new_symtab);
+        }
+    }
+
+    // Turn each specialized dummy into a named constant holding the
+    // call sites' literal; it stays in the clone's symtab so every use
+    // in the duplicated body keeps resolving, but leaves the argument list
+    std::string suffix = "__spec";
+    for( const ConstArg& const_arg: key ) {
+        ASR::Variable_t* orig = ASRUtils::EXPR2VAR(f->m_args[const_arg.index]);
+        ASR::symbol_t* new_sym = new_symtab->get_symbol(std::string(orig->m_name));
+        if( new_sym == nullptr || !ASR::is_a<ASR::Variable_t>(*new_sym) ) {
+            return nullptr;
+        }
+        ASR::Variable_t* new_var = ASR::down_cast<ASR::Variable_t>(new_sym);
+        ASR::expr_t* const_expr = nullptr;
+        if( const_arg.is_logical ) {
+            const_expr = ASRUtils::EXPR(ASR::make_LogicalConstant_t(al,
+                new_var->base.base.loc, const_arg.bool_value, new_var->m_type));
+            suffix += "_" + std::string(orig->m_name) +
+                (const_arg.bool_value ? "_t" : "_f");
+        } else {
+            const_expr = ASRUtils::EXPR(ASR::make_IntegerConstant_t(al,
+                new_var->base.base.loc, const_arg.int_value, new_var->m_type));
+            int64_t value = const_arg.int_value;
+            suffix += "_" + std::string(orig->m_name) + "_" +
+                (value < 0 ? "m" + std::to_string(-value) : std::to_string(value));
+        }
+        new_var->m_intent = ASR::intentType::Local;
+        new_var->m_storage = ASR::storage_typeType::Parameter;
+        new_var->m_symbolic_value = const_expr;
+        new_var->m_value = const_expr;
+    }
+
+    Vec<ASR::expr_t*> new_args;
+    new_args.reserve(al, f->n_args);
+    ASR::expr_t* return_var = nullptr;
+    size_t key_i = 0;
+    for( size_t i = 0; i < f->n_args + 1; i++ ) {
+        if( key_i < key.size() && i == key[key_i].index ) {
+            key_i += 1;
+            continue;
+        }
+        std::string arg_name;
+        if( i < f->n_args ) {
+            if( !ASR::is_a<ASR::Var_t>(*f->m_args[i]) ) {
+                return nullptr;
+            }
+            ASR::symbol_t* arg_sym = ASR::down_cast<ASR::Var_t>(f->m_args[i])->m_v;
+            arg_name = ASRUtils::symbol_name(arg_sym);
+        } else if( f->m_return_var ) {
+            arg_name = ASRUtils::EXPR2VAR(f->m_return_var)->m_name;
+        } else {
+            break ;
+        }
+        ASR::symbol_t* new_sym = new_symtab->get_symbol(arg_name);
+        if( new_sym == nullptr ) {
+            return nullptr;
+        }
+        ASR::expr_t* new_arg = ASRUtils::EXPR(ASR::make_Var_t(al,
+            f->m_args[0]->base.loc, new_sym));
+        if( i < f->n_args ) {
+            new_args.push_back(al, new_arg);
+        } else {
+            return_var = new_arg;
+        }
+    }
+
+    ASR::FunctionType_t* f_type = ASRUtils::get_FunctionType(f);
+    std::string new_name = parent_scope->get_unique_name(
+        to_lower(std::string(f->m_name) + suffix), false);
+    ASR::asr_t* new_function = ASRUtils::make_Function_t_util(al, f->base.base.loc,
+        new_symtab, s2c(al, new_name), f->m_dependencies, f->n_dependencies,
+        new_args.p, new_args.size(), new_body.p, new_body.size(),
+        return_var, f_type->m_abi, f->m_access, f_type->m_deftype,
+        nullptr, f_type->m_elemental, f_type->m_pure, f_type->m_module,
+        f_type->m_inline, f_type->m_static,
+        f_type->m_restrictions, f_type->n_restrictions, false, false, false);
+    ASR::symbol_t* new_symbol = ASR::down_cast<ASR::symbol_t>(new_function);
+    parent_scope->add_symbol(new_name, new_symbol);
+    return new_symbol;
+}
+
+class CallSiteRewriter : public ASR::BaseWalkVisitor<CallSiteRewriter> {
+    private:
+
+        Allocator& al;
+        std::map<ASR::symbol_t*, std::map<SpecKey, ASR::symbol_t*>>& clones;
+
+    public:
+
+        CallSiteRewriter(Allocator& al_,
+            std::map<ASR::symbol_t*, std::map<SpecKey, ASR::symbol_t*>>& clones_) :
+            al(al_), clones(clones_) {}
+
+        template <typename T>
+        void rewrite_call(const T& x) {
+            if( x.m_dt != nullptr ) {
+                return ;
+            }
+            auto func_it = clones.find(x.m_name);
+            if( func_it == clones.end() ) {
+                return ;
+            }
+            SpecKey key;
+            if( !call_site_key(x.m_name, x.m_args, x.n_args, key) ) {
+                return ;
+            }
+            auto clone_it = func_it->second.find(key);
+            if( clone_it == func_it->second.end() ) {
+                return ;
+            }
+            Vec<ASR::call_arg_t> new_args;
+            new_args.reserve(al, x.n_args);
+            size_t key_i = 0;
+            for( size_t i = 0; i < x.n_args; i++ ) {
+                if( key_i < key.size() && i == key[key_i].index ) {
+                    key_i += 1;
+                    continue;
+                }
+                new_args.push_back(al, x.m_args[i]);
+            }
+            T& xx = const_cast<T&>(x);
+            xx.m_name = clone_it->second;
+            xx.m_args = new_args.p;
+            xx.n_args = new_args.size();
+        }
+
+        void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+            ASR::BaseWalkVisitor<CallSiteRewriter>::visit_FunctionCall(x);
+            rewrite_call(x);
+        }
+
+        void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+            ASR::BaseWalkVisitor<CallSiteRewriter>::visit_SubroutineCall(x);
+            rewrite_call(x);
+        }
+};
+
+void pass_specialize_constant_args(Allocator &al, ASR::TranslationUnit_t &unit,
+                                   const PassOptions &pass_options) {
+    if( !pass_options.fast ) {
+        return ;
+    }
+    CallSiteCollector collector;
+    collector.visit_TranslationUnit(unit);
+
+    std::map<ASR::symbol_t*, std::map<SpecKey, ASR::symbol_t*>> clones;
+    for( auto& func_entry: collector.groups ) {
+        ASR::Function_t* f = ASR::down_cast<ASR::Function_t>(func_entry.first);
+        std::vector<std::pair<SpecKey, size_t>> candidates;
+        for( auto& group: func_entry.second ) {
+            if( group.second >= min_call_sites_for_specialization ) {
+                candidates.push_back(group);
+            }
+        }
+        // most popular constant combinations first
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [](const std::pair<SpecKey, size_t>& a,
+               const std::pair<SpecKey, size_t>& b) {
+                return a.second > b.second;
+            });
+        size_t n_clones = std::min(candidates.size(),
+            max_specializations_per_function);
+        for( size_t i = 0; i < n_clones; i++ ) {
+            ASR::symbol_t* clone = create_specialized_clone(al, f,
+                candidates[i].first);
+            if( clone != nullptr ) {
+                clones[func_entry.first][candidates[i].first] = clone;
+            }
+        }
+    }
+    if( clones.empty() ) {
+        return ;
+    }
+
+    CallSiteRewriter rewriter(al, clones);
+    rewriter.visit_TranslationUnit(unit);
+
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
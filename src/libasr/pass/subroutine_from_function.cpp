@@ -471,6 +471,7 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
     private:
 
         Allocator& al;
+        const LCompilers::PassOptions& pass_options;
         Vec<ASR::stmt_t*> pass_result;
         ReplaceFunctionCallWithSubroutineCall replacer;
         bool remove_original_statement = false;
@@ -507,12 +508,63 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
             return ASR::down_cast<ASR::Var_t>(a)->m_v == ASR::down_cast<ASR::Var_t>(b)->m_v;
         }
 
+        // Whether the assignment target itself can be passed as the result
+        // argument so the callee constructs the result in place, instead of
+        // a temporary that is moved into the target afterwards. Safe only
+        // when the callee has no way of observing the target while it runs:
+        // the target is a plain local variable without the TARGET attribute,
+        // the callee is not an internal procedure of the current scope
+        // (host association), and no actual argument mentions the target.
+        // Bounds checking needs the temporary for its shape check, so the
+        // elision is disabled then.
+        bool can_construct_result_in_place(ASR::expr_t* target, ASR::FunctionCall_t* fc) {
+            if( pass_options.bounds_checking ) {
+                return false;
+            }
+            if( !ASR::is_a<ASR::Var_t>(*target) ) {
+                return false;
+            }
+            ASR::symbol_t* target_sym = ASR::down_cast<ASR::Var_t>(target)->m_v;
+            if( !ASR::is_a<ASR::Variable_t>(*target_sym) ||
+                ASR::down_cast<ASR::Variable_t>(target_sym)->m_target_attr ) {
+                return false;
+            }
+            if( ASRUtils::symbol_parent_symtab(target_sym)->get_counter() !=
+                current_scope->get_counter() ) {
+                return false;
+            }
+            ASR::symbol_t* func_sym = ASRUtils::symbol_get_past_external(fc->m_name);
+            if( ASRUtils::symbol_parent_symtab(func_sym)->get_counter() ==
+                current_scope->get_counter() ) {
+                return false;
+            }
+            SetChar arg_identifiers;
+            arg_identifiers.reserve(al, fc->n_args);
+            ASRUtils::CollectIdentifiersFromASRExpression collector(al, arg_identifiers);
+            for( size_t i = 0; i < fc->n_args; i++ ) {
+                if( fc->m_args[i].m_value ) {
+                    collector.visit_expr(*fc->m_args[i].m_value);
+                }
+            }
+            if( fc->m_dt ) {
+                collector.visit_expr(*fc->m_dt);
+            }
+            std::string target_name = ASRUtils::symbol_name(target_sym);
+            for( size_t i = 0; i < arg_identifiers.size(); i++ ) {
+                if( target_name == arg_identifiers[i] ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
     public:
 
         ReplaceFunctionCallWithSubroutineCallVisitor(
-            Allocator& al_,
+            Allocator& al_, const LCompilers::PassOptions& pass_options_,
             std::unordered_map<ASR::Function_t*, ASR::ttype_t*> &Function__TO__ReturnType_MAP)
-            :al(al_), replacer(al, current_scope, pass_result, Function__TO__ReturnType_MAP)
+            :al(al_), pass_options(pass_options_),
+            replacer(al, current_scope, pass_result, Function__TO__ReturnType_MAP)
         {
             pass_result.n = 0;
             pass_result.reserve(al, 1);
@@ -701,9 +753,17 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
                     ASR::is_a<ASR::Assignment_t>(xx)) {
                     // If we already used a temp var for return don't use it here
                     if (!use_temp_var_for_return) {
-                        target = create_temporary_variable_for_array(al, target, current_scope, "_subroutine_from_function_");
+                        if (can_construct_result_in_place(target, fc)) {
+                            // Keep the original target as the result argument;
+                            // the callee allocates and fills it directly and
+                            // the temporary plus move assignment disappear.
+                        } else {
+                            target = create_temporary_variable_for_array(al, target, current_scope, "_subroutine_from_function_");
+                            value_and_target_allocatable_array = true;
+                        }
+                    } else {
+                        value_and_target_allocatable_array = true;
                     }
-                    value_and_target_allocatable_array = true;
                 }
                 // Make sure to deallocate the temporary that will hold the return of function.
                 Vec<ASR::expr_t*> to_be_deallocated;
@@ -819,11 +879,11 @@ class ReplaceFunctionCallWithSubroutineCallVisitor:
 };
 
 void pass_create_subroutine_from_function(Allocator &al, ASR::TranslationUnit_t &unit,
-                                          const LCompilers::PassOptions& /*pass_options*/) {
+                                          const LCompilers::PassOptions& pass_options) {
     std::unordered_map<ASR::Function_t*, ASR::ttype_t*> Function__TO__ReturnType_MAP;
     CreateFunctionFromSubroutine v(al,Function__TO__ReturnType_MAP);
     v.visit_TranslationUnit(unit);
-    ReplaceFunctionCallWithSubroutineCallVisitor u(al, Function__TO__ReturnType_MAP);
+    ReplaceFunctionCallWithSubroutineCallVisitor u(al, pass_options, Function__TO__ReturnType_MAP);
     u.visit_TranslationUnit(unit);
     PassUtils::UpdateDependenciesVisitor w(al);
     w.visit_TranslationUnit(unit);
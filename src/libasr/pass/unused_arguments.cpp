@@ -0,0 +1,391 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/unused_arguments.h>
+#include <libasr/pass/pass_utils.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace LCompilers {
+
+/*
+
+Interprocedural elimination of dead dummy arguments and dead module
+variables. dead_code_removal works at statement level and
+unused_functions drops whole procedures, but a dummy argument that the
+body never references is still threaded through every call site and
+through the backend, and an unreferenced private module variable is
+still emitted as a global. This pass:
+
+* drops dummy arguments whose symbol is never referenced inside the
+  procedure (body, local declarations, nested procedures), rewriting
+  every call site to stop passing the actual; and
+
+* erases private module variables that no expression, external symbol
+  or namelist in the translation unit references.
+
+Both rewrites require seeing all uses, so the pass only touches
+procedures whose signature cannot escape the translation unit — ones
+nested in a program or another procedure, or private in a local module
+— and that are referenced exclusively as direct calls (no procedure
+pointers, generics or type-bound bindings). An argument is kept when
+any call site passes an actual that is neither a variable nor a
+compile-time constant, since dropping it would also drop a potential
+side effect. Like unused_functions, the pass assumes whole-program
+view and does nothing without a main program (unless always_run).
+
+*/
+
+// References to symbols anywhere in the unit, split into direct call
+// targets and everything else (a procedure referenced any other way
+// must keep its signature)
+class GlobalRefCollector : public ASR::BaseWalkVisitor<GlobalRefCollector> {
+    public:
+
+        std::set<ASR::symbol_t*> var_refs;
+        std::set<ASR::symbol_t*> other_refs;
+        std::set<ASR::symbol_t*> called;
+
+        void visit_Var(const ASR::Var_t& x) {
+            var_refs.insert(x.m_v);
+        }
+
+        void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+            ASR::BaseWalkVisitor<GlobalRefCollector>::visit_FunctionCall(x);
+            record_call(x.m_name, x.m_original_name, x.m_dt);
+        }
+
+        void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+            ASR::BaseWalkVisitor<GlobalRefCollector>::visit_SubroutineCall(x);
+            record_call(x.m_name, x.m_original_name, x.m_dt);
+        }
+
+        void visit_ExternalSymbol(const ASR::ExternalSymbol_t& x) {
+            other_refs.insert(x.m_external);
+        }
+
+        void visit_GenericProcedure(const ASR::GenericProcedure_t& x) {
+            for( size_t i = 0; i < x.n_procs; i++ ) {
+                other_refs.insert(x.m_procs[i]);
+            }
+        }
+
+        void visit_CustomOperator(const ASR::CustomOperator_t& x) {
+            for( size_t i = 0; i < x.n_procs; i++ ) {
+                other_refs.insert(x.m_procs[i]);
+            }
+        }
+
+        void visit_StructMethodDeclaration(const ASR::StructMethodDeclaration_t& x) {
+            other_refs.insert(x.m_proc);
+        }
+
+        void visit_Namelist(const ASR::Namelist_t& x) {
+            for( size_t i = 0; i < x.n_var_list; i++ ) {
+                other_refs.insert(x.m_var_list[i]);
+            }
+        }
+
+        void visit_Variable(const ASR::Variable_t& x) {
+            ASR::BaseWalkVisitor<GlobalRefCollector>::visit_Variable(x);
+            if( x.m_type_declaration ) {
+                other_refs.insert(x.m_type_declaration);
+            }
+        }
+
+    private:
+
+        void record_call(ASR::symbol_t* name, ASR::symbol_t* original_name,
+                ASR::expr_t* dt) {
+            if( dt != nullptr ) {
+                other_refs.insert(name);
+            } else {
+                called.insert(name);
+            }
+            if( original_name != nullptr && original_name != name ) {
+                other_refs.insert(original_name);
+            }
+        }
+};
+
+// Symbols a procedure references: body, declarations (types carry
+// dimension and length expressions) and nested procedures; the
+// argument list itself is deliberately not walked
+class UsedSymbolCollector : public ASR::BaseWalkVisitor<UsedSymbolCollector> {
+    public:
+
+        std::set<ASR::symbol_t*> used;
+
+        void visit_Var(const ASR::Var_t& x) {
+            used.insert(x.m_v);
+        }
+};
+
+static bool is_program_present(const ASR::TranslationUnit_t &unit) {
+    for (auto &a : unit.m_symtab->get_scope()) {
+        if (ASR::is_a<ASR::Program_t>(*a.second)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_local_module(ASR::Module_t* m) {
+    return !m->m_loaded_from_mod && !m->m_intrinsic &&
+        !m->m_has_submodules && m->m_parent_module == nullptr;
+}
+
+// Can this procedure's signature change without being observable
+// outside the translation unit?
+static bool signature_is_local(ASR::Function_t* f) {
+    SymbolTable* parent = f->m_symtab->parent;
+    if( parent == nullptr || parent->asr_owner == nullptr ||
+        !ASR::is_a<ASR::symbol_t>(*parent->asr_owner) ) {
+        // global scope procedures have external linkage
+        return false;
+    }
+    ASR::symbol_t* owner = ASR::down_cast<ASR::symbol_t>(parent->asr_owner);
+    if( ASR::is_a<ASR::Program_t>(*owner) || ASR::is_a<ASR::Function_t>(*owner) ) {
+        return true;
+    }
+    if( ASR::is_a<ASR::Module_t>(*owner) ) {
+        return is_local_module(ASR::down_cast<ASR::Module_t>(owner)) &&
+            f->m_access == ASR::accessType::Private;
+    }
+    return false;
+}
+
+static bool is_rewritable_function(ASR::Function_t* f) {
+    ASR::FunctionType_t* f_type = ASRUtils::get_FunctionType(*f);
+    return f_type->m_abi == ASR::abiType::Source &&
+        f_type->m_deftype == ASR::deftypeType::Implementation &&
+        !f_type->m_elemental && f_type->n_restrictions == 0 &&
+        f->n_body > 0 && signature_is_local(f);
+}
+
+// Dropping this actual must not drop a side effect
+static bool is_droppable_actual(ASR::expr_t* actual) {
+    if( actual == nullptr ) {
+        return true;
+    }
+    return ASR::is_a<ASR::Var_t>(*actual) ||
+        ASRUtils::expr_value(actual) != nullptr;
+}
+
+// Finds the dead argument indices of every rewritable procedure
+class DeadArgFinder : public ASR::BaseWalkVisitor<DeadArgFinder> {
+    public:
+
+        const GlobalRefCollector& refs;
+        std::map<ASR::symbol_t*, std::vector<size_t>> dead_args;
+
+        DeadArgFinder(const GlobalRefCollector& refs_) : refs(refs_) {}
+
+        void visit_Function(const ASR::Function_t& x) {
+            ASR::BaseWalkVisitor<DeadArgFinder>::visit_Function(x);
+            ASR::Function_t* f = const_cast<ASR::Function_t*>(&x);
+            ASR::symbol_t* f_sym = (ASR::symbol_t*) f;
+            if( !is_rewritable_function(f) ||
+                refs.other_refs.count(f_sym) > 0 ||
+                refs.var_refs.count(f_sym) > 0 ||
+                refs.called.count(f_sym) == 0 ) {
+                return ;
+            }
+            UsedSymbolCollector used;
+            for( auto& item: f->m_symtab->get_scope() ) {
+                used.visit_symbol(*item.second);
+            }
+            for( size_t i = 0; i < f->n_body; i++ ) {
+                used.visit_stmt(*f->m_body[i]);
+            }
+            std::vector<size_t> dead;
+            for( size_t i = 0; i < f->n_args; i++ ) {
+                if( !ASR::is_a<ASR::Var_t>(*f->m_args[i]) ) {
+                    continue;
+                }
+                ASR::symbol_t* arg_sym = ASR::down_cast<ASR::Var_t>(f->m_args[i])->m_v;
+                if( ASR::is_a<ASR::Variable_t>(*arg_sym) &&
+                    used.used.count(arg_sym) == 0 ) {
+                    dead.push_back(i);
+                }
+            }
+            if( !dead.empty() ) {
+                dead_args[f_sym] = dead;
+            }
+        }
+};
+
+// Keeps arguments whose actual at some call site is not droppable
+class CallSiteChecker : public ASR::BaseWalkVisitor<CallSiteChecker> {
+    public:
+
+        std::map<ASR::symbol_t*, std::vector<size_t>>& dead_args;
+
+        CallSiteChecker(std::map<ASR::symbol_t*, std::vector<size_t>>& dead_args_) :
+            dead_args(dead_args_) {}
+
+        template <typename T>
+        void check_call(const T& x) {
+            auto it = dead_args.find(x.m_name);
+            if( it == dead_args.end() ) {
+                return ;
+            }
+            std::vector<size_t> still_dead;
+            for( size_t index: it->second ) {
+                if( index < x.n_args &&
+                    is_droppable_actual(x.m_args[index].m_value) ) {
+                    still_dead.push_back(index);
+                }
+            }
+            if( still_dead.empty() ) {
+                dead_args.erase(it);
+            } else {
+                it->second = still_dead;
+            }
+        }
+
+        void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+            ASR::BaseWalkVisitor<CallSiteChecker>::visit_FunctionCall(x);
+            check_call(x);
+        }
+
+        void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+            ASR::BaseWalkVisitor<CallSiteChecker>::visit_SubroutineCall(x);
+            check_call(x);
+        }
+};
+
+// Rewrites signatures and call sites in place
+class DeadArgEliminator : public ASR::BaseWalkVisitor<DeadArgEliminator> {
+    public:
+
+        Allocator& al;
+        const std::map<ASR::symbol_t*, std::vector<size_t>>& dead_args;
+
+        DeadArgEliminator(Allocator& al_,
+            const std::map<ASR::symbol_t*, std::vector<size_t>>& dead_args_) :
+            al(al_), dead_args(dead_args_) {}
+
+        void visit_Function(const ASR::Function_t& x) {
+            ASR::BaseWalkVisitor<DeadArgEliminator>::visit_Function(x);
+            auto it = dead_args.find((ASR::symbol_t*) &x);
+            if( it == dead_args.end() ) {
+                return ;
+            }
+            ASR::Function_t& xx = const_cast<ASR::Function_t&>(x);
+            const std::vector<size_t>& dead = it->second;
+            Vec<ASR::expr_t*> new_args;
+            new_args.reserve(al, xx.n_args);
+            size_t dead_i = 0;
+            for( size_t i = 0; i < xx.n_args; i++ ) {
+                if( dead_i < dead.size() && i == dead[dead_i] ) {
+                    dead_i += 1;
+                    // the dummy stays in the symtab as an unreferenced
+                    // local; erase it entirely
+                    ASR::symbol_t* arg_sym =
+                        ASR::down_cast<ASR::Var_t>(xx.m_args[i])->m_v;
+                    xx.m_symtab->erase_symbol(ASRUtils::symbol_name(arg_sym));
+                    continue;
+                }
+                new_args.push_back(al, xx.m_args[i]);
+            }
+            ASR::FunctionType_t* f_type = ASRUtils::get_FunctionType(x);
+            xx.m_function_signature = ASRUtils::TYPE(ASRUtils::make_FunctionType_t_util(
+                al, f_type->base.base.loc, new_args.p, new_args.size(),
+                xx.m_return_var, f_type, xx.m_symtab->parent));
+            xx.m_args = new_args.p;
+            xx.n_args = new_args.size();
+        }
+
+        template <typename T>
+        void rewrite_call(const T& x) {
+            auto it = dead_args.find(x.m_name);
+            if( it == dead_args.end() ) {
+                return ;
+            }
+            T& xx = const_cast<T&>(x);
+            const std::vector<size_t>& dead = it->second;
+            Vec<ASR::call_arg_t> new_args;
+            new_args.reserve(al, xx.n_args);
+            size_t dead_i = 0;
+            for( size_t i = 0; i < xx.n_args; i++ ) {
+                if( dead_i < dead.size() && i == dead[dead_i] ) {
+                    dead_i += 1;
+                    continue;
+                }
+                new_args.push_back(al, xx.m_args[i]);
+            }
+            xx.m_args = new_args.p;
+            xx.n_args = new_args.size();
+        }
+
+        void visit_FunctionCall(const ASR::FunctionCall_t& x) {
+            ASR::BaseWalkVisitor<DeadArgEliminator>::visit_FunctionCall(x);
+            rewrite_call(x);
+        }
+
+        void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+            ASR::BaseWalkVisitor<DeadArgEliminator>::visit_SubroutineCall(x);
+            rewrite_call(x);
+        }
+};
+
+static void remove_dead_module_variables(ASR::TranslationUnit_t& unit,
+        const GlobalRefCollector& refs) {
+    for( auto& item: unit.m_symtab->get_scope() ) {
+        if( !ASR::is_a<ASR::Module_t>(*item.second) ) {
+            continue;
+        }
+        ASR::Module_t* m = ASR::down_cast<ASR::Module_t>(item.second);
+        if( !is_local_module(m) ) {
+            continue;
+        }
+        std::vector<std::string> dead;
+        for( auto& sym: m->m_symtab->get_scope() ) {
+            if( !ASR::is_a<ASR::Variable_t>(*sym.second) ) {
+                continue;
+            }
+            ASR::Variable_t* v = ASR::down_cast<ASR::Variable_t>(sym.second);
+            if( v->m_access == ASR::accessType::Private &&
+                v->m_abi == ASR::abiType::Source &&
+                v->m_bindc_name == nullptr &&
+                refs.var_refs.count(sym.second) == 0 &&
+                refs.other_refs.count(sym.second) == 0 ) {
+                dead.push_back(sym.first);
+            }
+        }
+        for( const std::string& name: dead ) {
+            m->m_symtab->erase_symbol(name);
+        }
+    }
+}
+
+void pass_unused_arguments(Allocator &al, ASR::TranslationUnit_t &unit,
+                           const PassOptions &pass_options) {
+    if( !is_program_present(unit) && !pass_options.always_run ) {
+        return ;
+    }
+    GlobalRefCollector refs;
+    refs.visit_TranslationUnit(unit);
+
+    DeadArgFinder finder(refs);
+    finder.visit_TranslationUnit(unit);
+    if( !finder.dead_args.empty() ) {
+        CallSiteChecker checker(finder.dead_args);
+        checker.visit_TranslationUnit(unit);
+    }
+    bool changed = !finder.dead_args.empty();
+    if( changed ) {
+        DeadArgEliminator eliminator(al, finder.dead_args);
+        eliminator.visit_TranslationUnit(unit);
+    }
+
+    remove_dead_module_variables(unit, refs);
+
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
@@ -0,0 +1,374 @@
+#include <libasr/asr.h>
+#include <libasr/containers.h>
+#include <libasr/asr_utils.h>
+#include <libasr/pass/value_range_opt.h>
+#include <libasr/pass/pass_utils.h>
+#include <libasr/pass/intrinsic_functions.h>
+
+#include <map>
+
+namespace LCompilers {
+
+using ASR::down_cast;
+using ASR::is_a;
+
+/*
+
+Value-range propagation over ASR integers. Inside a do loop with
+compile-time bounds the loop variable is known to stay in [start, end],
+and intervals for expressions built from it follow bottom-up. The
+resulting proofs feed local strength reductions that constant folding
+alone cannot justify:
+
+    do i = 0, n - 1          ! n parameter
+        j = mod(i, n)        ! -> j = i          (0 <= i <= n-1)
+        k = abs(i - m)       ! -> k = i - m      if  i - m >= 0
+        l = i / 8            ! -> l = shiftr(i, 3)  (i >= 0)
+        p = min(i, n)        ! -> p = i
+    end do
+
+The signed division rewrite needs the dividend provably non-negative:
+for negative operands an arithmetic shift rounds toward -inf while
+Fortran division truncates toward zero, so without the proof LLVM has
+to emit the slower fixup sequence. Interval arithmetic saturates and
+gives up rather than wrapping, and a loop variable that the body might
+modify (direct assignment or being passed to a call) contributes no
+interval. The pass runs before do_loops so the loop structure is still
+visible, and only under --fast.
+
+*/
+
+struct Interval {
+    int64_t lo;
+    int64_t hi;
+};
+
+// Endpoint magnitudes are kept small enough that interval arithmetic in
+// int64_t cannot overflow
+const int64_t interval_limit = int64_t(1) << 30;
+
+static bool in_limits(int64_t lo, int64_t hi) {
+    return -interval_limit <= lo && lo <= hi && hi <= interval_limit;
+}
+
+// Bottom-up interval of an integer expression under the loop-variable
+// environment; false when nothing can be proven
+static bool expr_interval(ASR::expr_t* expr,
+        const std::map<ASR::symbol_t*, Interval>& env, Interval& result) {
+    if( expr == nullptr ) {
+        return false;
+    }
+    int64_t value = 0;
+    if( ASRUtils::is_value_constant(ASRUtils::expr_value(expr), value) ) {
+        result = {value, value};
+        return in_limits(result.lo, result.hi);
+    }
+    if( is_a<ASR::Var_t>(*expr) ) {
+        auto it = env.find(down_cast<ASR::Var_t>(expr)->m_v);
+        if( it == env.end() ) {
+            return false;
+        }
+        result = it->second;
+        return true;
+    }
+    if( is_a<ASR::IntegerUnaryMinus_t>(*expr) ) {
+        Interval arg;
+        if( !expr_interval(down_cast<ASR::IntegerUnaryMinus_t>(expr)->m_arg,
+                env, arg) ) {
+            return false;
+        }
+        result = {-arg.hi, -arg.lo};
+        return true;
+    }
+    if( is_a<ASR::Cast_t>(*expr) ) {
+        ASR::Cast_t* cast = down_cast<ASR::Cast_t>(expr);
+        if( cast->m_kind != ASR::cast_kindType::IntegerToInteger ) {
+            return false;
+        }
+        // values inside interval_limit fit in every integer kind >= 4;
+        // a narrowing cast to kind 1/2 may wrap, so prove the fit
+        int64_t kind = ASRUtils::extract_kind_from_ttype_t(cast->m_type);
+        if( !expr_interval(cast->m_arg, env, result) ) {
+            return false;
+        }
+        if( kind < 4 ) {
+            int64_t kind_max = (int64_t(1) << (8 * kind - 1)) - 1;
+            return -kind_max - 1 <= result.lo && result.hi <= kind_max;
+        }
+        return true;
+    }
+    if( is_a<ASR::IntegerBinOp_t>(*expr) ) {
+        ASR::IntegerBinOp_t* binop = down_cast<ASR::IntegerBinOp_t>(expr);
+        Interval left, right;
+        if( !expr_interval(binop->m_left, env, left) ||
+            !expr_interval(binop->m_right, env, right) ) {
+            return false;
+        }
+        switch( binop->m_op ) {
+            case ASR::binopType::Add:
+                result = {left.lo + right.lo, left.hi + right.hi};
+                break;
+            case ASR::binopType::Sub:
+                result = {left.lo - right.hi, left.hi - right.lo};
+                break;
+            case ASR::binopType::Mul: {
+                int64_t a = left.lo * right.lo, b = left.lo * right.hi;
+                int64_t c = left.hi * right.lo, d = left.hi * right.hi;
+                result = {std::min(std::min(a, b), std::min(c, d)),
+                          std::max(std::max(a, b), std::max(c, d))};
+                break;
+            }
+            case ASR::binopType::Div:
+                // only the easy, common shape: positive constant divisor
+                if( right.lo != right.hi || right.lo <= 0 ) {
+                    return false;
+                }
+                result = {left.lo / right.lo, left.hi / right.lo};
+                // trunc-toward-zero can round a negative lo up
+                if( left.lo < 0 ) {
+                    result.lo = left.lo;
+                }
+                break;
+            default:
+                return false;
+        }
+        return in_limits(result.lo, result.hi);
+    }
+    if( is_a<ASR::IntrinsicElementalFunction_t>(*expr) ) {
+        ASR::IntrinsicElementalFunction_t* f =
+            down_cast<ASR::IntrinsicElementalFunction_t>(expr);
+        int64_t id = f->m_intrinsic_id;
+        if( id == static_cast<int64_t>(
+                ASRUtils::IntrinsicElementalFunctions::Abs) &&
+            f->n_args == 1 ) {
+            Interval arg;
+            if( !expr_interval(f->m_args[0], env, arg) ) {
+                return false;
+            }
+            result.lo = arg.lo >= 0 ? arg.lo : (arg.hi <= 0 ? -arg.hi : 0);
+            result.hi = std::max(std::abs(arg.lo), std::abs(arg.hi));
+            return true;
+        }
+        if( (id == static_cast<int64_t>(
+                 ASRUtils::IntrinsicElementalFunctions::Mod) ||
+             id == static_cast<int64_t>(
+                 ASRUtils::IntrinsicElementalFunctions::Modulo)) &&
+            f->n_args == 2 ) {
+            Interval arg, divisor;
+            if( !expr_interval(f->m_args[0], env, arg) ||
+                !expr_interval(f->m_args[1], env, divisor) ||
+                divisor.lo != divisor.hi || divisor.lo <= 0 ) {
+                return false;
+            }
+            if( arg.lo >= 0 ) {
+                result = {0, std::min(arg.hi, divisor.lo - 1)};
+            } else if( id == static_cast<int64_t>(
+                    ASRUtils::IntrinsicElementalFunctions::Modulo) ) {
+                result = {0, divisor.lo - 1};
+            } else {
+                result = {-(divisor.lo - 1), divisor.lo - 1};
+            }
+            return true;
+        }
+        return false;
+    }
+    return false;
+}
+
+class ValueRangeReplacer: public ASR::BaseExprReplacer<ValueRangeReplacer> {
+    public:
+
+        Allocator& al;
+        const std::map<ASR::symbol_t*, Interval>& env;
+
+        ValueRangeReplacer(Allocator& al_,
+            const std::map<ASR::symbol_t*, Interval>& env_):
+            al(al_), env(env_) {}
+
+        void replace_IntrinsicElementalFunction(
+                ASR::IntrinsicElementalFunction_t* x) {
+            ASR::BaseExprReplacer<ValueRangeReplacer>
+                ::replace_IntrinsicElementalFunction(x);
+            if( x->m_value != nullptr || env.empty() ||
+                !ASRUtils::is_integer(*x->m_type) ) {
+                return;
+            }
+            int64_t id = x->m_intrinsic_id;
+            if( (id == static_cast<int64_t>(
+                     ASRUtils::IntrinsicElementalFunctions::Mod) ||
+                 id == static_cast<int64_t>(
+                     ASRUtils::IntrinsicElementalFunctions::Modulo)) &&
+                x->n_args == 2 ) {
+                // mod(e, c) == e when 0 <= e <= c-1
+                Interval arg, divisor;
+                if( expr_interval(x->m_args[0], env, arg) &&
+                    expr_interval(x->m_args[1], env, divisor) &&
+                    divisor.lo == divisor.hi && divisor.lo > 0 &&
+                    arg.lo >= 0 && arg.hi < divisor.lo ) {
+                    *current_expr = x->m_args[0];
+                }
+            } else if( id == static_cast<int64_t>(
+                    ASRUtils::IntrinsicElementalFunctions::Abs) &&
+                x->n_args == 1 ) {
+                Interval arg;
+                if( expr_interval(x->m_args[0], env, arg) && arg.lo >= 0 ) {
+                    *current_expr = x->m_args[0];
+                }
+            } else if( (id == static_cast<int64_t>(
+                            ASRUtils::IntrinsicElementalFunctions::Min) ||
+                        id == static_cast<int64_t>(
+                            ASRUtils::IntrinsicElementalFunctions::Max)) &&
+                x->n_args == 2 ) {
+                Interval a, b;
+                if( !expr_interval(x->m_args[0], env, a) ||
+                    !expr_interval(x->m_args[1], env, b) ) {
+                    return;
+                }
+                bool is_min = id == static_cast<int64_t>(
+                    ASRUtils::IntrinsicElementalFunctions::Min);
+                if( a.hi <= b.lo ) {
+                    *current_expr = is_min ? x->m_args[0] : x->m_args[1];
+                } else if( b.hi <= a.lo ) {
+                    *current_expr = is_min ? x->m_args[1] : x->m_args[0];
+                }
+            }
+        }
+
+        void replace_IntegerBinOp(ASR::IntegerBinOp_t* x) {
+            ASR::BaseExprReplacer<ValueRangeReplacer>::replace_IntegerBinOp(x);
+            if( x->m_value != nullptr || env.empty() ||
+                x->m_op != ASR::binopType::Div ) {
+                return;
+            }
+            // e / 2**k  ->  shiftr(e, k) once e is provably non-negative
+            int64_t divisor = 0;
+            if( !ASRUtils::is_value_constant(
+                    ASRUtils::expr_value(x->m_right), divisor) ||
+                divisor <= 1 || (divisor & (divisor - 1)) != 0 ) {
+                return;
+            }
+            Interval dividend;
+            if( !expr_interval(x->m_left, env, dividend) || dividend.lo < 0 ) {
+                return;
+            }
+            int64_t shift = 0;
+            while( (int64_t(1) << shift) < divisor ) {
+                shift++;
+            }
+            ASR::expr_t* shift_expr = ASRUtils::EXPR(ASR::make_IntegerConstant_t(
+                al, x->base.base.loc, shift, x->m_type));
+            *current_expr = ASRUtils::EXPR(ASR::make_IntegerBinOp_t(
+                al, x->base.base.loc, x->m_left, ASR::binopType::BitRShift,
+                shift_expr, x->m_type, nullptr));
+        }
+};
+
+// Detects writes to the loop variable inside the body (assignment, or
+// being handed to a call that may modify it); such a variable gets no
+// interval
+class LoopVarModificationDetector:
+    public ASR::BaseWalkVisitor<LoopVarModificationDetector> {
+    public:
+
+        ASR::symbol_t* sym;
+        bool modified = false;
+
+        LoopVarModificationDetector(ASR::symbol_t* sym_): sym(sym_) {}
+
+        void visit_Assignment(const ASR::Assignment_t& x) {
+            if( is_a<ASR::Var_t>(*x.m_target) &&
+                down_cast<ASR::Var_t>(x.m_target)->m_v == sym ) {
+                modified = true;
+            }
+            ASR::BaseWalkVisitor<LoopVarModificationDetector>
+                ::visit_Assignment(x);
+        }
+
+        void visit_SubroutineCall(const ASR::SubroutineCall_t& x) {
+            for( size_t i = 0; i < x.n_args; i++ ) {
+                if( x.m_args[i].m_value &&
+                    is_a<ASR::Var_t>(*x.m_args[i].m_value) &&
+                    down_cast<ASR::Var_t>(x.m_args[i].m_value)->m_v == sym ) {
+                    modified = true;
+                }
+            }
+            ASR::BaseWalkVisitor<LoopVarModificationDetector>
+                ::visit_SubroutineCall(x);
+        }
+};
+
+class ValueRangeVisitor:
+    public ASR::CallReplacerOnExpressionsVisitor<ValueRangeVisitor>
+{
+    public:
+
+        Allocator& al;
+        std::map<ASR::symbol_t*, Interval> env;
+        ValueRangeReplacer replacer;
+
+        ValueRangeVisitor(Allocator& al_):
+            al(al_), replacer(al_, env) {}
+
+        void call_replacer() {
+            replacer.current_expr = current_expr;
+            replacer.replace_expr(*current_expr);
+        }
+
+        void visit_DoLoop(const ASR::DoLoop_t& x) {
+            ASR::symbol_t* sym = nullptr;
+            bool have_interval = false;
+            Interval saved = {0, 0};
+            bool had_entry = false;
+            int64_t start = 0, end = 0, increment = 1;
+            if( x.m_head.m_v && is_a<ASR::Var_t>(*x.m_head.m_v) &&
+                ASRUtils::is_value_constant(
+                    ASRUtils::expr_value(x.m_head.m_start), start) &&
+                ASRUtils::is_value_constant(
+                    ASRUtils::expr_value(x.m_head.m_end), end) &&
+                (x.m_head.m_increment == nullptr ||
+                 ASRUtils::is_value_constant(
+                     ASRUtils::expr_value(x.m_head.m_increment), increment)) &&
+                increment != 0 &&
+                in_limits(std::min(start, end), std::max(start, end)) ) {
+                sym = down_cast<ASR::Var_t>(x.m_head.m_v)->m_v;
+                LoopVarModificationDetector detector(sym);
+                for( size_t i = 0; i < x.n_body; i++ ) {
+                    detector.visit_stmt(*x.m_body[i]);
+                }
+                if( !detector.modified ) {
+                    auto it = env.find(sym);
+                    if( it != env.end() ) {
+                        saved = it->second;
+                        had_entry = true;
+                    }
+                    env[sym] = {std::min(start, end), std::max(start, end)};
+                    have_interval = true;
+                }
+            }
+            ASR::CallReplacerOnExpressionsVisitor<ValueRangeVisitor>
+                ::visit_DoLoop(x);
+            if( have_interval ) {
+                if( had_entry ) {
+                    env[sym] = saved;
+                } else {
+                    env.erase(sym);
+                }
+            }
+        }
+};
+
+void pass_value_range_opt(Allocator &al, ASR::TranslationUnit_t &unit,
+                          const PassOptions &pass_options) {
+    if( !pass_options.fast ) {
+        // Registered before do_loops so that loop ranges are still
+        // visible, but it is an optimization and must not change the
+        // default output
+        return ;
+    }
+    ValueRangeVisitor v(al);
+    v.visit_TranslationUnit(unit);
+    PassUtils::UpdateDependenciesVisitor u(al);
+    u.visit_TranslationUnit(unit);
+}
+
+} // namespace LCompilers
@@ -5,6 +5,9 @@
 #include <libasr/asr_verify.h>
 #include <libasr/pass/pass_utils.h>
 #include <libasr/pass/replace_where.h>
+#include <libasr/pass/intrinsic_function_registry.h>
+
+#include <set>
 
 
 namespace LCompilers {
@@ -13,6 +16,25 @@ namespace LCompilers {
 This ASR pass replaces where with do loops and array expression assignments.
 The function `pass_replace_where` transforms the ASR tree in-place.
 
+When every statement of the construct is a plain assignment whose right
+hand side is safe to evaluate for masked-off elements, the construct is
+lowered branchlessly instead:
+
+    where(m)
+        a = x
+    else where
+        a = y
+    endwhere
+
+becomes
+
+    a = merge(x, a, m)
+    a = merge(a, y, m)
+
+which the array_op pass fuses into single select-style passes over the
+data, avoiding the per-element branch. Constructs that do not qualify
+(calls, divisions, nested where, ...) fall back to:
+
 Converts:
 
     where(a > b)
@@ -36,6 +58,16 @@ to:
     end do
 */
 
+class MaskDependencyCollector: public ASR::BaseWalkVisitor<MaskDependencyCollector> {
+    public:
+
+    std::set<ASR::symbol_t*> symbols;
+
+    void visit_Var(const ASR::Var_t& x) {
+        symbols.insert(x.m_v);
+    }
+};
+
 class TransformWhereVisitor: public ASR::CallReplacerOnExpressionsVisitor<TransformWhereVisitor> {
     private:
 
@@ -74,6 +106,154 @@ class TransformWhereVisitor: public ASR::CallReplacerOnExpressionsVisitor<Transf
         pass_result.n = 0;
     }
 
+    // Conservative check that evaluating `expr` for masked-off elements
+    // cannot trap: plain data references, numeric constants and
+    // non-trapping arithmetic only. Divisions, exponentiation, indexing
+    // and calls may only be evaluated where the mask is true
+    // (F2018 10.2.3.2), so they keep the branchy lowering.
+    bool is_speculation_safe(ASR::expr_t* expr) {
+        switch( expr->type ) {
+            case ASR::exprType::Var:
+            case ASR::exprType::IntegerConstant:
+            case ASR::exprType::RealConstant:
+            case ASR::exprType::ComplexConstant:
+            case ASR::exprType::LogicalConstant: {
+                return true;
+            }
+            case ASR::exprType::IntegerBinOp: {
+                ASR::IntegerBinOp_t* binop = ASR::down_cast<ASR::IntegerBinOp_t>(expr);
+                return (binop->m_op == ASR::binopType::Add ||
+                        binop->m_op == ASR::binopType::Sub ||
+                        binop->m_op == ASR::binopType::Mul) &&
+                       is_speculation_safe(binop->m_left) &&
+                       is_speculation_safe(binop->m_right);
+            }
+            case ASR::exprType::RealBinOp: {
+                ASR::RealBinOp_t* binop = ASR::down_cast<ASR::RealBinOp_t>(expr);
+                return (binop->m_op == ASR::binopType::Add ||
+                        binop->m_op == ASR::binopType::Sub ||
+                        binop->m_op == ASR::binopType::Mul) &&
+                       is_speculation_safe(binop->m_left) &&
+                       is_speculation_safe(binop->m_right);
+            }
+            case ASR::exprType::IntegerUnaryMinus: {
+                return is_speculation_safe(
+                    ASR::down_cast<ASR::IntegerUnaryMinus_t>(expr)->m_arg);
+            }
+            case ASR::exprType::RealUnaryMinus: {
+                return is_speculation_safe(
+                    ASR::down_cast<ASR::RealUnaryMinus_t>(expr)->m_arg);
+            }
+            case ASR::exprType::Cast: {
+                ASR::Cast_t* cast = ASR::down_cast<ASR::Cast_t>(expr);
+                return (cast->m_kind == ASR::cast_kindType::IntegerToInteger ||
+                        cast->m_kind == ASR::cast_kindType::IntegerToReal ||
+                        cast->m_kind == ASR::cast_kindType::RealToReal) &&
+                       is_speculation_safe(cast->m_arg);
+            }
+            case ASR::exprType::ArrayBroadcast: {
+                return is_speculation_safe(
+                    ASR::down_cast<ASR::ArrayBroadcast_t>(expr)->m_array);
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    bool is_maskable_assignment(ASR::stmt_t* stmt) {
+        if( !ASR::is_a<ASR::Assignment_t>(*stmt) ) {
+            return false;
+        }
+        ASR::Assignment_t* assignment = ASR::down_cast<ASR::Assignment_t>(stmt);
+        if( assignment->m_overloaded != nullptr ||
+            !ASR::is_a<ASR::Var_t>(*assignment->m_target) ||
+            !ASRUtils::is_array(ASRUtils::expr_type(assignment->m_target)) ||
+            !is_speculation_safe(assignment->m_value) ) {
+            return false;
+        }
+        ASR::ttype_t* el_type = ASRUtils::extract_type(
+            ASRUtils::expr_type(assignment->m_target));
+        return ASR::is_a<ASR::Integer_t>(*el_type) ||
+               ASR::is_a<ASR::Real_t>(*el_type) ||
+               ASR::is_a<ASR::Complex_t>(*el_type) ||
+               ASR::is_a<ASR::Logical_t>(*el_type);
+    }
+
+    ASR::stmt_t* make_masked_assignment(ASR::Assignment_t* assignment,
+        ASR::expr_t* mask, bool mask_selects_value) {
+        ASRUtils::ExprStmtDuplicator duplicator(al);
+        ASR::expr_t* target_read = duplicator.duplicate_expr(assignment->m_target);
+        // a scalar value appears as ArrayBroadcast in the where body; pass
+        // the scalar itself, the way the frontend represents merge(10, a, m),
+        // so the elemental lowering broadcasts it instead of choking on the
+        // wrapped node
+        ASR::expr_t* value = ASRUtils::get_past_array_broadcast(assignment->m_value);
+        Vec<ASR::expr_t*> merge_args; merge_args.reserve(al, 3);
+        if( mask_selects_value ) {
+            merge_args.push_back(al, value);
+            merge_args.push_back(al, target_read);
+        } else {
+            merge_args.push_back(al, target_read);
+            merge_args.push_back(al, value);
+        }
+        merge_args.push_back(al, duplicator.duplicate_expr(mask));
+        // construct the node exactly like the frontend does for
+        // merge(x, a, m): plain arguments and no physical casts, which is
+        // the shape the elemental lowering in array_op expects
+        ASR::expr_t* merge = ASRUtils::EXPR(ASR::make_IntrinsicElementalFunction_t(
+            al, assignment->base.base.loc,
+            static_cast<int64_t>(ASRUtils::IntrinsicElementalFunctions::Merge),
+            merge_args.p, merge_args.size(), 0,
+            ASRUtils::type_get_past_allocatable_pointer(
+                ASRUtils::expr_type(assignment->m_target)), nullptr));
+        return ASRUtils::STMT(ASR::make_Assignment_t(al, assignment->base.base.loc,
+            assignment->m_target, merge, nullptr, assignment->m_realloc_lhs,
+            assignment->m_move_allocation));
+    }
+
+    // Lowers an eligible construct to one merge-assignment per
+    // statement; returns false (emitting nothing) when any statement
+    // disqualifies it.
+    bool transform_Where_to_masked_assignments(const ASR::Where_t& x) {
+        for( ASR::stmt_t** body: {x.m_body, x.m_orelse} ) {
+            size_t n = (body == x.m_body) ? x.n_body : x.n_orelse;
+            for( size_t i = 0; i < n; i++ ) {
+                if( !is_maskable_assignment(body[i]) ) {
+                    return false;
+                }
+            }
+        }
+        if( x.n_body + x.n_orelse > 1 ) {
+            // the mask is evaluated once on entry to the construct
+            // (F2018 10.2.3.2); re-evaluating it per statement is only
+            // valid when no statement assigns a variable the mask reads
+            MaskDependencyCollector mask_deps;
+            mask_deps.visit_expr(*x.m_test);
+            for( ASR::stmt_t** body: {x.m_body, x.m_orelse} ) {
+                size_t n = (body == x.m_body) ? x.n_body : x.n_orelse;
+                for( size_t i = 0; i < n; i++ ) {
+                    ASR::Assignment_t* assignment =
+                        ASR::down_cast<ASR::Assignment_t>(body[i]);
+                    ASR::symbol_t* target_sym =
+                        ASR::down_cast<ASR::Var_t>(assignment->m_target)->m_v;
+                    if( mask_deps.symbols.count(target_sym) > 0 ) {
+                        return false;
+                    }
+                }
+            }
+        }
+        for( size_t i = 0; i < x.n_body; i++ ) {
+            pass_result.push_back(al, make_masked_assignment(
+                ASR::down_cast<ASR::Assignment_t>(x.m_body[i]), x.m_test, true));
+        }
+        for( size_t i = 0; i < x.n_orelse; i++ ) {
+            pass_result.push_back(al, make_masked_assignment(
+                ASR::down_cast<ASR::Assignment_t>(x.m_orelse[i]), x.m_test, false));
+        }
+        return true;
+    }
+
     ASR::stmt_t* transform_Where_to_If(const ASR::Where_t& x) {
         Vec<ASR::stmt_t*> or_else_vec; or_else_vec.reserve(al, x.n_orelse);
         Vec<ASR::stmt_t*> body_vec; body_vec.reserve(al, x.n_body);
@@ -107,6 +287,9 @@ class TransformWhereVisitor: public ASR::CallReplacerOnExpressionsVisitor<Transf
     }
 
     void visit_Where(const ASR::Where_t& x) {
+        if( transform_Where_to_masked_assignments(x) ) {
+            return ;
+        }
         ASR::stmt_t* if_stmt = transform_Where_to_If(x);
         pass_result.push_back(al, if_stmt);
     }
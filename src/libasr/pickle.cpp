@@ -1,5 +1,6 @@
 #include <libasr/asr.h>
 #include <libasr/location.h>
+#include <libasr/pickle.h>
 #include <libasr/asr_utils.h>
 #include <libasr/pass/intrinsic_function_registry.h>
 #include <libasr/pass/intrinsic_subroutine_registry.h>
@@ -16,10 +17,34 @@ class ASRPickleVisitor :
 {
 public:
     bool show_intrinsic_modules;
+    // When set, the buffered dump is written to this sink whenever the buffer
+    // grows past flush_threshold. The generated visitor only ever appends to
+    // `s`, so partial output can be flushed at any point of the traversal;
+    // this keeps peak memory bounded when dumping very large trees.
+    std::ostream *out = nullptr;
+    static constexpr std::size_t flush_threshold = 64*1024;
 
     std::string get_str() {
         return s;
     }
+    void maybe_flush() {
+        if (out && s.size() >= flush_threshold) {
+            out->write(s.data(), s.size());
+            s.clear();
+        }
+    }
+    void visit_expr(const ASR::expr_t &x) {
+        ASR::PickleBaseVisitor<ASRPickleVisitor>::visit_expr(x);
+        maybe_flush();
+    }
+    void visit_stmt(const ASR::stmt_t &x) {
+        ASR::PickleBaseVisitor<ASRPickleVisitor>::visit_stmt(x);
+        maybe_flush();
+    }
+    void visit_ttype(const ASR::ttype_t &x) {
+        ASR::PickleBaseVisitor<ASRPickleVisitor>::visit_ttype(x);
+        maybe_flush();
+    }
     void visit_symbol(const ASR::symbol_t &x) {
         s.append(ASRUtils::symbol_parent_symtab(&x)->get_counter());
         s.append(" ");
@@ -215,6 +240,23 @@ std::string pickle(ASR::TranslationUnit_t &asr, bool colors, bool indent, bool s
     return pickle((ASR::asr_t &)asr, colors, indent, show_intrinsic_modules, clojure);
 }
 
+void pickle(std::ostream &out, ASR::asr_t &asr, bool colors, bool indent,
+        bool show_intrinsic_modules, bool clojure) {
+    ASRPickleVisitor v;
+    v.use_colors = colors;
+    v.indent = indent;
+    v.show_intrinsic_modules = show_intrinsic_modules;
+    v.clojure = clojure;
+    v.out = &out;
+    v.visit_asr(asr);
+    out.write(v.s.data(), v.s.size());
+}
+
+void pickle(std::ostream &out, ASR::TranslationUnit_t &asr, bool colors,
+        bool indent, bool show_intrinsic_modules, bool clojure) {
+    pickle(out, (ASR::asr_t &)asr, colors, indent, show_intrinsic_modules, clojure);
+}
+
 /********************** ASR Pickle Tree *******************/
 class ASRTreeVisitor :
     public ASR::TreeBaseVisitor<ASRTreeVisitor>
@@ -1,6 +1,8 @@
 #ifndef LIBASR_PICKLE_H
 #define LIBASR_PICKLE_H
 
+#include <ostream>
+
 #include <libasr/asr.h>
 #include <libasr/location.h>
 
@@ -12,6 +14,14 @@ namespace LCompilers {
     std::string pickle(ASR::TranslationUnit_t &asr, bool colors=false,
             bool indent=false, bool show_intrinsic_modules=false, bool clojure=false);
 
+    // Pickle an ASR node, streaming the output into `out` as it is produced.
+    // Peak memory stays bounded by the flush buffer instead of the whole dump,
+    // which matters when dumping very large trees with --show-asr.
+    void pickle(std::ostream &out, ASR::asr_t &asr, bool colors=false,
+            bool indent=false, bool show_intrinsic_modules=false, bool clojure=false);
+    void pickle(std::ostream &out, ASR::TranslationUnit_t &asr, bool colors=false,
+            bool indent=false, bool show_intrinsic_modules=false, bool clojure=false);
+
     // Print the tree structure
     std::string pickle_tree(ASR::asr_t &asr, bool colors, bool show_intrinsic_modules=false);
     std::string pickle_tree(ASR::TranslationUnit_t &asr, bool colors, bool show_intrinsic_modules=false);
@@ -0,0 +1,42 @@
+#include <libasr/profiler.h>
+
+namespace LCompilers {
+
+namespace {
+
+// Event names are internal phase and pass names; escaping quotes,
+// backslashes and newlines is enough to keep the output valid JSON.
+std::string json_escape(const std::string &s) {
+    std::string r;
+    r.reserve(s.size());
+    for (char c : s) {
+        switch (c) {
+            case '"': r += "\\\""; break;
+            case '\\': r += "\\\\"; break;
+            case '\n': r += "\\n"; break;
+            default: r += c;
+        }
+    }
+    return r;
+}
+
+} // anonymous namespace
+
+void write_chrome_trace(std::ostream &out,
+        const std::vector<ProfileEvent> &events) {
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const ProfileEvent &e : events) {
+        if (!first) out << ",";
+        first = false;
+        out << "\n{\"name\":\"" << json_escape(e.name)
+            << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+            << ",\"ts\":" << e.start_us
+            << ",\"dur\":" << e.duration_us
+            << ",\"args\":{\"allocator_bytes\":" << e.allocator_bytes
+            << "}}";
+    }
+    out << "\n]}\n";
+}
+
+} // namespace LCompilers
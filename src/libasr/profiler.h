@@ -0,0 +1,63 @@
+#ifndef LIBASR_PROFILER_H
+#define LIBASR_PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <libasr/alloc.h>
+#include <libasr/utils.h>
+
+namespace LCompilers {
+
+// Microseconds since the first use of the profiler in this process. All
+// ProfileEvent timestamps share this epoch, so the events of one
+// compilation line up on a common timeline.
+inline uint64_t profiler_now_us() {
+    static const auto t0 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0).count();
+}
+
+// RAII scope that appends a ProfileEvent to `po.profile_events` when
+// --time-trace is enabled (po.time_trace), and is a cheap no-op
+// otherwise. When an allocator is attached, the event also records how
+// many bytes the scope allocated in it.
+class ProfileScope {
+public:
+    ProfileScope(PassOptions &po, std::string name, Allocator *al = nullptr)
+            : po{po}, name{std::move(name)}, al{al} {
+        if (!po.time_trace) return;
+        bytes0 = al ? al->size_allocated() : 0;
+        start_us = profiler_now_us();
+    }
+    ~ProfileScope() {
+        if (!po.time_trace) return;
+        ProfileEvent e;
+        e.name = std::move(name);
+        e.start_us = start_us;
+        e.duration_us = profiler_now_us() - start_us;
+        e.allocator_bytes = al ? al->size_allocated() - bytes0 : 0;
+        po.profile_events.push_back(std::move(e));
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+private:
+    PassOptions &po;
+    std::string name;
+    Allocator *al;
+    uint64_t bytes0 = 0;
+    uint64_t start_us = 0;
+};
+
+// Writes the events in the Chrome trace-event format (complete "X"
+// events); the result can be opened in chrome://tracing or Perfetto.
+void write_chrome_trace(std::ostream &out,
+    const std::vector<ProfileEvent> &events);
+
+} // namespace LCompilers
+
+#endif // LIBASR_PROFILER_H
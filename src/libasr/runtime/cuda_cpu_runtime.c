@@ -70,6 +70,41 @@ cudaError_t cudaMemcpy(void *dst, const void *src, size_t count, int kind) {
     return cudaSuccess;
 }
 
+cudaError_t cudaMemcpyAsync(void *dst, const void *src, size_t count,
+                            int kind, cudaStream_t stream) {
+    // Copies complete immediately on the CPU; the stream is irrelevant
+    (void)stream;
+    return cudaMemcpy(dst, src, count, kind);
+}
+
+cudaError_t cudaHostAlloc(void **ptr, size_t size, unsigned int flags) {
+    // There is no page-locking to do on the CPU; a plain allocation has
+    // the same semantics
+    (void)flags;
+    *ptr = malloc(size);
+    return *ptr ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+cudaError_t cudaFreeHost(void *ptr) {
+    free(ptr);
+    return cudaSuccess;
+}
+
+cudaError_t cudaStreamCreate(cudaStream_t *stream) {
+    *stream = NULL;
+    return cudaSuccess;
+}
+
+cudaError_t cudaStreamDestroy(cudaStream_t stream) {
+    (void)stream;
+    return cudaSuccess;
+}
+
+cudaError_t cudaStreamSynchronize(cudaStream_t stream) {
+    (void)stream;
+    return cudaSuccess;
+}
+
 cudaError_t cudaDeviceSynchronize(void) {
     // No-op for CPU implementation
     return cudaSuccess;
@@ -30,10 +30,22 @@ extern __thread uint3 blockIdx;
 extern __thread dim3 blockDim;
 extern __thread dim3 gridDim;
 
+// Streams (CPU emulation: copies and kernels already run in order, so a
+// stream is just an opaque handle and synchronization is a no-op)
+typedef void* cudaStream_t;
+cudaError_t cudaStreamCreate(cudaStream_t *stream);
+cudaError_t cudaStreamDestroy(cudaStream_t stream);
+cudaError_t cudaStreamSynchronize(cudaStream_t stream);
+
 // Memory management API
 cudaError_t cudaMalloc(void **devPtr, size_t size);
 cudaError_t cudaFree(void *devPtr);
 cudaError_t cudaMemcpy(void *dst, const void *src, size_t count, int kind);
+cudaError_t cudaMemcpyAsync(void *dst, const void *src, size_t count,
+                            int kind, cudaStream_t stream);
+// Pinned host memory degenerates to ordinary allocations on the CPU
+cudaError_t cudaHostAlloc(void **ptr, size_t size, unsigned int flags);
+cudaError_t cudaFreeHost(void *ptr);
 cudaError_t cudaDeviceSynchronize(void);
 
 // Memory copy kinds
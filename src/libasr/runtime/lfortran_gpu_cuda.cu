@@ -14,6 +14,21 @@ extern "C" {
 
 #define MAX_ARGS 32
 #define MAX_KERNELS 64
+#define MAX_RESIDENT 256
+
+// Buffers up to this size are carved out of a shared device arena and have
+// their uploads coalesced; larger ones get a dedicated cudaMalloc and move
+// individually (a staging memcpy would cost more than the latency it saves).
+#define SMALL_BUFFER_MAX (64 * 1024)
+#define ARENA_CHUNK_BYTES (8 * 1024 * 1024)
+#define ARENA_ALIGN 256
+
+// Pinned staging pool size classes: 4 KiB .. 16 MiB, powers of two.
+#define PINNED_MIN_LOG2 12
+#define PINNED_N_CLASSES 13
+
+#define MAX_PENDING_UPLOADS 64
+#define STAGING_BYTES (1024 * 1024)
 
 typedef void (*kernel_func_t)(void);
 
@@ -41,8 +56,297 @@ typedef struct scalar_arg {
 
 struct lfortran_gpu_ctx {
     int device_id;
+    cudaStream_t stream;      // compute: kernel launches
+    cudaStream_t copy_stream; // dedicated copy engine: H2D/D2H transfers
+    cudaEvent_t copy_done;    // orders uploads before the launches that use them
 };
 
+// ---------------------------------------------------------------------------
+// Pinned staging pool. cudaMemcpyAsync is only truly asynchronous from
+// page-locked memory, so small transfers are staged through pinned blocks
+// drawn from per-size-class free lists; pinning is expensive, so blocks are
+// recycled instead of allocated per transfer. Oversized requests get a
+// dedicated registration that is returned to CUDA on release.
+// ---------------------------------------------------------------------------
+typedef struct pinned_block {
+    void *ptr;
+    size_t capacity;
+    int size_class; // index into pinned_free; -1 = oversized, not pooled
+    struct pinned_block *next;
+} pinned_block;
+
+static pinned_block *pinned_free[PINNED_N_CLASSES];
+// Staging blocks whose copies are still queued; retired at the next sync.
+static pinned_block *staging_in_flight = NULL;
+
+static pinned_block* pinned_acquire(size_t size) {
+    int cls = 0;
+    size_t cap = (size_t)1 << PINNED_MIN_LOG2;
+    while (cls < PINNED_N_CLASSES && cap < size) {
+        cls++;
+        cap <<= 1;
+    }
+    if (cls < PINNED_N_CLASSES && pinned_free[cls]) {
+        pinned_block *b = pinned_free[cls];
+        pinned_free[cls] = b->next;
+        b->next = NULL;
+        return b;
+    }
+    pinned_block *b = (pinned_block*)malloc(sizeof(pinned_block));
+    b->capacity = cls < PINNED_N_CLASSES ? cap : size;
+    b->size_class = cls < PINNED_N_CLASSES ? cls : -1;
+    b->next = NULL;
+    cudaError_t err = cudaHostAlloc(&b->ptr, b->capacity, cudaHostAllocDefault);
+    if (err != cudaSuccess) {
+        fprintf(stderr, "lfortran_gpu: cudaHostAlloc failed: %s\n",
+            cudaGetErrorString(err));
+        exit(1);
+    }
+    return b;
+}
+
+static void pinned_release(pinned_block *b) {
+    if (!b) return;
+    if (b->size_class < 0) {
+        cudaFreeHost(b->ptr);
+        free(b);
+        return;
+    }
+    b->next = pinned_free[b->size_class];
+    pinned_free[b->size_class] = b;
+}
+
+// ---------------------------------------------------------------------------
+// Device arena for small buffers. Bump-allocating them from shared chunks
+// makes buffers uploaded together contiguous on the device, so a batch of
+// halo-sized arrays moves in one cudaMemcpyAsync instead of one per array;
+// the same chunk granularity coalesces the downloads at sync points.
+// ---------------------------------------------------------------------------
+typedef struct arena_chunk {
+    void *base;
+    size_t used;
+    struct arena_chunk *next;
+    pinned_block *download_staging; // transient, used inside lfortran_gpu_sync
+} arena_chunk;
+
+static arena_chunk *arena_head = NULL;
+
+static void* arena_alloc(size_t size, arena_chunk **out_chunk) {
+    size_t aligned = (size + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1);
+    if (!arena_head || arena_head->used + aligned > ARENA_CHUNK_BYTES) {
+        arena_chunk *c = (arena_chunk*)calloc(1, sizeof(arena_chunk));
+        cudaError_t err = cudaMalloc(&c->base, ARENA_CHUNK_BYTES);
+        if (err != cudaSuccess) {
+            fprintf(stderr, "lfortran_gpu: cudaMalloc (arena) failed: %s\n",
+                cudaGetErrorString(err));
+            exit(1);
+        }
+        c->next = arena_head;
+        arena_head = c;
+    }
+    void *p = (char*)arena_head->base + arena_head->used;
+    arena_head->used += aligned;
+    *out_chunk = arena_head;
+    return p;
+}
+
+// ---------------------------------------------------------------------------
+// Upload batch. Small uploads accumulate in one pinned staging block and are
+// flushed on the copy stream right before the next launch; runs of items
+// whose device destinations are contiguous (the common case, thanks to the
+// arena) collapse into a single transfer.
+// ---------------------------------------------------------------------------
+typedef struct pending_upload {
+    void *dst;
+    size_t size;
+    size_t off; // offset in the staging block
+} pending_upload;
+
+static struct {
+    pinned_block *staging;
+    size_t staged_bytes;
+    pending_upload items[MAX_PENDING_UPLOADS];
+    int n;
+    int any_direct; // large uploads queued directly on the copy stream
+} upload_batch;
+
+static void flush_uploads(lfortran_gpu_ctx *ctx) {
+    if (upload_batch.n > 0) {
+        int i = 0;
+        while (i < upload_batch.n) {
+            // Extend the run while device and staging offsets advance in
+            // lockstep, then move the whole run with one transfer.
+            int j = i + 1;
+            while (j < upload_batch.n &&
+                    (char*)upload_batch.items[j].dst ==
+                        (char*)upload_batch.items[i].dst +
+                        (upload_batch.items[j].off - upload_batch.items[i].off)) {
+                j++;
+            }
+            size_t run_bytes = (upload_batch.items[j - 1].off
+                - upload_batch.items[i].off) + upload_batch.items[j - 1].size;
+            cudaError_t err = cudaMemcpyAsync(upload_batch.items[i].dst,
+                (char*)upload_batch.staging->ptr + upload_batch.items[i].off,
+                run_bytes, cudaMemcpyHostToDevice, ctx->copy_stream);
+            if (err != cudaSuccess) {
+                fprintf(stderr, "lfortran_gpu: cudaMemcpyAsync H2D failed: %s\n",
+                    cudaGetErrorString(err));
+                exit(1);
+            }
+            i = j;
+        }
+        upload_batch.n = 0;
+    }
+    if (upload_batch.staging) {
+        // The copies still reference the staging block; retire it at the
+        // next sync point.
+        upload_batch.staging->next = staging_in_flight;
+        staging_in_flight = upload_batch.staging;
+        upload_batch.staging = NULL;
+        upload_batch.staged_bytes = 0;
+    }
+    if (upload_batch.any_direct || staging_in_flight) {
+        // Make the compute stream wait for everything queued on the copy
+        // stream; uploads for the next region may still overlap the kernels
+        // of the current one.
+        cudaEventRecord(ctx->copy_done, ctx->copy_stream);
+        cudaStreamWaitEvent(ctx->stream, ctx->copy_done, 0);
+        upload_batch.any_direct = 0;
+    }
+}
+
+// Device-residency cache. Buffers uploaded for one kernel stay allocated
+// (and, between sync points, valid) on the device, so a chain of offloaded
+// loops over the same arrays pays for the PCIe transfers once instead of
+// once per launch. Ownership rules:
+//   - device_valid: the device copy is current; set_buffer_arg skips the
+//     upload. Cleared at every sync point, because the host may write the
+//     array afterwards and we have no way to observe that.
+//   - device_dirty: a kernel may have written the buffer since the last
+//     download; lfortran_gpu_sync copies it back and clears the flag.
+typedef struct resident_buf {
+    void *host_ptr;
+    void *device_ptr;
+    size_t capacity;    // bytes allocated on the device
+    size_t size;        // bytes of the current mapping
+    arena_chunk *chunk; // owning arena chunk, NULL for dedicated cudaMalloc
+    int device_valid;
+    int device_dirty;
+} resident_buf;
+
+static resident_buf resident[MAX_RESIDENT];
+static int n_resident = 0;
+
+static resident_buf* resident_find(void *host_ptr) {
+    for (int i = 0; i < n_resident; i++) {
+        if (resident[i].host_ptr == host_ptr) return &resident[i];
+    }
+    return NULL;
+}
+
+// Queues the host -> device upload for one mapping: small buffers are staged
+// into the pinned batch, large ones go straight onto the copy stream.
+static void stage_upload(lfortran_gpu_ctx *ctx, resident_buf *e) {
+    if (e->size > SMALL_BUFFER_MAX) {
+        cudaError_t err = cudaMemcpyAsync(e->device_ptr, e->host_ptr, e->size,
+            cudaMemcpyHostToDevice, ctx->copy_stream);
+        if (err != cudaSuccess) {
+            fprintf(stderr, "lfortran_gpu: cudaMemcpyAsync H2D failed: %s\n",
+                cudaGetErrorString(err));
+            exit(1);
+        }
+        upload_batch.any_direct = 1;
+        return;
+    }
+    size_t aligned_off = (upload_batch.staged_bytes + (ARENA_ALIGN - 1))
+        & ~(size_t)(ARENA_ALIGN - 1);
+    if (upload_batch.staging &&
+            (upload_batch.n >= MAX_PENDING_UPLOADS ||
+             aligned_off + e->size > upload_batch.staging->capacity)) {
+        flush_uploads(ctx);
+        aligned_off = 0;
+    }
+    if (!upload_batch.staging) {
+        upload_batch.staging = pinned_acquire(
+            e->size > STAGING_BYTES ? e->size : STAGING_BYTES);
+        upload_batch.staged_bytes = 0;
+        aligned_off = 0;
+    }
+    memcpy((char*)upload_batch.staging->ptr + aligned_off, e->host_ptr, e->size);
+    upload_batch.items[upload_batch.n].dst = e->device_ptr;
+    upload_batch.items[upload_batch.n].size = e->size;
+    upload_batch.items[upload_batch.n].off = aligned_off;
+    upload_batch.n++;
+    upload_batch.staged_bytes = aligned_off + e->size;
+}
+
+// Maps (host_ptr, size) to a device buffer, queuing an upload only when the
+// device copy is not already current.
+static resident_buf* resident_map(lfortran_gpu_ctx *ctx, void *host_ptr,
+    size_t size)
+{
+    resident_buf *e = resident_find(host_ptr);
+    if (e && e->capacity < size) {
+        // The host array was reallocated larger at the same address;
+        // nothing queued can still reference the old buffer smaller than
+        // a sync point ago, but be safe and drain the stream first.
+        cudaStreamSynchronize(ctx->stream);
+        if (!e->chunk) {
+            cudaFree(e->device_ptr);
+        }
+        // Arena space is only reclaimed at shutdown.
+        e->device_ptr = NULL;
+        e->capacity = 0;
+        e->chunk = NULL;
+        e->device_valid = 0;
+        e->device_dirty = 0;
+    }
+    if (!e) {
+        if (n_resident >= MAX_RESIDENT) {
+            // Evict the oldest clean entry; flush the stream so no queued
+            // kernel still uses it. Dirty entries must survive until the
+            // next sync point downloads them.
+            cudaStreamSynchronize(ctx->stream);
+            int victim = -1;
+            for (int i = 0; i < n_resident; i++) {
+                if (!resident[i].device_dirty) { victim = i; break; }
+            }
+            if (victim < 0) {
+                fprintf(stderr, "lfortran_gpu: residency cache full of "
+                    "unsynchronized buffers\n");
+                exit(1);
+            }
+            if (!resident[victim].chunk) {
+                cudaFree(resident[victim].device_ptr);
+            }
+            resident[victim] = resident[--n_resident];
+        }
+        e = &resident[n_resident++];
+        memset(e, 0, sizeof(*e));
+        e->host_ptr = host_ptr;
+    }
+    if (!e->device_ptr) {
+        if (size <= SMALL_BUFFER_MAX) {
+            e->device_ptr = arena_alloc(size, &e->chunk);
+            e->capacity = size;
+        } else {
+            cudaError_t err = cudaMalloc(&e->device_ptr, size);
+            if (err != cudaSuccess) {
+                fprintf(stderr, "lfortran_gpu: cudaMalloc failed: %s\n",
+                    cudaGetErrorString(err));
+                exit(1);
+            }
+            e->capacity = size;
+        }
+    }
+    e->size = size;
+    if (!e->device_valid) {
+        stage_upload(ctx, e);
+        e->device_valid = 1;
+    }
+    return e;
+}
+
 struct lfortran_gpu_kernel {
     kernel_func_t func;
     lfortran_gpu_ctx *ctx;
@@ -70,11 +374,50 @@ lfortran_gpu_ctx* lfortran_gpu_init(void) {
         singleton = NULL;
         return NULL;
     }
+    err = cudaStreamCreate(&singleton->stream);
+    if (err == cudaSuccess) {
+        err = cudaStreamCreate(&singleton->copy_stream);
+    }
+    if (err == cudaSuccess) {
+        err = cudaEventCreateWithFlags(&singleton->copy_done,
+            cudaEventDisableTiming);
+    }
+    if (err != cudaSuccess) {
+        fprintf(stderr, "lfortran_gpu_init: stream setup failed: %s\n",
+            cudaGetErrorString(err));
+        free(singleton);
+        singleton = NULL;
+        return NULL;
+    }
     return singleton;
 }
 
 void lfortran_gpu_shutdown(lfortran_gpu_ctx* ctx) {
     if (!ctx) return;
+    lfortran_gpu_sync(ctx);
+    for (int i = 0; i < n_resident; i++) {
+        if (!resident[i].chunk) {
+            cudaFree(resident[i].device_ptr);
+        }
+    }
+    n_resident = 0;
+    while (arena_head) {
+        arena_chunk *c = arena_head;
+        arena_head = c->next;
+        cudaFree(c->base);
+        free(c);
+    }
+    for (int cls = 0; cls < PINNED_N_CLASSES; cls++) {
+        while (pinned_free[cls]) {
+            pinned_block *b = pinned_free[cls];
+            pinned_free[cls] = b->next;
+            cudaFreeHost(b->ptr);
+            free(b);
+        }
+    }
+    cudaEventDestroy(ctx->copy_done);
+    cudaStreamDestroy(ctx->copy_stream);
+    cudaStreamDestroy(ctx->stream);
     cudaDeviceReset();
     free(ctx);
 }
@@ -108,11 +451,9 @@ lfortran_gpu_kernel* lfortran_gpu_load_kernel(
 
 void lfortran_gpu_release_kernel(lfortran_gpu_kernel* k) {
     if (!k) return;
-    // Free device buffers
+    // Device buffers belong to the residency cache, which keeps them alive
+    // across kernels; only the scalar argument copies are ours to free.
     for (int i = 0; i < k->n_args; i++) {
-        if (k->arg_is_buffer[i] && k->buffer_device_ptrs[i]) {
-            cudaFree(k->buffer_device_ptrs[i]);
-        }
         if (!k->arg_is_buffer[i] && k->scalar_args[i].data) {
             free(k->scalar_args[i].data);
         }
@@ -129,21 +470,10 @@ void lfortran_gpu_set_buffer_arg(lfortran_gpu_kernel* k, int idx,
     k->arg_is_buffer[idx] = 1;
     if (idx >= k->n_args) k->n_args = idx + 1;
 
-    // Allocate device memory and copy host → device
-    void *d_ptr = NULL;
-    cudaError_t err = cudaMalloc(&d_ptr, size);
-    if (err != cudaSuccess) {
-        fprintf(stderr, "lfortran_gpu_set_buffer_arg: cudaMalloc failed: %s\n",
-            cudaGetErrorString(err));
-        exit(1);
-    }
-    err = cudaMemcpy(d_ptr, ptr, size, cudaMemcpyHostToDevice);
-    if (err != cudaSuccess) {
-        fprintf(stderr, "lfortran_gpu_set_buffer_arg: cudaMemcpy H2D failed: %s\n",
-            cudaGetErrorString(err));
-        exit(1);
-    }
-    k->buffer_device_ptrs[idx] = d_ptr;
+    // The upload (if one is needed at all) joins the pending batch on the
+    // copy stream; flush_uploads orders it before the next launch.
+    resident_buf *e = resident_map(k->ctx, ptr, size);
+    k->buffer_device_ptrs[idx] = e->device_ptr;
 }
 
 void lfortran_gpu_set_scalar_arg(lfortran_gpu_kernel* k, int idx,
@@ -165,6 +495,10 @@ void lfortran_gpu_launch(lfortran_gpu_ctx* ctx, lfortran_gpu_kernel* k,
 {
     if (!ctx || !k) return;
 
+    // Push any pending uploads onto the copy stream and make the compute
+    // stream wait for them before the kernel runs.
+    flush_uploads(ctx);
+
     // Build the kernel argument array for cudaLaunchKernel.
     // Arguments are in order: buffer args first (device pointers),
     // then scalar args (values).
@@ -181,42 +515,99 @@ void lfortran_gpu_launch(lfortran_gpu_ctx* ctx, lfortran_gpu_kernel* k,
     dim3 gridDim(grid[0], grid[1], grid[2]);
     dim3 blockDim(block[0], block[1], block[2]);
 
+    // Asynchronous launch: the kernel is queued on the context stream and
+    // nothing is copied back here. The offload pass emits a GpuSync wherever
+    // the host next consumes the data, and lfortran_gpu_sync performs the
+    // downloads; until then the buffers stay device-resident, so the next
+    // launch over the same arrays skips the PCIe round trip entirely.
     cudaError_t err = cudaLaunchKernel(
         (const void*)k->func, gridDim, blockDim,
-        args, 0, 0);
+        args, 0, ctx->stream);
     if (err != cudaSuccess) {
         fprintf(stderr, "lfortran_gpu_launch: cudaLaunchKernel failed: %s\n",
             cudaGetErrorString(err));
         exit(1);
     }
 
-    // Synchronize and copy results back
-    err = cudaDeviceSynchronize();
+    // Any buffer the kernel saw may have been written on the device.
+    for (int i = 0; i < k->n_args; i++) {
+        if (k->arg_is_buffer[i]) {
+            resident_buf *e = resident_find(k->buffer_host_ptrs[i]);
+            if (e) e->device_dirty = 1;
+        }
+    }
+}
+
+void lfortran_gpu_sync(lfortran_gpu_ctx* ctx) {
+    if (!ctx) {
+        cudaDeviceSynchronize();
+        return;
+    }
+    flush_uploads(ctx);
+    cudaError_t err = cudaStreamSynchronize(ctx->stream);
     if (err != cudaSuccess) {
-        fprintf(stderr, "lfortran_gpu_launch: cudaDeviceSynchronize failed: %s\n",
+        fprintf(stderr, "lfortran_gpu_sync: cudaStreamSynchronize failed: %s\n",
             cudaGetErrorString(err));
         exit(1);
     }
-
-    // Copy device → host for all buffer args
-    for (int i = 0; i < k->n_args; i++) {
-        if (k->arg_is_buffer[i] && k->buffer_device_ptrs[i]) {
-            err = cudaMemcpy(k->buffer_host_ptrs[i],
-                k->buffer_device_ptrs[i],
-                k->buffer_sizes[i],
-                cudaMemcpyDeviceToHost);
+    // Download everything a kernel may have written, then hand ownership
+    // back to the host: after a sync point it may write any array, so the
+    // device copies can no longer be trusted. Dirty arena-backed buffers are
+    // fetched one chunk at a time into pinned staging and scattered to their
+    // host arrays, so N small arrays cost one transfer per chunk, not N.
+    int any_download = 0;
+    for (int i = 0; i < n_resident; i++) {
+        if (!resident[i].device_dirty) continue;
+        if (resident[i].chunk) {
+            arena_chunk *c = resident[i].chunk;
+            if (!c->download_staging) {
+                c->download_staging = pinned_acquire(c->used);
+                err = cudaMemcpyAsync(c->download_staging->ptr, c->base,
+                    c->used, cudaMemcpyDeviceToHost, ctx->copy_stream);
+                if (err != cudaSuccess) {
+                    fprintf(stderr, "lfortran_gpu_sync: cudaMemcpyAsync D2H "
+                        "failed: %s\n", cudaGetErrorString(err));
+                    exit(1);
+                }
+            }
+        } else {
+            err = cudaMemcpyAsync(resident[i].host_ptr,
+                resident[i].device_ptr, resident[i].size,
+                cudaMemcpyDeviceToHost, ctx->copy_stream);
             if (err != cudaSuccess) {
-                fprintf(stderr, "lfortran_gpu_launch: cudaMemcpy D2H failed: %s\n",
-                    cudaGetErrorString(err));
+                fprintf(stderr, "lfortran_gpu_sync: cudaMemcpyAsync D2H "
+                    "failed: %s\n", cudaGetErrorString(err));
                 exit(1);
             }
         }
+        any_download = 1;
+    }
+    if (any_download) {
+        cudaStreamSynchronize(ctx->copy_stream);
+    }
+    for (int i = 0; i < n_resident; i++) {
+        if (resident[i].device_dirty && resident[i].chunk) {
+            arena_chunk *c = resident[i].chunk;
+            size_t off = (size_t)((char*)resident[i].device_ptr
+                - (char*)c->base);
+            memcpy(resident[i].host_ptr,
+                (char*)c->download_staging->ptr + off, resident[i].size);
+        }
+        resident[i].device_dirty = 0;
+        resident[i].device_valid = 0;
+    }
+    for (arena_chunk *c = arena_head; c; c = c->next) {
+        if (c->download_staging) {
+            pinned_release(c->download_staging);
+            c->download_staging = NULL;
+        }
+    }
+    // The queued copies have drained; recycle the upload staging blocks.
+    while (staging_in_flight) {
+        pinned_block *b = staging_in_flight;
+        staging_in_flight = b->next;
+        pinned_release(b);
     }
-}
-
-void lfortran_gpu_sync(lfortran_gpu_ctx* ctx) {
-    (void)ctx;
-    cudaDeviceSynchronize();
 }
 
 } // extern "C"
@@ -88,12 +88,189 @@ LFORTRAN_API lfortran_allocator_t* _lfortran_get_default_allocator(void);
 /* Debug allocator that tracks allocations (defined in lfortran_intrinsics.c) */
 LFORTRAN_API lfortran_allocator_t* _lfortran_get_compiler_mem_dbg_allocator(void);
 
+/*
+ * Arena allocator (defined in lfortran_intrinsics.c).
+ *
+ * Allocations are bump-allocated from the innermost active region and
+ * individually deallocating them is a no-op; the whole region is released
+ * at once by _lfortran_arena_region_end. The compiler opens a region on
+ * procedure entry and closes it on exit (--arena-allocator), so the
+ * thousands of small allocate/deallocate pairs of an inner loop collapse
+ * into pointer bumps plus one bulk free. Regions nest with procedure
+ * invocations. Outside any region the allocator falls back to malloc and
+ * its deallocate does free, so program-lifetime allocations stay valid.
+ */
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_arena_allocator(void);
+LFORTRAN_API void _lfortran_arena_region_begin(void);
+LFORTRAN_API void _lfortran_arena_region_begin_suspended(void);
+LFORTRAN_API void _lfortran_arena_region_end(void);
+
+/*
+ * String spill allocator (defined in lfortran_intrinsics.c).
+ *
+ * Statement-lifetime character temporaries (concatenation, repeat) are
+ * bump-allocated from a fixed per-thread buffer instead of the heap. The
+ * compiler records a mark before a statement and releases back to it
+ * afterwards; temporaries that do not fit in the buffer spill to the heap
+ * and are freed by the release. Deallocating a buffer allocation
+ * individually is a no-op.
+ */
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_string_spill_allocator(void);
+LFORTRAN_API int64_t _lfortran_string_spill_mark(void);
+LFORTRAN_API void _lfortran_string_spill_release(int64_t mark);
+
+/*
+ * Procedure instrumentation (--instrument).
+ *
+ * The compiler emits these hooks around every procedure body. Each call
+ * records the procedure name and a timestamp in a fixed ring buffer; at
+ * program exit the buffer is replayed and a per-procedure report of
+ * inclusive time and call counts is printed to stderr.
+ */
+LFORTRAN_API void _lfortran_instrument_enter(const char* name);
+LFORTRAN_API void _lfortran_instrument_exit(const char* name);
+
+/*
+ * Data-race checker (--check-parallel).
+ *
+ * The OpenMP lowering brackets each parallel region with begin/end and
+ * reports every shared-array access from inside it; two same-address
+ * accesses from different threads within one region, at least one a
+ * write, are reported as a race with both source offsets. No-ops on
+ * Windows and WASM.
+ */
+LFORTRAN_API void _lfortran_race_check_begin(void);
+LFORTRAN_API void _lfortran_race_check_end(void);
+LFORTRAN_API void _lfortran_race_check_access(void* addr, char* name,
+        int32_t name_len, int64_t loc, int32_t is_write);
+
+/*
+ * Hardware counter regions, callable from Fortran via a bind(c)
+ * interface (pass a null-terminated name, e.g. "kernel"//c_null_char).
+ * _lfortran_perf_start opens a named region, _lfortran_perf_stop closes
+ * the innermost one; regions nest. Per region the runtime aggregates
+ * wall time plus cycles, cache misses and branch misses from
+ * perf_event_open (Linux; elsewhere wall time only) and prints a report
+ * at program exit.
+ */
+LFORTRAN_API void _lfortran_perf_start(const char* name);
+LFORTRAN_API void _lfortran_perf_stop(void);
+
+/*
+ * Memory profiling allocator (--memory-profile, defined in
+ * lfortran_intrinsics.c).
+ *
+ * Tracks per-allocation-site counts, cumulative bytes, and current and
+ * peak residency, reported at program exit sorted by peak. The compiler
+ * emits a set_site call with "file:line" before every allocate and
+ * reallocate statement; allocations made while no site is set are
+ * attributed to "(runtime)".
+ */
+LFORTRAN_API lfortran_allocator_t* _lfortran_get_memory_profile_allocator(void);
+LFORTRAN_API void _lfortran_memory_profile_set_site(const char* site);
+
+/*
+ * Threaded array intrinsic kernels (--parallel-intrinsics).
+ *
+ * Arrays are contiguous column-major data; sizes are element counts,
+ * matmul takes c(m, n) = a(m, k) * b(k, n). The kernels thread with
+ * OpenMP when the runtime is built with it and fall back to the serial
+ * loop below a size threshold (or when OpenMP is unavailable); a runtime
+ * built WITH_RUNTIME_BLAS serves matmul and dot above the threshold from
+ * sgemm/dgemm and sdot/ddot instead. minloc
+ * returns a 1-based index (0 for an empty array); pack returns the
+ * number of elements written to `out`, whose mask is default logicals.
+ */
+LFORTRAN_API void _lfortran_parallel_matmul_r32(const float* a, const float* b,
+    float* c, int64_t m, int64_t k, int64_t n);
+LFORTRAN_API void _lfortran_parallel_matmul_r64(const double* a, const double* b,
+    double* c, int64_t m, int64_t k, int64_t n);
+LFORTRAN_API float _lfortran_parallel_dot_r32(const float* a, const float* b,
+    int64_t n);
+LFORTRAN_API double _lfortran_parallel_dot_r64(const double* a, const double* b,
+    int64_t n);
+LFORTRAN_API float _lfortran_parallel_sum_r32(const float* a, int64_t n);
+LFORTRAN_API double _lfortran_parallel_sum_r64(const double* a, int64_t n);
+LFORTRAN_API float _lfortran_parallel_maxval_r32(const float* a, int64_t n);
+LFORTRAN_API double _lfortran_parallel_maxval_r64(const double* a, int64_t n);
+LFORTRAN_API int64_t _lfortran_parallel_minloc_r32(const float* a, int64_t n);
+LFORTRAN_API int64_t _lfortran_parallel_minloc_r64(const double* a, int64_t n);
+LFORTRAN_API int64_t _lfortran_parallel_pack_r32(const float* a,
+    const int32_t* mask, int64_t n, float* out);
+LFORTRAN_API int64_t _lfortran_parallel_pack_r64(const double* a,
+    const int32_t* mask, int64_t n, double* out);
+LFORTRAN_API void _lfortran_parallel_transpose_r32(const float* a, float* b,
+    int64_t m, int64_t n);
+LFORTRAN_API void _lfortran_parallel_transpose_r64(const double* a, double* b,
+    int64_t m, int64_t n);
+
+/*
+ * Vectorized elemental math kernels (--parallel-intrinsics).
+ *
+ * Array variants of the elemental sin/cos/exp/log intrinsics: one runtime
+ * call per whole-array application instead of one libm call per element.
+ * Polynomial kernels cover the common argument range; elements outside it
+ * (non-finite, denormal results, |x| >= 1e6 for sin/cos) go through libm.
+ * The real(4) variants evaluate in double precision.
+ */
+LFORTRAN_API void _lfortran_vsin_r32(float* dest, const float* src, int64_t n);
+LFORTRAN_API void _lfortran_vsin_r64(double* dest, const double* src, int64_t n);
+LFORTRAN_API void _lfortran_vcos_r32(float* dest, const float* src, int64_t n);
+LFORTRAN_API void _lfortran_vcos_r64(double* dest, const double* src, int64_t n);
+LFORTRAN_API void _lfortran_vexp_r32(float* dest, const float* src, int64_t n);
+LFORTRAN_API void _lfortran_vexp_r64(double* dest, const double* src, int64_t n);
+LFORTRAN_API void _lfortran_vlog_r32(float* dest, const float* src, int64_t n);
+LFORTRAN_API void _lfortran_vlog_r64(double* dest, const double* src, int64_t n);
+
+/*
+ * Shift kernels for cshift/eoshift along the contiguous dimension: the
+ * rotation is at most two memcpy regions per column (plus the boundary
+ * fill for eoshift) instead of per-element index arithmetic.
+ */
+LFORTRAN_API void _lfortran_cshift_dim1(void* dest, const void* src,
+    int64_t elem_size, int64_t m, int64_t ncols, int64_t shift);
+LFORTRAN_API void _lfortran_eoshift_dim1(void* dest, const void* src,
+    const void* boundary, int64_t elem_size, int64_t m, int64_t shift);
+
+/*
+ * Coarray runtime shims (--coarray).
+ *
+ * Single-image by default; a runtime built WITH_RUNTIME_MPI maps them
+ * onto MPI_COMM_WORLD and MPI-3 passive-target RMA. Images are numbered
+ * from 1. Coarray memory comes from _lfortran_caf_register, which hands
+ * back a token that put/get use to address the same registration on a
+ * remote image; offsets and sizes are in bytes.
+ */
+LFORTRAN_API int32_t _lfortran_caf_this_image(void);
+LFORTRAN_API int32_t _lfortran_caf_num_images(void);
+LFORTRAN_API void _lfortran_caf_sync_all(void);
+LFORTRAN_API void _lfortran_caf_sync_memory(void);
+LFORTRAN_API void* _lfortran_caf_register(int64_t nbytes, int64_t* token);
+LFORTRAN_API void _lfortran_caf_put(int64_t token, int64_t offset,
+    const void* src, int64_t nbytes, int32_t image);
+LFORTRAN_API void _lfortran_caf_get(int64_t token, int64_t offset,
+    void* dest, int64_t nbytes, int32_t image);
+
 /* Convenience macros for calling through an allocator */
 #define ALLOCATOR_ALLOC(a, size)          ((a)->alloc((a)->context, (size)))
 #define ALLOCATOR_REALLOC(a, ptr, size)   ((a)->realloc_func((a)->context, (ptr), (size)))
 #define ALLOCATOR_DEALLOC(a, ptr)         ((a)->dealloc((a)->context, (ptr)))
 
 LFORTRAN_API void _lfortran_enable_fpe_traps(int32_t trap_mask);
+LFORTRAN_API void _lfortran_dump_array(int32_t unit_num, const void* data,
+    int32_t type_code, int32_t elem_size, int32_t rank, const int64_t* shape);
+LFORTRAN_API void _lfortran_restore_array(int32_t unit_num, void* data,
+    int32_t type_code, int32_t elem_size, int32_t rank, const int64_t* shape);
+LFORTRAN_API int32_t _lfortran_ieee_get_flag(int32_t flag);
+LFORTRAN_API void _lfortran_ieee_set_flag(int32_t flag, int32_t flag_value);
+LFORTRAN_API int32_t _lfortran_ieee_get_rounding_mode(void);
+LFORTRAN_API void _lfortran_ieee_set_rounding_mode(int32_t mode);
+LFORTRAN_API int32_t _lfortran_ieee_get_halting_mode(int32_t flag);
+LFORTRAN_API void _lfortran_ieee_set_halting_mode(int32_t flag, int32_t halting);
+LFORTRAN_API int32_t _lfortran_ieee_get_underflow_mode(void);
+LFORTRAN_API void _lfortran_ieee_set_underflow_mode(int32_t gradual);
+LFORTRAN_API void _lfortran_ieee_get_status(int64_t* status);
+LFORTRAN_API void _lfortran_ieee_set_status(const int64_t* status);
 LFORTRAN_API void _lfortran_internal_alloc_finalize(void);
 
 /* CFI allocation helpers — used by ISO_Fortran_binding.h so that
@@ -216,6 +393,16 @@ LFORTRAN_API double _lfortran_zphase(double_complex_t x);
 int str_compare(char *s1, int64_t s1_len, char *s2, int64_t s2_len);
 LFORTRAN_API char* _lfortran_float_to_str8_alloc(lfortran_allocator_t* al, double num);
 LFORTRAN_API char* _lfortran_float_to_str4_alloc(lfortran_allocator_t* al, float num);
+// Shortest round-trip real-to-string conversion into a caller buffer
+// (at least 32 bytes per value), no allocation; returns the length.
+// The array forms write n values separated by sep into out (at least
+// 33*n bytes) and return the total bytes written.
+LFORTRAN_API int32_t _lfortran_double_to_str_roundtrip(double num, char* out);
+LFORTRAN_API int32_t _lfortran_float_to_str_roundtrip(float num, char* out);
+LFORTRAN_API int64_t _lfortran_double_array_to_str_roundtrip(
+    const double* vals, int64_t n, char sep, char* out);
+LFORTRAN_API int64_t _lfortran_float_array_to_str_roundtrip(
+    const float* vals, int64_t n, char sep, char* out);
 LFORTRAN_API char* _lfortran_int_to_str1_alloc(lfortran_allocator_t* al, int8_t num);
 LFORTRAN_API char* _lfortran_int_to_str2_alloc(lfortran_allocator_t* al, int16_t num);
 LFORTRAN_API char* _lfortran_int_to_str4_alloc(lfortran_allocator_t* al, int32_t num);
@@ -352,6 +539,19 @@ LFORTRAN_API void _lfortran_string_write(lfortran_allocator_t* al, char **str_ho
         bool is_array_unit, int64_t array_size, int64_t* len, int32_t* iostat, const char* format,
         int64_t format_len, ...);
 LFORTRAN_API void _lfortran_file_write(int32_t unit_num, int32_t* iostat, const char* format_data, int64_t format_len, ...);
+/*
+ * Asynchronous unformatted writes (asynchronous='yes').
+ *
+ * _lfortran_file_write_async copies the record into an internal queue and
+ * returns an id immediately; a background thread performs the write.
+ * _lfortran_file_wait blocks until the identified operation (id < 0: all
+ * operations on the unit) has completed and reports its status through
+ * iostat. Synchronous operations on the same unit drain the queue first,
+ * so ordering is preserved. On platforms without threads the write is
+ * performed synchronously and wait is a flush.
+ */
+LFORTRAN_API int32_t _lfortran_file_write_async(int32_t unit_num, int32_t* iostat, ...);
+LFORTRAN_API void _lfortran_file_wait(int32_t unit_num, int32_t id, int32_t* iostat);
 LFORTRAN_API void _lfortran_string_read_i8(char *str, int64_t len, char *format, int8_t *i, int32_t *iostat, int64_t *offset);
 LFORTRAN_API void _lfortran_string_read_i16(char *str, int64_t len, char *format, int16_t *i, int32_t *iostat, int64_t *offset);
 LFORTRAN_API void _lfortran_string_read_i32(char *str, int64_t len, char *format, int32_t *i, int32_t *iostat, int64_t *offset);
@@ -0,0 +1,196 @@
+#include <libasr/self_profiler.h>
+#include <libasr/config.h>
+#include <libasr/stacktrace.h>
+
+#if defined(HAVE_LFORTRAN_UNWIND) && !defined(_WIN32)
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <csignal>
+#include <sys/time.h>
+#include <unwind.h>
+
+namespace LCompilers {
+
+namespace {
+
+// The sample buffer is preallocated before the first signal arrives and
+// the handler only writes plain integers into it: no allocation, locking
+// or I/O happens in signal context
+constexpr int MAX_DEPTH = 64;
+constexpr int MAX_SAMPLES = 1 << 17;
+
+struct Sample {
+    int depth;
+    uintptr_t pc[MAX_DEPTH];
+};
+
+std::vector<Sample> *sample_buffer = nullptr;
+std::atomic<int> sample_count{0};
+bool profiler_running = false;
+struct sigaction old_action;
+struct itimerval old_timer;
+
+_Unwind_Reason_Code unwind_callback(struct _Unwind_Context *context,
+        void *arg) {
+    Sample *sample = static_cast<Sample*>(arg);
+    if (sample->depth >= MAX_DEPTH) {
+        return _URC_END_OF_STACK;
+    }
+    uintptr_t pc = _Unwind_GetIP(context);
+    if (pc != 0) {
+        sample->pc[sample->depth] = pc;
+        sample->depth++;
+    }
+    return _URC_NO_REASON;
+}
+
+void profile_signal_handler(int) {
+    int i = sample_count.fetch_add(1, std::memory_order_relaxed);
+    if (i >= MAX_SAMPLES) {
+        // Buffer full; drop the sample
+        return;
+    }
+    Sample &sample = (*sample_buffer)[i];
+    sample.depth = 0;
+    _Unwind_Backtrace(unwind_callback, &sample);
+}
+
+// Frame names become flamegraph tokens; the collapsed format reserves
+// ';' as the frame separator and ' ' before the count
+std::string sanitize_frame_name(std::string name) {
+    for (char &c : name) {
+        if (c == ';') {
+            c = ':';
+        } else if (c == ' ') {
+            c = '_';
+        }
+    }
+    return name;
+}
+
+} // anonymous namespace
+
+bool start_self_profiler() {
+    if (profiler_running) {
+        return true;
+    }
+    sample_buffer = new std::vector<Sample>(MAX_SAMPLES);
+    sample_count = 0;
+
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = profile_signal_handler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(SIGPROF, &action, &old_action) != 0) {
+        return false;
+    }
+
+    // One sample per millisecond of CPU time
+    struct itimerval timer;
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = 1000;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, &old_timer) != 0) {
+        sigaction(SIGPROF, &old_action, nullptr);
+        return false;
+    }
+    profiler_running = true;
+    return true;
+}
+
+bool stop_self_profiler(const std::string &filename) {
+    if (!profiler_running) {
+        return false;
+    }
+    setitimer(ITIMER_PROF, &old_timer, nullptr);
+    sigaction(SIGPROF, &old_action, nullptr);
+    profiler_running = false;
+
+    int n = sample_count.load();
+    if (n > MAX_SAMPLES) {
+        n = MAX_SAMPLES;
+    }
+
+    // Aggregate identical stacks first, so each distinct pc is
+    // symbolized exactly once
+    std::map<std::vector<uintptr_t>, int> stacks;
+    std::unordered_map<uintptr_t, std::string> names;
+    for (int i = 0; i < n; i++) {
+        const Sample &sample = (*sample_buffer)[i];
+        // The first frames are the handler and the signal trampoline;
+        // the interrupted function starts below them
+        const int skip = 3;
+        if (sample.depth <= skip) {
+            continue;
+        }
+        std::vector<uintptr_t> stack(sample.pc + skip,
+            sample.pc + sample.depth);
+        stacks[stack] += 1;
+        for (uintptr_t pc : stack) {
+            names.emplace(pc, "");
+        }
+    }
+    delete sample_buffer;
+    sample_buffer = nullptr;
+
+    std::vector<StacktraceItem> items;
+    items.reserve(names.size());
+    for (auto &entry : names) {
+        StacktraceItem item;
+        item.pc = entry.first;
+        items.push_back(item);
+    }
+    get_local_addresses(items);
+    get_local_info(items);
+    for (StacktraceItem &item : items) {
+        if (!item.function_name.empty()) {
+            names[item.pc] = sanitize_frame_name(item.function_name);
+        } else {
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "0x%zx", (size_t) item.pc);
+            names[item.pc] = buf;
+        }
+    }
+
+    std::ofstream out(filename);
+    for (auto &entry : stacks) {
+        const std::vector<uintptr_t> &stack = entry.first;
+        // Collapsed stacks are written root first; the unwinder
+        // produced them leaf first
+        for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+            if (it != stack.rbegin()) {
+                out << ';';
+            }
+            out << names[*it];
+        }
+        out << ' ' << entry.second << '\n';
+    }
+    return bool(out);
+}
+
+} // namespace LCompilers
+
+#else
+
+namespace LCompilers {
+
+bool start_self_profiler() {
+    return false;
+}
+
+bool stop_self_profiler(const std::string &/*filename*/) {
+    return false;
+}
+
+} // namespace LCompilers
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef LFORTRAN_SELF_PROFILER_H
+#define LFORTRAN_SELF_PROFILER_H
+
+#include <string>
+
+namespace LCompilers {
+
+// Sampling self-profiler (--self-profile): periodically captures the
+// compiler's own call stack with the stacktrace unwinder while
+// compilation runs. Returns false if sampling is not available in this
+// build or on this platform (requires WITH_UNWIND and POSIX timers).
+bool start_self_profiler();
+
+// Stops sampling and writes the aggregated samples in collapsed-stack
+// format ("frame;frame;frame count" per line) to `filename`, ready for
+// flamegraph tooling. Returns false if the profiler never started or
+// the file cannot be written.
+bool stop_self_profiler(const std::string &filename);
+
+} // namespace LCompilers
+
+#endif // LFORTRAN_SELF_PROFILER_H
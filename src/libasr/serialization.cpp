@@ -41,8 +41,8 @@ public:
 
     void visit_StringConstant(const ASR::StringConstant_t &x) {
         write_int8(x.base.type);
-        write_int64(x.base.base.loc.first);
-        write_int64(x.base.base.loc.last);
+        write_int32(x.base.base.loc.first);
+        write_int32(x.base.base.loc.last);
 
         int64_t len = 0;
         bool len_found = false;
@@ -68,6 +68,9 @@ public:
 
 std::string serialize(const ASR::asr_t &asr) {
     ASRSerializationVisitor v;
+    // Start with a generous buffer so typical units serialize without
+    // re-growing it; larger ones fall back to amortized growth.
+    v.reserve(64*1024);
     v.write_int8(asr.type);
     v.visit_asr(asr);
     return v.get_str();
@@ -86,7 +89,7 @@ class ASRDeserializationVisitor :
         public ASR::DeserializationBaseVisitor<ASRDeserializationVisitor>
 {
 public:
-    ASRDeserializationVisitor(Allocator &al, const std::string &s,
+    ASRDeserializationVisitor(Allocator &al, std::string_view s,
         bool load_symtab_id, uint32_t offset) :
 #ifdef WITH_LFORTRAN_BINARY_MODFILES
             BinaryReader(s),
@@ -95,17 +98,19 @@ public:
 #endif
             DeserializationBaseVisitor(al, load_symtab_id, offset) {}
 
+    StringInterner interner;
+
     bool read_bool() {
         uint8_t b = read_int8();
         return (b == 1);
     }
 
     char* read_cstring() {
+        // Identifiers repeat heavily inside a modfile (every use of a
+        // symbol serializes its name), so hash-cons them instead of
+        // allocating a fresh copy per occurrence.
         std::string s = read_string();
-        LCompilers::Str cs;
-        cs.from_str_view(s);
-        char* p = cs.c_str(al);
-        return p;
+        return interner.intern(al, s);
     }
 
 #define READ_SYMBOL_CASE(x)                                \
@@ -502,12 +507,12 @@ void fix_external_symbols(ASR::TranslationUnit_t &unit,
     }
 }
 
-ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
+ASR::asr_t* deserialize_asr(Allocator &al, std::string_view s,
         bool load_symtab_id, SymbolTable & /*external_symtab*/, uint32_t offset) {
     return deserialize_asr(al, s, load_symtab_id, offset);
 }
 
-ASR::asr_t* deserialize_asr(Allocator &al, const std::string &s,
+ASR::asr_t* deserialize_asr(Allocator &al, std::string_view s,
         bool load_symtab_id, uint32_t offset) {
     ASRDeserializationVisitor v(al, s, load_symtab_id, offset);
     ASR::asr_t *node = v.deserialize_node();
@@ -609,9 +609,53 @@ void show_stacktrace()
 }
 
 
+#if defined(__GNUC__) && !defined(__OPTIMIZE__) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#define HAVE_LFORTRAN_FP_WALK
+
+// Walks the saved-frame-pointer chain instead of running the DWARF
+// unwinder. Only compiled in for unoptimized builds on x86-64/AArch64,
+// where GCC and Clang keep the frame pointer by default, so every frame
+// on the stack has the [saved fp, return address] layout the walk
+// assumes. Each step is two loads, which makes capturing a trace cheap
+// enough for paths that record one on every thrown exception; the
+// expensive symbolization stays where it already is, at print time.
+static void fp_walk(std::vector<StacktraceItem> &d)
+{
+  struct Frame {
+    Frame *next;
+    void *return_address;
+  };
+  const size_t max_frames = 256;
+  // A frame's saved fp must point further up the stack, stay pointer
+  // aligned and stay within a sane frame size, otherwise the chain has
+  // ended (or was never a frame-pointer chain to begin with)
+  Frame *fp = (Frame *) __builtin_frame_address(0);
+  while (fp != nullptr && d.size() < max_frames) {
+    void *return_address = fp->return_address;
+    if (return_address == nullptr) break;
+    StacktraceItem i;
+    i.pc = (uintptr_t) return_address - 1;
+    d.push_back(i);
+    Frame *next = fp->next;
+    if (next <= fp
+        || ((uintptr_t) next - (uintptr_t) fp) > 0x100000
+        || ((uintptr_t) next % sizeof(void *)) != 0) break;
+    fp = next;
+  }
+}
+#endif // frame-pointer walk
+
 std::vector<StacktraceItem> get_stacktrace_addresses()
 {
   std::vector<StacktraceItem> d;
+#ifdef HAVE_LFORTRAN_FP_WALK
+  fp_walk(d);
+  // A one-frame result means the chain ended immediately; retry with
+  // the unwinder, which handles frames without frame pointers
+  if (d.size() > 1) return d;
+  d.clear();
+#endif
 #ifdef HAVE_LFORTRAN_UNWIND
   _Unwind_Backtrace(unwind_callback, &d);
 #endif
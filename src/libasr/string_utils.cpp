@@ -1,4 +1,6 @@
 #include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <regex>
 #include <algorithm>
 #include <string>
@@ -302,4 +304,60 @@ void rtrim(std::string& str) {
     str.erase(std::find_if_not(str.rbegin(), str.rend(), ::isspace).base(), str.end());
 }
 
+size_t find_invalid_utf8(const std::string &s) {
+    const unsigned char *p = (const unsigned char*) s.data();
+    size_t n = s.size();
+    size_t i = 0;
+    const uint64_t highs = 0x8080808080808080ULL;
+    while (i < n) {
+        // Skip runs of plain ASCII eight bytes at a time; only words with
+        // a high bit set fall through to the byte-wise validator
+        while (i + 8 <= n) {
+            uint64_t w;
+            std::memcpy(&w, p + i, 8);
+            if (w & highs) break;
+            i += 8;
+        }
+        if (i >= n) break;
+        unsigned char c = p[i];
+        if (c < 0x80) {
+            i++;
+        } else if (c >= 0xC2 && c <= 0xDF) {
+            if (i + 1 >= n || (p[i+1] & 0xC0) != 0x80) return i;
+            i += 2;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            if (i + 2 >= n
+                    || (p[i+1] & 0xC0) != 0x80 || (p[i+2] & 0xC0) != 0x80
+                    // Overlong encodings and UTF-16 surrogates
+                    || (c == 0xE0 && p[i+1] < 0xA0)
+                    || (c == 0xED && p[i+1] > 0x9F)) return i;
+            i += 3;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            if (i + 3 >= n
+                    || (p[i+1] & 0xC0) != 0x80 || (p[i+2] & 0xC0) != 0x80
+                    || (p[i+3] & 0xC0) != 0x80
+                    // Overlong encodings and code points above U+10FFFF
+                    || (c == 0xF0 && p[i+1] < 0x90)
+                    || (c == 0xF4 && p[i+1] > 0x8F)) return i;
+            i += 4;
+        } else {
+            // 0x80-0xC1 (stray continuation or overlong lead) and
+            // 0xF5-0xFF are never valid lead bytes
+            return i;
+        }
+    }
+    return std::string::npos;
+}
+
+std::string fnv1a_hash64_hex(const std::string &s) {
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    std::ostringstream out;
+    out << std::hex << std::setfill('0') << std::setw(16) << h;
+    return out.str();
+}
+
 } // namespace LCompilers
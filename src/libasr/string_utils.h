@@ -54,6 +54,17 @@ char* str_unescape_fortran(Allocator &al, LCompilers::Str &s, char ch);
 bool str_compare(const unsigned char *pos, std::string s);
 void rtrim(std::string& str);
 
+// Returns the FNV-1a 64-bit hash of the given string, as a fixed-width
+// lowercase hex string. Used for content-addressed cache file names.
+std::string fnv1a_hash64_hex(const std::string &s);
+
+// Returns the byte offset of the first invalid UTF-8 sequence in `s`
+// (including overlong encodings, surrogates and code points above
+// U+10FFFF), or std::string::npos when the whole string is valid.
+// ASCII-only spans are checked eight bytes at a time, so clean source
+// costs one word-wise pass.
+size_t find_invalid_utf8(const std::string &s);
+
 } // namespace LCompilers
 
 #endif // LFORTRAN_STRING_UTILS_H
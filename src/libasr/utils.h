@@ -1,6 +1,7 @@
 #ifndef LIBASR_UTILS_H
 #define LIBASR_UTILS_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <filesystem>
@@ -25,6 +26,19 @@ std::string get_unique_ID();
 int visualize_json(std::string &astr_data_json, LCompilers::Platform os);
 std::string generate_visualize_html(std::string &astr_data_json);
 
+// One completed profiling scope, recorded when --time-trace is enabled.
+// Timestamps are microseconds on a common per-process timeline, so the
+// events of one compilation can be rendered as a Chrome trace. See
+// libasr/profiler.h for the RAII recorder and the trace writer.
+struct ProfileEvent {
+    std::string name;
+    uint64_t start_us;
+    uint64_t duration_us;
+    // bytes allocated in the attached arena during the scope, 0 if no
+    // arena was attached
+    uint64_t allocator_bytes;
+};
+
 struct PassOptions {
     std::filesystem::path mod_files_dir;
     std::vector<std::filesystem::path> include_dirs;
@@ -37,16 +51,29 @@ struct PassOptions {
     bool always_run = false; // for unused_functions pass
     bool inline_external_symbol_calls = true; // for inline_function_calls pass
     int64_t unroll_factor = 32; // for loop_unroll pass
+    int64_t tile_size = 64; // for loop_tiling pass
     bool fast = false; // is fast flag enabled.
+    bool fast_math = false; // enable fast-math without the rest of --fast
     bool no_fast_math = false; // disable fast-math optimizations (NaN, Inf, etc.)
+    bool parallel_intrinsics = false; // lower large-array intrinsics to threaded runtime kernels
+    bool check_parallel = false; // instrument OpenMP-lowered shared accesses with the runtime race checker
+    bool coarray = false; // lower coarray statements onto the _lfortran_caf_* runtime shims
+    bool parallel_do_concurrent = false; // lower do concurrent to the threaded runtime without pragmas
     bool verbose = false; // For developer debugging
     bool dump_all_passes = false; // For developer debugging
+    bool dump_pass_stats = false; // report pass trigger counts and skipped passes
     bool dump_fortran = false; // For developer debugging
     bool pass_cumulative = false; // Apply passes cumulatively
     bool disable_main = false;
     bool use_loop_variable_after_loop = false;
+    // number of worker threads passes may use to process independent
+    // program units concurrently (1 = serial)
+    int pass_jobs = 1;
     bool realloc_lhs_arrays = false;
     std::vector<int64_t> skip_optimization_func_instantiation;
+    // derived types (lowercase) the aos_to_soa pass may split into
+    // per-member arrays
+    std::vector<std::string> soa_structs;
     bool module_name_mangling = false;
     bool intrinsic_module_name_mangling = false;
     bool global_symbols_mangling = false;
@@ -70,11 +97,16 @@ struct PassOptions {
     bool gpu_offload_metal = false;
     bool gpu_offload_cuda = false;
     bool time_report = false;
+    bool time_trace = false; // collect structured ProfileEvent records
+    // verify only this compilation's own program units after each pass,
+    // skipping modules loaded from modfiles (debug builds only)
+    bool incremental_verify = false;
     bool skip_removal_of_unused_procedures_in_pass_array_by_data = false;
     bool bounds_checking = true;
     bool strict_bounds_checking = false;
     bool descriptor_index_64 = false; // Use 64-bit indices in array descriptors
     std::vector<std::string> vector_of_time_report;
+    std::vector<ProfileEvent> profile_events;
 };
 
 struct CompilerOptions {
@@ -153,11 +185,28 @@ struct CompilerOptions {
     bool descriptor_index_64 = false; // Use 64-bit indices in array descriptors (implied by -fdefault-integer-8)
     bool wasm_html = false;
     bool time_report = false;
+    std::string time_trace; // write Chrome trace-format profile to this path
+    std::string self_profile; // write sampled collapsed stacks to this path
     int32_t fpe_traps = 0; // Bitmask of LCOMPILERS_FE_* flags
     std::string emcc_embed;
     std::vector<std::string> import_paths;
     Platform platform;
     bool detect_leaks = false;
+    bool arena_allocator = false;
+    // Emit procedure entry/exit profiling callbacks; the runtime prints
+    // a hot-procedure report at program exit
+    bool instrument_functions = false;
+    // Route allocations through a counting allocator that reports
+    // per-source-location counts, bytes and peak residency at exit
+    bool memory_profile = false;
+    // Directory for the on-disk object cache; empty disables caching
+    std::string object_cache_dir = "";
+    // Instrumentation-based PGO: generate emits profiling counters,
+    // use reads a merged .profdata file
+    bool profile_generate = false;
+    std::string profile_use = "";
+    // -c emits bitcode instead of machine code; the link step runs ThinLTO
+    bool lto = false;
 
     CompilerOptions () : platform{get_platform()} {};
 };
@@ -1,5 +1,5 @@
 module omp_lib
-use iso_c_binding, only: c_funptr, c_ptr, c_int, c_long, c_bool
+use iso_c_binding, only: c_funptr, c_ptr, c_int, c_long, c_bool, c_char
 implicit none
 
 interface
@@ -173,6 +173,24 @@ end function omp_get_wtime
 integer function omp_get_num_procs() bind(c, name="omp_get_num_procs")
 end function omp_get_num_procs
 
+! Data-race checker (--check-parallel): the lowering brackets each parallel
+! region with begin/end and reports every shared access from inside it
+subroutine lfortran_race_check_begin() bind(c, name="_lfortran_race_check_begin")
+end subroutine
+
+subroutine lfortran_race_check_end() bind(c, name="_lfortran_race_check_end")
+end subroutine
+
+subroutine lfortran_race_check_access(addr, name, name_len, loc, is_write) &
+        bind(c, name="_lfortran_race_check_access")
+import :: c_ptr, c_char, c_int, c_long
+type(c_ptr), value :: addr
+character(kind=c_char), intent(in) :: name(*)
+integer(c_int), value :: name_len
+integer(c_long), value :: loc
+integer(c_int), value :: is_write
+end subroutine
+
 end interface
 
 end module
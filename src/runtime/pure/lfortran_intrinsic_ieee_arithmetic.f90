@@ -42,7 +42,7 @@ module lfortran_intrinsic_ieee_arithmetic
     ! IEEE status type (for saving/restoring exception state)
     type ieee_status_type
         private
-        integer :: flags(5)
+        integer(8) :: state = 0
     end type
 
     interface ieee_class
@@ -743,16 +743,24 @@ module lfortran_intrinsic_ieee_arithmetic
     ! IEEE_GET_ROUNDING_MODE
     subroutine ieee_get_rounding_mode(round_value)
         type(ieee_round_type), intent(out) :: round_value
-        ! TODO: Implement using C binding to get actual rounding mode
-        ! For now, return default (round to nearest)
-        round_value = ieee_nearest
+        interface
+        integer(4) function c_get_rounding_mode() &
+                bind(c, name="_lfortran_ieee_get_rounding_mode")
+            end function
+        end interface
+        round_value%value = c_get_rounding_mode()
     end subroutine
 
     ! IEEE_SET_ROUNDING_MODE
     subroutine ieee_set_rounding_mode(round_value)
         type(ieee_round_type), intent(in) :: round_value
-        ! TODO: Implement using C binding to set actual rounding mode
-        ! This requires calling fesetround() from C
+        interface
+        subroutine c_set_rounding_mode(mode) &
+                bind(c, name="_lfortran_ieee_set_rounding_mode")
+            integer(4), intent(in), value :: mode
+            end subroutine
+        end interface
+        call c_set_rounding_mode(round_value%value)
     end subroutine
 
     ! ========================================================================
@@ -763,60 +771,101 @@ module lfortran_intrinsic_ieee_arithmetic
     elemental subroutine ieee_get_flag(flag, flag_value)
         type(ieee_flag_type), intent(in) :: flag
         logical, intent(out) :: flag_value
-        ! TODO: Implement using C binding to get actual exception flags
-        ! For now, always return false (no exceptions)
-        flag_value = .false.
+        interface
+        pure integer(4) function c_get_flag(flag) &
+                bind(c, name="_lfortran_ieee_get_flag")
+            integer(4), intent(in), value :: flag
+            end function
+        end interface
+        flag_value = c_get_flag(flag%value) /= 0
     end subroutine
 
     ! IEEE_SET_FLAG
     elemental subroutine ieee_set_flag(flag, flag_value)
         type(ieee_flag_type), intent(in) :: flag
         logical, intent(in) :: flag_value
-        ! TODO: Implement using C binding to set exception flags
-        ! This requires calling feclearexcept() or feraiseexcept() from C
+        interface
+        pure subroutine c_set_flag(flag, flag_value) &
+                bind(c, name="_lfortran_ieee_set_flag")
+            integer(4), intent(in), value :: flag
+            integer(4), intent(in), value :: flag_value
+            end subroutine
+        end interface
+        call c_set_flag(flag%value, merge(1, 0, flag_value))
     end subroutine
 
     ! IEEE_GET_HALTING_MODE
     elemental subroutine ieee_get_halting_mode(flag, halting)
         type(ieee_flag_type), intent(in) :: flag
         logical, intent(out) :: halting
-        ! TODO: Implement halting mode query
-        ! For now, return false (no halting on exceptions)
-        halting = .false.
+        interface
+        pure integer(4) function c_get_halting_mode(flag) &
+                bind(c, name="_lfortran_ieee_get_halting_mode")
+            integer(4), intent(in), value :: flag
+            end function
+        end interface
+        halting = c_get_halting_mode(flag%value) /= 0
     end subroutine
 
     ! IEEE_SET_HALTING_MODE
     elemental subroutine ieee_set_halting_mode(flag, halting)
         type(ieee_flag_type), intent(in) :: flag
         logical, intent(in) :: halting
-        ! TODO: Implement halting mode setting
+        interface
+        pure subroutine c_set_halting_mode(flag, halting) &
+                bind(c, name="_lfortran_ieee_set_halting_mode")
+            integer(4), intent(in), value :: flag
+            integer(4), intent(in), value :: halting
+            end subroutine
+        end interface
+        call c_set_halting_mode(flag%value, merge(1, 0, halting))
     end subroutine
 
     ! IEEE_GET_UNDERFLOW_MODE
     subroutine ieee_get_underflow_mode(gradual)
         logical, intent(out) :: gradual
-        ! TODO: Implement using C binding to query FTZ/DAZ mode
-        gradual = .true.
+        interface
+        integer(4) function c_get_underflow_mode() &
+                bind(c, name="_lfortran_ieee_get_underflow_mode")
+            end function
+        end interface
+        gradual = c_get_underflow_mode() /= 0
     end subroutine
 
     ! IEEE_SET_UNDERFLOW_MODE
     subroutine ieee_set_underflow_mode(gradual)
         logical, intent(in) :: gradual
-        ! TODO: Implement using C binding to set FTZ/DAZ mode
+        interface
+        subroutine c_set_underflow_mode(gradual) &
+                bind(c, name="_lfortran_ieee_set_underflow_mode")
+            integer(4), intent(in), value :: gradual
+            end subroutine
+        end interface
+        call c_set_underflow_mode(merge(1, 0, gradual))
     end subroutine
 
     ! IEEE_GET_STATUS
     subroutine ieee_get_status(status_value)
         type(ieee_status_type), intent(out) :: status_value
-        ! TODO: Implement using C binding to save FPU status
-        ! For now, initialize to default state
-        status_value%flags = 0
+        interface
+        subroutine c_get_status(status) &
+                bind(c, name="_lfortran_ieee_get_status")
+            integer(8), intent(out) :: status
+            end subroutine
+        end interface
+        call c_get_status(status_value%state)
     end subroutine
 
     ! IEEE_SET_STATUS
     subroutine ieee_set_status(status_value)
         type(ieee_status_type), intent(in) :: status_value
-        ! TODO: Implement using C binding to restore FPU status
+        interface
+        subroutine c_set_status(status) &
+                bind(c, name="_lfortran_ieee_set_status")
+            integer(8), intent(in) :: status
+            end subroutine
+        end interface
+        call c_set_status(status_value%state)
     end subroutine
 
     ! IEEE_SUPPORT_FLAG
@@ -520,7 +520,9 @@ namespace LCompilers::LanguageServerProtocol {
         if (*taskIsRunning) {
             LSPAny any = transformer.responseMessageToAny(response);
             logSendResponseTrace(traceId, start, any);
-            const std::string outgoing = serializer.serialize(any);
+            static thread_local std::string outgoing;
+            outgoing.clear();
+            serializer.serialize(outgoing, any);
             logger.debug()
                 << "Input/Output Messages:" << std::endl
                 << "Incoming: " << incoming << std::endl
@@ -1431,6 +1433,40 @@ namespace LCompilers::LanguageServerProtocol {
         }
     }
 
+    auto BaseLspLanguageServer::publishDiagnostics(
+        PublishDiagnosticsParams &params
+    ) -> void {
+        // Fingerprint the diagnostics (but not the document version) so
+        // analysis runs that reproduce the same set do not re-notify the
+        // client. The canonical serialization is hashed rather than the
+        // pretty-printed form so the fingerprint is stable across
+        // configuration changes:
+        std::size_t fingerprint = params.diagnostics.size();
+        for (const Diagnostic &diagnostic : params.diagnostics) {
+            const LSPAny any = transformer.diagnosticToAny(diagnostic);
+            std::size_t hash = std::hash<std::string>{}(serializer.serialize(any));
+            fingerprint ^= hash + 0x9e3779b97f4a7c15ULL
+                + (fingerprint << 6) + (fingerprint >> 2);
+        }
+        {
+            auto readLock = LSP_READ_LOCK(publishedDiagnosticsMutex, "published-diagnostics");
+            auto iter = publishedDiagnosticsByUri.find(params.uri);
+            if ((iter != publishedDiagnosticsByUri.end()) &&
+                    (iter->second == fingerprint)) {
+                logger.trace()  //<- trace instead of debug because this will happen often
+                    << "Diagnostics are unchanged for document with URI="
+                    << params.uri << "; skipping publication."
+                    << std::endl;
+                return;
+            }
+        }
+        {
+            auto writeLock = LSP_WRITE_LOCK(publishedDiagnosticsMutex, "published-diagnostics");
+            publishedDiagnosticsByUri.insert_or_assign(params.uri, fingerprint);
+        }
+        sendTextDocument_publishDiagnostics(params);
+    }
+
     // request: "$/document"
     auto BaseLspLanguageServer::receiveDocument(
         const RequestMessage &/*request*/,
@@ -1484,6 +1520,13 @@ namespace LCompilers::LanguageServerProtocol {
                 }
             }
         }
+        {
+            auto writeLock = LSP_WRITE_LOCK(publishedDiagnosticsMutex, "published-diagnostics");
+            auto iter = publishedDiagnosticsByUri.find(uri);
+            if (iter != publishedDiagnosticsByUri.end()) {
+                publishedDiagnosticsByUri.erase(iter);
+            }
+        }
     }
 
     // notification: "textDocument/didSave"
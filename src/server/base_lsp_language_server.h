@@ -114,6 +114,12 @@ namespace LCompilers::LanguageServerProtocol {
         std::unordered_map<DocumentUri, std::shared_ptr<lsc::LspConfig>> lspConfigsByUri;
         std::shared_mutex lspConfigMutex;
 
+        // Fingerprints of the most recently published diagnostics, used to
+        // avoid re-notifying the client when a re-analysis reproduces the
+        // same set of diagnostics:
+        std::unordered_map<DocumentUri, std::size_t> publishedDiagnosticsByUri;
+        std::shared_mutex publishedDiagnosticsMutex;
+
         std::atomic_bool clientSupportsWorkspaceConfigRequests = false;
         std::atomic_bool clientSupportsWorkspaceConfigChangeNotifications = false;
 
@@ -263,6 +269,10 @@ namespace LCompilers::LanguageServerProtocol {
             const DocumentUri &uri
         ) -> std::shared_ptr<LspTextDocument>;
 
+        auto publishDiagnostics(
+            PublishDiagnosticsParams &params
+        ) -> void;
+
         virtual auto getConfig(
             const DocumentUri &uri,
             const std::string &configSection
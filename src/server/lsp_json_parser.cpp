@@ -1,4 +1,5 @@
 #include <cctype>
+#include <cstdlib>
 
 #include <server/lsp_exception.h>
 #include <server/lsp_json_parser.h>
@@ -79,14 +80,14 @@ namespace LCompilers::LanguageServerProtocol {
             unsigned char c = nextChar();
             switch (c) {
             case '"': {
-                const string_t key = parseString();
+                string_t key = parseString();
                 dropWhitespace();
                 if (hasNext()) {
                     unsigned char c = nextChar();
                     if (c == ':') {
                         dropWhitespace();
                         std::unique_ptr<LSPAny> value = parseValue();
-                        object.emplace(key, std::move(value));
+                        object.emplace(std::move(key), std::move(value));
                         hasAttribute = true;
                     } else {
                         buffer.clear();
@@ -238,7 +239,25 @@ namespace LCompilers::LanguageServerProtocol {
     }
 
     auto LspJsonParser::parseString() -> string_t {
+        // Fast path: most strings contain no escape sequences (in particular
+        // the document text carried by textDocument/didChange), so scan for
+        // the closing quote first and copy the bytes in between just once,
+        // without pushing them through the intermediate buffer:
+        std::size_t start = index;
+        while (hasNext()) {
+            unsigned char c = peekChar();
+            if (c == '"') {
+                string_t string = message.substr(start, index - start);
+                advance();
+                return string;
+            }
+            if (c == '\\') {
+                break;
+            }
+            advance();
+        }
         buffer.clear();
+        buffer.append(message, start, index - start);
         bool escaped = false;
         while (hasNext()) {
             unsigned char c = nextChar();
@@ -403,9 +422,11 @@ namespace LCompilers::LanguageServerProtocol {
     }
 
     auto LspJsonParser::parseNumber() -> std::unique_ptr<LSPAny> {
+        // Numbers are scanned in place and converted once from the message
+        // bytes; `start` marks the first character of the literal.
         bool isNegated = false;
         bool hasDigit = false;
-        buffer.clear();
+        std::size_t start = index;
         while (hasNext()) {
             unsigned char c = peekChar();
             switch (c) {
@@ -417,29 +438,10 @@ namespace LCompilers::LanguageServerProtocol {
                     );
                 }
                 isNegated = true;
-                buffer.push_back(c);
                 advance();
                 break;
             }
-            case '0': {
-                hasDigit = true;
-                buffer.push_back(c);
-                advance();
-                switch (peekChar()) {
-                case '.': {
-                    buffer.push_back(c);
-                    advance();
-                    return parseFraction();
-                }
-                case 'e': // fallthrough
-                case 'E': {
-                    buffer.push_back(c);
-                    advance();
-                    return parseExponent();
-                }
-                }
-                break;
-            }
+            case '0': // fallthrough
             case '1': // fallthrough
             case '2': // fallthrough
             case '3': // fallthrough
@@ -450,14 +452,26 @@ namespace LCompilers::LanguageServerProtocol {
             case '8': // fallthrough
             case '9': {
                 hasDigit = true;
-                buffer.push_back(c);
                 advance();
+                switch (peekChar()) {
+                case '.': {
+                    advance();
+                    return parseFraction(start);
+                }
+                case 'e': // fallthrough
+                case 'E': {
+                    advance();
+                    return parseExponent(start);
+                }
+                }
                 break;
             }
             default: {
                 if (hasDigit) {
                     std::unique_ptr<LSPAny> number = std::make_unique<LSPAny>();
-                    (*number) = std::stoi(buffer);
+                    (*number) = static_cast<integer_t>(
+                        std::strtoll(message.c_str() + start, nullptr, 10)
+                    );
                     return number;
                 }
                 throw LSP_EXCEPTION(
@@ -473,7 +487,7 @@ namespace LCompilers::LanguageServerProtocol {
         );
     }
 
-    auto LspJsonParser::parseFraction() -> std::unique_ptr<LSPAny> {
+    auto LspJsonParser::parseFraction(std::size_t start) -> std::unique_ptr<LSPAny> {
         bool hasDigit = false;
         while (hasNext()) {
             unsigned char c = peekChar();
@@ -489,20 +503,18 @@ namespace LCompilers::LanguageServerProtocol {
             case '8': // fallthrough
             case '9': {
                 hasDigit = true;
-                buffer.push_back(c);
                 advance();
                 break;
             }
             case 'e': // fallthrough
             case 'E': {
-                buffer.push_back(c);
                 advance();
-                return parseExponent();
+                return parseExponent(start);
             }
             default: {
                 if (hasDigit) {
                     std::unique_ptr<LSPAny> number = std::make_unique<LSPAny>();
-                    (*number) = std::stod(buffer);
+                    (*number) = std::strtod(message.c_str() + start, nullptr);
                     return number;
                 }
                 throw LSP_EXCEPTION(
@@ -518,7 +530,7 @@ namespace LCompilers::LanguageServerProtocol {
         );
     }
 
-    auto LspJsonParser::parseExponent() -> std::unique_ptr<LSPAny> {
+    auto LspJsonParser::parseExponent(std::size_t start) -> std::unique_ptr<LSPAny> {
         bool hasDigit = false;
         bool hasSign = false;
         while (hasNext()) {
@@ -533,7 +545,6 @@ namespace LCompilers::LanguageServerProtocol {
                     );
                 }
                 hasSign = true;
-                buffer.push_back(c);
                 advance();
                 break;
             }
@@ -548,14 +559,13 @@ namespace LCompilers::LanguageServerProtocol {
             case '8': // fallthrough
             case '9': {
                 hasDigit = true;
-                buffer.push_back(c);
                 advance();
                 break;
             }
             default: {
                 if (hasDigit) {
                     std::unique_ptr<LSPAny> number = std::make_unique<LSPAny>();
-                    (*number) = std::stod(buffer);
+                    (*number) = std::strtod(message.c_str() + start, nullptr);
                     return number;
                 }
                 throw LSP_EXCEPTION(
@@ -10,10 +10,11 @@ namespace LCompilers::LanguageServerProtocol {
 
     class LspJsonParser {
     public:
+        // NOTE: The parser reads the message in place and must not outlive it.
         LspJsonParser(const std::string &message);
         auto parse() -> std::unique_ptr<LSPAny>;
     private:
-        const std::string message;
+        const std::string &message;
         std::size_t index = 0;
         std::string buffer;
 
@@ -23,8 +24,8 @@ namespace LCompilers::LanguageServerProtocol {
         auto parseValue() -> std::unique_ptr<LSPAny>;
         auto parseString() -> string_t;
         auto parseNumber() -> std::unique_ptr<LSPAny>;
-        auto parseFraction() -> std::unique_ptr<LSPAny>;
-        auto parseExponent() -> std::unique_ptr<LSPAny>;
+        auto parseFraction(std::size_t start) -> std::unique_ptr<LSPAny>;
+        auto parseExponent(std::size_t start) -> std::unique_ptr<LSPAny>;
         auto parseTrue() -> std::unique_ptr<LSPAny>;
         auto parseFalse() -> std::unique_ptr<LSPAny>;
         auto parseNull() -> std::unique_ptr<LSPAny>;
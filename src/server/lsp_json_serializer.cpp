@@ -39,6 +39,27 @@ namespace LCompilers::LanguageServerProtocol {
         return buffer;
     }
 
+    auto LspJsonSerializer::serialize(
+        std::string &buffer,
+        const LSPAny &any
+    ) const -> void {
+        serializeValue(buffer, any);
+    }
+
+    auto LspJsonSerializer::serialize(
+        std::string &buffer,
+        const LSPObject &object
+    ) const -> void {
+        serializeObject(buffer, object);
+    }
+
+    auto LspJsonSerializer::serialize(
+        std::string &buffer,
+        const LSPArray &array
+    ) const -> void {
+        serializeArray(buffer, array);
+    }
+
     auto LspJsonSerializer::pprint(
         const LSPAny &any
     ) const -> std::string {
@@ -17,6 +17,12 @@ namespace LCompilers::LanguageServerProtocol {
         auto serialize(const LSPObject &object) const -> std::string;
         auto serialize(const LSPArray &array) const -> std::string;
 
+        // Append into a caller-provided buffer; with a reused buffer this
+        // avoids one allocation per message on the hot response path:
+        auto serialize(std::string &buffer, const LSPAny &any) const -> void;
+        auto serialize(std::string &buffer, const LSPObject &object) const -> void;
+        auto serialize(std::string &buffer, const LSPArray &array) const -> void;
+
         auto pprint(const LSPAny &any) const -> std::string;
         auto pprint(const LSPObject &object) const -> std::string;
         auto pprint(const LSPArray &array) const -> std::string;
@@ -168,12 +168,46 @@ namespace LCompilers::LanguageServerProtocol {
         logger.debug() << "Worker thread-pool terminated." << std::endl;
     }
 
+    // Matches the method attribute of a $/cancelRequest notification without
+    // parsing the whole message. Cancellations are tiny, so the length guard
+    // keeps document-bearing messages (whose text could coincidentally contain
+    // the pattern) from ever being promoted.
+    static auto isCancelNotification(const std::string &message) -> bool {
+        if (message.length() > 512) {
+            return false;
+        }
+        std::size_t pos = message.find("\"method\"");
+        while (pos != std::string::npos) {
+            std::size_t i = pos + 8;
+            while ((i < message.length())
+                   && std::isspace(static_cast<unsigned char>(message[i]))) {
+                ++i;
+            }
+            if ((i < message.length()) && (message[i] == ':')) {
+                ++i;
+                while ((i < message.length())
+                       && std::isspace(static_cast<unsigned char>(message[i]))) {
+                    ++i;
+                }
+                return message.compare(i, 17, "\"$/cancelRequest\"") == 0;
+            }
+            pos = message.find("\"method\"", pos + 1);
+        }
+        return false;
+    }
+
     auto ParallelLspLanguageServer::listen() -> void {
         try {
             while (!_exit) {
                 const std::string message = incomingMessages.dequeue();
                 if (!_exit) {
                     std::size_t sendId = nextSendId();
+                    // $/cancelRequest exists to interrupt work that is already
+                    // queued or running; were it to wait its turn behind that
+                    // work it could never take effect. Schedule it ahead of the
+                    // pending tasks: it only flips a cancellation token, so
+                    // promoting it cannot disturb document synchronization.
+                    bool urgent = isCancelNotification(message);
                     std::shared_ptr<std::atomic_bool> taskIsRunning =
                         requestPool.execute([this, message, sendId](
                             std::shared_ptr<std::atomic_bool> taskIsRunning
@@ -206,7 +240,7 @@ namespace LCompilers::LanguageServerProtocol {
                             }
                             ++pendingSendId;
                             sent.notify_all();
-                        });
+                        }, urgent);
                 }
             }
         } catch (std::exception &e) {
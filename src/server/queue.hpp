@@ -23,7 +23,7 @@ namespace LCompilers::LLanguageServer::Threading {
         auto name() const -> const std::string &;
         auto isRunning() const -> bool;
         auto isStopped() const -> bool;
-        auto enqueue(T value) -> T *;
+        auto enqueue(T value, bool front = false) -> T *;
         auto dequeue() -> T;
         auto stop() -> void;
         auto stopNow() -> void;
@@ -75,17 +75,26 @@ namespace LCompilers::LLanguageServer::Threading {
         return !isRunning();
     }
 
+    // Values enqueued with `front = true` are returned by dequeue() before any
+    // pending values, most-recent first; relative order of the remaining
+    // values is preserved.
     template <typename T, std::size_t N>
-    auto Queue<T,N>::enqueue(T value) -> T * {
+    auto Queue<T,N>::enqueue(T value, bool front) -> T * {
         if (receiving) {
             std::unique_lock<std::mutex> lock(mutex);
             dequeued.wait(lock, [this]{
                 return (_size < N) || !receiving;
             });
             if ((_size < N) && receiving) {
-                T *elem = &buffer[tail];
+                T *elem;
+                if (front) {
+                    head = (head + N - 1) % N;
+                    elem = &buffer[head];
+                } else {
+                    elem = &buffer[tail];
+                    tail = (tail + 1) % N;
+                }
                 (*elem) = value;
-                tail = (tail + 1) % N;
                 ++_size;
                 ++m_seen;
                 lock.unlock();
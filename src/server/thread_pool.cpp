@@ -82,10 +82,14 @@ namespace LCompilers::LLanguageServer::Threading {
         return size;
     }
 
-    auto ThreadPool::execute(Task task) -> std::shared_ptr<std::atomic_bool> {
+    // Urgent tasks are scheduled ahead of any pending tasks; they are meant
+    // for work that must not wait behind a backlog, such as request
+    // cancellation.
+    auto ThreadPool::execute(Task task, bool urgent) -> std::shared_ptr<std::atomic_bool> {
         if (!stopRunning) {
             QueueElem *elem = tasks.enqueue(
-                std::make_pair(task, std::make_shared<std::atomic_bool>(true))
+                std::make_pair(task, std::make_shared<std::atomic_bool>(true)),
+                urgent
             );
             if (elem) {
                 return elem->second;
@@ -46,7 +46,10 @@ namespace LCompilers::LLanguageServer::Threading {
 
         auto ensureCapacity() -> void;
         auto grow(std::size_t size) -> std::size_t;
-        auto execute(Task task) -> std::shared_ptr<std::atomic_bool>;
+        auto execute(
+            Task task,
+            bool urgent = false
+        ) -> std::shared_ptr<std::atomic_bool>;
         auto stop() -> void;
         auto stopNow() -> void;
         auto join() -> void;
@@ -0,0 +1,12 @@
+program continue_compilation_parser_1
+    implicit none
+    integer :: i, j
+    do i = 1, 3
+        j = i +
+        j = * 2
+    end do
+    if (j > 0) then
+        j = )
+    end if
+    print *, j
+end program
@@ -0,0 +1,4 @@
+program invalid_utf8_1
+! caf� au lait �
+print *, "ok"
+end program
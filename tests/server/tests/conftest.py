@@ -49,6 +49,11 @@ def client(request: pytest.FixtureRequest, capfd: pytest.CaptureFixture) -> Iter
         "LFortran": {
             "openIssueReporterOnError": False,
             "maxNumberOfProblems": 100,
+            # NOTE: A debounce of 0 publishes diagnostics immediately, which
+            # keeps the tests deterministic:
+            "validationDebounceMs": 0,
+            # NOTE: A ceiling of 0 disables memory-pressure cache eviction:
+            "maxMemoryUtilizationMb": 0,
             "trace": {
                 "server": "verbose",
             },
@@ -130,6 +135,8 @@ def client(request: pytest.FixtureRequest, capfd: pytest.CaptureFixture) -> Iter
         "--config-section", "LFortran",
         "--open-issue-reporter-on-error", str(config["LFortran"]["openIssueReporterOnError"]).lower(),
         "--max-number-of-problems", str(config["LFortran"]["maxNumberOfProblems"]),
+        "--validation-debounce-ms", str(config["LFortran"]["validationDebounceMs"]),
+        "--max-memory-utilization-mb", str(config["LFortran"]["maxMemoryUtilizationMb"]),
         "--trace-server", config["LFortran"]["trace"]["server"],
         "--compiler-path", str(compiler_path),
         "--log-pretty-print", str(config["LFortran"]["log"]["prettyPrint"]).lower(),